@@ -11,6 +11,8 @@ IMCC_O_FILES = \
     compilers/imcc/sets$(O) \
     compilers/imcc/debug$(O) \
     compilers/imcc/optimizer$(O) \
+    compilers/imcc/ssa$(O) \
+    compilers/imcc/inline$(O) \
     compilers/imcc/pbc$(O) \
     compilers/imcc/parser_util$(O) \
     compilers/imcc/pcc$(O) \
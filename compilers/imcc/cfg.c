@@ -281,7 +281,7 @@ find_basic_blocks(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), int first)
 
     ins = unit->instructions;
 
-    if (unit->type & IMC_PCCSUB) {
+    if ((unit->type & IMC_PCCSUB) && first) {
         IMCC_debug(imcc, DEBUG_CFG, "pcc_sub %s nparams %d\n",
                 ins->symregs[0]->name, ins->symregs[0]->pcc_sub->nargs);
         expand_pcc_sub(imcc, unit, ins);
@@ -1264,6 +1264,162 @@ search_predecessors_not_in(ARGIN(const Basic_block *node), ARGMOD(Set *s))
 
 /*** Utility functions ***/
 
+/*
+
+=item C<const char * hidden_control_flow(imc_info_t *imcc, const IMC_Unit
+*unit)>
+
+Returns why the CFG of C<unit> doesn't show all the ways control can flow
+through it, or C<NULL> if it does. Exception handlers, C<set_addr> and
+C<set_label> resume the unit at a label from wherever the handler gets
+invoked, C<local_branch> returns to an address from a stack, and a branch to
+a register can go anywhere; analyses that follow the edges of the CFG can't
+be trusted for such units.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+const char *
+hidden_control_flow(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit *unit))
+{
+    ASSERT_ARGS(hidden_control_flow)
+    const Instruction *ins;
+
+    if (imcc->dont_optimize)
+        return "untraceable invoke or jump";
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        if (!ins->opname)
+            continue;
+
+        if (STREQ(ins->opname, "push_eh")
+        ||  STREQ(ins->opname, "set_addr")
+        ||  STREQ(ins->opname, "set_label")
+        ||  STREQ(ins->opname, "local_branch")
+        ||  STREQ(ins->opname, "local_return"))
+            return ins->opname;
+
+        if (ins->type & ITBRANCH) {
+            const SymReg * const addr = get_branch_reg(ins);
+
+            if (addr) {
+                const SymReg * const label = find_sym(imcc, addr->name);
+
+                if (!label || !(label->type & VTADDRESS) || !label->first_ins)
+                    return "branch to a register";
+            }
+        }
+    }
+
+    return NULL;
+}
+
+
+/*
+
+=item C<void compute_liveness(imc_info_t *imcc, const IMC_Unit *unit, unsigned
+int n_regs, Set **live_in, Set **live_out)>
+
+Computes which registers are live on entry to and exit from each basic block
+of C<unit> into C<live_in> and C<live_out>, which are indexed by block and
+get a new set of size C<n_regs> per block. The caller numbers the registers
+it is interested in through their color, from 0 to C<n_regs> - 1; registers
+with a negative color are ignored.
+
+=cut
+
+*/
+
+void
+compute_liveness(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit *unit),
+        unsigned int n_regs, ARGOUT(Set **live_in), ARGOUT(Set **live_out))
+{
+    ASSERT_ARGS(compute_liveness)
+    const unsigned int n_blocks = unit->n_basic_blocks;
+    const unsigned int n_bytes  = (n_regs + 7) / 8;
+    Set        **use = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    Set        **def = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    Reg_refs     refs;
+    unsigned int b, i;
+    int          changed;
+
+    refs.regs   = NULL;
+    refs.writes = NULL;
+    refs.n      = 0;
+    refs.size   = 0;
+
+    /* the registers each block reads before writing them, and writes */
+    for (b = 0; b < n_blocks; b++) {
+        const Basic_block * const bb = unit->bb_list[b];
+        const Instruction *ins;
+
+        use[b]      = set_make(imcc, n_regs);
+        def[b]      = set_make(imcc, n_regs);
+        live_in[b]  = set_make(imcc, n_regs);
+        live_out[b] = set_make(imcc, n_regs);
+
+        for (ins = bb->start; ins; ins = ins->next) {
+            unsigned int j;
+
+            ins_reg_refs(imcc, ins, &refs);
+
+            for (j = 0; j < refs.n; j++) {
+                const int k = refs.regs[j]->color;
+
+                if (k >= 0 && !refs.writes[j] && !set_contains(def[b], k))
+                    set_add(use[b], k);
+            }
+
+            for (j = 0; j < refs.n; j++)
+                if (refs.writes[j] && refs.regs[j]->color >= 0)
+                    set_add(def[b], refs.regs[j]->color);
+
+            if (ins == bb->end)
+                break;
+        }
+    }
+
+    /* live_in = use + (live_out - def), live_out = live_in of successors */
+    do {
+        changed = 0;
+
+        for (b = n_blocks; b-- > 0;) {
+            const Basic_block * const bb = unit->bb_list[b];
+            const Edge *e;
+            unsigned char * const out = live_out[b]->bmp;
+            unsigned char * const in  = live_in[b]->bmp;
+
+            for (e = bb->succ_list; e; e = e->succ_next) {
+                const unsigned char * const succ_in = live_in[e->to->index]->bmp;
+                for (i = 0; i < n_bytes; i++)
+                    out[i] |= succ_in[i];
+            }
+
+            for (i = 0; i < n_bytes; i++) {
+                const unsigned char new_in = (unsigned char)(use[b]->bmp[i]
+                                           | (out[i] & ~def[b]->bmp[i]));
+                if (new_in != in[i]) {
+                    in[i]   = new_in;
+                    changed = 1;
+                }
+            }
+        }
+    } while (changed);
+
+    for (b = 0; b < n_blocks; b++) {
+        set_free(use[b]);
+        set_free(def[b]);
+    }
+
+    mem_sys_free(use);
+    mem_sys_free(def);
+    free_reg_refs(&refs);
+}
+
+
 /*
 
 =item C<static void init_basic_blocks(imc_info_t *imcc, IMC_Unit *unit)>
@@ -1279,7 +1435,7 @@ init_basic_blocks(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
 {
     ASSERT_ARGS(init_basic_blocks)
 
-    if (!unit->bb_list)
+    if (unit->bb_list)
         clear_basic_blocks(unit);
 
     unit->n_basic_blocks = 0;
@@ -72,6 +72,20 @@ void compute_dominators(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+void compute_liveness(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit),
+    unsigned int n_regs,
+    ARGOUT(Set **live_in),
+    ARGOUT(Set **live_out))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*live_in)
+        FUNC_MODIFIES(*live_out);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 int edge_count(ARGIN(const IMC_Unit *unit))
@@ -92,6 +106,15 @@ void find_loops(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+const char * hidden_control_flow(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 int natural_preheader(
@@ -118,6 +141,11 @@ void search_predecessors_not_in(
 #define ASSERT_ARGS_compute_dominators __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_compute_liveness __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(live_in) \
+    , PARROT_ASSERT_ARG(live_out))
 #define ASSERT_ARGS_edge_count __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_find_basic_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -126,6 +154,9 @@ void search_predecessors_not_in(
 #define ASSERT_ARGS_find_loops __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_hidden_control_flow __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_natural_preheader __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit) \
     , PARROT_ASSERT_ARG(loop_info))
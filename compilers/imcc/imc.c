@@ -230,8 +230,12 @@ imc_close_unit(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
 {
     ASSERT_ARGS(imc_close_unit)
 #if COMPILE_IMMEDIATE
-    if (unit)
+    if (unit) {
+        if (imcc->optimizer_level & OPT_INLINE)
+            inline_snapshot(imcc, unit);
+
         imc_compile_unit(imcc, unit);
+    }
 #endif
 
     imcc->cur_unit = NULL;
@@ -264,6 +268,7 @@ imc_free_unit(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
     imcc->n_comp_units--;
 
     clear_locals(unit);
+    inline_free(unit);
 
     if (unit->_namespace && unit->owns_namespace)
         free_sym(unit->_namespace);
@@ -366,6 +366,8 @@ typedef enum _enum_opt {
     OPT_PRE, /*0x001 */
     OPT_CFG  = 0x002,
     OPT_SUB  = 0x004,
+    OPT_SSA  = 0x008,
+    OPT_INLINE = 0x010,
     OPT_PASM = 0x100
  /* OPT_J    = 0x200 */
 } enum_opt_t;
@@ -397,6 +399,7 @@ typedef struct subs_t {
     IMC_Unit      *unit;
     struct subs_t *prev;
     struct subs_t *next;
+    struct subs_t *same_name;          /* next sub of the same name */
     SymHash        fixup;              /* currently set_p_pc sub names only */
     int            ins_line;           /* line number for debug */
     int            n_basic_blocks;     /* block count */
@@ -414,6 +417,8 @@ typedef struct code_segment_t {
     struct code_segment_t *prev;          /* previous code segment */
     struct code_segment_t *next;          /* next code segment */
     SymHash                key_consts;    /* this seg's cached key constants */
+    size_t                 size;          /* code size in ops of all subs */
+    int                    ins_line;      /* sum of the ins_line of all subs */
 } code_segment_t;
 
 /* globals store the state between individual e_pbc_emit calls */
@@ -0,0 +1,891 @@
+/*
+ * Copyright (C) 2016, Parrot Foundation.
+ */
+
+/*
+
+=head1 NAME
+
+compilers/imcc/inline.c
+
+=head1 DESCRIPTION
+
+Inlining of small leaf subs with C<-O3>. When a sub is closed, before it is
+compiled, C<inline_snapshot> keeps a copy of its body if it can be inlined;
+when a later sub of the same compilation is compiled, C<inline_calls>
+replaces its calls of that sub by name with the copy, before PCC is
+expanded. A sub can be inlined if it
+
+=over 4
+
+=item * has at most C<INLINE_MAX_OPS> ops, and calls nothing
+
+=item * is not a multi, vtable override, method, C<:main>, C<:load>,
+C<:init>, C<:immediate> or C<:postcomp> sub, and has no C<:outer> and no
+lexicals
+
+=item * takes and returns positional values only
+
+=item * uses no op that looks at the context, sub, namespace or lexicals it
+runs in, and no exception handlers
+
+=back
+
+The call has to name the sub the way C<fixup_globals> binds it at compile
+time: it is the first sub of that name in the namespace of the caller, and
+of the same HLL. It must pass as many arguments as the sub takes, of the
+same register types, and take no results or as many as every return of the
+sub returns, again of the same types. The registers of the sub become
+temporaries of the caller and its labels new labels; PMC and string
+registers the sub may read before it writes them are nulled first, as they
+are in a new frame. Subs defined after their callers are not inlined, as they aren't
+parsed yet when the caller is compiled.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "imc.h"
+#include "optimizer.h"
+
+/* the biggest sub inlined, in ops */
+#define INLINE_MAX_OPS 16
+
+/* the most ops inlined into one sub */
+#define INLINE_MAX_GROWTH 256
+
+/* flags of parameters, arguments and results that aren't plain positional */
+#define INLINE_ARG_FLAGS \
+    (VT_FLAT | VT_OPTIONAL | VT_OPT_FLAG | VT_NAMED | VT_CALL_SIG)
+
+/* sub pragmas that keep a sub from being inlined */
+#define INLINE_PRAGMAS (P_NEED_LEX | P_VTABLE | P_METHOD | P_MAIN | P_LOAD \
+                        | P_IMMEDIATE | P_POSTCOMP | P_INIT)
+
+/* Ops that look at the context, sub, namespace or lexicals they run in, or
+ * pass control in ways a copy of the sub can't follow. */
+static const char * const context_ops[] = {
+    "addhandler", "annotations", "callmethod", "callmethodcc", "capture_lex",
+    "count_eh", "end", "find_caller_lex", "find_dynamic_lex", "find_lex",
+    "find_name", "find_sub_not_null", "get_global", "get_namespace",
+    "get_params", "get_results", "getinterp", "interpinfo", "invoke",
+    "invokecc", "jump", "local_branch", "local_return", "new_callback",
+    "newclosure", "peek_exception", "pop_eh", "pop_upto_eh", "push_eh",
+    "result_info", "returncc", "set_addr", "set_args", "set_global",
+    "set_result_info", "set_returns", "store_dynamic_lex", "store_lex",
+    "tailcall", "tailcallmethod", "yield"
+};
+
+/* An op, label or return of the copy of a sub kept for inlining. */
+typedef struct Inline_ins {
+    char         *opname;       /* ops only */
+    unsigned int  type;         /* ITLABEL for labels, ITPCCRET for returns */
+    int           keys;
+    int           line;
+    int           n;
+    SymReg      **regs;         /* the operands, or the values returned */
+} Inline_ins;
+
+/* The copy of a sub kept for inlining. */
+struct Inline_body {
+    SymReg      **params;
+    int           n_params;
+    SymReg      **init;         /* P and S registers maybe read unwritten */
+    int           n_init;
+    Inline_ins   *ins;
+    int           n_ins;
+    int           size;         /* the ops it takes in the caller */
+};
+
+/* The symbols of an inlined sub and what they became in the caller. */
+typedef struct inline_map_t {
+    SymReg       **from;
+    SymReg       **to;
+    unsigned int   n;
+} inline_map_t;
+
+/* HEADERIZER HFILE: compilers/imcc/optimizer.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CANNOT_RETURN_NULL
+static Instruction * add_ins(
+    ARGMOD(IMC_Unit *unit),
+    ARGMOD(Instruction *pos),
+    ARGMOD_NULLOK(Instruction *ins),
+    int line)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*unit)
+        FUNC_MODIFIES(*pos)
+        FUNC_MODIFIES(*ins);
+
+PARROT_WARN_UNUSED_RESULT
+static int call_fits(
+    ARGIN(const pcc_sub_t *call),
+    ARGIN(const Inline_body *body))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+static SymReg ** copy_regs(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN_NULLOK(SymReg * const *regs),
+    int n)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static IMC_Unit * find_callee(
+    ARGIN(const imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const pcc_sub_t *call))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_CAN_RETURN_NULL
+static Instruction * inline_call(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGMOD(Instruction *call_ins),
+    ARGIN(const Inline_body *body))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit)
+        FUNC_MODIFIES(*call_ins);
+
+PARROT_WARN_UNUSED_RESULT
+static int inline_op_ok(
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int inline_reg_ok(
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const SymReg *r))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+static SymReg * map_sym(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(inline_map_t *map),
+    ARGIN(SymReg *r))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*map);
+
+PARROT_WARN_UNUSED_RESULT
+static int reg_listed(
+    ARGIN(SymReg * const *list),
+    unsigned int n,
+    ARGIN(const SymReg *r))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_add_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(pos))
+#define ASSERT_ARGS_call_fits __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(call) \
+    , PARROT_ASSERT_ARG(body))
+#define ASSERT_ARGS_copy_regs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc))
+#define ASSERT_ARGS_find_callee __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(call))
+#define ASSERT_ARGS_inline_call __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(call_ins) \
+    , PARROT_ASSERT_ARG(body))
+#define ASSERT_ARGS_inline_op_ok __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_inline_reg_ok __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(r))
+#define ASSERT_ARGS_map_sym __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(map) \
+    , PARROT_ASSERT_ARG(r))
+#define ASSERT_ARGS_reg_listed __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(list) \
+    , PARROT_ASSERT_ARG(r))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static int inline_reg_ok(const IMC_Unit *unit, const SymReg *r)>
+
+Returns whether the operand C<r> of the sub C<unit> can be copied into
+another sub: a register that isn't lexical or a PASM register, a label of
+C<unit> or a constant that isn't a key or looked up by subid.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+inline_reg_ok(ARGIN(const IMC_Unit *unit), ARGIN(const SymReg *r))
+{
+    ASSERT_ARGS(inline_reg_ok)
+
+    if ((r->type & VT_PCC_SUB) || r->nextkey
+    ||  (r->usage & (U_LEXICAL | U_SUBID_LOOKUP | U_LEXINFO_LOOKUP)))
+        return 0;
+
+    if (REG_NEEDS_ALLOC(r))
+        return !(r->type & (VTPASM | VTREGKEY));
+
+    if (r->type & VTADDRESS)
+        return _get_sym(&unit->hash, r->name) == r;
+
+    return 1;
+}
+
+/*
+
+=item C<static int inline_op_ok(const IMC_Unit *unit, const Instruction *ins)>
+
+Returns whether the op C<ins> of the sub C<unit> does the same when it is
+copied into another sub.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+inline_op_ok(ARGIN(const IMC_Unit *unit), ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(inline_op_ok)
+    unsigned int i;
+    int          j;
+
+    if (!ins->op)
+        return 0;
+
+    for (i = 0; i < N_ELEMENTS(context_ops); i++)
+        if (STREQ(ins->op->name, context_ops[i]))
+            return 0;
+
+    for (j = 0; j < ins->symreg_count; j++)
+        if (!inline_reg_ok(unit, ins->symregs[j]))
+            return 0;
+
+    return 1;
+}
+
+/*
+
+=item C<static int reg_listed(SymReg * const *list, unsigned int n, const SymReg
+*r)>
+
+Returns whether C<r> is among the first C<n> entries of C<list>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+reg_listed(ARGIN(SymReg * const *list), unsigned int n, ARGIN(const SymReg *r))
+{
+    ASSERT_ARGS(reg_listed)
+    unsigned int i;
+
+    for (i = 0; i < n; i++)
+        if (list[i] == r)
+            return 1;
+
+    return 0;
+}
+
+/*
+
+=item C<static SymReg ** copy_regs(imc_info_t *imcc, SymReg * const *regs, int
+n)>
+
+Returns a copy of the C<n> registers C<regs>.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+static SymReg **
+copy_regs(ARGMOD(imc_info_t *imcc), ARGIN_NULLOK(SymReg * const *regs), int n)
+{
+    ASSERT_ARGS(copy_regs)
+    SymReg ** const copy = mem_gc_allocate_n_typed(imcc->interp, n + 1, SymReg *);
+    int i;
+
+    for (i = 0; i < n; i++)
+        copy[i] = regs[i];
+
+    return copy;
+}
+
+/*
+
+=item C<void inline_snapshot(imc_info_t *imcc, IMC_Unit *unit)>
+
+Keeps a copy of the body of C<unit> in C<< unit->inline_body >>, if it can be
+inlined, before C<unit> is compiled. Besides the ops, labels and returns of
+the body, it holds the parameters and the PMC and string registers that may
+be read before they are written. If the end of the body can be reached, it returns
+nothing there.
+
+=cut
+
+*/
+
+void
+inline_snapshot(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(inline_snapshot)
+    const Instruction *head = unit->instructions;
+    const Instruction *ins;
+    const pcc_sub_t   *sub;
+    Inline_body       *body;
+    SymReg           **defined;
+    unsigned int       n_defined, size;
+    int                n_ops, n_ins, prefix, i;
+
+    if (!(unit->type & IMC_PCCSUB) || unit->pasm_file || unit->outer
+    ||  unit->is_vtable_method || unit->is_method
+    ||  !head || !(head->type & ITPCCPARAM) || !head->symreg_count
+    ||  !head->symregs[0]->pcc_sub)
+        return;
+
+    sub = head->symregs[0]->pcc_sub;
+
+    if (sub->nmulti || sub->yield || (sub->pragma & INLINE_PRAGMAS))
+        return;
+
+    for (i = 0; i < sub->nargs; i++)
+        if ((sub->arg_flags[i] & INLINE_ARG_FLAGS)
+        ||  !REG_NEEDS_ALLOC(sub->args[i])
+        ||  !inline_reg_ok(unit, sub->args[i]))
+            return;
+
+    /* check the body, and count its instructions, ops and operands */
+    n_ops = 0;
+    n_ins = 0;
+    size  = sub->nargs;
+
+    for (ins = head->next; ins; ins = ins->next) {
+        if (ins->type & ITPCCSUB) {
+            const pcc_sub_t * const ret = ins->symregs[0]->pcc_sub;
+
+            if (ins->type & (ITCALL | ITRESULT | ITPCCYIELD))
+                return;
+
+            for (i = 0; i < ret->nret; i++)
+                if ((ret->ret_flags[i] & INLINE_ARG_FLAGS)
+                ||  !inline_reg_ok(unit, ret->ret[i]))
+                    return;
+
+            n_ops += ret->nret + 1;
+            size  += ret->nret;
+        }
+        else if (ins->type & (ITPCCPARAM | ITCALL | ITRESULT))
+            return;
+        else if (ins->type & ITLABEL) {
+            if (!inline_reg_ok(unit, ins->symregs[0]))
+                return;
+        }
+        else {
+            if (!inline_op_ok(unit, ins))
+                return;
+
+            n_ops++;
+            size += ins->symreg_count;
+        }
+
+        if (n_ops > INLINE_MAX_OPS)
+            return;
+
+        n_ins++;
+    }
+
+    body           = mem_gc_allocate_zeroed_typed(imcc->interp, Inline_body);
+    body->params   = copy_regs(imcc, sub->args, sub->nargs);
+    body->n_params = sub->nargs;
+    body->init     = mem_gc_allocate_n_typed(imcc->interp, size + 1, SymReg *);
+    body->ins      = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_ins + 1,
+                            Inline_ins);
+
+    /* copy it; registers are defined for sure if they are parameters or
+     * written before the first label or branch */
+    defined   = mem_gc_allocate_n_typed(imcc->interp, size + 1, SymReg *);
+    n_defined = 0;
+    prefix    = 1;
+
+    for (i = 0; i < sub->nargs; i++)
+        defined[n_defined++] = sub->args[i];
+
+    for (ins = head->next; ins; ins = ins->next) {
+        Inline_ins * const copy = &body->ins[body->n_ins++];
+
+        copy->line = ins->line;
+
+        if (ins->type & ITPCCSUB) {
+            const pcc_sub_t * const ret = ins->symregs[0]->pcc_sub;
+
+            for (i = 0; i < ret->nret; i++) {
+                SymReg * const r = ret->ret[i];
+
+                if (REG_NEEDS_ALLOC(r) && (r->set == 'P' || r->set == 'S')
+                && !reg_listed(defined, n_defined, r)
+                && !reg_listed(body->init, body->n_init, r))
+                    body->init[body->n_init++] = r;
+            }
+
+            copy->type = ITPCCRET;
+            copy->n    = ret->nret;
+            copy->regs = copy_regs(imcc, ret->ret, ret->nret);
+            prefix     = 0;
+        }
+        else if (ins->type & ITLABEL) {
+            copy->type = ITLABEL;
+            copy->n    = 1;
+            copy->regs = copy_regs(imcc, ins->symregs, 1);
+            prefix     = 0;
+        }
+        else {
+            for (i = 0; i < ins->symreg_count; i++) {
+                SymReg * const r = ins->symregs[i];
+
+                if (REG_NEEDS_ALLOC(r) && (r->set == 'P' || r->set == 'S')
+                && ((ins->flags & (1 << i)) || !(ins->flags & (1 << (16 + i))))
+                && !reg_listed(defined, n_defined, r)
+                && !reg_listed(body->init, body->n_init, r))
+                    body->init[body->n_init++] = r;
+            }
+
+            for (i = 0; prefix && i < ins->symreg_count; i++) {
+                SymReg * const r = ins->symregs[i];
+
+                if (REG_NEEDS_ALLOC(r)
+                && !(ins->flags & (1 << i)) && (ins->flags & (1 << (16 + i)))
+                && !reg_listed(defined, n_defined, r))
+                    defined[n_defined++] = r;
+            }
+
+            copy->opname = mem_sys_strdup(ins->opname);
+            copy->keys   = ins->keys;
+            copy->n      = ins->symreg_count;
+            copy->regs   = copy_regs(imcc, ins->symregs, ins->symreg_count);
+
+            if (ins->type & ITBRANCH)
+                prefix = 0;
+        }
+    }
+
+    /* falling off the end returns nothing */
+    if (!n_ins || !(unit->last_ins->type & (ITPCCSUB | IF_goto))) {
+        Inline_ins * const copy = &body->ins[body->n_ins++];
+
+        copy->type = ITPCCRET;
+        copy->line = unit->last_ins->line;
+        copy->regs = copy_regs(imcc, NULL, 0);
+        n_ops++;
+    }
+
+    body->size        = n_ops + body->n_params + body->n_init;
+    unit->inline_body = body;
+
+    mem_sys_free(defined);
+}
+
+/*
+
+=item C<void inline_free(IMC_Unit *unit)>
+
+Frees the copy C<inline_snapshot> kept of C<unit>, if any.
+
+=cut
+
+*/
+
+void
+inline_free(ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(inline_free)
+    Inline_body * const body = unit->inline_body;
+    int i;
+
+    if (!body)
+        return;
+
+    for (i = 0; i < body->n_ins; i++) {
+        if (body->ins[i].opname)
+            mem_sys_free(body->ins[i].opname);
+
+        mem_sys_free(body->ins[i].regs);
+    }
+
+    mem_sys_free(body->ins);
+    mem_sys_free(body->params);
+    mem_sys_free(body->init);
+    mem_sys_free(body);
+
+    unit->inline_body = NULL;
+}
+
+/*
+
+=item C<static IMC_Unit * find_callee(const imc_info_t *imcc, const IMC_Unit
+*unit, const pcc_sub_t *call)>
+
+Returns the sub C<call> in C<unit> calls if it is known at compile time
+and can be inlined, else NULL.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static IMC_Unit *
+find_callee(ARGIN(const imc_info_t *imcc), ARGIN(const IMC_Unit *unit),
+        ARGIN(const pcc_sub_t *call))
+{
+    ASSERT_ARGS(find_callee)
+    const SymReg * const name = call->sub;
+    IMC_Unit            *callee;
+
+    if (!name || call->object || call->tailcall || call->cc
+    ||  !(name->type & VTADDRESS) || (name->type & VT_ENCODED))
+        return NULL;
+
+    /* the first sub of that name in the namespace, as in find_global_label */
+    for (callee = imcc->imc_units; callee && callee != unit; callee = callee->next) {
+        const SymReg * const r = callee->instructions
+                               && callee->instructions->symreg_count
+                               ? callee->instructions->symregs[0] : NULL;
+
+        if (!r || !r->name || !STREQ(r->name, name->name))
+            continue;
+
+        if (callee->_namespace && unit->_namespace
+                ? STREQ(callee->_namespace->name, unit->_namespace->name)
+                : !callee->_namespace && !unit->_namespace)
+            return callee->inline_body && callee->hll_id == unit->hll_id
+                 ? callee : NULL;
+    }
+
+    return NULL;
+}
+
+/*
+
+=item C<static int call_fits(const pcc_sub_t *call, const Inline_body *body)>
+
+Returns whether the arguments and results of C<call> match the parameters
+and returns of the copy C<body> of a sub.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+call_fits(ARGIN(const pcc_sub_t *call), ARGIN(const Inline_body *body))
+{
+    ASSERT_ARGS(call_fits)
+    int i, j;
+
+    if (call->nargs != body->n_params)
+        return 0;
+
+    for (i = 0; i < call->nargs; i++) {
+        const SymReg * const arg = call->args[i];
+
+        if ((call->arg_flags[i] & INLINE_ARG_FLAGS) || arg->nextkey
+        ||  arg->set != body->params[i]->set
+        ||  !(REG_NEEDS_ALLOC(arg) || (arg->type & VTCONST)))
+            return 0;
+    }
+
+    if (!call->nret)
+        return 1;
+
+    for (i = 0; i < call->nret; i++)
+        if ((call->ret_flags[i] & INLINE_ARG_FLAGS)
+        ||  !REG_NEEDS_ALLOC(call->ret[i]))
+            return 0;
+
+    for (j = 0; j < body->n_ins; j++) {
+        const Inline_ins * const ret = &body->ins[j];
+
+        if (ret->type != ITPCCRET)
+            continue;
+
+        if (ret->n != call->nret)
+            return 0;
+
+        for (i = 0; i < call->nret; i++)
+            if (ret->regs[i]->set != call->ret[i]->set)
+                return 0;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static SymReg * map_sym(imc_info_t *imcc, inline_map_t *map, SymReg *r)>
+
+Returns what the operand C<r> of an inlined sub becomes in the caller: a
+new temporary for a register, a new label for a label, and C<r> itself for
+a constant.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static SymReg *
+map_sym(ARGMOD(imc_info_t *imcc), ARGMOD(inline_map_t *map), ARGIN(SymReg *r))
+{
+    ASSERT_ARGS(map_sym)
+    SymReg      *to;
+    unsigned int i;
+
+    if (!REG_NEEDS_ALLOC(r) && !(r->type & VTADDRESS))
+        return r;
+
+    for (i = 0; i < map->n; i++)
+        if (map->from[i] == r)
+            return map->to[i];
+
+    if (REG_NEEDS_ALLOC(r))
+        to = mk_temp_reg(imcc, r->set);
+    else {
+        char name[32];
+        snprintf(name, sizeof (name), "%cinline_%d", IMCC_INTERNAL_CHAR,
+                imcc->cnr++);
+        to = mk_local_label(imcc, name);
+    }
+
+    map->from[map->n] = r;
+    map->to[map->n]   = to;
+    map->n++;
+
+    return to;
+}
+
+/*
+
+=item C<static Instruction * add_ins(IMC_Unit *unit, Instruction *pos,
+Instruction *ins, int line)>
+
+Inserts C<ins>, if any, after C<pos> with the source line C<line>, and
+returns the instruction to insert after next.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Instruction *
+add_ins(ARGMOD(IMC_Unit *unit), ARGMOD(Instruction *pos),
+        ARGMOD_NULLOK(Instruction *ins), int line)
+{
+    ASSERT_ARGS(add_ins)
+
+    if (!ins)
+        return pos;
+
+    ins->line = line;
+    insert_ins(unit, pos, ins);
+
+    return ins;
+}
+
+/*
+
+=item C<static Instruction * inline_call(imc_info_t *imcc, IMC_Unit *unit,
+Instruction *call_ins, const Inline_body *body)>
+
+Replaces the call C<call_ins> in C<unit> with the copy C<body> of the sub
+it calls: its arguments are copied into the parameters, and the values of
+each return into the results, followed by a branch past the copy. Returns
+the instruction after the copy.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static Instruction *
+inline_call(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit),
+        ARGMOD(Instruction *call_ins), ARGIN(const Inline_body *body))
+{
+    ASSERT_ARGS(inline_call)
+    const pcc_sub_t * const call = call_ins->symregs[0]->pcc_sub;
+    const int         line = call_ins->line;
+    Instruction      *pos  = call_ins;
+    SymReg           *end  = NULL;
+    SymReg           *regs[IMCC_MAX_FIX_REGS];
+    inline_map_t      map;
+    unsigned int      size;
+    int               i, j;
+
+    size = body->n_params + body->n_init;
+
+    for (j = 0; j < body->n_ins; j++)
+        size += body->ins[j].n;
+
+    map.from = mem_gc_allocate_n_typed(imcc->interp, size + 1, SymReg *);
+    map.to   = mem_gc_allocate_n_typed(imcc->interp, size + 1, SymReg *);
+    map.n    = 0;
+
+    for (i = 0; i < call->nargs; i++) {
+        regs[0] = map_sym(imcc, &map, body->params[i]);
+        regs[1] = call->args[i];
+        pos     = add_ins(unit, pos,
+                    INS(imcc, unit, "set", "", regs, 2, 0, 0), line);
+    }
+
+    for (i = 0; i < body->n_init; i++) {
+        regs[0] = map_sym(imcc, &map, body->init[i]);
+        pos     = add_ins(unit, pos,
+                    INS(imcc, unit, "null", "", regs, 1, 0, 0), line);
+    }
+
+    for (j = 0; j < body->n_ins; j++) {
+        const Inline_ins * const ins = &body->ins[j];
+
+        if (ins->type == ITPCCRET) {
+            for (i = 0; i < call->nret; i++) {
+                regs[0] = call->ret[i];
+                regs[1] = map_sym(imcc, &map, ins->regs[i]);
+                pos     = add_ins(unit, pos,
+                            INS(imcc, unit, "set", "", regs, 2, 0, 0),
+                            ins->line);
+            }
+
+            if (j < body->n_ins - 1) {
+                if (!end) {
+                    char name[32];
+                    snprintf(name, sizeof (name), "%cinline_%d",
+                            IMCC_INTERNAL_CHAR, imcc->cnr++);
+                    end = mk_local_label(imcc, name);
+                }
+
+                regs[0] = end;
+                pos     = add_ins(unit, pos,
+                            INS(imcc, unit, "branch", "", regs, 1, 0, 0),
+                            ins->line);
+            }
+        }
+        else if (ins->type == ITLABEL)
+            pos = add_ins(unit, pos, INS_LABEL(imcc, unit,
+                        map_sym(imcc, &map, ins->regs[0]), 0), ins->line);
+        else {
+            for (i = 0; i < ins->n; i++)
+                regs[i] = map_sym(imcc, &map, ins->regs[i]);
+
+            pos = add_ins(unit, pos, INS(imcc, unit, ins->opname, "", regs,
+                        ins->n, ins->keys, 0), ins->line);
+        }
+    }
+
+    if (end)
+        add_ins(unit, pos, INS_LABEL(imcc, unit, end, 0), line);
+
+    mem_sys_free(map.from);
+    mem_sys_free(map.to);
+
+    return delete_ins(unit, call_ins);
+}
+
+/*
+
+=item C<int inline_calls(imc_info_t *imcc, IMC_Unit *unit)>
+
+Inlines the calls in C<unit> of subs compiled before it that
+C<inline_snapshot> kept a copy of, up to C<INLINE_MAX_GROWTH> ops in all,
+and returns how many it inlined.
+
+=cut
+
+*/
+
+int
+inline_calls(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(inline_calls)
+    Instruction *ins, *next;
+    int          growth = 0;
+    int          n      = 0;
+
+    if (!(unit->type & IMC_PCCSUB) || unit->pasm_file)
+        return 0;
+
+    for (ins = unit->instructions; ins; ins = next) {
+        next = ins->next;
+
+        if ((ins->type & (ITCALL | ITPCCSUB)) == (ITCALL | ITPCCSUB)) {
+            const pcc_sub_t * const call   = ins->symregs[0]->pcc_sub;
+            const IMC_Unit  * const callee = find_callee(imcc, unit, call);
+
+            if (callee
+            &&  growth + callee->inline_body->size <= INLINE_MAX_GROWTH
+            &&  call_fits(call, callee->inline_body)) {
+                IMCC_debug(imcc, DEBUG_OPT2, "inline call of %s\n",
+                        call->sub->name);
+                growth += callee->inline_body->size;
+                next    = inline_call(imcc, unit, ins, callee->inline_body);
+                n++;
+            }
+        }
+    }
+
+    unit->ostat.inlined_calls += n;
+
+    return n;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<compilers/imcc/ssa.c>, which cleans up the copies of arguments and
+results afterwards.
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
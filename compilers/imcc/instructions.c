@@ -38,6 +38,24 @@ These functions operate over this array and its contents.
 /* HEADERIZER HFILE: compilers/imcc/instructions.h */
 
 /* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void add_reg_ref(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(Reg_refs *refs),
+    ARGIN(SymReg *r),
+    int writes)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*refs);
+
+#define ASSERT_ARGS_add_reg_ref __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(refs) \
+    , PARROT_ASSERT_ARG(r))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
 /*
@@ -233,6 +251,131 @@ instruction_writes(ARGIN(const Instruction *ins), ARGIN(const SymReg *r))
 }
 
 
+/*
+
+=item C<static void add_reg_ref(imc_info_t * imcc, Reg_refs *refs, SymReg *r,
+int writes)>
+
+Appends C<r> to C<refs> if it is a register that needs allocation.
+
+=cut
+
+*/
+
+static void
+add_reg_ref(ARGMOD(imc_info_t * imcc), ARGMOD(Reg_refs *refs), ARGIN(SymReg *r),
+        int writes)
+{
+    ASSERT_ARGS(add_reg_ref)
+
+    if (!REG_NEEDS_ALLOC(r))
+        return;
+
+    if (refs->n == refs->size) {
+        refs->size   = refs->size ? refs->size * 2 : 16;
+        refs->regs   = mem_gc_realloc_n_typed(imcc->interp, refs->regs,
+                            refs->size, SymReg *);
+        refs->writes = mem_gc_realloc_n_typed(imcc->interp, refs->writes,
+                            refs->size, int);
+    }
+
+    refs->regs[refs->n]   = r;
+    refs->writes[refs->n] = writes;
+    refs->n++;
+}
+
+/*
+
+=item C<void ins_reg_refs(imc_info_t * imcc, const Instruction *ins, Reg_refs
+*refs)>
+
+Fills C<refs> with the registers C<ins> reads and writes, in one pass over
+its operands instead of asking C<instruction_reads> and
+C<instruction_writes> about every symbol. Operands that are flagged neither
+way count as read, and so do operands that are read and written. A sub call
+reads the arguments of the C<set_args> before it; its results are written
+by the C<get_results> after it.
+
+=cut
+
+*/
+
+void
+ins_reg_refs(ARGMOD(imc_info_t * imcc), ARGIN(const Instruction *ins),
+        ARGMOD(Reg_refs *refs))
+{
+    ASSERT_ARGS(ins_reg_refs)
+    op_lib_t * const core_ops = PARROT_GET_CORE_OPLIB(imcc->interp);
+    int i;
+
+    refs->n = 0;
+
+    if (ins->op == &core_ops->op_info_table[PARROT_OP_set_args_pc]
+    ||  ins->op == &core_ops->op_info_table[PARROT_OP_set_returns_pc]) {
+        for (i = 0; i < ins->symreg_count; i++)
+            add_reg_ref(imcc, refs, ins->symregs[i], 0);
+        return;
+    }
+
+    if (ins->op == &core_ops->op_info_table[PARROT_OP_get_params_pc]
+    ||  ins->op == &core_ops->op_info_table[PARROT_OP_get_results_pc]) {
+        for (i = 0; i < ins->symreg_count; i++)
+            add_reg_ref(imcc, refs, ins->symregs[i], 1);
+        return;
+    }
+
+    for (i = 0; i < ins->symreg_count; i++) {
+        SymReg * const r = ins->symregs[i];
+
+        if (r->set == 'K') {
+            const SymReg *key;
+            for (key = r->nextkey; key; key = key->nextkey)
+                if (key->reg)
+                    add_reg_ref(imcc, refs, key->reg, 0);
+        }
+
+        add_reg_ref(imcc, refs, r,
+            (ins->flags & (1 << (16 + i))) && !(ins->flags & (1 << i)));
+    }
+
+    if (ins->type & ITPCCSUB) {
+        const Instruction *args = ins->prev;
+
+        while (args && args->op != &core_ops->op_info_table[PARROT_OP_set_args_pc])
+            args = args->prev;
+
+        if (args)
+            for (i = 0; i < args->symreg_count; i++)
+                add_reg_ref(imcc, refs, args->symregs[i], 0);
+    }
+}
+
+/*
+
+=item C<void free_reg_refs(Reg_refs *refs)>
+
+Frees the buffers of C<refs>.
+
+=cut
+
+*/
+
+void
+free_reg_refs(ARGMOD(Reg_refs *refs))
+{
+    ASSERT_ARGS(free_reg_refs)
+
+    if (refs->regs) {
+        mem_sys_free(refs->regs);
+        mem_sys_free(refs->writes);
+        refs->regs   = NULL;
+        refs->writes = NULL;
+    }
+
+    refs->n    = 0;
+    refs->size = 0;
+}
+
 /*
 
 =item C<int get_branch_regno(const Instruction *ins)>
@@ -41,6 +41,15 @@ typedef struct _Instruction {
 } Instruction;
 
 
+/* The registers one instruction reads or writes, see C<ins_reg_refs>. */
+typedef struct _Reg_refs {
+    SymReg       **regs;
+    int           *writes;   /* whether regs[i] is written only */
+    unsigned int   n;
+    unsigned int   size;
+} Reg_refs;
+
+
 /* XXX fix flags [bitmap]
  * int flags_r
  * int flags_w
@@ -131,6 +140,10 @@ void free_ins(ARGMOD(Instruction *ins))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*ins);
 
+void free_reg_refs(ARGMOD(Reg_refs *refs))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*refs);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 SymReg * get_branch_reg(ARGIN(const Instruction *ins))
@@ -149,6 +162,16 @@ ins_print(
         __attribute__nonnull__(3)
         FUNC_MODIFIES(* imcc);
 
+void ins_reg_refs(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const Instruction *ins),
+    ARGMOD(Reg_refs *refs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*refs);
+
 void insert_ins(
     ARGMOD(IMC_Unit *unit),
     ARGMOD_NULLOK(Instruction *ins),
@@ -224,6 +247,8 @@ void subst_ins(
        PARROT_ASSERT_ARG(imcc))
 #define ASSERT_ARGS_free_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_free_reg_refs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(refs))
 #define ASSERT_ARGS_get_branch_reg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ins))
 #define ASSERT_ARGS_get_branch_regno __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -231,6 +256,10 @@ void subst_ins(
 #define ASSERT_ARGS_ins_print __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_ins_reg_refs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(refs))
 #define ASSERT_ARGS_insert_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit) \
     , PARROT_ASSERT_ARG(tmp))
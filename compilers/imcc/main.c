@@ -262,6 +262,9 @@ imcc_set_optimization_level(ARGMOD(imc_info_t *imcc), ARGIN(const char *opts))
     if (strchr(opts, '2')) {
         imcc->optimizer_level |= (OPT_PRE | OPT_CFG);
     }
+    if (strchr(opts, '3')) {
+        imcc->optimizer_level |= (OPT_PRE | OPT_CFG | OPT_SSA | OPT_INLINE);
+    }
 }
 
 /*
@@ -300,6 +303,8 @@ imcc_preprocess(ARGMOD(imc_info_t *imcc), ARGIN(STRING * const sourcefile))
     ASSERT_ARGS(imcc_preprocess)
     yyscan_t yyscanner = imcc_get_scanner(imcc);
 
+    Parrot_runcore_build_op_hash(imcc->interp);
+
     /* TODO: THIS! */
     /* Figure out what kind of source file we have -- if we have one */
     if (!STRING_length(sourcefile))
@@ -528,6 +533,9 @@ imcc_run_compilation_internal(ARGMOD(imc_info_t *imcc), ARGIN(STRING *source),
     PMC      * const packfilepmc = Parrot_pf_get_packfile_pmc(imcc->interp, pf_raw, pf_path);
     INTVAL           success = 0;
 
+    /* the parser looks ops up by name */
+    Parrot_runcore_build_op_hash(imcc->interp);
+
     /* TODO: Don't set current packfile in the interpreter. Leave the
              interpreter alone */
 
@@ -53,6 +53,9 @@ used_once ... deletes assignments, when LHS is unused
 
 constant_propagation
 
+ssa_optimize (-O3) ... copy propagation, global value numbering, dead
+store elimination and loop-invariant code motion, see F<ssa.c>
+
 post_optimizer: currently pcc_optimize in pcc.c
 ---------------
 
@@ -280,6 +283,9 @@ Runs after the CFG is built and handles constant propagation.
 used_once ... deletes assignments, when LHS is unused and the
 op is purely functional, i.e. no side-effects.
 
+At C<-O3>, runs the optimizations of F<compilers/imcc/ssa.c> once these
+find nothing more to do.
+
 =cut
 
 */
@@ -294,6 +300,8 @@ optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         any = constant_propagation(imcc, unit);
         if (used_once(imcc, unit))
             return 1;
+        if (!any && (imcc->optimizer_level & OPT_SSA))
+            return ssa_optimize(imcc, unit);
     }
     return any;
 }
@@ -137,19 +137,27 @@ static PMC* create_lexinfo(
         FUNC_MODIFIES(*unit)
         FUNC_MODIFIES(* bc);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static subs_t * find_compiled_outer(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static subs_t * find_global_label(
     ARGMOD(imc_info_t * imcc),
+    ARGIN(const Hash *labels),
     ARGIN(const char *name),
-    ARGIN(const subs_t *sym),
-    ARGOUT(int *pc))
+    ARGIN(const subs_t *sym))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
         __attribute__nonnull__(4)
-        FUNC_MODIFIES(* imcc)
-        FUNC_MODIFIES(*pc);
+        FUNC_MODIFIES(* imcc);
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -203,6 +211,11 @@ static void imcc_globals_destroy(PARROT_INTERP, int ex, ARGMOD(void *param))
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*param);
 
+PARROT_CANNOT_RETURN_NULL
+static Hash * index_global_labels(ARGMOD(imc_info_t * imcc))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(* imcc);
+
 static void init_fixedintegerarray_from_string(
     ARGMOD(imc_info_t * imcc),
     ARGIN(PMC *p),
@@ -235,6 +248,23 @@ static PMC* mk_multi_sig(
         FUNC_MODIFIES(* imcc)
         FUNC_MODIFIES(* bc);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC* own_lexicals(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc);
+
+static void resolve_lexicals(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
+
 static void store_fixup(
     ARGMOD(imc_info_t * imcc),
     ARGIN(const SymReg *r),
@@ -312,11 +342,14 @@ static void verify_signature(
     , PARROT_ASSERT_ARG(unit) \
     , PARROT_ASSERT_ARG(sub_pmc) \
     , PARROT_ASSERT_ARG(bc))
+#define ASSERT_ARGS_find_compiled_outer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_find_global_label __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(labels) \
     , PARROT_ASSERT_ARG(name) \
-    , PARROT_ASSERT_ARG(sym) \
-    , PARROT_ASSERT_ARG(pc))
+    , PARROT_ASSERT_ARG(sym))
 #define ASSERT_ARGS_find_outer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -336,6 +369,8 @@ static void verify_signature(
     , PARROT_ASSERT_ARG(ins_line))
 #define ASSERT_ARGS_imcc_globals_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(param))
+#define ASSERT_ARGS_index_global_labels __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc))
 #define ASSERT_ARGS_init_fixedintegerarray_from_string \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
@@ -351,6 +386,12 @@ static void verify_signature(
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(r) \
     , PARROT_ASSERT_ARG(bc))
+#define ASSERT_ARGS_own_lexicals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_resolve_lexicals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_store_fixup __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(r))
@@ -545,19 +586,15 @@ get_old_size(ARGMOD(imc_info_t * imcc), ARGIN(PackFile_ByteCode * bc),
         ARGOUT(int *ins_line))
 {
     ASSERT_ARGS(get_old_size)
-    size_t size = 0;
+    const code_segment_t * const cs = imcc->globals->cs;
 
-    *ins_line   = 0;
-
-    if (imcc->globals->cs && bc->base.data) {
-        const subs_t *s;
-        for (s = imcc->globals->cs->subs; s; s = s->prev) {
-            size      += s->size;
-            *ins_line += s->ins_line;
-        }
+    if (cs && bc->base.data) {
+        *ins_line = cs->ins_line;
+        return cs->size;
     }
 
-    return size;
+    *ins_line = 0;
+    return 0;
 }
 
 
@@ -566,7 +603,8 @@ get_old_size(ARGMOD(imc_info_t * imcc), ARGIN(PackFile_ByteCode * bc),
 =item C<static void store_sub_size(imc_info_t * imcc, size_t size, size_t
 ins_line)>
 
-Sets the given size and line parameters for the current compilation unit.
+Sets the given size and line parameters for the current compilation unit,
+and keeps the totals of its code segment up to date.
 
 =cut
 
@@ -576,8 +614,13 @@ static void
 store_sub_size(ARGMOD(imc_info_t * imcc), size_t size, size_t ins_line)
 {
     ASSERT_ARGS(store_sub_size)
-    imcc->globals->cs->subs->size     = size;
-    imcc->globals->cs->subs->ins_line = ins_line;
+    code_segment_t * const cs = imcc->globals->cs;
+
+    cs->size     += size     - cs->subs->size;
+    cs->ins_line += (int)ins_line - cs->subs->ins_line;
+
+    cs->subs->size     = size;
+    cs->subs->ins_line = ins_line;
 }
 
 
@@ -832,11 +875,46 @@ bytecode_map_op(ARGMOD(imc_info_t * imcc), op_info_t *info) {
 
 /*
 
-=item C<static subs_t * find_global_label(imc_info_t * imcc, const char *name,
-const subs_t *sym, int *pc)>
+=item C<static Hash * index_global_labels(imc_info_t * imcc)>
 
-Finds a global label, returning the symreg (and setting the (absolute) pc
-through the out parameter).
+Returns a hash mapping the name of each sub in the current code segment to the
+first sub of that name. Later subs of the same name are chained to it through
+C<same_name>, in code order.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Hash *
+index_global_labels(ARGMOD(imc_info_t * imcc))
+{
+    ASSERT_ARGS(index_global_labels)
+    Hash * const labels = Parrot_hash_new_cstring_hash(imcc->interp);
+    subs_t      *s;
+
+    /* backwards, so that the first sub of a name ends up in the hash */
+    for (s = imcc->globals->cs->subs; s; s = s->prev) {
+        const SymReg * const r = s->unit->instructions->symregs[0];
+
+        s->same_name = NULL;
+
+        if (r && r->name) {
+            s->same_name = (subs_t *)Parrot_hash_get(imcc->interp, labels, r->name);
+            Parrot_hash_put(imcc->interp, labels, r->name, s);
+        }
+    }
+
+    return labels;
+}
+
+/*
+
+=item C<static subs_t * find_global_label(imc_info_t * imcc, const Hash *labels,
+const char *name, const subs_t *sym)>
+
+Finds the first sub named C<name> in the namespace of C<sym>, using the
+C<labels> built by C<index_global_labels>.
 
 =cut
 
@@ -845,25 +923,18 @@ through the out parameter).
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static subs_t *
-find_global_label(ARGMOD(imc_info_t * imcc), ARGIN(const char *name),
-    ARGIN(const subs_t *sym), ARGOUT(int *pc))
+find_global_label(ARGMOD(imc_info_t * imcc), ARGIN(const Hash *labels),
+    ARGIN(const char *name), ARGIN(const subs_t *sym))
 {
     ASSERT_ARGS(find_global_label)
     subs_t *s;
 
-    *pc = 0;
-
-    for (s = imcc->globals->cs->first; s; s = s->next) {
-        const SymReg * const r = s->unit->instructions->symregs[0];
-
-        /* if names and namespaces are matching - ok */
-        if (r && r->name && (strcmp(r->name, name) == 0)
-                && ((sym->unit->_namespace && s->unit->_namespace
-                        && (strcmp(sym->unit->_namespace->name, s->unit->_namespace->name) == 0))
-                    || (!sym->unit->_namespace && !s->unit->_namespace)))
+    for (s = (subs_t *)Parrot_hash_get(imcc->interp, labels, name); s; s = s->same_name) {
+        /* if namespaces are matching - ok */
+        if ((sym->unit->_namespace && s->unit->_namespace
+                && (strcmp(sym->unit->_namespace->name, s->unit->_namespace->name) == 0))
+            || (!sym->unit->_namespace && !s->unit->_namespace))
             return s;
-
-        *pc += s->size;
     }
     return NULL;
 }
@@ -920,6 +991,7 @@ fixup_globals(ARGMOD(imc_info_t * imcc))
     int     jumppc = 0;
     op_lib_t *core_ops = PARROT_GET_CORE_OPLIB(imcc->interp);
     PackFile_ByteCode * const bc = Parrot_pf_get_current_code_segment(imcc->interp);
+    Hash * const labels = index_global_labels(imcc);
 
     for (s = imcc->globals->cs->first; s; s = s->next) {
         const SymHash * const hsh = &s->fixup;
@@ -965,7 +1037,7 @@ fixup_globals(ARGMOD(imc_info_t * imcc))
                     continue;
                 }
                 else
-                    s1 = find_global_label(imcc, fixup->name, s, &pc);
+                    s1 = find_global_label(imcc, labels, fixup->name, s);
 
                 /*
                  * if failed change opcode:
@@ -1034,6 +1106,8 @@ fixup_globals(ARGMOD(imc_info_t * imcc))
 
         jumppc += s->size;
     }
+
+    Parrot_hash_destroy(imcc->interp, labels);
 }
 
 
@@ -1608,6 +1682,13 @@ add_const_pmc_sub(ARGMOD(imc_info_t * imcc), ARGMOD(SymReg *r), size_t offs,
     sub->outer_sub    = find_outer(imcc, unit);
     sub->vtable_index = -1;
 
+    /* resolve_lexicals referred to this sub's own LexInfo */
+    if (unit->lexinfo) {
+        PARROT_ASSERT(sub->lex_info);
+        unit->lexinfo->color = add_const_table_pmc(imcc, sub->lex_info);
+        imcc->globals->cs->subs->lexinfo_const = unit->lexinfo->color;
+    }
+
     /* check if it's declared multi */
     if (r->pcc_sub->nmulti)
         sub->multi_signature = mk_multi_sig(imcc, r, interp_code);
@@ -2171,31 +2252,38 @@ constant_folding(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
         ARGMOD(PackFile_ByteCode * bc))
 {
     ASSERT_ARGS(constant_folding)
-    const SymHash *hsh = &imcc->ghash;
-    unsigned int   i;
-
-    /* go through all consts of current sub */
-    for (i = 0; i < hsh->size; i++) {
-        SymReg *r;
-
-        /* normally constants are in ghash ... */
-        for (r = hsh->data[i]; r; r = r->next) {
-            if (r->type & (VTCONST|VT_CONSTP))
-                add_1_const(imcc, r, bc);
-
-            if (r->usage & U_LEXICAL) {
-                SymReg *n = r->reg;
-
-                /* r->reg is a chain of names for the same lex sym */
-                while (n) {
-                    /* lex_name */
-                    add_1_const(imcc, n, bc);
-                    n = n->reg;
-                }
+    SymHash      *ghsh = &imcc->ghash;
+    const SymHash *hsh;
+    unsigned int   i, kept;
+
+    /* go through all consts of current sub; normally constants are in
+     * ghash. Only the globals which were pending after the previous unit
+     * or were added since can still need a constant. */
+    for (i = 0, kept = 0; i < ghsh->n_pending; i++) {
+        SymReg * const r = ghsh->pending[i];
+
+        if (r->type & (VTCONST|VT_CONSTP))
+            add_1_const(imcc, r, bc);
+
+        if (r->usage & U_LEXICAL) {
+            SymReg *n = r->reg;
+
+            /* r->reg is a chain of names for the same lex sym */
+            while (n) {
+                /* lex_name */
+                add_1_const(imcc, n, bc);
+                n = n->reg;
             }
         }
+
+        /* keep the constants not used yet; lexical names chained to r
+         * are pending on their own */
+        if (r->type & (VTCONST|VT_CONSTP) && r->color < 0)
+            ghsh->pending[kept++] = r;
     }
 
+    ghsh->n_pending = kept;
+
     /* ... but keychains 'K' are in local hash, they may contain
      * variables and constants */
     hsh = &unit->hash;
@@ -2215,6 +2303,217 @@ constant_folding(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
 }
 
 
+/*
+
+=item C<static PMC* own_lexicals(imc_info_t * imcc, const IMC_Unit *unit)>
+
+Returns a Hash mapping the names of the lexicals declared in the given unit
+to their registers, encoded like LexInfo does, or PMCNULL if there are none.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC*
+own_lexicals(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit))
+{
+    ASSERT_ARGS(own_lexicals)
+    PMC           *lexicals = PMCNULL;
+    const SymHash * const hsh = &unit->hash;
+    unsigned int   i;
+
+    for (i = 0; i < hsh->size; i++) {
+        const SymReg *r;
+
+        for (r = hsh->data[i]; r; r = r->next) {
+            const SymReg *n;
+            INTVAL        reg_type;
+
+            if (!(r->usage & U_LEXICAL) || r->color < 0)
+                continue;
+
+            if (PMC_IS_NULL(lexicals))
+                lexicals = Parrot_pmc_new(imcc->interp, enum_class_Hash);
+
+            reg_type = r->set == 'I' ? REGNO_INT :
+                       r->set == 'N' ? REGNO_NUM :
+                       r->set == 'S' ? REGNO_STR :
+                                       REGNO_PMC;
+
+            for (n = r->reg; n; n = n->reg)
+                VTABLE_set_integer_keyed_str(imcc->interp, lexicals,
+                        IMCC_string_from_reg(imcc, n), (r->color << 2) | reg_type);
+        }
+    }
+
+    return lexicals;
+}
+
+
+/*
+
+=item C<static subs_t * find_compiled_outer(imc_info_t * imcc, const IMC_Unit
+*unit)>
+
+Returns the :outer sub of the given unit, if it was compiled already in the
+current code segment.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static subs_t *
+find_compiled_outer(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit))
+{
+    ASSERT_ARGS(find_compiled_outer)
+    subs_t *s;
+
+    if (!unit->outer || !*unit->outer->name)
+        return NULL;
+
+    for (s = imcc->globals->cs->first; s; s = s->next) {
+        if (s->unit == unit || !s->unit->subid || !s->unit->sub_pmc)
+            continue;
+
+        if (STREQ(s->unit->subid->name, unit->outer->name))
+            return s;
+    }
+
+    return NULL;
+}
+
+
+/*
+
+=item C<static void resolve_lexicals(imc_info_t * imcc, IMC_Unit *unit)>
+
+Replaces C<find_lex> and C<store_lex> of a constant name with
+C<find_lex_slot> and C<store_lex_slot>, when the lexical is declared in the
+given unit or in one of its already compiled :outer subs. The new ops carry
+the register and :outer depth of the lexical, along with the LexInfo to check
+against at run time.
+
+=cut
+
+*/
+
+#define MAX_LEXICAL_DEPTH 32
+
+static void
+resolve_lexicals(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(resolve_lexicals)
+    Instruction *ins;
+    PMC         *lexicals = NULL;
+
+    /* a mapped LexInfo may resolve names its own way */
+    if (unit->pasm_file
+    ||  Parrot_hll_get_ctx_HLL_type(imcc->interp, enum_class_LexInfo) != enum_class_LexInfo)
+        return;
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        SymReg      *name, *value, *lex_info;
+        SymReg      *regs[5];
+        Instruction *tmp;
+        STRING      *lex_name;
+        INTVAL       slot  = -1;
+        int          depth = 0;
+        int          is_store;
+        char         buf[64];
+
+        if (!ins->opname || !ins->op)
+            continue;
+
+        if (STREQ(ins->opname, "find_lex"))
+            is_store = 0;
+        else if (STREQ(ins->opname, "store_lex"))
+            is_store = 1;
+        else
+            continue;
+
+        name  = ins->symregs[is_store ? 0 : 1];
+        value = ins->symregs[is_store ? 1 : 0];
+
+        if (!(name->type & VTCONST) || name->set != 'S')
+            continue;
+
+        lex_name = IMCC_string_from_reg(imcc, name);
+
+        if (!lexicals)
+            lexicals = own_lexicals(imcc, unit);
+
+        if (!PMC_IS_NULL(lexicals)
+        &&  VTABLE_exists_keyed_str(imcc->interp, lexicals, lex_name)) {
+            slot = VTABLE_get_integer_keyed_str(imcc->interp, lexicals, lex_name);
+
+            /* the color is set once the LexInfo exists, in add_const_pmc_sub */
+            if (!unit->lexinfo)
+                unit->lexinfo = _mk_const(imcc, &unit->hash, "(lexinfo 0)", 'l');
+
+            lex_info = unit->lexinfo;
+        }
+        else {
+            const IMC_Unit *u = unit;
+            subs_t         *s1;
+
+            while (depth < MAX_LEXICAL_DEPTH && (s1 = find_compiled_outer(imcc, u)) != NULL) {
+                Parrot_Sub_attributes *sub;
+                PMC                   *outer_info;
+
+                ++depth;
+                PMC_get_sub(imcc->interp, s1->unit->sub_pmc, sub);
+                outer_info = sub->lex_info;
+
+                if (outer_info
+                &&  outer_info->vtable->base_type == enum_class_LexInfo
+                &&  VTABLE_exists_keyed_str(imcc->interp, outer_info, lex_name)) {
+                    slot = VTABLE_get_integer_keyed_str(imcc->interp, outer_info, lex_name);
+
+                    if (s1->lexinfo_const == -1)
+                        s1->lexinfo_const = add_const_table_pmc(imcc, outer_info);
+                    break;
+                }
+
+                u = s1->unit;
+            }
+
+            if (slot < 0)
+                continue;
+
+            snprintf(buf, sizeof (buf), "(lexinfo %d)", depth);
+            lex_info        = _mk_const(imcc, &unit->hash, buf, 'l');
+            lex_info->color = s1->lexinfo_const;
+        }
+
+        /* the register must be of the type the op moves */
+        if ("INSP"[slot & 3] != value->set)
+            continue;
+
+        regs[0] = is_store ? name : value;
+        regs[1] = is_store ? value : name;
+        snprintf(buf, sizeof (buf), "%d", depth);
+        regs[2] = mk_const(imcc, buf, 'I');
+        snprintf(buf, sizeof (buf), "%d", (int)(slot >> 2));
+        regs[3] = mk_const(imcc, buf, 'I');
+        regs[4] = lex_info;
+
+        snprintf(buf, sizeof (buf), "%s_slot%s_ic_ic_pc",
+                ins->opname, ins->op->full_name + strlen(ins->opname));
+
+        IMCC_debug(imcc, DEBUG_PBC, "lexical '%Ss' at depth %d reg %d: %s\n",
+                lex_name, depth, (int)(slot >> 2), buf);
+
+        tmp = INS(imcc, unit, buf, "", regs, 5, 0, 0);
+        subst_ins(unit, ins, tmp, 1);
+        ins = tmp;
+    }
+}
+
+
 /*
 
 =item C<void e_pbc_new_sub(imc_info_t * imcc, void *param, IMC_Unit *unit)>
@@ -2227,7 +2526,7 @@ has any instructions.
 */
 
 void
-e_pbc_new_sub(ARGMOD(imc_info_t * imcc), SHIM(void *param), ARGIN(IMC_Unit *unit))
+e_pbc_new_sub(ARGMOD(imc_info_t * imcc), SHIM(void *param), ARGMOD(IMC_Unit *unit))
 {
     ASSERT_ARGS(e_pbc_new_sub)
     if (!unit->instructions)
@@ -2235,6 +2534,7 @@ e_pbc_new_sub(ARGMOD(imc_info_t * imcc), SHIM(void *param), ARGIN(IMC_Unit *unit
 
     /* we start a new compilation unit */
     make_new_sub(imcc, unit);
+    resolve_lexicals(imcc, unit);
 }
 
 /*
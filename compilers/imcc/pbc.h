@@ -33,10 +33,11 @@ void e_pbc_end_sub(
 void e_pbc_new_sub(
     ARGMOD(imc_info_t * imcc),
     void *param,
-    ARGIN(IMC_Unit *unit))
+    ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(3)
-        FUNC_MODIFIES(* imcc);
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
 
 int e_pbc_open(ARGMOD(imc_info_t * imcc))
         __attribute__nonnull__(1)
@@ -12,14 +12,13 @@ compilers/imcc/reg_alloc.c
 
 Register allocator:
 
-This is a brute force register allocator. It uses a graph-coloring
-algorithm, but the implementation is very kludgy.
+Computes the live variables of every basic block of the CFG, turns them
+into one live range per register and runs a linear scan over those ranges,
+so that registers whose ranges don't overlap share a Parrot register.
 
-It is a partial implementation of a Briggs-style register allocator
-The following parts are just missing:
-
- - Renumbering
- - Coalescing
+Units the liveness analysis can't follow - exception handlers, computed
+branches, local subroutines - get one Parrot register per symbol, as do
+lexicals in every unit.
 
 =head2 Functions
 
@@ -32,6 +31,18 @@ The following parts are just missing:
 #include <string.h>
 #include "imc.h"
 #include "optimizer.h"
+#include "parrot/oplib/core_ops.h"
+
+/* The live range of a register in instruction indices and the symbol of it. */
+/* Upper limit of symbols times basic blocks for the live variable sets of
+ * C<linear_scan_reg_alloc>; bigger units get one register per symbol. */
+#define LIVE_SETS_MAX (1 << 25)
+
+typedef struct live_range_t {
+    int     start;
+    int     end;
+    SymReg *r;
+} live_range_t;
 
 /* HEADERIZER HFILE: compilers/imcc/imc.h */
 
@@ -65,6 +76,17 @@ static void compute_du_chain(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+static void compute_live_ranges(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGOUT(live_range_t *ranges))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit)
+        FUNC_MODIFIES(*ranges);
+
 static void compute_one_du_chain(ARGMOD(SymReg *r), ARGIN(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -85,6 +107,23 @@ static void imc_stat_init(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+PARROT_WARN_UNUSED_RESULT
+static int is_call_point(ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1);
+
+static void linear_scan_reg_alloc(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
+
+PARROT_WARN_UNUSED_RESULT
+static int live_range_cmp(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 static void make_stat(
     ARGMOD(IMC_Unit *unit),
     ARGMOD_NULLOK(int *sets),
@@ -128,6 +167,10 @@ static void vanilla_reg_alloc(
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_compute_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_compute_live_ranges __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ranges))
 #define ASSERT_ARGS_compute_one_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(r) \
     , PARROT_ASSERT_ARG(unit))
@@ -136,6 +179,14 @@ static void vanilla_reg_alloc(
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_imc_stat_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_is_call_point __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_linear_scan_reg_alloc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_live_range_cmp __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
 #define ASSERT_ARGS_make_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_print_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -168,6 +219,7 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
 {
     ASSERT_ARGS(imc_reg_alloc)
     const char *function;
+    int         first;
 
     if (!unit)
         return;
@@ -194,12 +246,18 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
         goto done;
     }
 
+    /* calls of small subs compiled before are inlined first */
+    if (imcc->optimizer_level & OPT_INLINE)
+        inline_calls(imcc, unit);
+
     /* all lexicals get a unique register */
     allocate_lexicals(imcc, unit);
 
-    /* build CFG and life info, and optimize iteratively */
+    /* build CFG and life info, and optimize iteratively; PCC is expanded
+     * the first time only */
+    first = 1;
+
     do {
-        int first = 1;
         do {
             while (pre_optimize(imcc, unit)) { };
 
@@ -222,8 +280,7 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
     if (imcc->debug & DEBUG_IMC)
         dump_symreg(unit);
 
-    /* TODO add option for a better allocator */
-    vanilla_reg_alloc(imcc, unit);
+    linear_scan_reg_alloc(imcc, unit);
 
     if (imcc->debug & DEBUG_IMC)
         dump_instructions(imcc, unit);
@@ -376,12 +433,20 @@ print_stat(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
               unit->ostat.used_once);
     IMCC_info(imcc, 1, "\t%d invariants_moved\n",
               unit->ostat.invariants_moved);
+    IMCC_info(imcc, 1, "\t%d copies propagated, %d values numbered, "
+              "%d dead stores\n",
+              unit->ostat.copies_propagated, unit->ostat.values_numbered,
+              unit->ostat.dead_stores);
+    IMCC_info(imcc, 1, "\t%d calls inlined\n",
+              unit->ostat.inlined_calls);
     IMCC_info(imcc, 1, "\tregisters needed:\t I%d, N%d, S%d, P%d\n",
             sets[0], sets[1], sets[2], sets[3]);
     IMCC_info(imcc, 1,
-            "\tregisters in .pasm:\t I%d, N%d, S%d, P%d - %d\n",
+            "\tregisters in .pasm:\t I%d, N%d, S%d, P%d\n",
             unit->n_regs_used[0], unit->n_regs_used[1],
             unit->n_regs_used[2], unit->n_regs_used[3]);
+    IMCC_info(imcc, 1, "\t%d registers shared by live range\n",
+            unit->ostat.shared_regs);
     IMCC_info(imcc, 1, "\t%d basic_blocks, %d edges\n",
             unit->n_basic_blocks, edge_count(unit));
 }
@@ -764,6 +829,309 @@ vanilla_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
 
 /*
 
+=item C<static int is_call_point(const Instruction *ins)>
+
+Returns whether C<ins> can give control to another sub that might capture
+a continuation and return through it again later.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_call_point(ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(is_call_point)
+    const char * const name = ins->opname;
+
+    if (ins->type & (ITPCCSUB | ITPCCYIELD))
+        return 1;
+
+    if (!name)
+        return 0;
+
+    return strncmp(name, "invoke", 6)      == 0
+        || strncmp(name, "callmethod", 10) == 0
+        || STREQ(name, "yield")
+        || STREQ(name, "throw")
+        || STREQ(name, "rethrow")
+        || STREQ(name, "die");
+}
+
+/*
+
+=item C<static int live_range_cmp(const void *a, const void *b)>
+
+Sorts live ranges by start, then by end.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+live_range_cmp(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(live_range_cmp)
+    const live_range_t * const ra = (const live_range_t *)a;
+    const live_range_t * const rb = (const live_range_t *)b;
+
+    if (ra->start != rb->start)
+        return ra->start < rb->start ? -1 : 1;
+
+    if (ra->end != rb->end)
+        return ra->end < rb->end ? -1 : 1;
+
+    return ra->r->color < rb->r->color ? -1 : ra->r->color > rb->r->color;
+}
+
+/*
+
+=item C<static void compute_live_ranges(imc_info_t * imcc, IMC_Unit *unit,
+live_range_t *ranges)>
+
+Computes the live range of every register in the register list of C<unit>
+into C<ranges>, indexed like the register list. Each register's color holds
+its index meanwhile.
+
+A range spans all instructions that use the register, plus the blocks it
+is live into or out of according to C<compute_liveness>. A range
+that spans a call is kept alive up to the end of the unit, because a
+continuation taken inside the call can return there again at any later
+time. Lexicals are reachable through the LexPad and live in the whole
+unit.
+
+=cut
+
+*/
+
+static void
+compute_live_ranges(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit),
+        ARGOUT(live_range_t *ranges))
+{
+    ASSERT_ARGS(compute_live_ranges)
+    const unsigned int n_symbols = unit->n_symbols;
+    const unsigned int n_blocks  = unit->n_basic_blocks;
+    Set        **live_in  = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    Set        **live_out = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    int         *calls;
+    Reg_refs     refs;
+    Instruction *ins;
+    unsigned int i, b, n_calls;
+    int          last;
+
+    refs.regs   = NULL;
+    refs.writes = NULL;
+    refs.n      = 0;
+    refs.size   = 0;
+
+    for (i = 0; i < n_symbols; i++) {
+        ranges[i].start = -1;
+        ranges[i].end   = -1;
+        ranges[i].r     = unit->reglist[i];
+    }
+
+    for (last = 0, ins = unit->instructions; ins; ins = ins->next)
+        ins->index = last++;
+
+    last--;
+    calls   = mem_gc_allocate_n_zeroed_typed(imcc->interp, last + 1, int);
+    n_calls = 0;
+
+    /* the hull of all uses */
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        const int    pos = (int)ins->index;
+        unsigned int j;
+
+        if (is_call_point(ins))
+            calls[n_calls++] = pos;
+
+        ins_reg_refs(imcc, ins, &refs);
+
+        for (j = 0; j < refs.n; j++) {
+            const int k = refs.regs[j]->color;
+
+            if (k >= 0) {
+                live_range_t * const range = &ranges[k];
+
+                if (range->start < 0 || range->start > pos)
+                    range->start = pos;
+                if (range->end < pos)
+                    range->end = pos;
+            }
+        }
+    }
+
+    free_reg_refs(&refs);
+    compute_liveness(imcc, unit, n_symbols, live_in, live_out);
+
+    /* widen the ranges to the blocks they are live through */
+    for (b = 0; b < n_blocks; b++) {
+        const Basic_block * const bb = unit->bb_list[b];
+        const int first = (int)bb->start->index;
+        const int end   = (int)bb->end->index;
+
+        for (i = 0; i < n_symbols; i++) {
+            live_range_t * const range = &ranges[i];
+
+            if (set_contains(live_in[b], i)) {
+                if (range->start < 0 || range->start > first)
+                    range->start = first;
+                if (range->end < first)
+                    range->end = first;
+            }
+
+            if (set_contains(live_out[b], i)) {
+                if (range->start < 0 || range->start > end)
+                    range->start = end;
+                if (range->end < end)
+                    range->end = end;
+            }
+        }
+
+        set_free(live_in[b]);
+        set_free(live_out[b]);
+    }
+
+    for (i = 0; i < n_symbols; i++) {
+        live_range_t * const range = &ranges[i];
+
+        if (range->start < 0 || (range->r->usage & U_LEXICAL)) {
+            range->start = 0;
+            range->end   = last;
+        }
+        else if (n_calls) {
+            /* find the first call after the start */
+            unsigned int lo = 0, hi = n_calls;
+
+            while (lo < hi) {
+                const unsigned int mid = (lo + hi) / 2;
+                if (calls[mid] <= range->start)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+
+            if (lo < n_calls && calls[lo] < range->end)
+                range->end = last;
+        }
+    }
+
+    mem_sys_free(live_in);
+    mem_sys_free(live_out);
+    mem_sys_free(calls);
+}
+
+/*
+
+=item C<static void linear_scan_reg_alloc(imc_info_t * imcc, IMC_Unit *unit)>
+
+Linear scan register allocator. Sorts the live ranges of each register set
+by their start and gives each the lowest Parrot register that is free
+again, i.e. whose previous range ended before this one starts. Falls back
+to C<vanilla_reg_alloc> for units whose live ranges can't be computed.
+
+=cut
+
+*/
+
+static void
+linear_scan_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(linear_scan_reg_alloc)
+    const char          type[] = "INSP";
+    const unsigned int  n_symbols = unit->n_symbols;
+    SymHash            *hsh = &unit->hash;
+    const char         *obstacle;
+    live_range_t       *ranges, *set_ranges;
+    int                *busy_until;
+    unsigned int        i, j;
+
+    if (!n_symbols || !unit->n_basic_blocks)
+        obstacle = "no registers";
+    else if ((double)n_symbols * unit->n_basic_blocks > LIVE_SETS_MAX)
+        obstacle = "too many symbols";
+    else
+        obstacle = hidden_control_flow(imcc, unit);
+
+    if (obstacle) {
+        IMCC_debug(imcc, DEBUG_IMC, "vanilla register allocation: %s\n",
+                obstacle);
+        vanilla_reg_alloc(imcc, unit);
+        return;
+    }
+
+    /* colors are the index into the register list during the analysis */
+    for (i = 0; i < hsh->size; i++) {
+        SymReg *r;
+        for (r = hsh->data[i]; r; r = r->next)
+            if (REG_NEEDS_ALLOC(r))
+                r->color = -1;
+    }
+
+    for (i = 0; i < n_symbols; i++) {
+        SymReg * const r = unit->reglist[i];
+        if (r->set && strchr(type, r->set))
+            r->color = i;
+    }
+
+    ranges = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_symbols, live_range_t);
+    compute_live_ranges(imcc, unit, ranges);
+
+    set_ranges = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_symbols, live_range_t);
+    busy_until = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_symbols, int);
+
+    for (j = 0; j < 4; j++) {
+        unsigned int n = 0, k;
+        int          n_colors = 0;
+
+        for (i = 0; i < n_symbols; i++)
+            if (ranges[i].r->set == type[j])
+                set_ranges[n++] = ranges[i];
+
+        qsort(set_ranges, n, sizeof (live_range_t), live_range_cmp);
+
+        for (k = 0; k < n; k++) {
+            const live_range_t * const range = &set_ranges[k];
+            int c;
+
+            for (c = 0; c < n_colors; c++)
+                if (busy_until[c] < range->start)
+                    break;
+
+            if (c == n_colors)
+                n_colors++;
+
+            busy_until[c] = range->end;
+            range->r->color = c;
+
+            IMCC_debug(imcc, DEBUG_IMC, "color %c '%s' %d-%d -> %d\n",
+                    range->r->set, range->r->name, range->start, range->end, c);
+        }
+
+        unit->first_avail[j]     = n_colors;
+        unit->ostat.shared_regs += n - n_colors;
+    }
+
+    /* registers not in use anymore still get one of their own */
+    for (i = 0; i < hsh->size; i++) {
+        SymReg *r;
+        for (r = hsh->data[i]; r; r = r->next) {
+            const char * const set = r->set ? strchr(type, r->set) : NULL;
+
+            if (set && REG_NEEDS_ALLOC(r) && r->color == -1)
+                r->color = unit->first_avail[set - type]++;
+        }
+    }
+
+    mem_sys_free(busy_until);
+    mem_sys_free(set_ranges);
+    mem_sys_free(ranges);
+}
+
+/*
+
 =item C<static void allocate_lexicals(imc_info_t * imcc, IMC_Unit *unit)>
 
 Allocate registers for lexical variables. These must have unique registers
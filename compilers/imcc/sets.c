@@ -206,6 +206,26 @@ set_add(ARGMOD(Set *s), unsigned int element)
 }
 
 
+/*
+
+=item C<void set_remove(Set *s, unsigned int element)>
+
+Removes from set C<s> the element C<element>, if it is in it.
+
+=cut
+
+*/
+
+void
+set_remove(ARGMOD(Set *s), unsigned int element)
+{
+    ASSERT_ARGS(set_remove)
+
+    if (element < s->length)
+        s->bmp[BYTE_IN_SET(element)] &= (unsigned char)~BIT_IN_BYTE(element);
+}
+
+
 /*
 
 =item C<unsigned int set_first_zero(const Set *s)>
@@ -296,7 +316,7 @@ set_union(ARGMOD(imc_info_t * imcc), ARGIN(const Set *s1), ARGIN(const Set *s2))
 
     PARROT_ASSERT(s1->length == s2->length);
 
-    for (i = 0; i < BYTE_IN_SET(s1->length); i++) {
+    for (i = 0; i < NUM_BYTES(s1->length); i++) {
         s->bmp[i] = s1->bmp[i] | s2->bmp[i];
     }
 
@@ -327,7 +347,7 @@ set_intersec(ARGMOD(imc_info_t * imcc), ARGIN(const Set *s1),
 
     PARROT_ASSERT(s1->length == s2->length);
 
-    for (i = 0; i < BYTE_IN_SET(s1->length); i++) {
+    for (i = 0; i < NUM_BYTES(s1->length); i++) {
         s->bmp[i] = s1->bmp[i] & s2->bmp[i];
     }
 
@@ -354,7 +374,7 @@ set_intersec_inplace(ARGMOD(Set *s1), ARGIN(const Set *s2))
 
     PARROT_ASSERT(s1->length == s2->length);
 
-    for (i = 0; i < BYTE_IN_SET(s1->length); i++) {
+    for (i = 0; i < NUM_BYTES(s1->length); i++) {
         s1->bmp[i] &= s2->bmp[i];
     }
 }
@@ -75,6 +75,10 @@ Set* set_make_full(ARGMOD(imc_info_t * imcc), unsigned int length)
         __attribute__nonnull__(1)
         FUNC_MODIFIES(* imcc);
 
+void set_remove(ARGMOD(Set *s), unsigned int element)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*s);
+
 PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
 Set * set_union(
@@ -113,6 +117,8 @@ Set * set_union(
        PARROT_ASSERT_ARG(imcc))
 #define ASSERT_ARGS_set_make_full __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc))
+#define ASSERT_ARGS_set_remove __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_set_union __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(s1) \
@@ -0,0 +1,1615 @@
+/*
+ * Copyright (C) 2016, Parrot Foundation.
+ */
+
+/*
+
+=head1 NAME
+
+compilers/imcc/ssa.c
+
+=head1 DESCRIPTION
+
+The optimizations of C<-O3>. They run from C<optimize> once the C<-O2> ones
+find nothing more to do, with the CFG, dominators, dominance frontiers and
+loops of the unit built, and do one of these per call:
+
+=over 4
+
+=item copy propagation and global value numbering
+
+Every write to a register gets a value number, and phis at the iterated
+dominance frontiers of its writes give it a new one wherever different
+writes merge; registers are numbered by walking the dominator tree, so the
+code never has to be rewritten into SSA form and back. A register read
+after C<set x, y> is replaced by C<y> if C<y> still holds the same value,
+and a pure operation whose operands hold the same values as one that
+dominates it becomes a copy of that result; if the register it went to
+was overwritten since, the first operation writes a new temporary first.
+
+=item dead store elimination
+
+Pure operations and copies are deleted if their result is not live, by the
+liveness of C<compute_liveness> rather than the use count of C<used_once>;
+copies of a register to itself are deleted too.
+
+=item loop-invariant code motion
+
+Pure operations whose operands aren't written in a loop move to its
+preheader, if their result is written nowhere else in the loop and not
+needed from before it.
+
+=back
+
+Units with control flow the CFG doesn't show are left alone, see
+C<hidden_control_flow>. A call may return more than once, if the callee
+takes a continuation and invokes it later; so after a call, registers
+written anywhere reachable from it are taken to hold unknown values, and
+registers live after a call are never dead. This isn't done for vtable
+methods that PIR classes override, which the C<-O2> optimizations don't
+expect to return twice either.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "imc.h"
+#include "optimizer.h"
+#include "parrot/oplib/core_ops.h"
+
+/* Upper limit of registers times basic blocks for the sets of C<ssa_walk>;
+ * bigger units are not optimized. */
+#define SSA_SETS_MAX (1 << 24)
+
+/* what C<ssa_op_kind> allows to do with an instruction */
+#define SSA_NUMBER 0x01     /* value numbering */
+#define SSA_DEAD   0x02     /* deleting it if its result is dead */
+#define SSA_HOIST  0x04     /* executing it where it wasn't before */
+
+/* A value of a register: the one it has on entry to the unit, the result
+ * of an instruction or the merge of others at a phi. */
+typedef struct ssa_value_t {
+    int copy_var;       /* for copies, the register copied, else -1 */
+    int copy_val;       /* and the value it had */
+} ssa_value_t;
+
+/* The result of a pure operation, available in the blocks its instruction
+ * dominates. Each operand is a constant or the value of a register. */
+typedef struct ssa_expr_t {
+    const op_info_t *op;
+    const SymReg    *consts[2];
+    int              vals[2];
+    int              var;       /* the register holding the result */
+    int              val;       /* and its value */
+    Instruction     *ins;       /* the instruction computing it */
+    Basic_block     *bb;        /* and its block */
+    SymReg          *temp;      /* a register keeping it, once needed */
+    int              next;      /* next in the bucket */
+    unsigned int     bucket;
+} ssa_expr_t;
+
+typedef struct ssa_info_t {
+    imc_info_t   *imcc;
+    IMC_Unit     *unit;
+    unsigned int  n_vars;       /* the register list; colors are indices */
+    int          *cur;          /* the current value of each register */
+    ssa_value_t  *values;
+    unsigned int  n_values;
+    unsigned int  values_size;
+    int          *undo;         /* register and old value, per change */
+    unsigned int  n_undo;
+    unsigned int  undo_size;
+    ssa_expr_t   *exprs;
+    unsigned int  n_exprs;
+    unsigned int  exprs_size;
+    int          *buckets;
+    unsigned int  n_buckets;
+    int           changed;
+} ssa_info_t;
+
+/* HEADERIZER HFILE: compilers/imcc/optimizer.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_WARN_UNUSED_RESULT
+static int copy_source(ARGIN(const ssa_info_t *info), int var)
+        __attribute__nonnull__(1);
+
+static int dead_stores(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
+static void ins_var_writes(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Instruction *ins),
+    ARGOUT(int *vars),
+    ARGOUT(int *n))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*vars)
+        FUNC_MODIFIES(*n);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int is_call(ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+static int is_copy(ARGMOD(imc_info_t *imcc), ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+static int is_pcc_ins(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_CANNOT_RETURN_NULL
+static SymReg * keep_value(
+    ARGMOD(ssa_info_t *info),
+    ARGMOD(ssa_expr_t *expr))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*info)
+        FUNC_MODIFIES(*expr);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Set ** later_writes(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    unsigned int n_vars)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
+static void live_before(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Instruction *ins),
+    ARGMOD(Set *live),
+    ARGMOD(Reg_refs *refs))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*live)
+        FUNC_MODIFIES(*refs);
+
+static int loop_invariants(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(Set **later))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
+static int new_value(
+    ARGMOD(ssa_info_t *info),
+    int var,
+    int copy_var,
+    int copy_val)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*info);
+
+PARROT_WARN_UNUSED_RESULT
+static int number_value(
+    ARGMOD(ssa_info_t *info),
+    ARGIN(const Instruction *ins),
+    ARGOUT(ssa_expr_t *expr))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*info)
+        FUNC_MODIFIES(*expr);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Set ** place_phis(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    unsigned int n_vars,
+    ARGIN(Set **later))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
+static void propagate_copies(
+    ARGMOD(ssa_info_t *info),
+    ARGMOD(Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*info)
+        FUNC_MODIFIES(*ins);
+
+PARROT_CANNOT_RETURN_NULL
+static Instruction * ssa_instruction(
+    ARGMOD(ssa_info_t *info),
+    ARGMOD(Basic_block *bb),
+    ARGMOD(Instruction *ins),
+    ARGMOD(int *writes))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*info)
+        FUNC_MODIFIES(*bb)
+        FUNC_MODIFIES(*ins)
+        FUNC_MODIFIES(*writes);
+
+PARROT_WARN_UNUSED_RESULT
+static int ssa_op_kind(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int ssa_var(ARGIN(const IMC_Unit *unit), ARGIN(const SymReg *r))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static int ssa_walk(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(Set **later))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
+#define ASSERT_ARGS_copy_source __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_dead_stores __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_ins_var_writes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(vars) \
+    , PARROT_ASSERT_ARG(n))
+#define ASSERT_ARGS_is_call __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_is_copy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_is_pcc_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_keep_value __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(expr))
+#define ASSERT_ARGS_later_writes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_live_before __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(live) \
+    , PARROT_ASSERT_ARG(refs))
+#define ASSERT_ARGS_loop_invariants __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(later))
+#define ASSERT_ARGS_new_value __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_number_value __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(expr))
+#define ASSERT_ARGS_place_phis __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(later))
+#define ASSERT_ARGS_propagate_copies __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_ssa_instruction __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(info) \
+    , PARROT_ASSERT_ARG(bb) \
+    , PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(writes))
+#define ASSERT_ARGS_ssa_op_kind __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_ssa_var __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(r))
+#define ASSERT_ARGS_ssa_walk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(later))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static int ssa_var(const IMC_Unit *unit, const SymReg *r)>
+
+Returns the index of C<r> in the register list of C<unit>, or -1 if it is
+not a register the optimizations know about. Lexicals are among the latter:
+they are changed through the LexPad, too.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+ssa_var(ARGIN(const IMC_Unit *unit), ARGIN(const SymReg *r))
+{
+    ASSERT_ARGS(ssa_var)
+
+    if (!REG_NEEDS_ALLOC(r) || r->color < 0
+    ||  (unsigned int)r->color >= unit->n_symbols
+    ||  unit->reglist[r->color] != r)
+        return -1;
+
+    return r->color;
+}
+
+/*
+
+=item C<static int is_pcc_ins(imc_info_t *imcc, const Instruction *ins)>
+
+Returns whether C<ins> passes arguments or results, or is a sub call.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_pcc_ins(ARGMOD(imc_info_t *imcc), ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(is_pcc_ins)
+    const op_info_t * const ops = PARROT_GET_CORE_OPLIB(imcc->interp)->op_info_table;
+
+    return ins->op == &ops[PARROT_OP_set_args_pc]
+        || ins->op == &ops[PARROT_OP_set_returns_pc]
+        || ins->op == &ops[PARROT_OP_get_params_pc]
+        || ins->op == &ops[PARROT_OP_get_results_pc]
+        || (ins->type & (ITPCCSUB | ITPCCYIELD));
+}
+
+/*
+
+=item C<static int is_call(const Instruction *ins)>
+
+Returns whether C<ins> calls a sub, which may return more than once.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+is_call(ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(is_call)
+    const char * const name = ins->opname;
+
+    return (ins->type & (ITPCCSUB | ITPCCYIELD))
+        || (name && (strncmp(name, "invoke", 6) == 0
+                 ||  strncmp(name, "callmethod", 10) == 0
+                 ||  strncmp(name, "tailcall", 8) == 0
+                 ||  strncmp(name, "yield", 5) == 0));
+}
+
+/*
+
+=item C<static int is_copy(imc_info_t *imcc, const Instruction *ins)>
+
+Returns whether C<ins> copies a register to another one of the same kind.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_copy(ARGMOD(imc_info_t *imcc), ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(is_copy)
+    const op_info_t * const ops = PARROT_GET_CORE_OPLIB(imcc->interp)->op_info_table;
+
+    return ins->op == &ops[PARROT_OP_set_i_i]
+        || ins->op == &ops[PARROT_OP_set_n_n]
+        || ins->op == &ops[PARROT_OP_set_s_s]
+        || ins->op == &ops[PARROT_OP_set_p_p];
+}
+
+/*
+
+=item C<static int ssa_op_kind(imc_info_t *imcc, const Instruction *ins)>
+
+Returns what may be done with C<ins>, as C<SSA_*> flags. It must write its
+first operand, a register, and only read the others, which aren't keys.
+Only operations on integers, numbers and strings qualify, which don't
+throw and have no effect but their result; of the PMC ones, only copies.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+ssa_op_kind(ARGMOD(imc_info_t *imcc), ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(ssa_op_kind)
+    PARROT_OBSERVER static const char * const pure_ops[] = {
+        "add", "sub", "mul", "neg", "abs",
+        "band", "bor", "bxor", "bnot", "shl", "shr",
+        "not", "and", "or", "xor",
+        "iseq", "isne", "islt", "isle", "isgt", "isge", "cmp",
+        "length", "concat"
+    };
+    const char *name = ins->opname;
+    size_t      i;
+    int         j;
+
+    if (!ins->op || !name || ins->keys || is_pcc_ins(imcc, ins)
+    ||  ins->symreg_count < 2 || ins->symreg_count > 3
+    ||  !REG_NEEDS_ALLOC(ins->symregs[0])
+    ||  (ins->flags & 1) || !(ins->flags & (1 << 16)))
+        return 0;
+
+    if (is_copy(imcc, ins))
+        return ins->symregs[0]->set == 'P' ? SSA_DEAD : SSA_DEAD | SSA_HOIST;
+
+    for (j = 0; j < ins->symreg_count; j++) {
+        const SymReg * const r = ins->symregs[j];
+
+        if (r->set == 'P' || r->set == 'K' || r->type & VTADDRESS)
+            return 0;
+
+        if (j && (!(ins->flags & (1 << j)) || (ins->flags & (1 << (16 + j)))))
+            return 0;
+    }
+
+    if (STREQ(name, "set"))
+        return SSA_DEAD | SSA_HOIST;
+
+    for (i = 0; i < N_ELEMENTS(pure_ops); i++) {
+        if (STREQ(name, pure_ops[i]))
+            /* concat allocates, and may fail on mismatched encodings */
+            return STREQ(name, "concat")
+                ? SSA_NUMBER | SSA_DEAD
+                : SSA_NUMBER | SSA_DEAD | SSA_HOIST;
+    }
+
+    return 0;
+}
+
+/*
+
+=item C<static void ins_var_writes(imc_info_t *imcc, const IMC_Unit *unit, const
+Instruction *ins, int *vars, int *n)>
+
+Stores the registers C<ins> writes into C<vars> and their number in C<n>.
+C<vars> needs room for one entry per operand.
+
+=cut
+
+*/
+
+static void
+ins_var_writes(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit *unit),
+        ARGIN(const Instruction *ins), ARGOUT(int *vars), ARGOUT(int *n))
+{
+    ASSERT_ARGS(ins_var_writes)
+    const op_info_t * const ops = PARROT_GET_CORE_OPLIB(imcc->interp)->op_info_table;
+    const int all = ins->op == &ops[PARROT_OP_get_params_pc]
+                 || ins->op == &ops[PARROT_OP_get_results_pc];
+    int i;
+
+    *n = 0;
+
+    for (i = 0; i < ins->symreg_count; i++) {
+        if (all || (i < 16 && (ins->flags & (1 << (16 + i))))) {
+            const int v = ssa_var(unit, ins->symregs[i]);
+
+            if (v >= 0)
+                vars[(*n)++] = v;
+        }
+    }
+}
+
+/*
+
+=item C<static int new_value(ssa_info_t *info, int var, int copy_var, int
+copy_val)>
+
+Makes a new value of register C<var> its current one, recording that it is
+a copy of value C<copy_val> of C<copy_var> if that isn't -1, and returns it.
+
+=cut
+
+*/
+
+static int
+new_value(ARGMOD(ssa_info_t *info), int var, int copy_var, int copy_val)
+{
+    ASSERT_ARGS(new_value)
+    imc_info_t * const imcc = info->imcc;
+
+    if (info->n_values == info->values_size) {
+        info->values_size *= 2;
+        info->values = mem_gc_realloc_n_typed(imcc->interp, info->values,
+                            info->values_size, ssa_value_t);
+    }
+
+    info->values[info->n_values].copy_var = copy_var;
+    info->values[info->n_values].copy_val = copy_val;
+
+    if (info->n_undo + 2 > info->undo_size) {
+        info->undo_size *= 2;
+        info->undo = mem_gc_realloc_n_typed(imcc->interp, info->undo,
+                            info->undo_size, int);
+    }
+
+    info->undo[info->n_undo++] = var;
+    info->undo[info->n_undo++] = info->cur[var];
+    info->cur[var]             = info->n_values;
+
+    return info->n_values++;
+}
+
+/*
+
+=item C<static int copy_source(const ssa_info_t *info, int var)>
+
+Returns the register that first held the current value of C<var> and still
+does, following copies.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+copy_source(ARGIN(const ssa_info_t *info), int var)
+{
+    ASSERT_ARGS(copy_source)
+    int val = info->cur[var];
+
+    while (info->values[val].copy_var >= 0
+    &&     info->cur[info->values[val].copy_var] == info->values[val].copy_val) {
+        var = info->values[val].copy_var;
+        val = info->values[val].copy_val;
+    }
+
+    return var;
+}
+
+/*
+
+=item C<static void propagate_copies(ssa_info_t *info, Instruction *ins)>
+
+Replaces the registers C<ins> only reads by the registers they were copied
+from, as long as those still hold the same value.
+
+=cut
+
+*/
+
+static void
+propagate_copies(ARGMOD(ssa_info_t *info), ARGMOD(Instruction *ins))
+{
+    ASSERT_ARGS(propagate_copies)
+    IMC_Unit * const unit = info->unit;
+    int i;
+
+    if (is_pcc_ins(info->imcc, ins))
+        return;
+
+    for (i = 0; i < ins->symreg_count && i < 16; i++) {
+        const int var = ssa_var(unit, ins->symregs[i]);
+        int       src;
+
+        if (var < 0 || !(ins->flags & (1 << i)) || (ins->flags & (1 << (16 + i))))
+            continue;
+
+        src = copy_source(info, var);
+
+        if (src != var) {
+            IMCC_debug(info->imcc, DEBUG_OPT2, "copy %s => %s in ",
+                    unit->reglist[var]->name, unit->reglist[src]->name);
+            IMCC_debug_ins(info->imcc, DEBUG_OPT2, ins);
+
+            ins->symregs[i] = unit->reglist[src];
+            unit->ostat.copies_propagated++;
+            info->changed = 1;
+        }
+    }
+}
+
+/*
+
+=item C<static int number_value(ssa_info_t *info, const Instruction *ins,
+ssa_expr_t *expr)>
+
+Fills C<expr> with the operation of C<ins> and the values of its operands,
+and returns the index of an available expression with the same ones, or -1.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+number_value(ARGMOD(ssa_info_t *info), ARGIN(const Instruction *ins),
+        ARGOUT(ssa_expr_t *expr))
+{
+    ASSERT_ARGS(number_value)
+    size_t hash = (size_t)ins->op;
+    int    i, e;
+
+    expr->op = ins->op;
+
+    for (i = 0; i < 2; i++) {
+        const SymReg * const r = i + 1 < ins->symreg_count ? ins->symregs[i + 1] : NULL;
+
+        expr->consts[i] = NULL;
+        expr->vals[i]   = -1;
+
+        if (r && REG_NEEDS_ALLOC(r)) {
+            const int var = ssa_var(info->unit, r);
+
+            if (var < 0)
+                return -2;
+
+            expr->vals[i] = info->cur[var];
+            hash          = hash * 31 + (size_t)expr->vals[i];
+        }
+        else if (r) {
+            expr->consts[i] = r;
+            hash            = hash * 31 + (size_t)r;
+        }
+    }
+
+    expr->bucket = (unsigned int)(hash ^ (hash >> 16)) & (info->n_buckets - 1);
+
+    for (e = info->buckets[expr->bucket]; e >= 0; e = info->exprs[e].next) {
+        const ssa_expr_t * const other = &info->exprs[e];
+
+        if (other->op        == expr->op
+        &&  other->consts[0] == expr->consts[0]
+        &&  other->consts[1] == expr->consts[1]
+        &&  other->vals[0]   == expr->vals[0]
+        &&  other->vals[1]   == expr->vals[1])
+            return e;
+    }
+
+    return -1;
+}
+
+/*
+
+=item C<static SymReg * keep_value(ssa_info_t *info, ssa_expr_t *expr)>
+
+Returns a register that holds the result of C<expr> wherever it is
+available. If the register it was computed into may have changed since,
+the instruction computing it writes a new temporary instead, and copies
+that to the old register.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static SymReg *
+keep_value(ARGMOD(ssa_info_t *info), ARGMOD(ssa_expr_t *expr))
+{
+    ASSERT_ARGS(keep_value)
+    imc_info_t * const imcc = info->imcc;
+    IMC_Unit   * const unit = info->unit;
+    Instruction *ins, *copy;
+    SymReg      *regs[2];
+
+    if (info->cur[expr->var] == expr->val)
+        return unit->reglist[expr->var];
+
+    if (expr->temp)
+        return expr->temp;
+
+    ins        = expr->ins;
+    expr->temp = mk_temp_reg(imcc, ins->symregs[0]->set);
+    regs[0]    = ins->symregs[0];
+    regs[1]    = expr->temp;
+    copy       = INS(imcc, unit, "set", "", regs, 2, 0, 0);
+
+    IMCC_debug(imcc, DEBUG_OPT2, "value kept in %s from ", expr->temp->name);
+    IMCC_debug_ins(imcc, DEBUG_OPT2, ins);
+
+    ins->symregs[0] = expr->temp;
+    insert_ins(unit, ins, copy);
+
+    if (expr->bb->end == ins)
+        expr->bb->end = copy;
+
+    return expr->temp;
+}
+
+/*
+
+=item C<static Instruction * ssa_instruction(ssa_info_t *info, Basic_block *bb,
+Instruction *ins, int *writes)>
+
+Propagates copies into C<ins>, replaces it by a copy if it computes an
+available value, see C<keep_value>, and numbers the registers it writes. Returns the
+instruction in its place. C<writes> is scratch space for
+C<ins_var_writes>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Instruction *
+ssa_instruction(ARGMOD(ssa_info_t *info), ARGMOD(Basic_block *bb),
+        ARGMOD(Instruction *ins), ARGMOD(int *writes))
+{
+    ASSERT_ARGS(ssa_instruction)
+    imc_info_t * const imcc = info->imcc;
+    IMC_Unit   * const unit = info->unit;
+    ssa_expr_t   expr;
+    int          i, n, e = -2;
+
+    if (!ins->op)
+        return ins;
+
+    propagate_copies(info, ins);
+
+    if (ssa_op_kind(imcc, ins) & SSA_NUMBER) {
+        e = number_value(info, ins, &expr);
+
+        if (e >= 0) {
+            SymReg      *regs[2];
+            Instruction *tmp;
+
+            regs[0] = ins->symregs[0];
+            regs[1] = keep_value(info, &info->exprs[e]);
+            tmp     = INS(imcc, unit, "set", "", regs, 2, 0, 0);
+
+            IMCC_debug(imcc, DEBUG_OPT2, "value numbering ");
+            IMCC_debug_ins(imcc, DEBUG_OPT2, ins);
+            IMCC_debug(imcc, DEBUG_OPT2, "  => ");
+            IMCC_debug_ins(imcc, DEBUG_OPT2, tmp);
+
+            if (bb->start == ins)
+                bb->start = tmp;
+            if (bb->end == ins)
+                bb->end = tmp;
+
+            subst_ins(unit, ins, tmp, 1);
+            ins = tmp;
+            e   = -2;
+            unit->ostat.values_numbered++;
+            info->changed = 1;
+        }
+    }
+
+    if (is_copy(imcc, ins)) {
+        const int dest = ssa_var(unit, ins->symregs[0]);
+        const int src  = ssa_var(unit, ins->symregs[1]);
+
+        if (dest >= 0) {
+            if (src >= 0)
+                new_value(info, dest, src, info->cur[src]);
+            else
+                new_value(info, dest, -1, -1);
+        }
+
+        return ins;
+    }
+
+    ins_var_writes(imcc, unit, ins, writes, &n);
+
+    for (i = 0; i < n; i++)
+        new_value(info, writes[i], -1, -1);
+
+    /* make the result available to the blocks dominated by this one */
+    if (e == -1 && n == 1) {
+        if (info->n_exprs == info->exprs_size) {
+            info->exprs_size *= 2;
+            info->exprs = mem_gc_realloc_n_typed(imcc->interp, info->exprs,
+                                info->exprs_size, ssa_expr_t);
+        }
+
+        expr.var  = writes[0];
+        expr.val  = info->cur[writes[0]];
+        expr.ins  = ins;
+        expr.bb   = bb;
+        expr.temp = NULL;
+        expr.next = info->buckets[expr.bucket];
+
+        info->exprs[info->n_exprs]   = expr;
+        info->buckets[expr.bucket]   = info->n_exprs++;
+    }
+
+    return ins;
+}
+
+/*
+
+=item C<static Set ** later_writes(imc_info_t *imcc, IMC_Unit *unit, unsigned
+int n_vars)>
+
+Returns for each block the set of registers written in it or in a block
+reachable from it. When a call in the block returns again, these may hold
+other values than the first time.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Set **
+later_writes(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), unsigned int n_vars)
+{
+    ASSERT_ARGS(later_writes)
+    const unsigned int n_blocks = unit->n_basic_blocks;
+    const unsigned int n_bytes  = (n_vars + 7) / 8;
+    Set        **later  = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    int         *writes = NULL;
+    int          writes_size = 0;
+    unsigned int b, i;
+    int          changed;
+
+    for (b = 0; b < n_blocks; b++) {
+        const Basic_block * const bb = unit->bb_list[b];
+        const Instruction *ins;
+
+        later[b] = set_make(imcc, n_vars);
+
+        for (ins = bb->start; ins; ins = ins->next) {
+            int j, n;
+
+            if (ins->symreg_count > writes_size) {
+                writes_size = ins->symreg_count;
+                writes      = mem_gc_realloc_n_typed(imcc->interp, writes,
+                                    writes_size, int);
+            }
+
+            if (ins->op) {
+                ins_var_writes(imcc, unit, ins, writes, &n);
+
+                for (j = 0; j < n; j++)
+                    set_add(later[b], writes[j]);
+            }
+
+            if (ins == bb->end)
+                break;
+        }
+    }
+
+    do {
+        changed = 0;
+
+        for (b = n_blocks; b-- > 0;) {
+            const Edge *e;
+            unsigned char * const bmp = later[b]->bmp;
+
+            for (e = unit->bb_list[b]->succ_list; e; e = e->succ_next) {
+                const unsigned char * const succ = later[e->to->index]->bmp;
+
+                for (i = 0; i < n_bytes; i++) {
+                    if (succ[i] & ~bmp[i]) {
+                        bmp[i] |= succ[i];
+                        changed = 1;
+                    }
+                }
+            }
+        }
+    } while (changed);
+
+    if (writes)
+        mem_sys_free(writes);
+
+    return later;
+}
+
+/*
+
+=item C<static Set ** place_phis(imc_info_t *imcc, IMC_Unit *unit, unsigned int
+n_vars, Set **later)>
+
+Returns for each block the set of registers that need a phi at its start:
+those written in a block of whose iterated dominance frontier it is part.
+A call counts as writing the registers of C<later> of its block.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Set **
+place_phis(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), unsigned int n_vars,
+        ARGIN(Set **later))
+{
+    ASSERT_ARGS(place_phis)
+    const unsigned int n_blocks = unit->n_basic_blocks;
+    Set        **phis     = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    Set        **def_bbs  = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_vars, Set *);
+    int         *work     = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, int);
+    int         *writes   = NULL;
+    int          writes_size = 0;
+    unsigned int b, v;
+
+    for (v = 0; v < n_vars; v++)
+        def_bbs[v] = set_make(imcc, n_blocks);
+
+    for (b = 0; b < n_blocks; b++) {
+        const Basic_block * const bb = unit->bb_list[b];
+        const Instruction *ins;
+
+        phis[b] = set_make(imcc, n_vars);
+
+        for (ins = bb->start; ins; ins = ins->next) {
+            int i, n;
+
+            if (ins->symreg_count > writes_size) {
+                writes_size = ins->symreg_count;
+                writes      = mem_gc_realloc_n_typed(imcc->interp, writes,
+                                    writes_size, int);
+            }
+
+            if (ins->op) {
+                ins_var_writes(imcc, unit, ins, writes, &n);
+
+                for (i = 0; i < n; i++)
+                    set_add(def_bbs[writes[i]], b);
+            }
+
+            if (is_call(ins))
+                for (v = 0; v < n_vars; v++)
+                    if (set_contains(later[b], v))
+                        set_add(def_bbs[v], b);
+
+            if (ins == bb->end)
+                break;
+        }
+    }
+
+    for (v = 0; v < n_vars; v++) {
+        Set * const defs = def_bbs[v];
+        int   n_work = 0;
+
+        for (b = 0; b < n_blocks; b++)
+            if (set_contains(defs, b))
+                work[n_work++] = b;
+
+        while (n_work) {
+            const Set * const frontier = unit->dominance_frontiers[work[--n_work]];
+
+            for (b = 0; b < n_blocks; b++) {
+                if (set_contains(frontier, b) && !set_contains(phis[b], v)) {
+                    set_add(phis[b], v);
+
+                    if (!set_contains(defs, b)) {
+                        set_add(defs, b);
+                        work[n_work++] = b;
+                    }
+                }
+            }
+        }
+
+        set_free(defs);
+    }
+
+    mem_sys_free(def_bbs);
+    mem_sys_free(work);
+
+    if (writes)
+        mem_sys_free(writes);
+
+    return phis;
+}
+
+/*
+
+=item C<static int ssa_walk(imc_info_t *imcc, IMC_Unit *unit, Set **later)>
+
+Numbers the values of all registers along the dominator tree, propagating
+copies and replacing operations whose value is available by copies. After
+a call, the registers of C<later> of its block get new values. Returns
+whether anything changed.
+
+=cut
+
+*/
+
+static int
+ssa_walk(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), ARGIN(Set **later))
+{
+    ASSERT_ARGS(ssa_walk)
+    const unsigned int n_blocks = unit->n_basic_blocks;
+    const unsigned int n_vars   = unit->n_symbols;
+    Set        **phis       = place_phis(imcc, unit, n_vars, later);
+    int         *children   = mem_gc_allocate_n_typed(imcc->interp, n_blocks, int);
+    int         *siblings   = mem_gc_allocate_n_typed(imcc->interp, n_blocks, int);
+    int         *stack      = mem_gc_allocate_n_typed(imcc->interp, 2 * n_blocks, int);
+    unsigned int *undo_marks = mem_gc_allocate_n_typed(imcc->interp, n_blocks, unsigned int);
+    unsigned int *expr_marks = mem_gc_allocate_n_typed(imcc->interp, n_blocks, unsigned int);
+    int         *writes     = NULL;
+    int          writes_size = 0;
+    ssa_info_t   info;
+    unsigned int b, v, n_ins;
+    int          sp;
+    Instruction *ins;
+
+    info.imcc        = imcc;
+    info.unit        = unit;
+    info.n_vars      = n_vars;
+    info.changed     = 0;
+    info.cur         = mem_gc_allocate_n_typed(imcc->interp, n_vars, int);
+    info.values_size = 2 * n_vars;
+    info.values      = mem_gc_allocate_n_typed(imcc->interp, info.values_size, ssa_value_t);
+    info.undo_size   = 64;
+    info.undo        = mem_gc_allocate_n_typed(imcc->interp, info.undo_size, int);
+    info.n_undo      = 0;
+    info.exprs_size  = 16;
+    info.exprs       = mem_gc_allocate_n_typed(imcc->interp, info.exprs_size, ssa_expr_t);
+    info.n_exprs     = 0;
+
+    /* each register starts with its value on entry to the unit */
+    for (v = 0; v < n_vars; v++) {
+        info.cur[v]             = v;
+        info.values[v].copy_var = -1;
+        info.values[v].copy_val = -1;
+    }
+
+    info.n_values = n_vars;
+
+    for (n_ins = 0, ins = unit->instructions; ins; ins = ins->next)
+        n_ins++;
+
+    for (info.n_buckets = 16; info.n_buckets < n_ins; info.n_buckets *= 2)
+        ;
+
+    info.buckets = mem_gc_allocate_n_typed(imcc->interp, info.n_buckets, int);
+
+    for (b = 0; b < info.n_buckets; b++)
+        info.buckets[b] = -1;
+
+    /* the dominator tree */
+    for (b = 0; b < n_blocks; b++)
+        children[b] = siblings[b] = -1;
+
+    for (b = n_blocks; --b > 0;) {
+        const int parent = unit->idoms[b];
+
+        siblings[b]      = children[parent];
+        children[parent] = b;
+    }
+
+    /* even entries are blocks to number, odd ones blocks to leave */
+    sp          = 0;
+    stack[sp++] = 0;
+
+    while (sp) {
+        const int   top = stack[--sp];
+        Basic_block *bb;
+        int          c;
+
+        b = top >> 1;
+
+        if (top & 1) {
+            while (info.n_undo > undo_marks[b]) {
+                info.n_undo -= 2;
+                info.cur[info.undo[info.n_undo]] = info.undo[info.n_undo + 1];
+            }
+
+            while (info.n_exprs > expr_marks[b]) {
+                const ssa_expr_t * const expr = &info.exprs[--info.n_exprs];
+                info.buckets[expr->bucket] = expr->next;
+            }
+
+            continue;
+        }
+
+        bb            = unit->bb_list[b];
+        undo_marks[b] = info.n_undo;
+        expr_marks[b] = info.n_exprs;
+
+        for (v = 0; v < n_vars; v++)
+            if (set_contains(phis[b], v))
+                new_value(&info, v, -1, -1);
+
+        for (ins = bb->start; ins; ins = ins->next) {
+            const int last = ins == bb->end;
+
+            if (ins->symreg_count > writes_size) {
+                writes_size = ins->symreg_count;
+                writes      = mem_gc_realloc_n_typed(imcc->interp, writes,
+                                    writes_size, int);
+            }
+
+            ins = ssa_instruction(&info, bb, ins, writes);
+
+            if (is_call(ins))
+                for (v = 0; v < n_vars; v++)
+                    if (set_contains(later[b], v))
+                        new_value(&info, v, -1, -1);
+
+            if (last)
+                break;
+        }
+
+        stack[sp++] = (int)(b << 1) | 1;
+
+        for (c = children[b]; c >= 0; c = siblings[c])
+            stack[sp++] = c << 1;
+    }
+
+    for (b = 0; b < n_blocks; b++)
+        set_free(phis[b]);
+
+    mem_sys_free(phis);
+    mem_sys_free(children);
+    mem_sys_free(siblings);
+    mem_sys_free(stack);
+    mem_sys_free(undo_marks);
+    mem_sys_free(expr_marks);
+    mem_sys_free(info.cur);
+    mem_sys_free(info.values);
+    mem_sys_free(info.undo);
+    mem_sys_free(info.exprs);
+    mem_sys_free(info.buckets);
+
+    if (writes)
+        mem_sys_free(writes);
+
+    return info.changed;
+}
+
+/*
+
+=item C<static void live_before(imc_info_t *imcc, const IMC_Unit *unit, const
+Instruction *ins, Set *live, Reg_refs *refs)>
+
+Turns C<live> from the registers live after C<ins> into those live before
+it. C<refs> is scratch space for C<ins_reg_refs>.
+
+=cut
+
+*/
+
+static void
+live_before(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit *unit),
+        ARGIN(const Instruction *ins), ARGMOD(Set *live), ARGMOD(Reg_refs *refs))
+{
+    ASSERT_ARGS(live_before)
+    unsigned int j;
+
+    ins_reg_refs(imcc, ins, refs);
+
+    for (j = 0; j < refs->n; j++) {
+        const int var = ssa_var(unit, refs->regs[j]);
+        if (var >= 0 && refs->writes[j])
+            set_remove(live, var);
+    }
+
+    for (j = 0; j < refs->n; j++) {
+        const int var = ssa_var(unit, refs->regs[j]);
+        if (var >= 0 && !refs->writes[j])
+            set_add(live, var);
+    }
+}
+
+/*
+
+=item C<static int dead_stores(imc_info_t *imcc, IMC_Unit *unit)>
+
+Deletes pure operations and copies whose result is not live after them,
+walking each block backwards from the registers live at its end. Registers
+live after a call are kept, as it may return again. Returns whether
+anything was deleted.
+
+=cut
+
+*/
+
+static int
+dead_stores(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(dead_stores)
+    const unsigned int n_blocks = unit->n_basic_blocks;
+    const unsigned int n_vars   = unit->n_symbols;
+    Set        **live_in  = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    Set        **live_out = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    Set         *reentered;
+    Reg_refs     refs;
+    unsigned int b, v;
+    int          changed = 0;
+
+    refs.regs   = NULL;
+    refs.writes = NULL;
+    refs.n      = 0;
+    refs.size   = 0;
+
+    compute_liveness(imcc, unit, n_vars, live_in, live_out);
+
+    /* the registers live after any call */
+    reentered = set_make(imcc, n_vars);
+
+    for (b = 0; b < n_blocks; b++) {
+        const Basic_block * const bb = unit->bb_list[b];
+        Set         * const live     = set_copy(imcc, live_out[b]);
+        const Instruction *ins;
+
+        for (ins = bb->end; ins; ins = ins->prev) {
+            if (is_call(ins))
+                for (v = 0; v < n_vars; v++)
+                    if (set_contains(live, v))
+                        set_add(reentered, v);
+
+            if (ins == bb->start)
+                break;
+
+            live_before(imcc, unit, ins, live, &refs);
+        }
+
+        set_free(live);
+    }
+
+    for (b = 0; b < n_blocks; b++) {
+        Basic_block * const bb   = unit->bb_list[b];
+        Set         * const live = live_out[b];
+        Instruction *ins, *prev;
+
+        for (ins = bb->end; ins; ins = prev) {
+            const int first = ins == bb->start;
+            const int kind  = ssa_op_kind(imcc, ins);
+            const int dest  = kind ? ssa_var(unit, ins->symregs[0]) : -1;
+
+            prev = ins->prev;
+
+            if ((kind & SSA_DEAD)
+            && ((ins->symregs[0] == ins->symregs[1] && is_copy(imcc, ins))
+            ||  (dest >= 0 && !set_contains(live, dest)
+            &&   !set_contains(reentered, dest)))) {
+                IMCC_debug(imcc, DEBUG_OPT2, "dead store deleted ");
+                IMCC_debug_ins(imcc, DEBUG_OPT2, ins);
+
+                if (bb->end == ins)
+                    bb->end = prev;
+                if (first)
+                    bb->start = ins->next;
+
+                ins = delete_ins(unit, ins);
+                unit->ostat.deleted_ins++;
+                unit->ostat.dead_stores++;
+                changed = 1;
+
+                if (first)
+                    break;
+
+                continue;
+            }
+
+            live_before(imcc, unit, ins, live, &refs);
+
+            if (first)
+                break;
+        }
+    }
+
+    for (b = 0; b < n_blocks; b++) {
+        set_free(live_in[b]);
+        set_free(live_out[b]);
+    }
+
+    mem_sys_free(live_in);
+    mem_sys_free(live_out);
+    set_free(reentered);
+    free_reg_refs(&refs);
+
+    return changed;
+}
+
+/*
+
+=item C<static int loop_invariants(imc_info_t *imcc, IMC_Unit *unit, Set
+**later)>
+
+Moves the invariant pure operations of the first loop that has any to the
+end of its preheader. An operation is invariant if no register it reads is
+written in the loop. Its result must be written nowhere else in the loop,
+not be live on entry to the loop, and either not be live where the loop
+exits or be computed before every exit. If the loop calls a sub, none of
+these registers may be written after the loop either, by C<later>, as the
+call may return again from there. Returns whether anything moved.
+
+=cut
+
+*/
+
+static int
+loop_invariants(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit),
+        ARGIN(Set **later))
+{
+    ASSERT_ARGS(loop_invariants)
+    const unsigned int n_blocks = unit->n_basic_blocks;
+    const unsigned int n_vars   = unit->n_symbols;
+    Set        **live_in  = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    Set        **live_out = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_blocks, Set *);
+    int         *n_defs   = mem_gc_allocate_n_typed(imcc->interp, n_vars, int);
+    int         *writes   = NULL;
+    int          writes_size = 0;
+    int          l, moved = 0;
+    unsigned int b;
+
+    compute_liveness(imcc, unit, n_vars, live_in, live_out);
+
+    for (l = 0; l < unit->n_loops && !moved; l++) {
+        const Loop_info * const loop = unit->loop_info[l];
+        const int        p = natural_preheader(unit, loop);
+        Basic_block     *pre;
+        Instruction     *at;
+        unsigned int     v;
+        int              calls = 0;
+
+        if (p < 0)
+            continue;
+
+        /* hoisted operations go after the last instruction of the
+         * preheader, or before it if it is a branch to the header */
+        pre = unit->bb_list[p];
+        at  = pre->end;
+
+        if (at->type & ITBRANCH) {
+            if (!at->opname || !STREQ(at->opname, "branch") || at == pre->start)
+                continue;
+            at = at->prev;
+        }
+        else if (at->type & (ITPCCSUB | ITPCCYIELD))
+            continue;
+
+        for (v = 0; v < n_vars; v++)
+            n_defs[v] = 0;
+
+        for (b = 0; b < n_blocks; b++) {
+            const Basic_block * const bb = unit->bb_list[b];
+            const Instruction *ins;
+
+            if (!set_contains(loop->loop, b))
+                continue;
+
+            for (ins = bb->start; ins; ins = ins->next) {
+                int i, n;
+
+                if (ins->symreg_count > writes_size) {
+                    writes_size = ins->symreg_count;
+                    writes      = mem_gc_realloc_n_typed(imcc->interp, writes,
+                                        writes_size, int);
+                }
+
+                if (ins->op) {
+                    ins_var_writes(imcc, unit, ins, writes, &n);
+
+                    for (i = 0; i < n; i++)
+                        n_defs[writes[i]]++;
+                }
+
+                if (is_call(ins))
+                    calls = 1;
+
+                if (ins == bb->end)
+                    break;
+            }
+        }
+
+        for (b = 0; b < n_blocks; b++) {
+            Basic_block * const bb = unit->bb_list[b];
+            Instruction *ins, *next;
+
+            if (!set_contains(loop->loop, b))
+                continue;
+
+            for (ins = bb->start; ins; ins = next) {
+                const int last = ins == bb->end;
+                const int dest = (ssa_op_kind(imcc, ins) & SSA_HOIST)
+                               ? ssa_var(unit, ins->symregs[0]) : -1;
+                int       i, ok = dest >= 0 && n_defs[dest] == 1
+                               && !set_contains(live_in[loop->header], dest)
+                               && !(ins == bb->start && last);
+
+                next = ins->next;
+
+                for (i = 1; ok && i < ins->symreg_count; i++) {
+                    const SymReg * const r = ins->symregs[i];
+
+                    if (REG_NEEDS_ALLOC(r)) {
+                        const int var = ssa_var(unit, r);
+                        ok = var >= 0 && n_defs[var] == 0;
+                    }
+                }
+
+                /* the old value must not be needed after the loop, and
+                 * nothing after it may change what a call returns to */
+                if (ok) {
+                    unsigned int e;
+
+                    for (e = 0; ok && e < n_blocks; e++) {
+                        const Edge *edge;
+
+                        if (!set_contains(loop->loop, e))
+                            continue;
+
+                        for (edge = unit->bb_list[e]->succ_list; ok && edge;
+                                edge = edge->succ_next) {
+                            const int to = edge->to->index;
+
+                            if (set_contains(loop->loop, to))
+                                continue;
+
+                            if (!set_contains(unit->dominators[e], b)
+                            &&  set_contains(live_in[to], dest))
+                                ok = 0;
+
+                            for (i = 0; calls && ok && i < ins->symreg_count; i++) {
+                                const int var = ssa_var(unit, ins->symregs[i]);
+                                ok = var < 0 || !set_contains(later[to], var);
+                            }
+                        }
+                    }
+                }
+
+                if (ok) {
+                    IMCC_debug(imcc, DEBUG_OPT2, "loop invariant moved ");
+                    IMCC_debug_ins(imcc, DEBUG_OPT2, ins);
+
+                    if (bb->start == ins)
+                        bb->start = next;
+                    if (bb->end == ins)
+                        bb->end = ins->prev;
+
+                    move_ins(unit, ins, at);
+
+                    if (pre->end == at)
+                        pre->end = ins;
+
+                    at           = ins;
+                    n_defs[dest] = 0;
+                    unit->ostat.invariants_moved++;
+                    moved = 1;
+                }
+
+                if (last)
+                    break;
+            }
+        }
+    }
+
+    for (b = 0; b < n_blocks; b++) {
+        set_free(live_in[b]);
+        set_free(live_out[b]);
+    }
+
+    mem_sys_free(live_in);
+    mem_sys_free(live_out);
+    mem_sys_free(n_defs);
+
+    if (writes)
+        mem_sys_free(writes);
+
+    return moved;
+}
+
+/*
+
+=item C<int ssa_optimize(imc_info_t *imcc, IMC_Unit *unit)>
+
+Runs the first of copy propagation and value numbering, dead store
+elimination and loop-invariant code motion that changes C<unit>, and
+returns whether one did. The colors of the registers are their index in
+the register list meanwhile.
+
+=cut
+
+*/
+
+int
+ssa_optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(ssa_optimize)
+    const unsigned int n_vars = unit->n_symbols;
+    const char        *obstacle;
+    Set              **later;
+    int               *colors;
+    unsigned int       i;
+    int                changed;
+
+    if (unit->pasm_file || !n_vars || !unit->n_basic_blocks)
+        return 0;
+
+    if ((double)n_vars * unit->n_basic_blocks > SSA_SETS_MAX)
+        obstacle = "too many symbols";
+    else
+        obstacle = hidden_control_flow(imcc, unit);
+
+    if (obstacle) {
+        IMCC_debug(imcc, DEBUG_OPT2, "no SSA optimizations: %s\n", obstacle);
+        return 0;
+    }
+
+    IMCC_info(imcc, 2, "ssa_optimize\n");
+
+    colors = mem_gc_allocate_n_typed(imcc->interp, n_vars, int);
+
+    for (i = 0; i < n_vars; i++) {
+        SymReg * const r = unit->reglist[i];
+
+        colors[i] = r->color;
+        r->color  = r->usage & U_LEXICAL ? -1 : (int)i;
+    }
+
+    later   = later_writes(imcc, unit, n_vars);
+    changed = ssa_walk(imcc, unit, later);
+
+    if (!changed)
+        changed = dead_stores(imcc, unit);
+
+    if (!changed)
+        changed = loop_invariants(imcc, unit, later);
+
+    for (i = 0; i < unit->n_basic_blocks; i++)
+        set_free(later[i]);
+
+    for (i = 0; i < n_vars; i++)
+        unit->reglist[i]->color = colors[i];
+
+    mem_sys_free(later);
+    mem_sys_free(colors);
+
+    return changed;
+}
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -1293,9 +1293,12 @@ void
 create_symhash(ARGMOD(imc_info_t * imcc), ARGOUT(SymHash *hash))
 {
     ASSERT_ARGS(create_symhash)
-    hash->data    = mem_gc_allocate_n_zeroed_typed(imcc->interp, 16, SymReg *);
-    hash->size    = 16;
-    hash->entries = 0;
+    hash->data         = mem_gc_allocate_n_zeroed_typed(imcc->interp, 16, SymReg *);
+    hash->size         = 16;
+    hash->entries      = 0;
+    hash->pending      = NULL;
+    hash->n_pending    = 0;
+    hash->pending_size = 0;
 }
 
 
@@ -1382,6 +1385,17 @@ _store_symreg(ARGMOD(imc_info_t * imcc), ARGMOD(SymHash *hsh),
 
     if (hsh->entries >= hsh->size)
         resize_symhash(imcc, hsh);
+
+    /* remember new global symbols for constant_folding, so that it needn't
+     * walk all the globals of the file for every unit */
+    if (hsh == &imcc->ghash) {
+        if (hsh->n_pending >= hsh->pending_size) {
+            hsh->pending_size = hsh->pending_size ? hsh->pending_size << 1 : 16;
+            hsh->pending      = mem_gc_realloc_n_typed(imcc->interp,
+                                    hsh->pending, hsh->pending_size, SymReg *);
+        }
+        hsh->pending[hsh->n_pending++] = r;
+    }
 }
 
 
@@ -1551,10 +1565,14 @@ clear_sym_hash(ARGMOD(SymHash *hsh))
     }
 
     mem_sys_free(hsh->data);
-
-    hsh->data    = NULL;
-    hsh->entries = 0;
-    hsh->size    = 0;
+    mem_sys_free(hsh->pending);
+
+    hsh->data         = NULL;
+    hsh->entries      = 0;
+    hsh->size         = 0;
+    hsh->pending      = NULL;
+    hsh->n_pending    = 0;
+    hsh->pending_size = 0;
 }
 
 
@@ -67,6 +67,9 @@ typedef struct _SymHash {
     SymReg     **data;
     unsigned int size;
     unsigned int entries;
+    SymReg     **pending;       /* global symbols constant folding has */
+    unsigned int n_pending;     /* still to look at, in insertion order */
+    unsigned int pending_size;
 } SymHash;
 
 /* namespaces */
@@ -29,8 +29,16 @@ struct imcc_ostat {
     int invariants_moved;
     int deleted_ins;
     int used_once;
+    int shared_regs;
+    int copies_propagated;
+    int values_numbered;
+    int dead_stores;
+    int inlined_calls;
 } ;
 
+/* the copy of a sub kept for inlining it, private to inline.c */
+typedef struct Inline_body Inline_body;
+
 struct IMC_Unit {
     INTVAL            type;
     Instruction      *instructions;
@@ -71,6 +79,8 @@ struct IMC_Unit {
     char             *instance_of;      /* PMC or class this is an instance of if any */
     INTVAL            hll_id;           /* HLL ID for this sub */
     SymReg           *subid;            /* Unique subroutine id */
+    SymReg           *lexinfo;          /* const for own LexInfo, if needed */
+    Inline_body      *inline_body;      /* copy to inline, see inline.c */
 
     struct            imcc_ostat ostat;
 };
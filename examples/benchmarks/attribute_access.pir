@@ -0,0 +1,55 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/attribute_access.pir - Object attribute reads and writes
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/attribute_access.pir
+
+=head1 DESCRIPTION
+
+Reads and writes attributes of objects of a class with a parent, a million
+times each, through both the object's own and the inherited attributes.
+Nearly all of the time goes into finding the attribute's slot.
+
+=cut
+
+.sub 'main' :main
+    .local pmc parent, child, o, x, y
+    .local int i
+
+    parent = newclass 'Point'
+    addattribute parent, 'x'
+    addattribute parent, 'y'
+    child = subclass parent, 'Point3D'
+    addattribute child, 'z'
+
+    o = new 'Point3D'
+    x = box 1
+    y = box 2
+    setattribute o, 'x', x
+    setattribute o, 'y', y
+    setattribute o, 'z', x
+
+    i = 0
+  loop:
+    $P0 = getattribute o, 'x'
+    $P1 = getattribute o, 'y'
+    $P2 = getattribute o, 'z'
+    setattribute o, 'x', $P1
+    setattribute o, 'y', $P2
+    setattribute o, 'z', $P0
+    inc i
+    if i < 1000000 goto loop
+
+    $P0 = getattribute o, 'x'
+    say $P0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
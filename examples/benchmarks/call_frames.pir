@@ -0,0 +1,88 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/call_frames.pir - Calls to a sub with many short-lived temporaries
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/call_frames.pir
+    % ./parrot -v examples/benchmarks/call_frames.pir
+
+=head1 DESCRIPTION
+
+Walks a binary call tree of depth 27 - about 630,000 calls - through a sub
+that computes a checksum of its argument in a long chain of temporaries,
+none of which live for more than a few instructions. Every call needs a
+fresh register frame, so the cost of a call grows with the number of
+registers the sub was allocated; C<-v> shows how many that is.
+
+=cut
+
+.sub 'main' :main
+    $I0 = 'walk'(27)
+    say $I0
+.end
+
+.sub 'walk'
+    .param int n
+    .local int acc
+    acc = 0
+
+    $I10 = n * 2
+    $I11 = $I10 % 7
+    acc += $I11
+    $I12 = n * 3
+    $I13 = $I12 % 7
+    acc += $I13
+    $I14 = n * 5
+    $I15 = $I14 % 7
+    acc += $I15
+    $I16 = n * 11
+    $I17 = $I16 % 7
+    acc += $I17
+    $I18 = n * 13
+    $I19 = $I18 % 7
+    acc += $I19
+    $I20 = n * 17
+    $I21 = $I20 % 7
+    acc += $I21
+    $I22 = n * 19
+    $I23 = $I22 % 7
+    acc += $I23
+    $I24 = n * 23
+    $I25 = $I24 % 7
+    acc += $I25
+
+    $S0 = n
+    $S1 = concat $S0, '-'
+    $I26 = length $S1
+    acc += $I26
+    $S2 = repeat $S0, 2
+    $I27 = length $S2
+    acc += $I27
+
+    $P0 = box n
+    $P1 = $P0 * 2
+    $I28 = $P1
+    acc += $I28
+    $P2 = $P1 - n
+    $I29 = $P2
+    acc += $I29
+
+    if n < 2 goto done
+    $I1 = n - 1
+    $I2 = 'walk'($I1)
+    $I3 = n - 2
+    $I4 = 'walk'($I3)
+    acc += $I2
+    acc += $I4
+  done:
+    .return (acc)
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,54 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/case_mapping.pir - Unicode case mapping and normalization
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/case_mapping.pir
+
+=head1 DESCRIPTION
+
+Upcases, downcases, foldcases and normalizes a mix of ASCII, Latin-1 and
+Greek text, the way a case-insensitive index or a search tool would.
+
+=cut
+
+.sub 'main' :main
+    .local string text, s
+    .local int i, total
+
+    text = utf8:"The quick brown fox jumps over the lazy dog. Gr\u00fc\u00dfe aus K\u00f6ln, "
+    $S0  = utf8:"\u00c0 bient\u00f4t! \u039f\u03b4\u03c5\u03c3\u03c3\u03b5\u03cd\u03c2 "
+    text .= $S0
+    text = repeat text, 8
+
+    i     = 0
+    total = 0
+  loop:
+    s = upcase text
+    $I0 = length s
+    total += $I0
+    s = downcase text
+    $I0 = length s
+    total += $I0
+    s = foldcase text
+    $I0 = length s
+    total += $I0
+    s = compose text
+    $I0 = length s
+    total += $I0
+
+    inc i
+    if i < 50000 goto loop
+
+    say total
+.end
+
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
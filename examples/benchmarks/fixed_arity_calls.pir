@@ -0,0 +1,80 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/fixed_arity_calls.pir - Calls with plain positional arguments
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/fixed_arity_calls.pir
+
+=head1 DESCRIPTION
+
+Makes two million calls to small subs taking one to four plain positional
+parameters of each register type and returning a single value. No call
+uses optional, named, slurpy or flattened arguments, which is the shape of
+most calls in compiled code.
+
+=cut
+
+.sub 'main' :main
+    .local int i, sum
+    .local num f
+    .local string s
+    .local pmc p
+
+    i   = 0
+    sum = 0
+    f   = 0.0
+    s   = 'x'
+    p   = box 1
+  loop:
+    $I0 = 'add_ints'(i, 3)
+    sum += $I0
+    f   = 'scale'(f, 0.5, i)
+    $S0 = 'pick'(s, 'y', i, p)
+    p   = 'same'(p)
+    inc i
+    if i < 500000 goto loop
+
+    say sum
+    say $S0
+.end
+
+.sub 'add_ints'
+    .param int a
+    .param int b
+    $I0 = a + b
+    .return ($I0)
+.end
+
+.sub 'scale'
+    .param num x
+    .param num factor
+    .param int n
+    $N0 = x * factor
+    $N0 += n
+    .return ($N0)
+.end
+
+.sub 'pick'
+    .param string a
+    .param string b
+    .param int n
+    .param pmc which
+    if n goto pick_b
+    .return (a)
+  pick_b:
+    .return (b)
+.end
+
+.sub 'same'
+    .param pmc p
+    .return (p)
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,64 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/global_lookup.pir - Global and namespace lookups
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/global_lookup.pir
+
+=head1 DESCRIPTION
+
+Looks up globals a million times each, through C<get_global>,
+C<get_hll_global> and C<get_root_global>, in namespaces holding a few
+hundred other globals, and calls the subs found. This is how a compiler
+targeting Parrot usually calls its functions.
+
+=cut
+
+.sub 'main' :main
+    .local int i
+
+    'fill'()
+
+    i = 0
+  loop:
+    $P0 = get_global 'add_one'
+    i = $P0(i)
+    $P1 = get_hll_global ['Lib'], 'counter'
+    inc $P1
+    $P2 = get_root_global ['parrot'], 'main'
+    if i < 1000000 goto loop
+
+    $P1 = get_hll_global ['Lib'], 'counter'
+    say $P1
+.end
+
+.sub 'add_one'
+    .param int n
+    $I0 = n + 1
+    .return ($I0)
+.end
+
+.sub 'fill'
+    .local int i
+    $P0 = box 0
+    set_hll_global ['Lib'], 'counter', $P0
+
+    i = 0
+  fill_loop:
+    $S0 = i
+    $S1 = concat 'global_', $S0
+    $P1 = box i
+    set_global $S1, $P1
+    set_hll_global ['Lib'], $S1, $P1
+    inc i
+    if i < 300 goto fill_loop
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
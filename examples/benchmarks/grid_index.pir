@@ -0,0 +1,131 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/grid_index.pir - Index arithmetic of a naive code generator
+
+=head1 SYNOPSIS
+
+    % time ./parrot -O2 examples/benchmarks/grid_index.pir
+    % time ./parrot -O3 examples/benchmarks/grid_index.pir
+
+=head1 DESCRIPTION
+
+Smooths a 200 x 200 grid stored row by row in a flat array, 20 times. The
+code is what a simple compiler emits for C<a[r][c]>: every access computes
+its index from scratch, loop variables are copied into temporaries, and the
+bounds are recomputed in every iteration. C<-O3> numbers the repeated index
+computations, propagates the copies and moves the bounds out of the loops;
+C<-v> shows how much of that it did.
+
+=cut
+
+.sub 'main' :main
+    .local int rows, cols, pass, r, c, sum
+    .local pmc grid, next
+    rows = 200
+    cols = 200
+
+    $I0  = rows * cols
+    grid = new ['FixedIntegerArray']
+    grid = $I0
+    next = new ['FixedIntegerArray']
+    next = $I0
+
+    r = 0
+  init_row:
+    c = 0
+  init_col:
+    $I0 = r * cols
+    $I1 = $I0 + c
+    $I2 = r * 7
+    $I3 = c * 13
+    $I4 = $I2 + $I3
+    $I5 = $I4 % 101
+    grid[$I1] = $I5
+    inc c
+    if c < cols goto init_col
+    inc r
+    if r < rows goto init_row
+
+    pass = 0
+  next_pass:
+    r = 1
+  row:
+    c = 1
+  col:
+    # copies of the loop variables, as for arguments of an inlined accessor
+    $I20 = r
+    $I21 = c
+    $I22 = cols
+
+    # a[r][c]
+    $I0 = $I20 * $I22
+    $I1 = $I0 + $I21
+    $I10 = grid[$I1]
+
+    # a[r - 1][c]
+    $I2 = $I20 - 1
+    $I0 = $I2 * $I22
+    $I1 = $I0 + $I21
+    $I11 = grid[$I1]
+
+    # a[r + 1][c]
+    $I2 = $I20 + 1
+    $I0 = $I2 * $I22
+    $I1 = $I0 + $I21
+    $I12 = grid[$I1]
+
+    # a[r][c - 1]
+    $I0 = $I20 * $I22
+    $I2 = $I21 - 1
+    $I1 = $I0 + $I2
+    $I13 = grid[$I1]
+
+    # a[r][c + 1]
+    $I0 = $I20 * $I22
+    $I2 = $I21 + 1
+    $I1 = $I0 + $I2
+    $I14 = grid[$I1]
+
+    $I15 = $I10 * 4
+    $I15 += $I11
+    $I15 += $I12
+    $I15 += $I13
+    $I15 += $I14
+    $I15 = $I15 / 8
+
+    # b[r][c]
+    $I0 = $I20 * $I22
+    $I1 = $I0 + $I21
+    next[$I1] = $I15
+
+    inc c
+    $I30 = cols - 1
+    if c < $I30 goto col
+    inc r
+    $I31 = rows - 1
+    if r < $I31 goto row
+
+    $P0  = grid
+    grid = next
+    next = $P0
+    inc pass
+    if pass < 20 goto next_pass
+
+    sum = 0
+    $I0 = rows * cols
+    $I1 = 0
+  sum_loop:
+    $I2 = grid[$I1]
+    sum += $I2
+    inc $I1
+    if $I1 < $I0 goto sum_loop
+    say sum
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,70 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/inline_calls.pir - Calls of small helper subs in a loop
+
+=head1 SYNOPSIS
+
+    % time ./parrot -O2 examples/benchmarks/inline_calls.pir
+    % time ./parrot -O3 examples/benchmarks/inline_calls.pir
+
+=head1 DESCRIPTION
+
+Sums the clamped squares of the distances of a million points from a
+center, with a helper sub for each step, the way code split into small
+functions does. C<-O3> inlines the helpers, so the loop makes no calls;
+C<-v> shows how many it inlined.
+
+=cut
+
+.sub 'square'
+    .param int x
+    $I0 = x * x
+    .return ($I0)
+.end
+
+.sub 'absdiff'
+    .param int a
+    .param int b
+    if a < b goto less
+    $I0 = a - b
+    .return ($I0)
+  less:
+    $I0 = b - a
+    .return ($I0)
+.end
+
+.sub 'clamp'
+    .param int x
+    .param int hi
+    if x <= hi goto done
+    x = hi
+  done:
+    .return (x)
+.end
+
+.sub 'main' :main
+    .local int i, x, y, d, sum
+    sum = 0
+    i = 0
+  loop:
+    x = i % 1000
+    y = i / 1000
+    $I0 = absdiff(x, 500)
+    $I1 = absdiff(y, 500)
+    $I0 = 'square'($I0)
+    $I1 = 'square'($I1)
+    d = $I0 + $I1
+    d = 'clamp'(d, 100000)
+    sum += d
+    inc i
+    if i < 1000000 goto loop
+    say sum
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
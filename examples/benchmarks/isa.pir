@@ -0,0 +1,57 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/isa.pir - Subtype checks on objects and PMCs
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/isa.pir
+
+=head1 DESCRIPTION
+
+Asks objects of a three level class hierarchy and core PMCs whether they are
+of a given class or do a given role, by name and by class object, three
+hundred thousand times each.
+
+=cut
+
+.sub 'main' :main
+    .local pmc shape, polygon, square, sq, one, proxy
+    .local int i, n
+
+    shape   = newclass 'Shape'
+    polygon = subclass shape, 'Polygon'
+    square  = subclass polygon, 'Square'
+    sq      = new 'Square'
+    one     = box 1
+    proxy   = get_class 'Integer'
+
+    i = 0
+    n = 0
+  loop:
+    $I0 = isa sq, 'Shape'
+    n  += $I0
+    $I0 = isa sq, shape
+    n  += $I0
+    $I0 = isa sq, 'Integer'
+    n  += $I0
+    $I0 = isa one, 'Integer'
+    n  += $I0
+    $I0 = isa one, proxy
+    n  += $I0
+    $I0 = isa one, shape
+    n  += $I0
+    $I0 = does sq, 'array'
+    n  += $I0
+    inc i
+    if i < 300000 goto loop
+
+    say n
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
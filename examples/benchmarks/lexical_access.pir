@@ -0,0 +1,77 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/lexical_access.pir - Lexical reads and writes in closures
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/lexical_access.pir
+
+=head1 DESCRIPTION
+
+Runs a loop of a million iterations in a closure two C<:outer> levels below
+the sub declaring the loop counter and the sum, with a few more lexicals
+declared along the way. Every iteration reads and writes lexicals of both
+the closure's own pad and its outer pads.
+
+=cut
+
+.sub 'main' :main
+    .lex 'sum', $P0
+    .lex 'limit', $I0
+    .lex 'a', $P1
+    .lex 'b', $P2
+    .lex 'c', $P3
+    $P0 = box 0
+    $I0 = 1000000
+    $P1 = box 1
+    $P2 = box 2
+    $P3 = box 3
+
+    $P4 = get_global 'middle'
+    $P4 = newclosure $P4
+    $P4()
+
+    $P0 = find_lex 'sum'
+    say $P0
+.end
+
+.sub 'middle' :outer('main')
+    .lex 'step', $I0
+    .lex 'd', $P0
+    .lex 'e', $P1
+    $I0 = 3
+    $P0 = box 4
+    $P1 = box 5
+
+    $P2 = get_global 'inner'
+    $P2 = newclosure $P2
+    $P2()
+.end
+
+.sub 'inner' :outer('middle')
+    .lex 'i', $I0
+    .local int limit, step
+    .local pmc sum
+
+    $I0 = 0
+  loop:
+    $I1 = find_lex 'i'
+    limit = find_lex 'limit'
+    if $I1 >= limit goto done
+    step = find_lex 'step'
+    sum = find_lex 'sum'
+    sum = add sum, step
+    store_lex 'sum', sum
+    inc $I1
+    store_lex 'i', $I1
+    goto loop
+  done:
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,79 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/library_search.pir - Finding files in the search paths
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/library_search.pir
+
+=head1 DESCRIPTION
+
+Compiles a PIR unit that C<.include>s a dozen files two thousand times,
+after putting a few more directories in front of the include search path,
+the way an application with its own libraries does. Each C<.include> looks
+for its file in every directory before the one that has it.
+
+=cut
+
+.include 'iglobals.pasm'
+.include 'interpinfo.pasm'
+.include 'libpaths.pasm'
+
+.sub 'main' :main
+    .local pmc interp, lib_paths, paths, pir, dirs
+    .local string prefix, code
+    .local int i, n
+
+    interp    = getinterp
+    lib_paths = interp[.IGLOBALS_LIB_PATHS]
+    paths     = lib_paths[.PARROT_LIB_PATH_INCLUDE]
+    prefix    = interpinfo .INTERPINFO_RUNTIME_PREFIX
+
+    dirs = split ' ', 'examples/pir examples/library examples/io examples/json src/pmc'
+    n = elements dirs
+    i = 0
+  add_dirs:
+    $S0 = dirs[i]
+    $S0 = concat '/', $S0
+    $S0 = concat prefix, $S0
+    $S0 = concat $S0, '/'
+    unshift paths, $S0
+    inc i
+    if i < n goto add_dirs
+
+    code = <<'PIR'
+.include 'cclass.pasm'
+.include 'datatypes.pasm'
+.include 'hash_key_type.pasm'
+.include 'iglobals.pasm'
+.include 'interpinfo.pasm'
+.include 'libpaths.pasm'
+.include 'stat.pasm'
+.include 'sysinfo.pasm'
+.include 'call_bits.pasm'
+.include 'iterator.pasm'
+.include 'cloneflags.pasm'
+.include 'timer.pasm'
+.sub 'f'
+    .return (.CCLASS_NUMERIC)
+.end
+PIR
+
+    pir = compreg 'PIR'
+    i = 0
+  loop:
+    $P0 = pir(code)
+    inc i
+    if i < 2000 goto loop
+
+    $I0 = interpinfo .INTERPINFO_LIBRARY_PROBES_SAVED
+    say $I0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,112 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/multi_dispatch.pir - Multiple dispatch on argument types
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/multi_dispatch.pir
+
+=head1 DESCRIPTION
+
+Calls a multi sub with six candidates a million times, cycling through
+native, core PMC and user class arguments, some of which only match a
+candidate for a parent class. Then adds objects of a user class, which goes
+through the multiple dispatch fallback of the C<add> vtable, two hundred
+thousand times.
+
+=cut
+
+.sub 'main' :main
+    .local pmc shape, square, circle, one, half
+    .local int i, sum
+
+    shape  = newclass 'Shape'
+    square = subclass shape, 'Square'
+    circle = subclass shape, 'Circle'
+    square = new 'Square'
+    circle = new 'Circle'
+    one    = box 1
+    half   = box 0.5
+
+    i   = 0
+    sum = 0
+  multi_loop:
+    $I0 = 'area'(i, 2)
+    sum += $I0
+    $I0 = 'area'(one, one)
+    sum += $I0
+    $I0 = 'area'(half, one)
+    sum += $I0
+    $I0 = 'area'(square, one)
+    sum += $I0
+    $I0 = 'area'(circle, half)
+    sum += $I0
+    $I0 = 'area'(square, circle)
+    sum += $I0
+    inc i
+    if i < 166667 goto multi_loop
+
+    say sum
+
+    i = 0
+  add_loop:
+    $P0 = add square, circle
+    inc i
+    if i < 200000 goto add_loop
+
+    say $P0
+.end
+
+.sub 'area' :multi(int, int)
+    .param int a
+    .param int b
+    $I0 = a * b
+    .return ($I0)
+.end
+
+.sub 'area' :multi(Integer, Integer)
+    .param pmc a
+    .param pmc b
+    .return (1)
+.end
+
+.sub 'area' :multi(Float, _)
+    .param pmc a
+    .param pmc b
+    .return (2)
+.end
+
+.sub 'area' :multi(Shape, Integer)
+    .param pmc a
+    .param pmc b
+    .return (3)
+.end
+
+.sub 'area' :multi(Circle, _)
+    .param pmc a
+    .param pmc b
+    .return (4)
+.end
+
+.sub 'area' :multi(Shape, Shape)
+    .param pmc a
+    .param pmc b
+    .return (5)
+.end
+
+.namespace ['Square']
+
+.sub 'add' :multi(Square, Shape, PMC)
+    .param pmc a
+    .param pmc b
+    .param pmc dest
+    .return ('sum')
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,48 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/numeric_strings.pir - Number to string conversions
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/numeric_strings.pir
+
+=head1 DESCRIPTION
+
+Converts integers and floats to strings and back, the way a JSON or CSV
+reader and writer would.
+
+=cut
+
+.sub 'main' :main
+    .local int i, isum
+    .local num n, nsum
+
+    i    = 0
+    isum = 0
+    nsum = 0.0
+  loop:
+    $S0 = i
+    $I0 = $S0
+    isum += $I0
+
+    n = i
+    n /= 8.0
+    $S1 = n
+    $N0 = $S1
+    nsum += $N0
+
+    inc i
+    if i < 2000000 goto loop
+
+    say isum
+    say nsum
+.end
+
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
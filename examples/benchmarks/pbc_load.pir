@@ -0,0 +1,44 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/pbc_load.pir - Unpack a large bytecode file
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/pbc_load.pir
+
+=head1 DESCRIPTION
+
+Reads the bytecode of the NQP compiler once, then unpacks it into a
+C<Packfile> twenty times, which thaws all its constants and places its subs
+into their namespaces each time.
+
+=cut
+
+.sub 'main' :main
+    .local pmc fh, pf
+    .local string image
+    .local int i
+
+    fh    = new 'FileHandle'
+    fh.'open'('runtime/parrot/library/nqp-rx.pbc', 'rb')
+    image = fh.'readall'()
+    fh.'close'()
+
+    i = 0
+  load_loop:
+    pf = new 'Packfile'
+    pf = image
+    inc i
+    if i < 20 goto load_loop
+
+    $I0 = length image
+    say $I0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
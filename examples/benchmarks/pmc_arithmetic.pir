@@ -0,0 +1,59 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/pmc_arithmetic.pir - Arithmetic on Integer and Float PMCs
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/pmc_arithmetic.pir
+
+=head1 DESCRIPTION
+
+Runs loops that add, subtract, multiply, take the modulus of, increment and
+compare C<Integer> and C<Float> PMCs, a million iterations each.
+
+=cut
+
+.sub 'main' :main
+    .local pmc i, max, sum, tmp, x, step
+
+    i   = new 'Integer'
+    i   = 0
+    max = new 'Integer'
+    max = 1000000
+    sum = new 'Integer'
+    sum = 0
+
+  int_loop:
+    tmp = i * i
+    tmp = tmp % 7
+    sum = sum + tmp
+    sum = sum - 1
+    inc i
+    if i < max goto int_loop
+
+    say sum
+
+    x    = new 'Float'
+    x    = 0.0
+    step = new 'Float'
+    step = 0.5
+    i    = 0
+
+  float_loop:
+    tmp = x * step
+    x   = x + step
+    x   = x - tmp
+    inc x
+    inc i
+    if i < 1000000 goto float_loop
+
+    say x
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
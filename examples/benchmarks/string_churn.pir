@@ -0,0 +1,53 @@
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/string_churn.pir - Long-lived strings among short-lived ones
+
+=head1 SYNOPSIS
+
+    % time ./parrot examples/benchmarks/string_churn.pir
+
+=head1 DESCRIPTION
+
+Keeps 200000 strings alive in an array and keeps replacing them, while
+building a couple of temporary strings per replacement. Most string
+storage dies young, but the surviving part is large, which stresses how
+the string pool is compacted. Watch the peak memory as well as the time.
+
+=cut
+
+.sub 'main' :main
+    .local pmc live
+    .local int i, j, n
+    live = new 'ResizableStringArray'
+    n = 200000
+    i = 0
+  fill:
+    $S0 = i
+    $S0 = repeat $S0, 6
+    push live, $S0
+    inc i
+    if i < n goto fill
+
+    j = 0
+  churn:
+    $I0 = j * 7919
+    $I0 = $I0 % n
+    $S0 = j
+    $S0 = repeat $S0, 5
+    live[$I0] = $S0
+    $S1 = concat $S0, "-tmp-"
+    $S1 = concat $S1, $S0
+    inc j
+    if j < 3000000 goto churn
+
+    $S0 = live[17]
+    say $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
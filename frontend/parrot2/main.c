@@ -660,6 +660,9 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
                 args->imcc_opts |= PARROT_IMCC_OPT_PRE;
             if (strchr(opt.opt_arg, '2'))
                 args->imcc_opts |= (PARROT_IMCC_OPT_PRE|PARROT_IMCC_OPT_CFG);
+            if (strchr(opt.opt_arg, '3'))
+                args->imcc_opts |= (PARROT_IMCC_OPT_PRE|PARROT_IMCC_OPT_CFG|PARROT_IMCC_OPT_SSA
+                                   |PARROT_IMCC_OPT_INLINE);
             break;
 
           case '.':  /* Give Windows Parrot hackers an opportunity to
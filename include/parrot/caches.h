@@ -25,6 +25,20 @@ typedef struct _meth_cache_entry {
     struct _meth_cache_entry *next;
 } Meth_cache_entry;
 
+/*
+ * global lookup cache entry, one per get_*global op site
+ */
+typedef struct _global_cache_entry {
+    void    *site;      /* the op doing the lookup */
+    PMC     *ns;        /* the namespace searched */
+    STRING  *name;      /* the constant name looked up */
+    UINTVAL  stamp;     /* stamp of the namespace at lookup time */
+    PMC     *value;     /* the global found, or PMCNULL */
+} Global_cache_entry;
+
+#define GLOBAL_CACHE_SIZE 512
+#define GLOBAL_CACHE_SLOT(site) ((((UINTVAL)(site)) >> 3) & (GLOBAL_CACHE_SIZE - 1))
+
 /*
  * method cache, continuation freelist, stack chunk freelist, regsave cache
  */
@@ -32,6 +46,8 @@ typedef struct _Caches {
     UINTVAL mc_size;            /* sizeof table */
     Meth_cache_entry ***idx;    /* bufstart idx */
     /* PMC **hash */            /* for non-constant keys */
+    UINTVAL ns_stamp;           /* last namespace stamp handed out */
+    Global_cache_entry globals[GLOBAL_CACHE_SIZE];
 } Caches;
 
 #endif   /* PARROT_CACHES_H_GUARD */
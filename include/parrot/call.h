@@ -28,6 +28,7 @@ typedef struct parrot_runloop_t {
     opcode_t                *handler_start; /* Used in exception handling */
     int                      id;            /* runloop id */
     PMC                     *exception;     /* Reference to the exception object */
+    struct parrot_frame_t   *frame_floor;   /* frames this runloop must not pop */
 
     /* let the biggest element cross the cacheline boundary */
     Parrot_jump_buff         resume;        /* jmp_buf */
@@ -35,8 +36,26 @@ typedef struct parrot_runloop_t {
 
 typedef parrot_runloop_t Parrot_runloop;
 
+/* Register frames of sub calls are allocated LIFO from a per-interpreter
+ * stack of chunks. Each frame starts with this header; ctx is NULL once the
+ * context owning the frame is gone. */
+
+typedef struct parrot_frame_t {
+    struct parrot_frame_t   *prev;          /* frame below this one */
+    PMC                     *ctx;           /* CallContext using the frame */
+} Parrot_Frame;
+
+typedef struct parrot_frame_chunk_t {
+    struct parrot_frame_chunk_t *prev;      /* chunk below this one */
+    char                    *top;           /* first free byte */
+    char                    *limit;         /* end of the chunk */
+} Parrot_Frame_chunk;
+
 typedef enum {
-    CALLSIGNATURE_is_exception_FLAG      = PObj_private0_FLAG /* last element */
+    CALLSIGNATURE_is_exception_FLAG      = PObj_private0_FLAG,
+    CALLSIGNATURE_on_frame_stack_FLAG    = PObj_private1_FLAG,
+    CALLSIGNATURE_escaped_FLAG           = PObj_private2_FLAG,
+    CALLSIGNATURE_chain_escaped_FLAG     = PObj_private3_FLAG /* last element */
 } callsignature_flags_enum;
 
 #define CALLSIGNATURE_get_FLAGS(o) (PObj_get_FLAGS(o))
@@ -52,6 +71,19 @@ typedef enum {
 #define CALLSIGNATURE_is_exception_SET(o)   CALLSIGNATURE_flag_SET(is_exception, (o))
 #define CALLSIGNATURE_is_exception_CLEAR(o) CALLSIGNATURE_flag_CLEAR(is_exception, (o))
 
+/* Mark if the registers of a context live on the frame stack */
+#define CALLSIGNATURE_on_frame_stack_TEST(o)  CALLSIGNATURE_flag_TEST(on_frame_stack, (o))
+#define CALLSIGNATURE_on_frame_stack_SET(o)   CALLSIGNATURE_flag_SET(on_frame_stack, (o))
+#define CALLSIGNATURE_on_frame_stack_CLEAR(o) CALLSIGNATURE_flag_CLEAR(on_frame_stack, (o))
+
+/* Mark if a context may be resumed after its frame is popped */
+#define CALLSIGNATURE_escaped_TEST(o)  CALLSIGNATURE_flag_TEST(escaped, (o))
+#define CALLSIGNATURE_escaped_SET(o)   CALLSIGNATURE_flag_SET(escaped, (o))
+
+/* Mark if a context and all of its callers have escaped */
+#define CALLSIGNATURE_chain_escaped_TEST(o)  CALLSIGNATURE_flag_TEST(chain_escaped, (o))
+#define CALLSIGNATURE_chain_escaped_SET(o)   CALLSIGNATURE_flag_SET(chain_escaped, (o))
+
 /* HEADERIZER BEGIN: src/call/pcc.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -441,6 +473,13 @@ PARROT_CAN_RETURN_NULL
 PMC* Parrot_pcc_get_sub(PARROT_INTERP, ARGIN(const PMC *ctx))
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+void Parrot_pcc_mark_chain_escaped(PARROT_INTERP, ARGIN_NULLOK(PMC *ctx));
+
+PARROT_EXPORT
+void Parrot_pcc_mark_escaped(PARROT_INTERP, ARGIN(PMC *ctx))
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 void Parrot_pcc_reuse_continuation(PARROT_INTERP,
     ARGIN(PMC *call_context),
@@ -502,6 +541,13 @@ PMC * Parrot_pcc_allocate_empty_context(PARROT_INTERP,
     ARGIN_NULLOK(PMC *old))
         __attribute__nonnull__(1);
 
+void Parrot_pcc_allocate_frame_registers(PARROT_INTERP,
+    ARGIN(PMC *pmcctx),
+    ARGIN(const UINTVAL *number_regs_used))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 void Parrot_pcc_allocate_registers(PARROT_INTERP,
     ARGIN(PMC *pmcctx),
     ARGIN(const UINTVAL *number_regs_used))
@@ -509,6 +555,9 @@ void Parrot_pcc_allocate_registers(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+void Parrot_pcc_destroy_frame_stack(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 void Parrot_pcc_free_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -519,12 +568,20 @@ PMC * Parrot_pcc_init_context(PARROT_INTERP,
     ARGIN_NULLOK(PMC *old))
         __attribute__nonnull__(2);
 
+void Parrot_pcc_pop_tailcall_frame(PARROT_INTERP, ARGIN(PMC *ctx))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 PMC * Parrot_pcc_unproxy_context(PARROT_INTERP, ARGIN(PMC * proxy))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+void Parrot_pcc_unwind_frames(PARROT_INTERP, ARGIN(PMC *to_ctx))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 PMC * Parrot_set_new_context(PARROT_INTERP,
@@ -552,6 +609,9 @@ PMC * Parrot_set_new_context(PARROT_INTERP,
     , PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_Parrot_pcc_get_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_Parrot_pcc_mark_chain_escaped __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_Parrot_pcc_mark_escaped __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_Parrot_pcc_reuse_continuation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(call_context))
@@ -580,18 +640,32 @@ PMC * Parrot_set_new_context(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_pcc_allocate_empty_context \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pcc_allocate_frame_registers \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx) \
+    , PARROT_ASSERT_ARG(number_regs_used))
 #define ASSERT_ARGS_Parrot_pcc_allocate_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmcctx) \
     , PARROT_ASSERT_ARG(number_regs_used))
+#define ASSERT_ARGS_Parrot_pcc_destroy_frame_stack \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_pcc_free_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmcctx))
 #define ASSERT_ARGS_Parrot_pcc_init_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_Parrot_pcc_pop_tailcall_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_Parrot_pcc_unproxy_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(proxy))
+#define ASSERT_ARGS_Parrot_pcc_unwind_frames __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(to_ctx))
 #define ASSERT_ARGS_Parrot_set_new_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(number_regs_used))
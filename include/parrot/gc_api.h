@@ -125,7 +125,10 @@ typedef enum {
     CPU_TYPE,
 
     /* additional gc constants */
-    MAX_GENERATIONS
+    MAX_GENERATIONS,
+
+    /* library search */
+    LIBRARY_PROBES_SAVED
 } Interpinfo_enum;
 
 /* &end_gen */
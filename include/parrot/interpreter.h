@@ -79,6 +79,8 @@ typedef enum { /* sync with compilers/imcc/imc.h */
     PARROT_IMCC_OPT_PRE             = 0x001,  /* -O1 */
     PARROT_IMCC_OPT_CFG             = 0x002,  /* -O2 */
     PARROT_IMCC_OPT_SUB             = 0x004,  /* -Oc */
+    PARROT_IMCC_OPT_SSA             = 0x008,  /* -O3 */
+    PARROT_IMCC_OPT_INLINE          = 0x010,  /* -O3 */
     PARROT_IMCC_OPT_PASM            = 0x100,  /* -Op */
 } Parrot_imcc_opt_flags;
 
@@ -240,6 +242,9 @@ struct parrot_interp_t {
 
     UINTVAL hash_seed;                        /* STRING hash seed */
 
+    UINTVAL lib_probes_saved;                 /* stats avoided by the library
+                                               * directory cache */
+
     PMC    *iglobals;                         /* FixedPMCArray of PMCs, containing: */
     /* 0:   PMC *Parrot_base_classname_hash; hash containing name->base_type */
     /* 1:   PMC *Parrot_compreg_hash;    hash containing assembler/compilers */
@@ -261,7 +266,7 @@ struct parrot_interp_t {
     PMC *scheduler;                           /* concurrency scheduler */
     PMC *cur_task;
 
-    MMD_Cache *op_mmd_cache;                  /* MMD cache for builtins. */
+    struct MMD_Dispatch_table *op_mmd_dispatch; /* MMD dispatch table for builtins. */
 
     struct _Caches * caches;                  /* see caches.h */
 
@@ -278,6 +283,10 @@ struct parrot_interp_t {
     int current_runloop_id;
     int runloop_id_counter;                   /* for synthesizing runloop ids. */
 
+    struct parrot_frame_t       *frame_top;       /* register frame stack */
+    struct parrot_frame_chunk_t *frame_chunk;     /* chunk holding frame_top */
+    struct parrot_frame_chunk_t *spare_frame_chunk; /* last emptied chunk */
+
     UINTVAL              last_alarm;          /* has an alarm triggered? */
     FLOATVAL             quantum_done;        /* expiration of current quantum */
 
@@ -321,6 +330,7 @@ typedef enum {
     IGLOBALS_PBC_LIBS,          /* Hash of load_bytecode cde */
     IGLOBALS_EXECUTABLE,        /* How Parrot was invoked (from argv[0]) */
     IGLOBALS_LOADED_PBCS,       /* Hash of .pbc file -> PackfileView */
+    IGLOBALS_LIB_DIR_CACHE,     /* Hash of search directory -> listing */
 
     IGLOBALS_SIZE
 } iglobals_enum;
@@ -56,6 +56,32 @@ typedef struct _multi_func_list {
 
 #define MMD_Cache PMC
 
+/* Longest native type-id tuple a dispatch table keys on; calls with more
+ * invocants than this go through the full Manhattan distance search. */
+#define PARROT_MMD_DISPATCH_MAX_ARGS 8
+
+typedef struct MMD_Dispatch_entry {
+    PMC    *sub;                                  /* chosen candidate; NULL if free */
+    char   *name;                                 /* multi name, for builtin tables */
+    UINTVAL hash;
+    INTVAL  n_args;                               /* positionals, clamped to arity + 1 */
+    INTVAL  types[PARROT_MMD_DISPATCH_MAX_ARGS];  /* type ids of the invocants */
+} MMD_Dispatch_entry;
+
+/* Open addressed table mapping argument type-id tuples straight to the
+ * chosen candidate. A MultiSub's table is only valid for the candidate list
+ * and type registry it was filled against; both are recorded so a change
+ * to either throws the table away. */
+typedef struct MMD_Dispatch_table {
+    MMD_Dispatch_entry  *slots;         /* mask + 1 slots, or NULL if uncacheable */
+    UINTVAL              mask;
+    UINTVAL              used;
+    INTVAL               arity;         /* longest candidate signature, -1 for any */
+    INTVAL               n_types;       /* interp->n_vtable_max when filled */
+    PMC                **candidates;    /* copy of the MultiSub's candidate list */
+    INTVAL               n_candidates;
+} MMD_Dispatch_table;
+
 /* HEADERIZER BEGIN: src/multidispatch.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -159,6 +185,27 @@ void Parrot_mmd_cache_store_by_values(PARROT_INTERP,
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*cache);
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_mmd_dispatch_multisub(PARROT_INTERP,
+    ARGIN(PMC *multi),
+    ARGIN(PMC *sig_obj))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+void Parrot_mmd_dispatch_table_destroy(PARROT_INTERP,
+    ARGFREE(MMD_Dispatch_table *table))
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+void Parrot_mmd_dispatch_table_mark(PARROT_INTERP,
+    ARGIN(MMD_Dispatch_table *table))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 PARROT_CAN_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -251,6 +298,17 @@ PMC * Parrot_mmd_sort_manhattan_by_sig_pmc(PARROT_INTERP,
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(values) \
     , PARROT_ASSERT_ARG(chosen))
+#define ASSERT_ARGS_Parrot_mmd_dispatch_multisub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(multi) \
+    , PARROT_ASSERT_ARG(sig_obj))
+#define ASSERT_ARGS_Parrot_mmd_dispatch_table_destroy \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_mmd_dispatch_table_mark \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(table))
 #define ASSERT_ARGS_Parrot_mmd_find_multi_from_long_sig \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -27,7 +27,7 @@ PARROT_CANNOT_RETURN_NULL
 PMC * Parrot_ns_find_global_from_op(PARROT_INTERP,
     ARGIN(PMC *ns),
     ARGIN_NULLOK(STRING *globalname),
-    void *next)
+    ARGIN_NULLOK(void *next))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
@@ -135,6 +135,11 @@ void Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+void Parrot_ns_store_subs(PARROT_INTERP, ARGIN(PMC **pmcs), INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 #define ASSERT_ARGS_Parrot_ns_find_current_namespace_global \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
@@ -185,6 +190,9 @@ void Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 #define ASSERT_ARGS_Parrot_ns_store_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
+#define ASSERT_ARGS_Parrot_ns_store_subs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcs))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/namespace.c */
 
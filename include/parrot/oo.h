@@ -40,6 +40,20 @@ typedef enum {
 
 #define GET_CLASS(obj)          (obj)->vtable->pmc_class
 
+/*
+ * Sets of type ids, for subtype checks without name lookups. Word 0 holds the
+ * number of type ids the set covers, the bits follow.
+ */
+#define PARROT_TYPE_BITS_PER_WORD (sizeof (UINTVAL) * 8)
+#define PARROT_TYPE_BITS_COVERS(bits, type) \
+    ((type) > 0 && (UINTVAL)(type) < (bits)[0])
+#define PARROT_TYPE_BITS_TEST(bits, type) \
+    (((bits)[1 + (UINTVAL)(type) / PARROT_TYPE_BITS_PER_WORD] \
+        >> ((UINTVAL)(type) % PARROT_TYPE_BITS_PER_WORD)) & 1)
+#define PARROT_TYPE_BITS_SET(bits, type) \
+    ((bits)[1 + (UINTVAL)(type) / PARROT_TYPE_BITS_PER_WORD] |= \
+        (UINTVAL)1 << ((UINTVAL)(type) % PARROT_TYPE_BITS_PER_WORD))
+
 /* HEADERIZER BEGIN: src/oo.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -149,6 +163,10 @@ void init_object_cache(PARROT_INTERP)
 void mark_object_cache(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+void Parrot_oo_build_ancestor_bits(PARROT_INTERP, ARGIN(PMC *_class))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CANNOT_RETURN_NULL
 PMC * Parrot_oo_clone_object(PARROT_INTERP,
     ARGIN(PMC *pmc),
@@ -164,6 +182,18 @@ void Parrot_oo_extract_methods_from_namespace(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_oo_has_ancestor(PARROT_INTERP,
+    ARGIN(PMC *_class),
+    ARGIN(PMC *lookup))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+UINTVAL * Parrot_oo_new_type_bits(PARROT_INTERP, INTVAL n_types);
+
 PARROT_CANNOT_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 PMC * Parrot_oo_newclass_from_str(PARROT_INTERP, ARGIN(STRING *name))
@@ -227,6 +257,9 @@ INTVAL Parrot_oo_register_type(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_mark_object_cache __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_oo_build_ancestor_bits __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(_class))
 #define ASSERT_ARGS_Parrot_oo_clone_object __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc))
@@ -235,6 +268,11 @@ INTVAL Parrot_oo_register_type(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self) \
     , PARROT_ASSERT_ARG(ns))
+#define ASSERT_ARGS_Parrot_oo_has_ancestor __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(_class) \
+    , PARROT_ASSERT_ARG(lookup))
+#define ASSERT_ARGS_Parrot_oo_new_type_bits __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_oo_newclass_from_str __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name))
@@ -44,6 +44,33 @@ typedef enum {
 #define CLASS_has_alien_parents_SET(o)   CLASS_flag_SET(has_alien_parents, (o))
 #define CLASS_has_alien_parents_CLEAR(o) CLASS_flag_CLEAR(has_alien_parents, (o))
 
+/* Number of entries in a class' attribute slot cache. Must be a power of 2. */
+#define ATTRIB_SHAPE_SLOTS 16
+
+/* Pick the slot cache entry for an attribute name. Names are compared by
+ * identity, so the hash is taken from the header address. */
+#define ATTRIB_SHAPE_SLOT(name) \
+    ((((UINTVAL)(name)) >> 5) & (ATTRIB_SHAPE_SLOTS - 1))
+
+/*
+ * The attribute layout ("shape") of an instantiated class. It is rebuilt
+ * along with the attribute index, which can't change once the class has
+ * been instantiated, so the cached attribute indexes stay valid for all
+ * objects of the class.
+ */
+typedef struct Parrot_Attrib_Shape {
+    /* get_attr_str/set_attr_str overrides; NULL until looked up */
+    PMC *get_attr_override;
+    PMC *set_attr_override;
+
+    /* Attribute names seen by get_attr_str/set_attr_str and their indexes
+     * into the attribute store. */
+    struct {
+        STRING *name;
+        INTVAL  index;
+    } slots[ATTRIB_SHAPE_SLOTS];
+} Parrot_Attrib_Shape;
+
 #endif /* PARROT_OO_PRIVATE_H_GUARD */
 
 /*
@@ -1151,6 +1151,50 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_disable_preemption(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_enable_preemption(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_terminate(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_p_sc_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_s_sc_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_i_sc_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_n_sc_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_p_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_s_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_sc_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_i_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_ic_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_n_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_nc_ic_ic_pc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_int_int_p_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_sub_int_int_p_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_mul_int_int_p_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_mod_int_int_p_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_int_p_p_i(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_int_p_p_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_sub_int_p_p_i(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_sub_int_p_p_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_add_num_num_p_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_sub_num_num_p_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_mul_num_num_p_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_int_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_int_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_inc_num_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_dec_num_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_eq_int_p_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_eq_int_p_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_ne_int_p_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_ne_int_p_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_int_p_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_int_p_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_le_int_p_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_le_int_p_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_gt_int_p_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_gt_int_p_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_ge_int_p_i_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_ge_int_p_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_eq_int_int_p_p_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_ne_int_int_p_p_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_lt_int_int_p_p_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_le_int_int_p_p_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_gt_int_int_p_p_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_ge_int_int_p_p_ic(opcode_t *, PARROT_INTERP);
 
 
 #endif /* PARROT_OPLIB_CORE_OPS_H_GUARD */
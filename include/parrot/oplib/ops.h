@@ -1144,7 +1144,51 @@ typedef enum {
     PARROT_OP_pass,                            /* 1127 */
     PARROT_OP_disable_preemption,              /* 1128 */
     PARROT_OP_enable_preemption,               /* 1129 */
-    PARROT_OP_terminate                        /* 1130 */
+    PARROT_OP_terminate,                       /* 1130 */
+    PARROT_OP_find_lex_slot_p_sc_ic_ic_pc,     /* 1131 */
+    PARROT_OP_find_lex_slot_s_sc_ic_ic_pc,     /* 1132 */
+    PARROT_OP_find_lex_slot_i_sc_ic_ic_pc,     /* 1133 */
+    PARROT_OP_find_lex_slot_n_sc_ic_ic_pc,     /* 1134 */
+    PARROT_OP_store_lex_slot_sc_p_ic_ic_pc,    /* 1135 */
+    PARROT_OP_store_lex_slot_sc_s_ic_ic_pc,    /* 1136 */
+    PARROT_OP_store_lex_slot_sc_sc_ic_ic_pc,   /* 1137 */
+    PARROT_OP_store_lex_slot_sc_i_ic_ic_pc,    /* 1138 */
+    PARROT_OP_store_lex_slot_sc_ic_ic_ic_pc,   /* 1139 */
+    PARROT_OP_store_lex_slot_sc_n_ic_ic_pc,    /* 1140 */
+    PARROT_OP_store_lex_slot_sc_nc_ic_ic_pc,   /* 1141 */
+    PARROT_OP_add_int_int_p_p_p,               /* 1142 */
+    PARROT_OP_sub_int_int_p_p_p,               /* 1143 */
+    PARROT_OP_mul_int_int_p_p_p,               /* 1144 */
+    PARROT_OP_mod_int_int_p_p_p,               /* 1145 */
+    PARROT_OP_add_int_p_p_i,                   /* 1146 */
+    PARROT_OP_add_int_p_p_ic,                  /* 1147 */
+    PARROT_OP_sub_int_p_p_i,                   /* 1148 */
+    PARROT_OP_sub_int_p_p_ic,                  /* 1149 */
+    PARROT_OP_add_num_num_p_p_p,               /* 1150 */
+    PARROT_OP_sub_num_num_p_p_p,               /* 1151 */
+    PARROT_OP_mul_num_num_p_p_p,               /* 1152 */
+    PARROT_OP_inc_int_p,                       /* 1153 */
+    PARROT_OP_dec_int_p,                       /* 1154 */
+    PARROT_OP_inc_num_p,                       /* 1155 */
+    PARROT_OP_dec_num_p,                       /* 1156 */
+    PARROT_OP_eq_int_p_i_ic,                   /* 1157 */
+    PARROT_OP_eq_int_p_ic_ic,                  /* 1158 */
+    PARROT_OP_ne_int_p_i_ic,                   /* 1159 */
+    PARROT_OP_ne_int_p_ic_ic,                  /* 1160 */
+    PARROT_OP_lt_int_p_i_ic,                   /* 1161 */
+    PARROT_OP_lt_int_p_ic_ic,                  /* 1162 */
+    PARROT_OP_le_int_p_i_ic,                   /* 1163 */
+    PARROT_OP_le_int_p_ic_ic,                  /* 1164 */
+    PARROT_OP_gt_int_p_i_ic,                   /* 1165 */
+    PARROT_OP_gt_int_p_ic_ic,                  /* 1166 */
+    PARROT_OP_ge_int_p_i_ic,                   /* 1167 */
+    PARROT_OP_ge_int_p_ic_ic,                  /* 1168 */
+    PARROT_OP_eq_int_int_p_p_ic,               /* 1169 */
+    PARROT_OP_ne_int_int_p_p_ic,               /* 1170 */
+    PARROT_OP_lt_int_int_p_p_ic,               /* 1171 */
+    PARROT_OP_le_int_int_p_p_ic,               /* 1172 */
+    PARROT_OP_gt_int_int_p_p_ic,               /* 1173 */
+    PARROT_OP_ge_int_int_p_p_ic                /* 1174 */
 
 } parrot_opcode_enums;
 
@@ -1144,6 +1144,50 @@ enum OPS_ENUM {
     enum_ops_disable_preemption            = 1128,
     enum_ops_enable_preemption             = 1129,
     enum_ops_terminate                     = 1130,
+    enum_ops_find_lex_slot_p_sc_ic_ic_pc   = 1131,
+    enum_ops_find_lex_slot_s_sc_ic_ic_pc   = 1132,
+    enum_ops_find_lex_slot_i_sc_ic_ic_pc   = 1133,
+    enum_ops_find_lex_slot_n_sc_ic_ic_pc   = 1134,
+    enum_ops_store_lex_slot_sc_p_ic_ic_pc  = 1135,
+    enum_ops_store_lex_slot_sc_s_ic_ic_pc  = 1136,
+    enum_ops_store_lex_slot_sc_sc_ic_ic_pc = 1137,
+    enum_ops_store_lex_slot_sc_i_ic_ic_pc  = 1138,
+    enum_ops_store_lex_slot_sc_ic_ic_ic_pc = 1139,
+    enum_ops_store_lex_slot_sc_n_ic_ic_pc  = 1140,
+    enum_ops_store_lex_slot_sc_nc_ic_ic_pc = 1141,
+    enum_ops_add_int_int_p_p_p             = 1142,
+    enum_ops_sub_int_int_p_p_p             = 1143,
+    enum_ops_mul_int_int_p_p_p             = 1144,
+    enum_ops_mod_int_int_p_p_p             = 1145,
+    enum_ops_add_int_p_p_i                 = 1146,
+    enum_ops_add_int_p_p_ic                = 1147,
+    enum_ops_sub_int_p_p_i                 = 1148,
+    enum_ops_sub_int_p_p_ic                = 1149,
+    enum_ops_add_num_num_p_p_p             = 1150,
+    enum_ops_sub_num_num_p_p_p             = 1151,
+    enum_ops_mul_num_num_p_p_p             = 1152,
+    enum_ops_inc_int_p                     = 1153,
+    enum_ops_dec_int_p                     = 1154,
+    enum_ops_inc_num_p                     = 1155,
+    enum_ops_dec_num_p                     = 1156,
+    enum_ops_eq_int_p_i_ic                 = 1157,
+    enum_ops_eq_int_p_ic_ic                = 1158,
+    enum_ops_ne_int_p_i_ic                 = 1159,
+    enum_ops_ne_int_p_ic_ic                = 1160,
+    enum_ops_lt_int_p_i_ic                 = 1161,
+    enum_ops_lt_int_p_ic_ic                = 1162,
+    enum_ops_le_int_p_i_ic                 = 1163,
+    enum_ops_le_int_p_ic_ic                = 1164,
+    enum_ops_gt_int_p_i_ic                 = 1165,
+    enum_ops_gt_int_p_ic_ic                = 1166,
+    enum_ops_ge_int_p_i_ic                 = 1167,
+    enum_ops_ge_int_p_ic_ic                = 1168,
+    enum_ops_eq_int_int_p_p_ic             = 1169,
+    enum_ops_ne_int_int_p_p_ic             = 1170,
+    enum_ops_lt_int_int_p_p_ic             = 1171,
+    enum_ops_le_int_int_p_p_ic             = 1172,
+    enum_ops_gt_int_int_p_p_ic             = 1173,
+    enum_ops_ge_int_int_p_p_ic             = 1174,
 };
 
 
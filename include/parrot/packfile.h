@@ -45,11 +45,14 @@
 **   parrot, pbc_merge, parrot_debugger use 0
 **   pbc_dump, pbc_disassemble use 1 to skip the version check
 **   pbc_dump -h requires 2
+**   8 marks a source buffer that outlives the PackFile, so constants may
+**   point into it instead of copying
 */
 #define PFOPT_NONE            0
 #define PFOPT_UTILS           1
 #define PFOPT_HEADERONLY      2
 #define PFOPT_PMC_FREEZE_ONLY 4
+#define PFOPT_KEEP_SRC        8
 
 /*
 ** Enumerated constants
@@ -219,6 +222,7 @@ struct PackFile_ByteCode {
     op_func_t                    *op_func_table;   /* opcode dispatch table */
     op_func_t                    *save_func_table; /* for when we hijack op_func_table */
     op_info_t                   **op_info_table;
+    Hash                         *deopt_sites;     /* op sites not to quicken again */
     size_t                        n_libdeps;       /* number of library dependancies */
     STRING                      **libdeps;         /* names of prerequisite libraries */
 };
@@ -996,6 +1000,24 @@ void Parrot_pf_mark_packfile(PARROT_INTERP, ARGMOD_NULLOK(PackFile * pf))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/packfile/api.c */
 
+/* HEADERIZER BEGIN: src/packfile/cache.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CANNOT_RETURN_NULL
+PMC * Parrot_pf_cache_compile_file(PARROT_INTERP,
+    ARGIN(PMC *compiler),
+    ARGIN(STRING *path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_Parrot_pf_cache_compile_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(compiler) \
+    , PARROT_ASSERT_ARG(path))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/packfile/cache.c */
+
 /* HEADERIZER BEGIN: src/packfile/output.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -179,6 +179,16 @@ PMC* Parrot_thaw_pbc(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*cursor);
 
+PARROT_EXPORT
+void Parrot_thaw_pbc_constants(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *ct),
+    ARGMOD(const opcode_t **cursor))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*ct)
+        FUNC_MODIFIES(*cursor);
+
 void Parrot_pf_verify_image_string(PARROT_INTERP, ARGIN(STRING *image))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -213,6 +223,10 @@ void Parrot_pf_verify_image_string(PARROT_INTERP, ARGIN(STRING *image))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ct) \
     , PARROT_ASSERT_ARG(cursor))
+#define ASSERT_ARGS_Parrot_thaw_pbc_constants __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ct) \
+    , PARROT_ASSERT_ARG(cursor))
 #define ASSERT_ARGS_Parrot_pf_verify_image_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(image))
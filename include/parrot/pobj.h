@@ -81,6 +81,12 @@ typedef enum Forward_flag {
 
 /* Here is the Parrot string header object, "inheriting" from Buffer. */
 
+/* Strings of up to this many bytes keep their contents in the header
+   itself instead of in a variable size pool. See
+   Parrot_gc_str_allocate_string_storage in src/gc/string_gc.c. */
+
+#define STRING_INLINE_SIZE 8
+
 struct parrot_string_t {
     Parrot_UInt flags;
     void *     _bufstart;
@@ -93,8 +99,15 @@ struct parrot_string_t {
 
     /*    parrot_string_representation_t representation;*/
     const struct _str_vtable *encoding; /* Pointer to string vtable. */
+    char        inline_buf[STRING_INLINE_SIZE]; /* Storage for short strings. */
 };
 
+/* True if the string's contents live in its own header. Such strings are
+   flagged external so the GC neither moves nor frees their storage. */
+
+#define STRING_is_inline(s) \
+    ((const char *)Buffer_bufstart(s) == (const char *)(s)->inline_buf)
+
 /* Here is the Parrot PMC object, "inheriting" from PObj. */
 
 struct PMC {
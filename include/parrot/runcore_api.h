@@ -36,7 +36,8 @@ struct runcore_t {
 
 typedef enum Parrot_runcore_flags {
     RUNCORE_REENTRANT_FLAG    = 1 << 0,
-    RUNCORE_FUNC_TABLE_FLAG   = 1 << 1
+    RUNCORE_FUNC_TABLE_FLAG   = 1 << 1,
+    RUNCORE_QUICKEN_FLAG      = 1 << 2
 } Parrot_runcore_flags;
 
 
@@ -50,6 +51,11 @@ typedef enum Parrot_runcore_flags {
 #define PARROT_RUNCORE_FUNC_TABLE_SET(runcore) \
     Runcore_flag_SET(runcore, RUNCORE_FUNC_TABLE_FLAG)
 
+#define PARROT_RUNCORE_QUICKEN_TEST(runcore) \
+    Runcore_flag_TEST(runcore, RUNCORE_QUICKEN_FLAG)
+#define PARROT_RUNCORE_QUICKEN_SET(runcore) \
+    Runcore_flag_SET(runcore, RUNCORE_QUICKEN_FLAG)
+
 /* HEADERIZER BEGIN: src/runcore/main.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -64,6 +70,10 @@ void Parrot_dynop_register(PARROT_INTERP, ARGIN(PMC *lib_pmc))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+void Parrot_runcore_build_op_hash(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 void Parrot_runcore_disable_event_checking(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -87,12 +97,25 @@ void parrot_hash_oplib(PARROT_INTERP, ARGIN(op_lib_t *lib))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_CAN_RETURN_NULL
+opcode_t * Parrot_runcore_deopt_op(PARROT_INTERP, ARGMOD(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pc);
+
 void Parrot_runcore_destroy(PARROT_INTERP)
         __attribute__nonnull__(1);
 
 void Parrot_runcore_init(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+void Parrot_runcore_quicken_op(PARROT_INTERP,
+    ARGMOD(opcode_t *pc),
+    INTVAL base_type)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*pc);
+
 void prepare_for_run(PARROT_INTERP)
         __attribute__nonnull__(1);
 
@@ -105,6 +128,8 @@ void runops_int(PARROT_INTERP, size_t offset)
 #define ASSERT_ARGS_Parrot_dynop_register __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lib_pmc))
+#define ASSERT_ARGS_Parrot_runcore_build_op_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_disable_event_checking \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
@@ -120,10 +145,16 @@ void runops_int(PARROT_INTERP, size_t offset)
 #define ASSERT_ARGS_parrot_hash_oplib __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lib))
+#define ASSERT_ARGS_Parrot_runcore_deopt_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_Parrot_runcore_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_runcore_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_runcore_quicken_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_prepare_for_run __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_runops_int __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
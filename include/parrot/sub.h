@@ -220,6 +220,16 @@ PMC* Parrot_sub_find_dynamic_pad(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_sub_find_indexed_ctx(PARROT_INTERP,
+    ARGIN(PMC *ctx),
+    INTVAL depth,
+    ARGIN(PMC *lex_info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4);
+
 PARROT_CAN_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 PMC* Parrot_sub_find_pad(PARROT_INTERP,
@@ -270,6 +280,10 @@ INTVAL Parrot_sub_get_line_from_pc(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lex_name) \
     , PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_Parrot_sub_find_indexed_ctx __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx) \
+    , PARROT_ASSERT_ARG(lex_info))
 #define ASSERT_ARGS_Parrot_sub_find_pad __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lex_name) \
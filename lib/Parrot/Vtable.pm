@@ -199,6 +199,7 @@ EOF
 
     $struct .= <<'EOF';
     UINTVAL attr_size;      /* Size of the attributes struct */
+    UINTVAL *isa_bits;      /* Type ids this type isa, built on demand */
 EOF
 
     $struct .= "} _vtable;\n";
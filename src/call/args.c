@@ -52,6 +52,14 @@ typedef struct pcc_funcs_ptr {
     pmc_func_t      pmc_constant;
 } pcc_funcs_ptr;
 
+/* Signature arrays remember whether they hold plain positionals only; see
+ * simple_positional_sig(). */
+#define PObj_sig_classified_FLAG PObj_private0_FLAG
+#define PObj_sig_simple_FLAG     PObj_private1_FLAG
+
+/* Flags allowed in a plain positional signature besides the type. */
+#define SIMPLE_SIG_FLAGS (PARROT_ARG_TYPE_MASK | PARROT_ARG_CONSTANT | PARROT_ARG_INVOCANT)
+
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -97,6 +105,28 @@ static void fill_params(PARROT_INTERP,
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*call_object);
 
+PARROT_WARN_UNUSED_RESULT
+static int fill_simple_params_from_op(PARROT_INTERP,
+    ARGIN(PMC *call_object),
+    ARGIN(PMC *raw_sig),
+    ARGIN(const opcode_t *raw_params))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+static void fill_simple_positionals_from_op(PARROT_INTERP,
+    ARGIN(PMC *call_object),
+    ARGIN(PMC *ctx),
+    ARGIN(const INTVAL *int_array),
+    INTVAL arg_count,
+    ARGIN(const opcode_t *raw_args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(6);
+
 PARROT_WARN_UNUSED_RESULT
 static INTVAL intval_constant_from_op(PARROT_INTERP,
     ARGIN(const opcode_t *raw_params),
@@ -209,6 +239,11 @@ static void set_call_from_varargs(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*args);
 
+PARROT_WARN_UNUSED_RESULT
+static int simple_positional_sig(PARROT_INTERP, ARGIN(PMC *raw_sig))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING* string_constant_from_op(PARROT_INTERP,
@@ -258,6 +293,18 @@ static STRING** string_param_from_op(PARROT_INTERP,
     , PARROT_ASSERT_ARG(raw_sig) \
     , PARROT_ASSERT_ARG(arg_info) \
     , PARROT_ASSERT_ARG(accessor))
+#define ASSERT_ARGS_fill_simple_params_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(call_object) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_params))
+#define ASSERT_ARGS_fill_simple_positionals_from_op \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(call_object) \
+    , PARROT_ASSERT_ARG(ctx) \
+    , PARROT_ASSERT_ARG(int_array) \
+    , PARROT_ASSERT_ARG(raw_args))
 #define ASSERT_ARGS_intval_constant_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(raw_params))
 #define ASSERT_ARGS_intval_constant_from_varargs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -299,6 +346,9 @@ static STRING** string_param_from_op(PARROT_INTERP,
     , PARROT_ASSERT_ARG(signature) \
     , PARROT_ASSERT_ARG(sig) \
     , PARROT_ASSERT_ARG(args))
+#define ASSERT_ARGS_simple_positional_sig __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(raw_sig))
 #define ASSERT_ARGS_string_constant_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_params))
@@ -352,6 +402,12 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
     GETATTR_FixedIntegerArray_size(interp, raw_sig, arg_count);
     GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
 
+    if (arg_count && simple_positional_sig(interp, raw_sig)) {
+        fill_simple_positionals_from_op(interp, call_object, ctx,
+                int_array, arg_count, raw_args);
+        return call_object;
+    }
+
     for (; arg_index < arg_count; ++arg_index) {
         const INTVAL arg_flags = int_array[arg_index];
         const int constant = 0 != PARROT_ARG_CONSTANT_ISSET(arg_flags);
@@ -425,6 +481,124 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
 
 /*
 
+=item C<static int simple_positional_sig(PARROT_INTERP, PMC *raw_sig)>
+
+Returns true if the signature array C<raw_sig> describes plain positional
+arguments or parameters only: no named, optional, slurpy, flattened,
+lookahead or C<:call_sig> entries. The answer is cached in the flags of
+C<raw_sig>, which is the constant signature of a single call site, so each
+signature is classified once.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+simple_positional_sig(PARROT_INTERP, ARGIN(PMC *raw_sig))
+{
+    ASSERT_ARGS(simple_positional_sig)
+
+    if (!PObj_flag_TEST(sig_classified, raw_sig)) {
+        INTVAL *int_array;
+        INTVAL  count, i;
+        int     simple = raw_sig->vtable->base_type == enum_class_FixedIntegerArray;
+
+        if (simple) {
+            GETATTR_FixedIntegerArray_size(interp, raw_sig, count);
+            GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
+
+            for (i = 0; i < count; ++i)
+                if (int_array[i] & ~SIMPLE_SIG_FLAGS) {
+                    simple = 0;
+                    break;
+                }
+        }
+
+        if (simple)
+            PObj_flag_SET(sig_simple, raw_sig);
+        PObj_flag_SET(sig_classified, raw_sig);
+    }
+
+    return PObj_flag_TEST(sig_simple, raw_sig);
+}
+
+/*
+
+=item C<static void fill_simple_positionals_from_op(PARROT_INTERP, PMC
+*call_object, PMC *ctx, const INTVAL *int_array, INTVAL arg_count, const
+opcode_t *raw_args)>
+
+Fills the positional cells of C<call_object> straight from the registers
+and constants named by a set_args or set_returns op whose signature has
+passed C<simple_positional_sig>. This skips the per-argument flag decoding
+and storage checks of C<Parrot_pcc_build_sig_object_from_op>.
+
+=cut
+
+*/
+
+static void
+fill_simple_positionals_from_op(PARROT_INTERP, ARGIN(PMC *call_object),
+        ARGIN(PMC *ctx), ARGIN(const INTVAL *int_array), INTVAL arg_count,
+        ARGIN(const opcode_t *raw_args))
+{
+    ASSERT_ARGS(fill_simple_positionals_from_op)
+    Pcc_cell * const cells = Parrot_pcc_reserve_positionals(interp, call_object, arg_count);
+    INTVAL           i;
+
+    for (i = 0; i < arg_count; ++i) {
+        const INTVAL arg_flags = int_array[i];
+        const INTVAL raw_index = raw_args[i + 2];
+        Pcc_cell * const cell  = &cells[i];
+
+        if (PARROT_ARG_CONSTANT_ISSET(arg_flags)) {
+            switch (PARROT_ARG_TYPE_MASK_MASK(arg_flags)) {
+              case PARROT_ARG_INTVAL:
+                cell->u.i  = raw_index;
+                cell->type = INTCELL;
+                break;
+              case PARROT_ARG_FLOATVAL:
+                cell->u.n  = Parrot_pcc_get_num_constant(interp, ctx, raw_index);
+                cell->type = FLOATCELL;
+                break;
+              case PARROT_ARG_STRING:
+                cell->u.s  = Parrot_pcc_get_string_constant(interp, ctx, raw_index);
+                cell->type = STRINGCELL;
+                break;
+              default:
+                cell->u.p  = Parrot_pcc_get_pmc_constant(interp, ctx, raw_index);
+                cell->type = PMCCELL;
+                break;
+            }
+        }
+        else {
+            switch (PARROT_ARG_TYPE_MASK_MASK(arg_flags)) {
+              case PARROT_ARG_INTVAL:
+                cell->u.i  = CTX_REG_INT(interp, ctx, raw_index);
+                cell->type = INTCELL;
+                break;
+              case PARROT_ARG_FLOATVAL:
+                cell->u.n  = CTX_REG_NUM(interp, ctx, raw_index);
+                cell->type = FLOATCELL;
+                break;
+              case PARROT_ARG_STRING:
+                cell->u.s  = CTX_REG_STR(interp, ctx, raw_index);
+                cell->type = STRINGCELL;
+                break;
+              default:
+                cell->u.p  = CTX_REG_PMC(interp, ctx, raw_index);
+                cell->type = PMCCELL;
+                PARROT_ASSERT(cell->u.p
+                    || !"CallContext: Empty PMC argument");
+                break;
+            }
+        }
+    }
+}
+
+/*
+
 =item C<static void extract_named_arg_from_op(PARROT_INTERP, PMC *call_object,
 STRING *name, PMC *raw_sig, opcode_t *raw_args, INTVAL arg_index)>
 
@@ -1327,11 +1501,84 @@ Parrot_pcc_fill_params_from_op(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
         (pmc_func_t)pmc_constant_from_op,
     };
 
+    if (!PMC_IS_NULL(call_object)
+    &&  simple_positional_sig(interp, raw_sig)
+    &&  fill_simple_params_from_op(interp, call_object, raw_sig, raw_params))
+        return;
+
     fill_params(interp, call_object, raw_sig, raw_params, &function_pointers, direction);
 }
 
 /*
 
+=item C<static int fill_simple_params_from_op(PARROT_INTERP, PMC *call_object,
+PMC *raw_sig, const opcode_t *raw_params)>
+
+Fast path of C<Parrot_pcc_fill_params_from_op> for a get_params or
+get_results op whose signature has passed C<simple_positional_sig>. If
+C<call_object> holds exactly as many positionals as there are parameters,
+no named arguments, and every argument already has the type of its
+parameter, copies the arguments into the registers and returns true.
+Otherwise returns false, and the caller must fall back to C<fill_params>,
+which handles conversions and reports errors.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+fill_simple_params_from_op(PARROT_INTERP, ARGIN(PMC *call_object),
+        ARGIN(PMC *raw_sig), ARGIN(const opcode_t *raw_params))
+{
+    ASSERT_ARGS(fill_simple_params_from_op)
+    /* Cell type expected for each PARROT_ARG_* type. */
+    static const INTVAL cell_type[] = { INTCELL, STRINGCELL, PMCCELL, FLOATCELL };
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+    Pcc_cell   *cells;
+    Hash       *hash;
+    INTVAL     *int_array;
+    INTVAL      param_count, positional_args, i;
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, param_count);
+    GETATTR_CallContext_num_positionals(interp, call_object, positional_args);
+    GETATTR_CallContext_hash(interp, call_object, hash);
+
+    if (param_count != positional_args || (hash && hash->entries))
+        return 0;
+
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, int_array);
+    GETATTR_CallContext_positionals(interp, call_object, cells);
+
+    /* Check every type before writing any register. */
+    for (i = 0; i < param_count; ++i)
+        if (cells[i].type != cell_type[PARROT_ARG_TYPE_MASK_MASK(int_array[i])])
+            return 0;
+
+    for (i = 0; i < param_count; ++i) {
+        const INTVAL raw_index = raw_params[i + 2];
+
+        switch (PARROT_ARG_TYPE_MASK_MASK(int_array[i])) {
+          case PARROT_ARG_INTVAL:
+            CTX_REG_INT(interp, ctx, raw_index) = cells[i].u.i;
+            break;
+          case PARROT_ARG_FLOATVAL:
+            CTX_REG_NUM(interp, ctx, raw_index) = cells[i].u.n;
+            break;
+          case PARROT_ARG_STRING:
+            CTX_REG_STR(interp, ctx, raw_index) = cells[i].u.s;
+            break;
+          default:
+            CTX_REG_PMC(interp, ctx, raw_index) = cells[i].u.p;
+            break;
+        }
+    }
+
+    return 1;
+}
+
+/*
+
 =item C<void Parrot_pcc_fill_params_from_c_args(PARROT_INTERP, PMC *call_object,
 const char *signature, ...)>
 
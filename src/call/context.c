@@ -63,6 +63,29 @@ an available context is stored corresponds to the size of the context.
         / SLOT_CHUNK_SIZE) * SLOT_CHUNK_SIZE)
 #define CALCULATE_SLOT_NUM(size) ((size) / SLOT_CHUNK_SIZE)
 
+/*
+
+=head2 Frame Stack
+
+Register frames of plain sub calls are allocated LIFO from a per-interpreter
+stack of chunks instead of the fixed-size heap.  Each frame starts with a
+C<Parrot_Frame> header naming the context that owns it.  When control returns
+below a frame, the frame is popped; if its context has escaped (it is the
+outer of a closure, owns a lexpad, or may be resumed by a captured
+continuation) its registers are first copied to the heap.
+
+=cut
+
+*/
+
+#define FRAME_CHUNK_SIZE        (64 * 1024)
+#define FRAME_HEADER_SIZE       ROUND_ALLOC_SIZE(sizeof (Parrot_Frame))
+#define FRAME_CHUNK_HEADER_SIZE ROUND_ALLOC_SIZE(sizeof (Parrot_Frame_chunk))
+#define FRAME_CHUNK_BASE(chunk) ((char *)(chunk) + FRAME_CHUNK_HEADER_SIZE)
+
+/* How far up the caller chain to look for a context on the frame stack */
+#define FRAME_UNWIND_SEARCH_DEPTH 8
+
 
 /* HEADERIZER HFILE: include/parrot/call.h */
 
@@ -71,7 +94,8 @@ an available context is stored corresponds to the size of the context.
 
 static void allocate_registers(PARROT_INTERP,
     ARGIN(PMC *pmcctx),
-    ARGIN(const UINTVAL *number_regs_used))
+    ARGIN(const UINTVAL *number_regs_used),
+    int on_frame_stack)
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
@@ -92,6 +116,10 @@ static PMC* init_context(ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*pmcctx);
 
+PARROT_CANNOT_RETURN_NULL
+static Parrot_Frame_chunk * new_frame_chunk(PARROT_INTERP, size_t size)
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 static size_t Parrot_pcc_calculate_registers_size(PARROT_INTERP,
@@ -99,6 +127,23 @@ static size_t Parrot_pcc_calculate_registers_size(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void pop_frame(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+static void promote_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+static void * push_frame(PARROT_INTERP,
+    ARGIN(PMC *pmcctx),
+    size_t reg_alloc)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void release_registers(ARGIN(PMC *pmcctx))
+        __attribute__nonnull__(1);
+
 static void set_context(PARROT_INTERP, ARGIN(PMC *ctx))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -114,10 +159,22 @@ static void set_context(PARROT_INTERP, ARGIN(PMC *ctx))
     , PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_init_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pmcctx))
+#define ASSERT_ARGS_new_frame_chunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_pcc_calculate_registers_size \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(number_regs_used))
+#define ASSERT_ARGS_pop_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_promote_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx))
+#define ASSERT_ARGS_push_frame __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmcctx))
+#define ASSERT_ARGS_release_registers __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(pmcctx))
 #define ASSERT_ARGS_set_context __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ctx))
@@ -388,15 +445,17 @@ Parrot_pcc_calculate_registers_size(PARROT_INTERP, ARGIN(const UINTVAL *number_r
 /*
 
 =item C<static void allocate_registers(PARROT_INTERP, PMC *pmcctx, const UINTVAL
-*number_regs_used)>
+*number_regs_used, int on_frame_stack)>
 
-Allocate registers inside Context.
+Allocate registers inside Context, either on the frame stack or from the
+fixed-size heap.
 
 =cut
 
 */
 static void
-allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx), ARGIN(const UINTVAL *number_regs_used))
+allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx), ARGIN(const UINTVAL *number_regs_used),
+        int on_frame_stack)
 {
     ASSERT_ARGS(allocate_registers)
     Parrot_CallContext_attributes *ctx = PARROT_CALLCONTEXT(pmcctx);
@@ -420,7 +479,10 @@ allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx), ARGIN(const UINTVAL *numbe
         return;
     }
     /* don't allocate any storage if there are no registers */
-    ctx->registers = (Parrot_Context *)Parrot_gc_allocate_fixed_size_storage(interp, reg_alloc);
+    if (on_frame_stack)
+        ctx->registers = push_frame(interp, pmcctx, reg_alloc);
+    else
+        ctx->registers = Parrot_gc_allocate_fixed_size_storage(interp, reg_alloc);
 
     /* ctx.bp points to I0, which has Nx on the left */
     ctx->bp.regs_i = (INTVAL *)((char *)ctx->registers + size_n);
@@ -432,6 +494,177 @@ allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx), ARGIN(const UINTVAL *numbe
 }
 
 
+/*
+
+=item C<static void * push_frame(PARROT_INTERP, PMC *pmcctx, size_t reg_alloc)>
+
+Pushes a frame holding C<reg_alloc> bytes of registers for C<pmcctx> onto the
+frame stack and returns the register storage.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static void *
+push_frame(PARROT_INTERP, ARGIN(PMC *pmcctx), size_t reg_alloc)
+{
+    ASSERT_ARGS(push_frame)
+    Parrot_Frame_chunk *chunk = interp->frame_chunk;
+    const size_t        size  = FRAME_HEADER_SIZE + reg_alloc;
+    Parrot_Frame       *frame;
+
+    if (!chunk || (size_t)(chunk->limit - chunk->top) < size)
+        chunk = new_frame_chunk(interp, size);
+
+    frame        = (Parrot_Frame *)chunk->top;
+    frame->prev  = interp->frame_top;
+    frame->ctx   = pmcctx;
+    chunk->top  += size;
+
+    interp->frame_top = frame;
+    CALLSIGNATURE_on_frame_stack_SET(pmcctx);
+
+    return (char *)frame + FRAME_HEADER_SIZE;
+}
+
+
+/*
+
+=item C<static Parrot_Frame_chunk * new_frame_chunk(PARROT_INTERP, size_t size)>
+
+Pushes a chunk with room for at least C<size> bytes onto the frame stack,
+reusing the spare chunk when it is big enough.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Parrot_Frame_chunk *
+new_frame_chunk(PARROT_INTERP, size_t size)
+{
+    ASSERT_ARGS(new_frame_chunk)
+    Parrot_Frame_chunk *chunk = interp->spare_frame_chunk;
+
+    if (chunk && (size_t)(chunk->limit - FRAME_CHUNK_BASE(chunk)) >= size)
+        interp->spare_frame_chunk = NULL;
+    else {
+        const size_t chunk_size = size + FRAME_CHUNK_HEADER_SIZE > FRAME_CHUNK_SIZE
+                                ? size + FRAME_CHUNK_HEADER_SIZE
+                                : FRAME_CHUNK_SIZE;
+
+        chunk        = (Parrot_Frame_chunk *)mem_internal_allocate(chunk_size);
+        chunk->limit = (char *)chunk + chunk_size;
+    }
+
+    chunk->prev         = interp->frame_chunk;
+    chunk->top          = FRAME_CHUNK_BASE(chunk);
+    interp->frame_chunk = chunk;
+
+    return chunk;
+}
+
+
+/*
+
+=item C<static void pop_frame(PARROT_INTERP)>
+
+Pops the topmost frame off the frame stack.  The registers of an escaped
+context are moved to the heap; any other context loses its registers.
+
+=cut
+
+*/
+
+static void
+pop_frame(PARROT_INTERP)
+{
+    ASSERT_ARGS(pop_frame)
+    Parrot_Frame       * const frame = interp->frame_top;
+    Parrot_Frame_chunk * const chunk = interp->frame_chunk;
+    PMC                * const ctx   = frame->ctx;
+
+    if (ctx) {
+        if (CALLSIGNATURE_escaped_TEST(ctx))
+            promote_registers(interp, ctx);
+        else
+            release_registers(ctx);
+    }
+
+    interp->frame_top = frame->prev;
+    chunk->top        = (char *)frame;
+
+    /* keep the emptied chunk around; programs tend to recurse to the same depth */
+    if (chunk->top == FRAME_CHUNK_BASE(chunk) && chunk->prev) {
+        interp->frame_chunk = chunk->prev;
+
+        if (interp->spare_frame_chunk)
+            mem_internal_free(interp->spare_frame_chunk);
+
+        interp->spare_frame_chunk = chunk;
+    }
+}
+
+
+/*
+
+=item C<static void promote_registers(PARROT_INTERP, PMC *pmcctx)>
+
+Moves the registers of C<pmcctx> from the frame stack to the fixed-size heap.
+
+=cut
+
+*/
+
+static void
+promote_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
+{
+    ASSERT_ARGS(promote_registers)
+    Parrot_Context * const ctx  = CONTEXT_STRUCT(pmcctx);
+    const size_t           size = calculate_registers_size(interp, ctx->n_regs_used);
+    char           * const from = (char *)ctx->registers;
+    char           * const to   = (char *)Parrot_gc_allocate_fixed_size_storage(interp, size);
+
+    memcpy(to, from, size);
+
+    ctx->registers    = to;
+    ctx->bp.regs_i    = (INTVAL *)(to + ((char *)ctx->bp.regs_i - from));
+    ctx->bp_ps.regs_s = (STRING **)(to + ((char *)ctx->bp_ps.regs_s - from));
+
+    CALLSIGNATURE_on_frame_stack_CLEAR(pmcctx);
+}
+
+
+/*
+
+=item C<static void release_registers(PMC *pmcctx)>
+
+Forgets the frame stack registers of C<pmcctx>.  The context cannot run again,
+so it keeps no registers at all.
+
+=cut
+
+*/
+
+static void
+release_registers(ARGIN(PMC *pmcctx))
+{
+    ASSERT_ARGS(release_registers)
+    Parrot_Context * const ctx = CONTEXT_STRUCT(pmcctx);
+
+    ctx->registers              = NULL;
+    ctx->bp.regs_i              = NULL;
+    ctx->bp_ps.regs_s           = NULL;
+    ctx->n_regs_used[REGNO_INT] = 0;
+    ctx->n_regs_used[REGNO_NUM] = 0;
+    ctx->n_regs_used[REGNO_STR] = 0;
+    ctx->n_regs_used[REGNO_PMC] = 0;
+
+    CALLSIGNATURE_on_frame_stack_CLEAR(pmcctx);
+}
+
+
 /*
 
 =item C<static void clear_regs(PARROT_INTERP, Parrot_Context *ctx)>
@@ -490,7 +723,32 @@ Parrot_pcc_allocate_registers(PARROT_INTERP, ARGIN(PMC *pmcctx),
     ||  number_regs_used[1]
     ||  number_regs_used[2]
     ||  number_regs_used[3])
-        allocate_registers(interp, pmcctx, number_regs_used);
+        allocate_registers(interp, pmcctx, number_regs_used, 0);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_allocate_frame_registers(PARROT_INTERP, PMC *pmcctx,
+const UINTVAL *number_regs_used)>
+
+Allocate registers in Context on the frame stack.  They stay valid until
+control returns below the context; see C<Parrot_pcc_unwind_frames>.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_allocate_frame_registers(PARROT_INTERP, ARGIN(PMC *pmcctx),
+        ARGIN(const UINTVAL *number_regs_used))
+{
+    ASSERT_ARGS(Parrot_pcc_allocate_frame_registers)
+    if (number_regs_used[0]
+    ||  number_regs_used[1]
+    ||  number_regs_used[2]
+    ||  number_regs_used[3])
+        allocate_registers(interp, pmcctx, number_regs_used, 1);
 }
 
 
@@ -513,11 +771,174 @@ Parrot_pcc_free_registers(PARROT_INTERP, ARGIN(PMC *pmcctx))
     const size_t reg_size =
         Parrot_pcc_calculate_registers_size(interp, ctx->n_regs_used);
 
-    if (reg_size)
+    if (CALLSIGNATURE_on_frame_stack_TEST(pmcctx)) {
+        Parrot_Frame * const frame = (Parrot_Frame *)
+            ((char *)ctx->registers - FRAME_HEADER_SIZE);
+
+        /* the frame itself goes away with the next unwind */
+        frame->ctx = NULL;
+        release_registers(pmcctx);
+    }
+    else if (reg_size)
         Parrot_gc_free_fixed_size_storage(interp, reg_size, ctx->registers);
 }
 
 
+/*
+
+=item C<void Parrot_pcc_unwind_frames(PARROT_INTERP, PMC *to_ctx)>
+
+Pops the frames which are no longer needed now that C<to_ctx> runs: all
+frames above the nearest context in the call chain of C<to_ctx> which lives
+on the frame stack.  Frames a C runloop still waits for are never popped.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_unwind_frames(PARROT_INTERP, ARGIN(PMC *to_ctx))
+{
+    ASSERT_ARGS(Parrot_pcc_unwind_frames)
+    Parrot_Frame * const floor  = interp->current_runloop
+                                ? interp->current_runloop->frame_floor
+                                : NULL;
+    Parrot_Frame        *keep   = NULL;
+    PMC                 *ctx    = to_ctx;
+    int                  depth;
+
+    if (interp->frame_top == floor)
+        return;
+
+    for (depth = 0; !PMC_IS_NULL(ctx); ++depth) {
+        if (ctx->vtable->base_type != enum_class_CallContext)
+            return;
+
+        if (CALLSIGNATURE_on_frame_stack_TEST(ctx)) {
+            keep = (Parrot_Frame *)
+                ((char *)CONTEXT_STRUCT(ctx)->registers - FRAME_HEADER_SIZE);
+            break;
+        }
+
+        /* leaving frames in place is always safe */
+        if (depth == FRAME_UNWIND_SEARCH_DEPTH)
+            return;
+
+        ctx = CONTEXT_STRUCT(ctx)->caller_ctx;
+    }
+
+    while (interp->frame_top != keep && interp->frame_top != floor)
+        pop_frame(interp);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_pop_tailcall_frame(PARROT_INTERP, PMC *ctx)>
+
+Pops the frame of C<ctx>, which just made a tail call, so that the callee
+takes its place.  The frame stays if it is not the topmost one or a C runloop
+still waits for it.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_pop_tailcall_frame(PARROT_INTERP, ARGIN(PMC *ctx))
+{
+    ASSERT_ARGS(Parrot_pcc_pop_tailcall_frame)
+    Parrot_Frame * const top = interp->frame_top;
+
+    if (CALLSIGNATURE_on_frame_stack_TEST(ctx)
+    &&  top->ctx == ctx
+    &&  !(interp->current_runloop && interp->current_runloop->frame_floor == top))
+        pop_frame(interp);
+}
+
+/*
+
+=item C<void Parrot_pcc_mark_escaped(PARROT_INTERP, PMC *ctx)>
+
+Notes that C<ctx> may be used after it returns, e.g. as the outer context of
+a closure, so its registers must survive the popping of its frame.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_mark_escaped(SHIM_INTERP, ARGIN(PMC *ctx))
+{
+    ASSERT_ARGS(Parrot_pcc_mark_escaped)
+    CALLSIGNATURE_escaped_SET(ctx);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_mark_chain_escaped(PARROT_INTERP, PMC *ctx)>
+
+Notes that C<ctx> may be resumed after it returns, e.g. through a captured
+continuation.  As it then returns to its callers in turn, they escape too.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_mark_chain_escaped(SHIM_INTERP, ARGIN_NULLOK(PMC *ctx))
+{
+    ASSERT_ARGS(Parrot_pcc_mark_chain_escaped)
+
+    while (!PMC_IS_NULL(ctx)
+    &&     ctx->vtable->base_type == enum_class_CallContext
+    &&     !CALLSIGNATURE_chain_escaped_TEST(ctx)) {
+        CALLSIGNATURE_escaped_SET(ctx);
+        CALLSIGNATURE_chain_escaped_SET(ctx);
+        ctx = CONTEXT_STRUCT(ctx)->caller_ctx;
+    }
+}
+
+
+/*
+
+=item C<void Parrot_pcc_destroy_frame_stack(PARROT_INTERP)>
+
+Detaches the contexts still living on the frame stack and frees its chunks.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_destroy_frame_stack(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_destroy_frame_stack)
+    Parrot_Frame_chunk *chunk = interp->frame_chunk;
+    Parrot_Frame       *frame;
+
+    for (frame = interp->frame_top; frame; frame = frame->prev)
+        if (frame->ctx)
+            release_registers(frame->ctx);
+
+    while (chunk) {
+        Parrot_Frame_chunk * const prev = chunk->prev;
+        mem_internal_free(chunk);
+        chunk = prev;
+    }
+
+    if (interp->spare_frame_chunk)
+        mem_internal_free(interp->spare_frame_chunk);
+
+    interp->frame_top         = NULL;
+    interp->frame_chunk       = NULL;
+    interp->spare_frame_chunk = NULL;
+}
+
+
 /*
 
 =item C<PMC * Parrot_alloc_context(PARROT_INTERP, const UINTVAL
@@ -543,7 +964,7 @@ Parrot_alloc_context(PARROT_INTERP, ARGIN(const UINTVAL *number_regs_used),
     ASSERT_ARGS(Parrot_alloc_context)
     PMC * const pmcctx = Parrot_pmc_new(interp, enum_class_CallContext);
 
-    allocate_registers(interp, pmcctx, number_regs_used);
+    allocate_registers(interp, pmcctx, number_regs_used, 0);
     return init_context(pmcctx, old);
 }
 
@@ -884,17 +1305,29 @@ Parrot_pcc_reuse_continuation(PARROT_INTERP, ARGIN(PMC *call_context), ARGIN_NUL
     if (!PMC_IS_NULL(cont)) {
         INTVAL  invoked;
         GETATTR_Continuation_invoked(interp, cont, invoked);
-        /* Reuse if invoked. And not tailcalled? */
-        reuse = invoked && !(PObj_get_FLAGS(cont) |= SUB_FLAG_TAILCALL);
+        /* Reuse if the last call returned through it, unless it was passed
+         * on by a tail call or may have been captured */
+        reuse = invoked
+             && !(PObj_get_FLAGS(cont) & SUB_FLAG_TAILCALL)
+             && !CALLSIGNATURE_escaped_TEST(call_context);
     }
 
     if (!reuse || !PMC_data(cont)) {
-        cont = Parrot_pmc_new(interp, enum_class_Continuation);
+        cont            = Parrot_pmc_new(interp, enum_class_Continuation);
+        c->continuation = cont;
+        PARROT_GC_WRITE_BARRIER(interp, call_context);
 #ifndef NDEBUG
         if (Interp_trace_TEST(interp, PARROT_TRACE_CORO_STATE_FLAG))
             Parrot_io_eprintf(interp, "# continuation not reused\n");
+#endif
     }
     else {
+        /* a coroutine may have redirected it to its latest caller */
+        SETATTR_Continuation_to_ctx(interp, cont, call_context);
+        SETATTR_Continuation_to_call_object(interp, cont, c->current_sig);
+        SETATTR_Continuation_seg(interp, cont, interp->code);
+        SETATTR_Continuation_invoked(interp, cont, 0);
+#ifndef NDEBUG
         if (Interp_trace_TEST(interp, PARROT_TRACE_CORO_STATE_FLAG))
             Parrot_io_eprintf(interp, "# continuation reused\n");
 #endif
@@ -185,6 +185,7 @@ Parrot_runloop_new_jump_point(PARROT_INTERP)
 
     jump_point->prev           = interp->current_runloop;
     jump_point->id             = ++interp->runloop_id_counter;
+    jump_point->frame_floor    = interp->frame_top;
     interp->current_runloop    = jump_point;
     interp->current_runloop_id = jump_point->id;
     ++interp->current_runloop_level;
@@ -211,7 +211,7 @@ is_invokable(PARROT_INTERP, ARGIN(PMC *sub_obj))
 {
     ASSERT_ARGS(is_invokable)
 
-    if (VTABLE_isa(interp, sub_obj, CONST_STRING(interp, "Sub")))
+    if (Parrot_pmc_isa_type(interp, sub_obj, enum_class_Sub))
         return 1;
     else
         return VTABLE_does(interp, sub_obj, CONST_STRING(interp, "invokable"));
@@ -306,6 +306,9 @@ Parrot_pcc_invoke_from_sig_object(PARROT_INTERP, ARGIN(PMC *sub_obj),
 
         runops(interp, offset);
         Interp_core_SET(interp, old_core);
+
+        /* the frames of the called sub are not needed anymore */
+        Parrot_pcc_unwind_frames(interp, CURRENT_CONTEXT(interp));
     }
 }
 
@@ -591,9 +591,9 @@ Parrot_ex_get_current_handler(PARROT_INTERP, ARGIN_NULLOK(PMC *expmc))
         /* If isa ExceptionHandler, use it. If isa Exception, get its active handler */
         if (expmc->vtable->base_type == enum_class_Exception)
             GETATTR_Exception_handler(interp, expmc, eh);
-        else if (VTABLE_isa(interp, expmc, CONST_STRING(interp, "ExceptionHandler")))
+        else if (Parrot_pmc_isa_type(interp, expmc, enum_class_ExceptionHandler))
             eh = expmc;
-        else if (VTABLE_isa(interp, expmc, CONST_STRING(interp, "Exception")))
+        else if (Parrot_pmc_isa_type(interp, expmc, enum_class_Exception))
             eh = VTABLE_get_attr_str(interp, expmc, CONST_STRING(interp, "handler"));
     }
     return eh;
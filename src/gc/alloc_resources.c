@@ -227,9 +227,34 @@ merge_pools(ARGMOD(Variable_Size_Pool *dest), ARGMOD(Variable_Size_Pool *source)
         cur_block = next_block;
     }
 
+    /* Large blocks just move over to the other list */
+    while (source->large_blocks) {
+        cur_block            = source->large_blocks;
+        source->large_blocks = cur_block->next;
+
+        cur_block->prev      = NULL;
+        cur_block->next      = dest->large_blocks;
+        if (dest->large_blocks)
+            dest->large_blocks->prev = cur_block;
+        dest->large_blocks   = cur_block;
+    }
+
+    while (source->large_cache) {
+        cur_block           = source->large_cache;
+        source->large_cache = cur_block->next;
+        cur_block->next     = dest->large_cache;
+        dest->large_cache   = cur_block;
+    }
+
+    dest->large_cached           += source->large_cached;
+    dest->large_allocated        += source->large_allocated;
+    dest->large_orphaned         += source->large_orphaned;
     dest->guaranteed_reclaimable += source->guaranteed_reclaimable;
     dest->possibly_reclaimable   += source->possibly_reclaimable;
 
+    source->large_cached           = 0;
+    source->large_allocated        = 0;
+    source->large_orphaned         = 0;
     source->top_block              = NULL;
     source->total_allocated        = 0;
     source->possibly_reclaimable   = 0;
@@ -437,6 +462,15 @@ check_buffer_ptr(ARGMOD(Parrot_Buffer * pobj), ARGMOD(Variable_Size_Pool * pool)
         }
         cur_block = cur_block->prev;
     }
+
+    cur_block = pool->large_blocks;
+    while (cur_block) {
+        if (bufstart >= cur_block->start &&
+            (char *)Buffer_bufstart(pobj) +
+            Buffer_buflen(pobj) <= cur_block->start + cur_block->size)
+            return;
+        cur_block = cur_block->next;
+    }
     PARROT_ASSERT(0);
 }
 
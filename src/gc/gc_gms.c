@@ -135,10 +135,19 @@ TBD
 #  error GC_MAX_GENERATIONS < 1
 #endif
 
+/* Attributes of PMCs this small live in the header instead of the fixed size
+ * allocator, which covers the Integer, Float and String boxes. */
+typedef union pmc_inline_attrs {
+    INTVAL    i;
+    FLOATVAL  n;
+    void     *p;
+} pmc_inline_attrs;
+
 /* We allocate additional space in front of PObj* to store additional pointer */
 typedef struct pmc_alloc_struct {
-    void *ptr;
-    PMC   pmc;   /* NB: Value! */
+    void             *ptr;
+    PMC               pmc;      /* NB: Value! */
+    pmc_inline_attrs  attrs;    /* see PMC_ATTRS_INLINE() */
 } pmc_alloc_struct;
 
 typedef struct string_alloc_struct {
@@ -149,6 +158,9 @@ typedef struct string_alloc_struct {
 #define PMC2PAC(p) ((pmc_alloc_struct *)((char*)(p) - sizeof (void *)))
 #define STR2PAC(p) ((string_alloc_struct *)((char*)(p) - sizeof (void *)))
 
+/* Are PMC attributes stored in the header's own slot? */
+#define PMC_ATTRS_INLINE(p) (PMC_data(p) == (void *)&PMC2PAC(p)->attrs)
+
 
 /* Get generation from PObj->flags */
 #define POBJ2GEN(pobj)                                                  \
@@ -1338,6 +1350,10 @@ void *data)>
 
 Functions for allocating/deallocating various objects.
 
+Attributes of PMCs whose C<attr_size> fits into C<pmc_inline_attrs> are kept in
+the PMC header itself, which saves an allocation for every Integer or Float box.
+Freeing them is a no-op.
+
 */
 
 
@@ -1350,6 +1366,12 @@ gc_gms_allocate_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
     MarkSweep_GC * const self = (MarkSweep_GC *)interp->gc_sys->gc_private;
     const size_t  attr_size = pmc->vtable->attr_size;
 
+    if (attr_size <= sizeof (pmc_inline_attrs)) {
+        PMC_data(pmc) = &PMC2PAC(pmc)->attrs;
+        memset(PMC_data(pmc), 0, attr_size);
+        return PMC_data(pmc);
+    }
+
     if (interp->thread_data)
         LOCK(interp->thread_data->interp_lock);
 
@@ -1370,7 +1392,7 @@ static void
 gc_gms_free_pmc_attributes_locked(PARROT_INTERP, ARGMOD(PMC *pmc))
 {
     ASSERT_ARGS(gc_gms_free_pmc_attributes_locked)
-    if (PMC_data(pmc)) {
+    if (PMC_data(pmc) && !PMC_ATTRS_INLINE(pmc)) {
         MarkSweep_GC * const self   = (MarkSweep_GC *)interp->gc_sys->gc_private;
 
         if (interp->thread_data && ! self->locked)
@@ -1387,7 +1409,7 @@ static void
 gc_gms_free_pmc_attributes(PARROT_INTERP, ARGMOD(PMC *pmc))
 {
     ASSERT_ARGS(gc_gms_free_pmc_attributes)
-    if (PMC_data(pmc)) {
+    if (PMC_data(pmc) && !PMC_ATTRS_INLINE(pmc)) {
         GC_Subsystem * const gc_sys = interp->gc_sys;
         MarkSweep_GC * const self   = (MarkSweep_GC *)gc_sys->gc_private;
         const UINTVAL        size   = pmc->vtable->attr_size;
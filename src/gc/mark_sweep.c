@@ -248,9 +248,9 @@ mark_interp(PARROT_INTERP)
     PARROT_ASSERT(interp->gc_registry);
     Parrot_gc_mark_PMC_alive(interp, interp->gc_registry);
 
-    /* Mark the MMD cache. */
-    if (interp->op_mmd_cache)
-        Parrot_mmd_cache_mark(interp, interp->op_mmd_cache);
+    /* Mark the MMD dispatch table. */
+    if (interp->op_mmd_dispatch)
+        Parrot_mmd_dispatch_table_mark(interp, interp->op_mmd_dispatch);
 
     /* Walk the iodata */
     Parrot_io_mark(interp, interp->piodata);
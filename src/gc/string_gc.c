@@ -20,17 +20,49 @@ GC subsystem to manage STRINGs.
 #include "parrot/parrot.h"
 #include "gc_private.h"
 
+#ifdef PARROT_HAS_HEADER_SYSMMAN
+#  include <sys/mman.h>
+#  if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#    define MAP_ANONYMOUS MAP_ANON
+#  endif
+#  ifdef MAP_ANONYMOUS
+#    define LARGE_BLOCKS_MMAP
+#  endif
+#endif
+
 typedef void (*compact_f) (Interp *, GC_Statistics *stats, Variable_Size_Pool *);
 
 #define POOL_SIZE (65536 * 2)
 
+/* Buffers this big get a block of their own, which is never moved */
+#define LARGE_BUFFER_SIZE POOL_SIZE
+
+/* Compact for large blocks only when their possibly dead share is that big */
+#define LARGE_ORPHANED_LIMIT (LARGE_BUFFER_SIZE * 16)
+
+/* Freed large blocks kept mapped for reuse, at most this many bytes */
+#define LARGE_CACHE_SIZE (LARGE_BUFFER_SIZE * 16)
+
 /* show allocated blocks on stderr. Replaced by --ccflags=-DMEMORY_DEBUG and -D201 */
 #define RESOURCE_DEBUG 0
 #define RESOURCE_DEBUG_SIZE 10000
 
-#define RECLAMATION_FACTOR 0.20
+#define RECLAMATION_FACTOR 0.50
 #define WE_WANT_EVER_GROWING_ALLOCATIONS 0
 
+/* Which blocks a compaction run evacuates, and where the survivors go */
+typedef struct Compaction_State {
+    Memory_Block *target;       /* promotion block receiving the survivors */
+    Memory_Block *nursery;      /* the top block, if it is evacuated */
+    Memory_Block *merge;        /* undersized promotion block to fold in */
+    int           scan_old;     /* any other fragmented blocks to evacuate? */
+    int           scan_large;   /* any large blocks with a freed sharer? */
+} Compaction_State;
+
+/* Is the buffer memory C<p> carved from C<block>? */
+#define BLOCK_CONTAINS(block, p) \
+    ((block) && (const char *)(p) >= (block)->start && (const char *)(p) < (block)->top)
+
 /* HEADERIZER HFILE: src/gc/gc_private.h */
 
 /* HEADERIZER BEGIN: static */
@@ -45,6 +77,17 @@ static char * aligned_mem(
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_CANNOT_RETURN_NULL
+static Memory_Block * alloc_large_block(PARROT_INTERP,
+    ARGMOD(GC_Statistics *stats),
+    size_t size,
+    ARGMOD(Variable_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*stats)
+        FUNC_MODIFIES(*pool);
+
 static void alloc_new_block(PARROT_INTERP,
     ARGMOD(GC_Statistics *stats),
     size_t size,
@@ -77,33 +120,58 @@ static void debug_print_buf(PARROT_INTERP, ARGIN(const Parrot_Buffer *b))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static void free_large_block(
+    ARGMOD(GC_Statistics *stats),
+    ARGMOD(Variable_Size_Pool *pool),
+    ARGFREE(Memory_Block *block))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*stats)
+        FUNC_MODIFIES(*pool);
+
 static void free_memory_pool(ARGFREE(Variable_Size_Pool *pool));
-static void free_old_mem_blocks(
-     ARGMOD(GC_Statistics *stats),
+static void free_old_mem_blocks(PARROT_INTERP,
+    ARGMOD(GC_Statistics *stats),
     ARGMOD(Variable_Size_Pool *pool),
-    ARGMOD(Memory_Block *new_block),
-    UINTVAL total_size)
+    ARGIN(const Compaction_State *state))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
         FUNC_MODIFIES(*stats)
-        FUNC_MODIFIES(*pool)
-        FUNC_MODIFIES(*new_block);
+        FUNC_MODIFIES(*pool);
+
+static void free_orphaned_large_blocks(
+    ARGMOD(GC_Statistics *stats),
+    ARGMOD(Variable_Size_Pool *pool))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*stats)
+        FUNC_MODIFIES(*pool);
 
 static int is_block_almost_full(ARGIN(const Memory_Block *block))
         __attribute__nonnull__(1);
 
+static int is_block_evacuated(
+    ARGIN(const Compaction_State *state),
+    ARGIN(const Memory_Block *block))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
 static void * mem_allocate(PARROT_INTERP,
     ARGMOD(GC_Statistics *stats),
     size_t size,
-    ARGMOD(Variable_Size_Pool *pool))
+    ARGMOD(Variable_Size_Pool *pool),
+    ARGOUT(Memory_Block **block))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
         FUNC_MODIFIES(*stats)
-        FUNC_MODIFIES(*pool);
+        FUNC_MODIFIES(*pool)
+        FUNC_MODIFIES(*block);
 
 static void move_buffer_callback(PARROT_INTERP,
     ARGIN(Parrot_Buffer *b),
@@ -120,6 +188,17 @@ static void move_one_buffer(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*old_buf);
 
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+static Memory_Block * new_block(PARROT_INTERP,
+    ARGMOD(GC_Statistics *stats),
+    size_t size,
+    ARGIN(const char *why))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*stats);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
@@ -128,13 +207,20 @@ static Variable_Size_Pool * new_memory_pool(
     NULLOK(compact_f compact));
 
 static UINTVAL pad_pool_size(PARROT_INTERP,
-    ARGIN(const Variable_Size_Pool *pool))
+    ARGIN(const Variable_Size_Pool *pool),
+    ARGIN(const Compaction_State *state))
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2);
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
 
+static void unmap_large_block(ARGFREE(Memory_Block *block));
 #define ASSERT_ARGS_aligned_mem __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(buffer_unused) \
     , PARROT_ASSERT_ARG(mem))
+#define ASSERT_ARGS_alloc_large_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(stats) \
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_alloc_new_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(stats) \
@@ -150,17 +236,28 @@ static UINTVAL pad_pool_size(PARROT_INTERP,
 #define ASSERT_ARGS_debug_print_buf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_free_large_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(stats) \
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_free_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_free_old_mem_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(stats) \
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(stats) \
     , PARROT_ASSERT_ARG(pool) \
-    , PARROT_ASSERT_ARG(new_block))
+    , PARROT_ASSERT_ARG(state))
+#define ASSERT_ARGS_free_orphaned_large_blocks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(stats) \
+    , PARROT_ASSERT_ARG(pool))
 #define ASSERT_ARGS_is_block_almost_full __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(block))
+#define ASSERT_ARGS_is_block_evacuated __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(state) \
+    , PARROT_ASSERT_ARG(block))
 #define ASSERT_ARGS_mem_allocate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(stats) \
-    , PARROT_ASSERT_ARG(pool))
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(block))
 #define ASSERT_ARGS_move_buffer_callback __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(b) \
@@ -169,10 +266,16 @@ static UINTVAL pad_pool_size(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pool) \
     , PARROT_ASSERT_ARG(old_buf))
+#define ASSERT_ARGS_new_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(stats) \
+    , PARROT_ASSERT_ARG(why))
 #define ASSERT_ARGS_new_memory_pool __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_pad_pool_size __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(pool))
+    , PARROT_ASSERT_ARG(pool) \
+    , PARROT_ASSERT_ARG(state))
+#define ASSERT_ARGS_unmap_large_block __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -244,15 +347,16 @@ Parrot_gc_str_allocate_buffer_storage(PARROT_INTERP,
 {
     ASSERT_ARGS(Parrot_gc_str_allocate_buffer_storage)
     const size_t new_size   = ALIGNED_STRING_SIZE(size);
+    Memory_Block *block;
 
     interp->gc_sys->stats.memory_used += new_size;
 
     Buffer_bufstart(buffer) = (void *)aligned_mem(buffer,
         (char *)mem_allocate(interp,
-        &interp->gc_sys->stats, new_size, gc->memory_pool));
+        &interp->gc_sys->stats, new_size, gc->memory_pool, &block));
 
     /* Save pool used to allocate into buffer header */
-    *Buffer_poolptr(buffer) = gc->memory_pool->top_block;
+    *Buffer_poolptr(buffer) = block;
 
     Buffer_buflen(buffer)   = new_size - sizeof (void *);
 }
@@ -280,6 +384,7 @@ Parrot_gc_str_reallocate_buffer_storage(PARROT_INTERP,
 {
     ASSERT_ARGS(Parrot_gc_str_reallocate_buffer_storage)
     Variable_Size_Pool * const pool = gc->memory_pool;
+    Memory_Block *block, *old_block;
     char   *mem;
     size_t  new_size, copysize;
 
@@ -299,7 +404,9 @@ Parrot_gc_str_reallocate_buffer_storage(PARROT_INTERP,
 
     interp->gc_sys->stats.memory_used += new_size;
 
-    mem = (char *)mem_allocate(interp, &interp->gc_sys->stats, new_size, pool);
+    old_block = PObj_is_movable_TESTALL(buffer) ? Buffer_pool(buffer) : NULL;
+
+    mem = (char *)mem_allocate(interp, &interp->gc_sys->stats, new_size, pool, &block);
     mem = aligned_mem(buffer, mem);
 
     /* We shouldn't ever have a 0 from size, but we do. If we can track down
@@ -309,11 +416,17 @@ Parrot_gc_str_reallocate_buffer_storage(PARROT_INTERP,
     if (copysize)
         memcpy(mem, Buffer_bufstart(buffer), copysize);
 
+    /* A large block held only this buffer; compaction may have moved it
+     * out of an ordinary one, but never out of a large one */
+    if (old_block && Buffer_pool(buffer) == old_block
+    && (old_block->flags & Memory_Block_large_FLAG))
+        free_large_block(&interp->gc_sys->stats, pool, old_block);
+
     Buffer_bufstart(buffer) = mem;
     Buffer_buflen(buffer)   = new_size - sizeof (void *);
 
     /* Save pool used to allocate into buffer header */
-    *Buffer_poolptr(buffer) = gc->memory_pool->top_block;
+    *Buffer_poolptr(buffer) = block;
 }
 
 /*
@@ -326,6 +439,10 @@ buffer maybe slightly bigger than the given C<size>. This function
 sets also C<< str->strstart >> to the new buffer location, C<< str->bufused >>
 is B<not> changed.
 
+Requests of up to C<STRING_INLINE_SIZE> bytes are satisfied from the
+C<inline_buf> of the header itself. Such strings are flagged external, so
+they are never moved by compaction and have no storage to free.
+
 =cut
 
 */
@@ -338,6 +455,7 @@ Parrot_gc_str_allocate_string_storage(PARROT_INTERP,
 {
     ASSERT_ARGS(Parrot_gc_str_allocate_string_storage)
     Variable_Size_Pool *pool;
+    Memory_Block *block;
     size_t  new_size;
     char   *mem;
 
@@ -347,6 +465,16 @@ Parrot_gc_str_allocate_string_storage(PARROT_INTERP,
         return;
     }
 
+    if (size <= STRING_INLINE_SIZE) {
+        Buffer_bufstart(str) = str->strstart = str->inline_buf;
+        Buffer_buflen(str)   = STRING_INLINE_SIZE;
+        PObj_external_SET(str);
+        return;
+    }
+
+    if (STRING_is_inline(str))
+        PObj_external_CLEAR(str);
+
     new_size = ALIGNED_STRING_SIZE(size);
 
     if (PObj_constant_TEST(str)) {
@@ -357,14 +485,14 @@ Parrot_gc_str_allocate_string_storage(PARROT_INTERP,
         interp->gc_sys->stats.memory_used += new_size;
     }
 
-    mem      = (char *)mem_allocate(interp, &interp->gc_sys->stats, new_size, pool);
+    mem      = (char *)mem_allocate(interp, &interp->gc_sys->stats, new_size, pool, &block);
     mem     += sizeof (void *);
 
     Buffer_bufstart(str) = str->strstart = mem;
     Buffer_buflen(str)   = new_size - sizeof (void *);
 
     /* Save pool used to allocate into buffer header */
-    *Buffer_poolptr(str) = pool->top_block;
+    *Buffer_poolptr(str) = block;
 }
 
 /*
@@ -376,6 +504,8 @@ Reallocate the STRING's buffer memory to the given size. The allocated
 buffer will not shrink. This function sets also C<str-E<gt>strstart> to the
 new buffer location, C<str-E<gt>bufused> is B<not> changed.
 
+A string outgrowing its inline storage is moved into the memory pool.
+
 =cut
 
 */
@@ -388,6 +518,7 @@ Parrot_gc_str_reallocate_string_storage(PARROT_INTERP,
 {
     ASSERT_ARGS(Parrot_gc_str_reallocate_string_storage)
     Variable_Size_Pool *pool;
+    Memory_Block *block, *old_block;
     char   *mem;
     size_t  new_size, old_size;
 
@@ -395,6 +526,17 @@ Parrot_gc_str_reallocate_string_storage(PARROT_INTERP,
     if (newsize <= Buffer_buflen(str))
         return;
 
+    if (STRING_is_inline(str)) {
+        const char * const old_start = str->strstart;
+
+        Parrot_gc_str_allocate_string_storage(interp, gc, str, newsize);
+
+        /* The header doesn't move, so the inline contents are still there */
+        if (str->bufused)
+            memcpy(str->strstart, old_start, str->bufused);
+        return;
+    }
+
     new_size = ALIGNED_STRING_SIZE(newsize);
     old_size = ALIGNED_STRING_SIZE(Buffer_buflen(str));
 
@@ -406,7 +548,7 @@ Parrot_gc_str_reallocate_string_storage(PARROT_INTERP,
         interp->gc_sys->stats.memory_used += new_size;
     }
 
-    mem = (char *)mem_allocate(interp, &interp->gc_sys->stats, new_size, pool);
+    mem = (char *)mem_allocate(interp, &interp->gc_sys->stats, new_size, pool, &block);
     mem += sizeof (void *);
 
     /* Update Memory_Block usage */
@@ -416,10 +558,6 @@ Parrot_gc_str_reallocate_string_storage(PARROT_INTERP,
     /* We must not reallocate shared buffers! */
     PARROT_ASSERT(!(*Buffer_bufflagsptr(str) & Buffer_shared_FLAG));
 
-    /* Decrease usage */
-    PARROT_ASSERT(Buffer_pool(str));
-    Buffer_pool(str)->freed += old_size;
-
     PARROT_ASSERT(str->bufused <= Buffer_buflen(str));
 
     /* copy mem from strstart, *not* bufstart */
@@ -429,11 +567,23 @@ Parrot_gc_str_reallocate_string_storage(PARROT_INTERP,
     if (str->bufused)
         memcpy(mem, str->strstart, str->bufused);
 
+    /* Decrease usage */
+    old_block = Buffer_pool(str);
+    PARROT_ASSERT(old_block);
+
+    if (old_block->flags & Memory_Block_large_FLAG)
+        free_large_block(&interp->gc_sys->stats, pool, old_block);
+    else {
+        old_block->freed             += old_size;
+        pool->guaranteed_reclaimable += old_size;
+        pool->possibly_reclaimable   += old_size;
+    }
+
     Buffer_bufstart(str) = str->strstart = mem;
     Buffer_buflen(str)   = new_size - sizeof (void *);
 
     /* Save pool used to allocate into buffer header */
-    *Buffer_poolptr(str) = pool->top_block;
+    *Buffer_poolptr(str) = block;
 }
 
 /*
@@ -458,14 +608,15 @@ Parrot_gc_str_compact_pool(PARROT_INTERP, ARGIN(String_GC *gc))
 Parrot_Buffer *b)>
 
 Frees a buffer, returning it to the memory pool for Parrot to possibly
-reuse later.
+reuse later. A large block is given back to the system right away, unless
+its buffer is shared; then the next compaction run checks for other users.
 
 =cut
 
 */
 
 void
-Parrot_gc_str_free_buffer_storage(SHIM_INTERP,
+Parrot_gc_str_free_buffer_storage(PARROT_INTERP,
         ARGIN(String_GC *gc),
         ARGMOD(Parrot_Buffer *b))
 {
@@ -486,9 +637,27 @@ Parrot_gc_str_free_buffer_storage(SHIM_INTERP,
 
             PARROT_ASSERT(block);
 
-            /* We can have shared buffers. Don't count them (yet) */
-            if (!(*buffer_flags & Buffer_shared_FLAG)) {
-                block->freed  += ALIGNED_STRING_SIZE(Buffer_buflen(b));
+            if (block->flags & Memory_Block_large_FLAG) {
+                if (!(*buffer_flags & Buffer_shared_FLAG))
+                    free_large_block(&interp->gc_sys->stats, mem_pool, block);
+                else if (!(block->flags & Memory_Block_orphan_FLAG)) {
+                    block->flags |= Memory_Block_orphan_FLAG;
+                    mem_pool->large_orphaned += block->size;
+                }
+            }
+
+            /* We can have shared buffers. They only hint at fragmentation */
+            else {
+                const size_t size = ALIGNED_STRING_SIZE(Buffer_buflen(b));
+
+                if (*buffer_flags & Buffer_shared_FLAG)
+                    block->freed_shared          += size;
+                else {
+                    block->freed                     += size;
+                    mem_pool->guaranteed_reclaimable += size;
+                }
+
+                mem_pool->possibly_reclaimable += size;
             }
 
         }
@@ -519,6 +688,11 @@ new_memory_pool(size_t min_block, NULLOK(compact_f compact))
     Variable_Size_Pool * const pool = mem_internal_allocate_typed(Variable_Size_Pool);
 
     pool->top_block              = NULL;
+    pool->large_blocks           = NULL;
+    pool->large_allocated        = 0;
+    pool->large_orphaned         = 0;
+    pool->large_cache            = NULL;
+    pool->large_cached           = 0;
     pool->compact                = compact;
     pool->minimum_block_size     = min_block;
     pool->total_allocated        = 0;
@@ -531,12 +705,63 @@ new_memory_pool(size_t min_block, NULLOK(compact_f compact))
 
 /*
 
+=item C<static Memory_Block * new_block(PARROT_INTERP, GC_Statistics *stats,
+size_t size, const char *why)>
+
+Allocate an unlinked memory block of exactly C<size> bytes. The given
+C<char *why> text is used for debugging.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+static Memory_Block *
+new_block(PARROT_INTERP, ARGMOD(GC_Statistics *stats), size_t size,
+        ARGIN(const char *why))
+{
+    ASSERT_ARGS(new_block)
+    Memory_Block *block;
+
+#ifndef NDEBUG
+    MEMORY_DEBUG_DETAIL_2("new_block (%s) size %u\n", why, size);
+#else
+    UNUSED(why)
+#endif
+
+    /* Allocate a new block. Header info's on the front */
+    block = (Memory_Block *)mem_internal_allocate_zeroed(
+        sizeof (Memory_Block) + size);
+
+    if (!block) {
+        fprintf(stderr, "out of mem allocsize = %d\n", (int)size);
+        PANIC(interp, "out of memory");
+    }
+
+    block->free  = size;
+    block->size  = size;
+
+    block->next  = NULL;
+    block->prev  = NULL;
+    block->start = (char *)block + sizeof (Memory_Block);
+    block->top   = block->start;
+
+    /* Note that we've allocated it */
+    stats->memory_allocated += size;
+
+    return block;
+}
+
+/*
+
 =item C<static void alloc_new_block(PARROT_INTERP, GC_Statistics *stats, size_t
 size, Variable_Size_Pool *pool, const char *why)>
 
 Allocate a new memory block. We allocate either the requested size or the
 default size, whichever is larger. Add the new block to the given memory
-pool. The given C<char *why> text is used for debugging.
+pool, where it becomes the nursery all new buffers are carved from. The given
+C<char *why> text is used for debugging.
 
 =cut
 
@@ -548,53 +773,171 @@ alloc_new_block(PARROT_INTERP, ARGMOD(GC_Statistics *stats),
                 ARGIN(const char *why))
 {
     ASSERT_ARGS(alloc_new_block)
-    Memory_Block *new_block;
-
     const size_t alloc_size = (size > pool->minimum_block_size)
             ? size : pool->minimum_block_size;
-#ifndef NDEBUG
-    MEMORY_DEBUG_DETAIL_3("new_block (%s) size %u -> %u\n",
-                          why, size, alloc_size);
+    Memory_Block * const block = new_block(interp, stats, alloc_size, why);
+
+    /* If this is for a public pool, add it to the list */
+    block->prev = pool->top_block;
+
+    /* If we're not first, then tack us on the list */
+    if (pool->top_block)
+        pool->top_block->next = block;
+
+    pool->top_block        = block;
+    pool->total_allocated += alloc_size;
+}
+
+/*
+
+=item C<static Memory_Block * alloc_large_block(PARROT_INTERP, GC_Statistics
+*stats, size_t size, Variable_Size_Pool *pool)>
+
+Map a block for a single buffer of C<size> bytes and add it to the large
+blocks of the pool. A cached block of up to twice the size is reused
+instead, if there is one. Large blocks aren't part of the block list
+compaction works on, and they don't count towards the C<total_allocated> of
+the pool.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static Memory_Block *
+alloc_large_block(PARROT_INTERP, ARGMOD(GC_Statistics *stats), size_t size,
+        ARGMOD(Variable_Size_Pool *pool))
+{
+    ASSERT_ARGS(alloc_large_block)
+    Memory_Block **cached = &pool->large_cache;
+    Memory_Block  *block;
+
+    while (*cached && ((*cached)->size < size || (*cached)->size / 2 > size))
+        cached = &(*cached)->next;
+
+    if (*cached) {
+        block               = *cached;
+        *cached             = block->next;
+        pool->large_cached -= block->size;
+    }
+    else {
+        const size_t length = sizeof (Memory_Block) + size;
+
+#ifdef LARGE_BLOCKS_MMAP
+        void * const mem = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        block = mem == MAP_FAILED ? NULL : (Memory_Block *)mem;
 #else
-    UNUSED(why)
+        block = (Memory_Block *)mem_internal_allocate_zeroed(length);
 #endif
 
-    /* Allocate a new block. Header info's on the front */
-    new_block = (Memory_Block *)mem_internal_allocate_zeroed(
-        sizeof (Memory_Block) + alloc_size);
+        if (!block) {
+            fprintf(stderr, "out of mem allocsize = %d\n", (int)size);
+            PANIC(interp, "out of memory");
+        }
 
-    if (!new_block) {
-        fprintf(stderr, "out of mem allocsize = %d\n", (int)alloc_size);
-        PANIC(interp, "out of memory");
+        block->size              = size;
+        stats->memory_allocated += size;
     }
 
-    new_block->free  = alloc_size;
-    new_block->size  = alloc_size;
+    block->free         = block->size - size;
+    block->freed        = 0;
+    block->freed_shared = 0;
+    block->flags        = Memory_Block_large_FLAG;
+    block->start        = (char *)block + sizeof (Memory_Block);
+    block->top          = block->start + size;
 
-    new_block->next  = NULL;
-    new_block->start = (char *)new_block + sizeof (Memory_Block);
-    new_block->top   = new_block->start;
+    block->prev  = NULL;
+    block->next  = pool->large_blocks;
+    if (pool->large_blocks)
+        pool->large_blocks->prev = block;
+    pool->large_blocks = block;
 
-    /* Note that we've allocated it */
-    stats->memory_allocated += alloc_size;
+    pool->large_allocated += block->size;
 
-    /* If this is for a public pool, add it to the list */
-    new_block->prev = pool->top_block;
+    return block;
+}
 
-    /* If we're not first, then tack us on the list */
-    if (pool->top_block)
-        pool->top_block->next = new_block;
+/*
 
-    pool->top_block        = new_block;
-    pool->total_allocated += alloc_size;
+=item C<static void free_large_block(GC_Statistics *stats, Variable_Size_Pool
+*pool, Memory_Block *block)>
+
+Unlink a large block from its pool. It is kept for reuse if the cache of
+the pool has room; its pages are still handed back to the system with
+C<madvise>, which lets the kernel take them whenever it needs them. Anything
+else is unmapped.
+
+=cut
+
+*/
+
+static void
+free_large_block(ARGMOD(GC_Statistics *stats), ARGMOD(Variable_Size_Pool *pool),
+        ARGFREE(Memory_Block *block))
+{
+    ASSERT_ARGS(free_large_block)
+
+    if (block->prev)
+        block->prev->next  = block->next;
+    else
+        pool->large_blocks = block->next;
+
+    if (block->next)
+        block->next->prev  = block->prev;
+
+    if (block->flags & Memory_Block_orphan_FLAG)
+        pool->large_orphaned -= block->size;
+
+    pool->large_allocated -= block->size;
+    stats->memory_used    -= block->size - block->free;
+
+    if (pool->large_cached + block->size <= LARGE_CACHE_SIZE) {
+#if defined(LARGE_BLOCKS_MMAP) && defined(MADV_FREE)
+        madvise((void *)block->start, block->size, MADV_FREE);
+#endif
+        block->next         = pool->large_cache;
+        pool->large_cache   = block;
+        pool->large_cached += block->size;
+    }
+    else {
+        stats->memory_allocated -= block->size;
+        unmap_large_block(block);
+    }
+}
+
+/*
+
+=item C<static void unmap_large_block(Memory_Block *block)>
+
+Return the memory of a large block to the system.
+
+=cut
+
+*/
+
+static void
+unmap_large_block(ARGFREE(Memory_Block *block))
+{
+    ASSERT_ARGS(unmap_large_block)
+#ifdef LARGE_BLOCKS_MMAP
+    munmap((void *)block, sizeof (Memory_Block) + block->size);
+#else
+    mem_internal_free(block);
+#endif
 }
 
 /*
 
 =item C<static void * mem_allocate(PARROT_INTERP, GC_Statistics *stats, size_t
-size, Variable_Size_Pool *pool)>
+size, Variable_Size_Pool *pool, Memory_Block **block)>
 
-Allocates memory for headers.
+Allocates memory for headers. The block the memory was carved from is
+returned in C<block>.
+
+Requests of C<LARGE_BUFFER_SIZE> or more from a compacted pool get a block
+of their own, mapped straight from the system. Such a block is never moved
+or copied by compaction, and it is unmapped as soon as its buffer dies.
 
 Alignment problems history:
 
@@ -621,7 +964,8 @@ static void *
 mem_allocate(PARROT_INTERP,
         ARGMOD(GC_Statistics *stats),
         size_t size,
-        ARGMOD(Variable_Size_Pool *pool))
+        ARGMOD(Variable_Size_Pool *pool),
+        ARGOUT(Memory_Block **block))
 {
     ASSERT_ARGS(mem_allocate)
     void *return_val;
@@ -629,20 +973,32 @@ mem_allocate(PARROT_INTERP,
     /* we always should have one block at least */
     PARROT_ASSERT(pool->top_block);
 
+    if (size >= LARGE_BUFFER_SIZE && pool->compact) {
+        /* Fresh memory from the system either way; run a GC if needed */
+        interp->gc_sys->maybe_gc_mark(interp, GC_trace_stack_FLAG);
+
+        /* Look for the users of shared large buffers once they pile up */
+        if (pool->large_orphaned >= LARGE_ORPHANED_LIMIT
+        &&  pool->large_orphaned >  pool->large_allocated / 2)
+            (*pool->compact)(interp, stats, pool);
+        *block = alloc_large_block(interp, stats, size, pool);
+        return (*block)->start;
+    }
+
     /* If not enough room, try to find some */
     if (pool->top_block->free < size) {
         /* Run a GC if needed */
         interp->gc_sys->maybe_gc_mark(interp, GC_trace_stack_FLAG);
 
+        /* Evacuate the nursery rather than grow, if enough is garbage */
+        if (pool->top_block->free < size && pool->compact
+        &&  pool->guaranteed_reclaimable >
+                pool->total_allocated * pool->reclaim_factor)
+            (*pool->compact)(interp, stats, pool);
+
         if (pool->top_block->free < size) {
             if (pool->minimum_block_size < 65536 * 16)
                 pool->minimum_block_size *= 2;
-            /*
-             * TODO - Big blocks
-             *
-             * Mark the block as big block (it has just one item)
-             * And don't set big blocks as the top_block.
-             */
             alloc_new_block(interp, stats, size, pool, "compact failed");
 
             if (pool->top_block->free < size) {
@@ -655,6 +1011,7 @@ mem_allocate(PARROT_INTERP,
     return_val             = pool->top_block->top;
     pool->top_block->top  += size;
     pool->top_block->free -= size;
+    *block                 = pool->top_block;
 
     return return_val;
 }
@@ -755,6 +1112,17 @@ Variable_Size_Pool *pool)>
 Compact the string buffer pool. Does not perform a GC scan, or mark items
 as being alive in any way.
 
+The top block of the pool is the nursery every new buffer is bumped into;
+the blocks below it hold buffers which survived an earlier compaction.
+Only blocks with more than 20% garbage are evacuated, so the live parts of
+the older blocks stay put. Survivors are promoted into one new block which
+is linked in below the nursery. The emptied nursery is then reset in place
+rather than freed, and the fragmented older blocks are released.
+
+Large blocks are never moved. If one of them lost a sharer of its buffer,
+the run also looks for the remaining users and unmaps the block if there
+are none.
+
 =cut
 
 */
@@ -765,8 +1133,10 @@ compact_pool(PARROT_INTERP,
         ARGMOD(Variable_Size_Pool *pool))
 {
     ASSERT_ARGS(compact_pool)
-    UINTVAL       total_size, new_size;
-    Memory_Block *new_block;
+    Memory_Block * const nursery = pool->top_block;
+    Memory_Block        *cur_block;
+    Compaction_State     state;
+    UINTVAL              total_size;
 
     /* Bail if we're blocked */
     if (Parrot_is_blocked_GC_sweep(interp) || Parrot_is_blocked_GC_move(interp))
@@ -777,32 +1147,67 @@ compact_pool(PARROT_INTERP,
     /* We're collecting */
     ++stats->gc_collect_runs;
 
-    /* Snag a block big enough for everything */
-    total_size = pad_pool_size(interp, pool);
+    /* A promotion block smaller than a nursery is folded into the next one,
+     * so frequent compactions don't leave a trail of tiny blocks behind */
+    state.target   = NULL;
+    state.merge    = nursery->prev && nursery->prev->size < pool->minimum_block_size
+                   ? nursery->prev
+                   : NULL;
+    state.nursery    = is_block_evacuated(&state, nursery) ? nursery : NULL;
+    state.scan_old   = 0;
+    state.scan_large = pool->large_orphaned > 0;
+
+    /* Buffers in the nursery and the merged block are found by address; the
+     * block of any other buffer is only looked up if some old block needs it */
+    for (cur_block = nursery->prev; cur_block; cur_block = cur_block->prev)
+        if (cur_block != state.merge && !is_block_almost_full(cur_block)) {
+            state.scan_old = 1;
+            break;
+        }
 
-    if (total_size == 0) {
-        free_old_mem_blocks(stats, pool, pool->top_block, total_size);
-        Parrot_unblock_GC_move(interp);
-        return;
+    /* Snag a block big enough for all survivors */
+    total_size = pad_pool_size(interp, pool, &state);
+
+    if (!total_size) {
+        /* Nothing to move; just look for the users of large blocks */
+        state.nursery  = NULL;
+        state.merge    = NULL;
+        state.scan_old = 0;
+
+        if (state.scan_large)
+            interp->gc_sys->iterate_live_strings(interp, move_buffer_callback, &state);
     }
+    else {
+        Memory_Block * const target = new_block(interp, stats, total_size,
+                                                "inside compact");
+        UINTVAL new_size;
 
-    alloc_new_block(interp, stats, total_size, pool, "inside compact");
-    new_block = pool->top_block;
+        /* Link it in below the nursery */
+        target->prev  = nursery->prev;
+        target->next  = nursery;
+        if (nursery->prev)
+            nursery->prev->next = target;
+        nursery->prev = target;
+        state.target  = target;
 
-    /* Run through all the Parrot_Buffer header pools and copy */
-    interp->gc_sys->iterate_live_strings(interp, move_buffer_callback, new_block);
+        /* Run through all the Parrot_Buffer header pools and copy */
+        interp->gc_sys->iterate_live_strings(interp, move_buffer_callback, &state);
 
-    new_size = new_block->top - new_block->start;
+        new_size = target->top - target->start;
 
-    PARROT_ASSERT(new_block->size >= new_size);
+        PARROT_ASSERT(target->size >= new_size);
 
-    /* How much is free. That's the total size minus the amount we used */
-    new_block->free          = new_block->size - new_size;
+        /* How much is free. That's the total size minus the amount we used */
+        target->free             = target->size - new_size;
+
+        stats->memory_collected += new_size;
+        stats->memory_used      += new_size;
+    }
 
-    stats->memory_collected += new_size;
-    stats->memory_used      += new_size;
+    if (state.scan_large)
+        free_orphaned_large_blocks(stats, pool);
 
-    free_old_mem_blocks(stats, pool, new_block, total_size);
+    free_old_mem_blocks(interp, stats, pool, &state);
     Parrot_unblock_GC_move(interp);
 }
 
@@ -820,16 +1225,34 @@ static void
 move_buffer_callback(PARROT_INTERP, ARGIN(Parrot_Buffer *b), ARGIN(void *data))
 {
     ASSERT_ARGS(move_buffer_callback)
-    Memory_Block * const new_block = (Memory_Block *)data;
+    const Compaction_State * const state = (const Compaction_State *)data;
 
     if (Buffer_buflen(b) && PObj_is_movable_TESTALL(b)) {
-        Memory_Block * const old_block = Buffer_pool(b);
+        const void * const mem = Buffer_bufstart(b);
 
-        if (!is_block_almost_full(old_block)) {
-            MEMORY_DEBUG_DETAIL_3("Move buffer %2u %p => %p\n",
-                                  (unsigned)Buffer_buflen(b), old_block, new_block);
-            move_one_buffer(interp, new_block, b);
+        if (!BLOCK_CONTAINS(state->nursery, mem) && !BLOCK_CONTAINS(state->merge, mem)) {
+            Memory_Block *old_block;
+
+            if (!state->scan_old && !state->scan_large)
+                return;
+
+            old_block = Buffer_pool(b);
+
+            /* Large blocks stay put; just note that the buffer is in use */
+            if (old_block->flags & Memory_Block_large_FLAG) {
+                old_block->flags |= Memory_Block_live_FLAG;
+                return;
+            }
+
+            if (!state->scan_old
+            ||   old_block == state->target
+            ||   is_block_almost_full(old_block))
+                return;
         }
+
+        MEMORY_DEBUG_DETAIL_3("Move buffer %2u %p => %p\n",
+                              (unsigned)Buffer_buflen(b), mem, state->target);
+        move_one_buffer(interp, state->target, b);
     }
 
 }
@@ -837,20 +1260,18 @@ move_buffer_callback(PARROT_INTERP, ARGIN(Parrot_Buffer *b), ARGIN(void *data))
 /*
 
 =item C<static UINTVAL pad_pool_size(PARROT_INTERP, const Variable_Size_Pool
-*pool)>
+*pool, const Compaction_State *state)>
 
-Calculate the size of the new pool. The currently used size equals the total
-size minus the reclaimable size. Add a minimum block to the current amount, so
-we can avoid having to allocate it in the future.
+Calculate the size of the promotion block. The currently used size of each
+evacuated block equals its total size minus the reclaimable size.
 
-Returns 0 if all blocks below the top block are almost full. In this case
-compacting is not needed.
+Returns 0 if nothing in the evacuated blocks is alive. In this case
+copying is not needed.
 
 TODO - Big blocks
 
-Currently all available blocks are compacted into one new
-block with total_size. This is suboptimal, if the block has
-just one live item from a big allocation.
+A big allocation gets evacuated as soon as its block is fragmented, which
+is suboptimal if the block has just one live item.
 
 But currently it's unknown if the buffer memory is alive
 as the live bits are in Buffer headers. We have to run the
@@ -866,18 +1287,19 @@ problem easily.
 */
 
 static UINTVAL
-pad_pool_size(PARROT_INTERP, ARGIN(const Variable_Size_Pool *pool))
+pad_pool_size(PARROT_INTERP, ARGIN(const Variable_Size_Pool *pool),
+        ARGIN(const Compaction_State *state))
 {
     ASSERT_ARGS(pad_pool_size)
-    Memory_Block *cur_block = pool->top_block->prev;
+    Memory_Block *cur_block = pool->top_block;
 
     UINTVAL total_size   = 0;
 #ifndef NDEBUG
-    size_t  total_blocks = 1;
+    size_t  total_blocks = 0;
 #endif
 
     while (cur_block) {
-        if (!is_block_almost_full(cur_block))
+        if (is_block_evacuated(state, cur_block))
             total_size += cur_block->size - cur_block->freed - cur_block->free;
         cur_block   = cur_block->prev;
 #ifndef NDEBUG
@@ -885,16 +1307,10 @@ pad_pool_size(PARROT_INTERP, ARGIN(const Variable_Size_Pool *pool))
 #endif
     }
 
-    if (total_size == 0)
-        return 0;
-
-    cur_block = pool->top_block;
-    if (!is_block_almost_full(cur_block))
-        total_size += cur_block->size - cur_block->freed - cur_block->free;
-
     /* this makes for ever increasing allocations but fewer collect runs */
 #if WE_WANT_EVER_GROWING_ALLOCATIONS
-    total_size += pool->minimum_block_size;
+    if (total_size)
+        total_size += pool->minimum_block_size;
 #endif
 
 #ifndef NDEBUG
@@ -997,38 +1413,37 @@ move_one_buffer(PARROT_INTERP, ARGIN(Memory_Block *pool),
 
 /*
 
-=item C<static void free_old_mem_blocks( GC_Statistics *stats,
-Variable_Size_Pool *pool, Memory_Block *new_block, UINTVAL total_size)>
+=item C<static void free_old_mem_blocks(PARROT_INTERP, GC_Statistics *stats,
+Variable_Size_Pool *pool, const Compaction_State *state)>
 
-The compact_pool operation collects disjointed blocks of memory allocated on a
-given pool's free list into one large block of memory, setting it as the new
-top block for the pool. Once that is done, and all items have been moved into
-the new block of memory, this function iterates through the old blocks and
-frees each one. It also performs the necessary housekeeping to record the
-freed memory blocks. At the end of this function, the pool will have only one
-block of memory on its free list.
+Once all live buffers have been promoted out of the evacuated blocks, this
+function iterates through the blocks below the nursery and frees each
+evacuated one. It also performs the necessary housekeeping to record the
+freed memory blocks.
+
+An evacuated nursery is reset in place, so the next allocations reuse it. A
+nursery still mostly alive is kept as an old block instead, and a fresh
+nursery is allocated on top of it.
 
 =cut
 
 */
 
 static void
-free_old_mem_blocks(
+free_old_mem_blocks(PARROT_INTERP,
         ARGMOD(GC_Statistics *stats),
         ARGMOD(Variable_Size_Pool *pool),
-        ARGMOD(Memory_Block *new_block),
-        UINTVAL total_size)
+        ARGIN(const Compaction_State *state))
 {
     ASSERT_ARGS(free_old_mem_blocks)
-    Memory_Block *prev_block = new_block;
-    Memory_Block *cur_block  = new_block->prev;
-
-    PARROT_ASSERT(new_block == pool->top_block);
+    Memory_Block * const nursery    = pool->top_block;
+    Memory_Block        *prev_block = nursery;
+    Memory_Block        *cur_block  = nursery->prev;
 
     while (cur_block) {
         Memory_Block * const next_block = cur_block->prev;
 
-        if (is_block_almost_full(cur_block)) {
+        if (cur_block == state->target || !is_block_evacuated(state, cur_block)) {
             /* Skip block */
             prev_block = cur_block;
             cur_block  = next_block;
@@ -1045,20 +1460,68 @@ free_old_mem_blocks(
 
             /* Unlink it from list */
             prev_block->prev = next_block;
+            if (next_block)
+                next_block->next = prev_block;
         }
     }
 
-    /* Terminate list */
-    prev_block->prev = NULL;
-
+    if (is_block_evacuated(state, nursery)) {
+        stats->memory_used -= nursery->size - nursery->free;
+        nursery->top          = nursery->start;
+        nursery->free         = nursery->size;
+        nursery->freed        = 0;
+        nursery->freed_shared = 0;
+    }
+    else
+        alloc_new_block(interp, stats, pool->minimum_block_size, pool,
+                        "nursery promoted");
 
-    /* ANR: I suspect this should be set to new_block->size, instead of passing
-     * in the raw value of total_size, because alloc_new_block pads the size of
-     * the new block under certain conditions. Leaving it unmodified for now,
-     * so this refactor has no functionality changes, only code cleanups.*/
-    pool->total_allocated        = total_size;
+    /* Recount what is left */
+    pool->total_allocated        = 0;
     pool->guaranteed_reclaimable = 0;
     pool->possibly_reclaimable   = 0;
+
+    for (cur_block = pool->top_block; cur_block; cur_block = cur_block->prev) {
+        pool->total_allocated        += cur_block->size;
+        pool->guaranteed_reclaimable += cur_block->freed;
+        pool->possibly_reclaimable   += cur_block->freed + cur_block->freed_shared;
+    }
+}
+
+/*
+
+=item C<static void free_orphaned_large_blocks(GC_Statistics *stats,
+Variable_Size_Pool *pool)>
+
+Unmaps the large blocks which lost a sharer of their buffer and weren't
+seen by the compaction run, and clears the marks on all the others.
+
+=cut
+
+*/
+
+static void
+free_orphaned_large_blocks(ARGMOD(GC_Statistics *stats),
+        ARGMOD(Variable_Size_Pool *pool))
+{
+    ASSERT_ARGS(free_orphaned_large_blocks)
+    Memory_Block *cur_block = pool->large_blocks;
+
+    while (cur_block) {
+        Memory_Block * const next_block = cur_block->next;
+
+        if (!(cur_block->flags & Memory_Block_orphan_FLAG))
+            cur_block->flags &= ~Memory_Block_live_FLAG;
+        else if (!(cur_block->flags & Memory_Block_live_FLAG))
+            free_large_block(stats, pool, cur_block);
+        else {
+            /* Still in use; the next freed sharer flags it again */
+            cur_block->flags    &= ~(Memory_Block_live_FLAG | Memory_Block_orphan_FLAG);
+            pool->large_orphaned -= cur_block->size;
+        }
+
+        cur_block = next_block;
+    }
 }
 
 /*
@@ -1066,6 +1529,8 @@ free_old_mem_blocks(
 =item C<static int is_block_almost_full(const Memory_Block *block)>
 
 Tests if the block is almost full and should be skipped during compacting.
+Freed shared buffers count as available here, as compacting is the only way
+to find out whether another user still holds them.
 
 Returns true if less that 20% of block is available
 
@@ -1077,7 +1542,28 @@ static int
 is_block_almost_full(ARGIN(const Memory_Block *block))
 {
     ASSERT_ARGS(is_block_almost_full)
-    return 5 * (block->free + block->freed) < block->size;
+    return 5 * (block->free + block->freed + block->freed_shared) < block->size;
+}
+
+/*
+
+=item C<static int is_block_evacuated(const Compaction_State *state, const
+Memory_Block *block)>
+
+Tests if the live buffers of the block are moved out by the current
+compaction run. That's the case for every block which isn't almost full,
+and for a small promotion block left by the previous run.
+
+=cut
+
+*/
+
+static int
+is_block_evacuated(ARGIN(const Compaction_State *state),
+        ARGIN(const Memory_Block *block))
+{
+    ASSERT_ARGS(is_block_evacuated)
+    return block == state->merge || !is_block_almost_full(block);
 }
 
 /*
@@ -1103,6 +1589,18 @@ free_memory_pool(ARGFREE(Variable_Size_Pool *pool))
         cur_block = next_block;
     }
 
+    for (cur_block = pool->large_blocks; cur_block;) {
+        Memory_Block * const next_block = cur_block->next;
+        unmap_large_block(cur_block);
+        cur_block = next_block;
+    }
+
+    for (cur_block = pool->large_cache; cur_block;) {
+        Memory_Block * const next_block = cur_block->next;
+        unmap_large_block(cur_block);
+        cur_block = next_block;
+    }
+
     mem_internal_free(pool);
 }
 
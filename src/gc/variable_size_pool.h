@@ -17,6 +17,13 @@ E.g. strings.
 
 struct GC_Statistics;
 
+/* Memory_Block flags */
+typedef enum {
+    Memory_Block_large_FLAG  = 1 << 0,  /* holds one big buffer, never moved */
+    Memory_Block_live_FLAG   = 1 << 1,  /* buffer seen by a compaction run */
+    Memory_Block_orphan_FLAG = 1 << 2   /* a sharer of the buffer was freed */
+} Memory_Block_flags;
+
 typedef struct Memory_Block {
     size_t free;
     size_t size;
@@ -27,10 +34,20 @@ typedef struct Memory_Block {
 
     /* Amount of freed memory. Used in compact_pool */
     size_t freed;
+
+    /* Amount of freed shared memory, some of which may still be in use */
+    size_t freed_shared;
+
+    UINTVAL flags;
 } Memory_Block;
 
 typedef struct Variable_Size_Pool {
     Memory_Block *top_block;
+    Memory_Block *large_blocks;         /* mapped one by one, linked by next */
+    size_t        large_allocated;      /* bytes in large blocks */
+    size_t        large_orphaned;       /* of those, in blocks with a freed sharer */
+    Memory_Block *large_cache;          /* freed large blocks kept for reuse */
+    size_t        large_cached;         /* bytes in the cache */
     void (*compact)(PARROT_INTERP, struct GC_Statistics *, struct Variable_Size_Pool *);
     size_t minimum_block_size;
     size_t total_allocated; /* total bytes allocated to this pool */
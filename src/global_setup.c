@@ -22,7 +22,7 @@ I<What are these global variables?>
 
 #define INSIDE_GLOBAL_SETUP
 #include "parrot/parrot.h"
-#include "parrot/oplib/core_ops.h"
+#include "parrot/runcore_api.h"
 #include "global_setup.str"
 #include "parrot/api.h"
 
@@ -248,16 +248,11 @@ Parrot_gbl_setup_2(PARROT_INTERP)
 
     create_initial_context(interp);
 
-    /* initialize the ops hash */
-    if (interp->parent_interpreter) {
-        interp->op_hash = interp->parent_interpreter->op_hash;
-    }
-    else {
-        op_lib_t * const core_ops = PARROT_CORE_OPLIB_INIT(interp, 1);
-        interp->op_hash     = Parrot_hash_create_sized(interp, enum_type_ptr,
-                                    Hash_key_type_cstring, core_ops->op_count);
-        parrot_hash_oplib(interp, core_ops);
-    }
+    /* the ops hash is built on first use by the compilers, but a child
+     * shares it with its parent from the start, so dynamic oplibs the child
+     * loads go into the shared hash */
+    if (interp->parent_interpreter)
+        Parrot_runcore_build_op_hash(interp);
 
     /* create the namespace root stash */
     interp->root_namespace = Parrot_pmc_new(interp, enum_class_NameSpace);
@@ -378,6 +378,10 @@ hash_compare_pmc(PARROT_INTERP, ARGIN(PMC *a), ARGIN(PMC *b))
 Generic function to get the hashvalue of a given key. It may dispatch to
 key_hash_STRING, key_hash_cstring, etc. depending on hash->key_type.
 
+Pointer keys are folded onto their low bits: headers of one size come out of
+the same arenas, so their addresses share the low bits the bucket mask looks
+at, and a plain pointer value piles them into a few buckets.
+
 =cut
 
 */
@@ -401,6 +405,12 @@ key_hash(PARROT_INTERP, ARGIN(const Hash *hash), ARGIN_NULLOK(void *key))
     if (hash->key_type == Hash_key_type_PMC)
         return VTABLE_hashvalue(interp, (PMC *)key);
 
+    if (hash->key_type == Hash_key_type_ptr
+    ||  hash->key_type == Hash_key_type_PMC_ptr) {
+        const size_t k = (size_t)key;
+        return (k ^ (k >> 5) ^ (k >> 11)) ^ hash->seed;
+    }
+
     return ((size_t) key) ^ hash->seed;
 
 }
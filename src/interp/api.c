@@ -284,10 +284,6 @@ Parrot_interp_initialize_interpreter(PARROT_INTERP, ARGIN(Parrot_GC_Init_Args *a
     /* create the root set registry */
     interp->gc_registry = Parrot_pmc_new(interp, enum_class_AddrRegistry);
 
-    /* Set up MMD; MMD cache for builtins. */
-    interp->op_mmd_cache = Parrot_mmd_cache_create(interp);
-    Parrot_pmc_gc_register(interp, interp->op_mmd_cache);
-
     Parrot_gbl_init_world_once(interp);
 
     /* context data */
@@ -624,6 +620,13 @@ Parrot_interp_really_destroy(PARROT_INTERP, SHIM(int exit_code), SHIM(void *arg)
     Parrot_gc_mark_and_sweep(interp, GC_finish_FLAG);
 
     destroy_runloop_jump_points(interp);
+    Parrot_pcc_destroy_frame_stack(interp);
+
+    /* MMD dispatch table for builtins */
+    if (interp->op_mmd_dispatch) {
+        Parrot_mmd_dispatch_table_destroy(interp, interp->op_mmd_dispatch);
+        interp->op_mmd_dispatch = NULL;
+    }
 
     /* cache structure */
     destroy_object_cache(interp);
@@ -995,6 +998,9 @@ Parrot_interp_info(PARROT_INTERP, INTVAL what)
       case CURRENT_RUNCORE:
         ret = interp->run_core->id;
         break;
+      case LIBRARY_PROBES_SAVED:
+        ret = (INTVAL)interp->lib_probes_saved;
+        break;
         /*
          * sysinfo attributes go here.
          * We may deprecate sysinfo dynop in favour of interpinfo in future,
@@ -1046,12 +1052,14 @@ Parrot_interp_info_p(PARROT_INTERP, INTVAL what)
     switch (what) {
       case CURRENT_CTX:
         result = CURRENT_CONTEXT(interp);
+        Parrot_pcc_mark_chain_escaped(interp, result);
         break;
       case CURRENT_SUB:
         result = Parrot_pcc_get_sub(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_CONT:
         result = Parrot_pcc_get_continuation(interp, CURRENT_CONTEXT(interp));
+        Parrot_pcc_mark_chain_escaped(interp, CURRENT_CONTEXT(interp));
         break;
       case CURRENT_LEXPAD:
         result = Parrot_pcc_get_lex_pad(interp, CURRENT_CONTEXT(interp));
@@ -1,5 +1,5 @@
 /*
-Copyright (C) 2004-2012, Parrot Foundation.
+Copyright (C) 2004-2016, Parrot Foundation.
 
 =head1 NAME
 
@@ -11,6 +11,16 @@ This file contains C functions to access Parrot's bytecode library functions,
 for include files (via C<.include>), library files (via C<load_bytecode>), and
 dynext files (via C<loadlib>).
 
+Looking for a file tries every search path with every extension that may
+apply, and most of these tries fail. To avoid a C<stat> for each of them, the
+names in each absolute search directory are read once and kept in a
+per-interpreter cache. A name that isn't in the listing of its directory
+isn't probed; one that is gets probed as before. If a search finds nothing
+with the listings, it's done again without them, in case a file was created
+since, and the listings are dropped if that finds the file. They are also
+dropped when the search paths change through C<Parrot_lib_add_path>. The
+C<stat> calls saved are counted in C<interpinfo .INTERPINFO_LIBRARY_PROBES_SAVED>.
+
 =head2 Functions
 
 =over 4
@@ -21,6 +31,7 @@ dynext files (via C<loadlib>).
 
 #include "parrot/parrot.h"
 #include "parrot/dynext.h"
+#include "parrot/events.h"
 #include "library.str"
 
 /* HEADERIZER HFILE: include/parrot/library.h */
@@ -35,6 +46,9 @@ static void add_env_paths(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static void clear_dir_cache(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static STRING * cnv_to_win32_filesep(PARROT_INTERP,
@@ -42,6 +56,12 @@ static STRING * cnv_to_win32_filesep(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * get_dir_listing(PARROT_INTERP, ARGIN(STRING *dir))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PMC* get_search_paths(PARROT_INTERP, enum_lib_paths which)
@@ -52,6 +72,18 @@ static int is_abs_path(PARROT_INTERP, ARGIN(const STRING *file))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING* locate_in_paths(PARROT_INTERP,
+    ARGIN(STRING *file),
+    ARGIN(PMC *paths),
+    enum_runtime_ft type,
+    ARGMOD_NULLOK(INTVAL *saved))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*saved);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static STRING* path_concat(PARROT_INTERP,
@@ -70,28 +102,43 @@ static STRING* path_guarantee_trailing_separator(PARROT_INTERP,
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
-static STRING* try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
+static STRING* try_bytecode_extensions(PARROT_INTERP,
+    ARGIN(STRING* path),
+    ARGMOD_NULLOK(INTVAL *saved))
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2);
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*saved);
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
-static STRING* try_load_path(PARROT_INTERP, ARGIN(STRING* path))
+static STRING* try_load_path(PARROT_INTERP,
+    ARGIN(STRING* path),
+    ARGMOD_NULLOK(INTVAL *saved))
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2);
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*saved);
 
 #define ASSERT_ARGS_add_env_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(libpath) \
     , PARROT_ASSERT_ARG(envstr))
+#define ASSERT_ARGS_clear_dir_cache __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_cnv_to_win32_filesep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_get_dir_listing __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(dir))
 #define ASSERT_ARGS_get_search_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_is_abs_path __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(file))
+#define ASSERT_ARGS_locate_in_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(file) \
+    , PARROT_ASSERT_ARG(paths))
 #define ASSERT_ARGS_path_concat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(l_path) \
@@ -312,6 +359,8 @@ Parrot_lib_update_paths_from_config_hash(PARROT_INTERP)
     if (!STRING_IS_NULL(dynext_dirs) && !STRING_IS_EMPTY(dynext_dirs)) {
         add_env_paths(interp, paths, dynext_dirs);
     }
+
+    clear_dir_cache(interp);
 }
 
 
@@ -552,12 +601,102 @@ add_env_paths(PARROT_INTERP, ARGIN(PMC *libpath),
 
 /*
 
-=item C<static STRING* try_load_path(PARROT_INTERP, STRING* path)>
+=item C<static PMC * get_dir_listing(PARROT_INTERP, STRING *dir)>
+
+Returns a Hash of the names in the directory C<dir>, reading it into the
+directory cache the first time, or PMCNULL if C<dir> is relative or can't be
+read. A directory that doesn't exist has no names, and neither has a file.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+get_dir_listing(PARROT_INTERP, ARGIN(STRING *dir))
+{
+    ASSERT_ARGS(get_dir_listing)
+    PMC           *cache = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                IGLOBALS_LIB_DIR_CACHE);
+    PMC           *listing;
+    Parrot_runloop jmp;
+
+    if (!PMC_IS_NULL(cache)) {
+        listing = VTABLE_get_pmc_keyed_str(interp, cache, dir);
+        if (!PMC_IS_NULL(listing))
+            return listing;
+    }
+
+    /* relative directories depend on the current one */
+    if (!is_abs_path(interp, dir))
+        return PMCNULL;
+
+    listing = Parrot_pmc_new_init_int(interp, enum_class_Hash, enum_type_INTVAL);
+
+    if (Parrot_file_stat_intval(interp, dir, STAT_EXISTS)
+    &&  Parrot_file_stat_intval(interp, dir, STAT_ISDIR)) {
+        if (setjmp(jmp.resume)) {
+            /* not readable, so files in it can only be probed */
+            Parrot_cx_delete_handler_local(interp);
+            return PMCNULL;
+        }
+        else {
+            PMC   *names;
+            INTVAL i, n;
+
+            Parrot_ex_add_c_handler(interp, &jmp);
+            names = Parrot_file_readdir(interp, dir);
+            Parrot_cx_delete_handler_local(interp);
+
+            n = VTABLE_elements(interp, names);
+            for (i = 0; i < n; ++i)
+                VTABLE_set_integer_keyed_str(interp, listing,
+                        VTABLE_get_string_keyed_int(interp, names, i), 1);
+        }
+    }
+
+    if (PMC_IS_NULL(cache)) {
+        cache = Parrot_pmc_new(interp, enum_class_Hash);
+        VTABLE_set_pmc_keyed_int(interp, interp->iglobals,
+                IGLOBALS_LIB_DIR_CACHE, cache);
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, cache, dir, listing);
+
+    return listing;
+}
+
+/*
+
+=item C<static void clear_dir_cache(PARROT_INTERP)>
+
+Drops the directory listings read by C<get_dir_listing>.
+
+=cut
+
+*/
+
+static void
+clear_dir_cache(PARROT_INTERP)
+{
+    ASSERT_ARGS(clear_dir_cache)
+    VTABLE_set_pmc_keyed_int(interp, interp->iglobals,
+            IGLOBALS_LIB_DIR_CACHE, PMCNULL);
+}
+
+/*
+
+=item C<static STRING* try_load_path(PARROT_INTERP, STRING* path, INTVAL
+*saved)>
 
 Attempts to load a file with name C<path>. If the file is successfully located,
 the finalized name of the file is returned as a STRING. Otherwise, returns
 NULL.
 
+If C<saved> isn't NULL, a file missing from the cached listing of its
+directory isn't looked for, and C<saved> counts these.
+
 =cut
 
 */
@@ -565,7 +704,7 @@ NULL.
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING*
-try_load_path(PARROT_INTERP, ARGIN(STRING* path))
+try_load_path(PARROT_INTERP, ARGIN(STRING* path), ARGMOD_NULLOK(INTVAL *saved))
 {
     ASSERT_ARGS(try_load_path)
 
@@ -573,6 +712,28 @@ try_load_path(PARROT_INTERP, ARGIN(STRING* path))
     path = cnv_to_win32_filesep(interp, path);
 #endif
 
+    if (saved) {
+#ifdef WIN32
+        STRING * const sep = CONST_STRING(interp, "\\");
+#else
+        STRING * const sep = CONST_STRING(interp, "/");
+#endif
+        const INTVAL   len = STRING_length(path);
+        const INTVAL   end = Parrot_str_find_reverse_index(interp, path, sep, len);
+
+        if (end >= 0 && end < len - 1) {
+            PMC * const listing = get_dir_listing(interp,
+                                        STRING_substr(interp, path, 0, end + 1));
+
+            if (!PMC_IS_NULL(listing)
+            &&  !VTABLE_exists_keyed_str(interp, listing,
+                        STRING_substr(interp, path, end + 1, len - end - 1))) {
+                ++*saved;
+                return NULL;
+            }
+        }
+    }
+
     if (Parrot_file_stat_intval(interp, path, STAT_EXISTS)) {
         return path;
     }
@@ -582,11 +743,13 @@ try_load_path(PARROT_INTERP, ARGIN(STRING* path))
 
 /*
 
-=item C<static STRING* try_bytecode_extensions(PARROT_INTERP, STRING* path)>
+=item C<static STRING* try_bytecode_extensions(PARROT_INTERP, STRING* path,
+INTVAL *saved)>
 
 Guess extensions, so that the user can drop the extensions
 leaving it up to the build process/install whether or not
-a .pbc, .pasm or a .pir file is used.
+a .pbc, .pasm or a .pir file is used. C<saved> is passed on to
+C<try_load_path>.
 
 =cut
 
@@ -595,7 +758,8 @@ a .pbc, .pasm or a .pir file is used.
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING*
-try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
+try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path),
+        ARGMOD_NULLOK(INTVAL *saved))
 {
     ASSERT_ARGS(try_bytecode_extensions)
     STRING *test_path, *result;
@@ -606,7 +770,7 @@ try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
     test_path = path;
 
     /* First try the path as given. */
-    result = try_load_path(interp, test_path);
+    result = try_load_path(interp, test_path, saved);
     if (result)
         return result;
 
@@ -624,7 +788,7 @@ try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
             if (STRING_equal(interp, orig_ext, pir_extension)) {
                 STRING * const without_ext = Parrot_str_chopn(interp, test_path, 4);
                 test_path = Parrot_str_concat(interp, without_ext, bytecode_extension);
-                result = try_load_path(interp, test_path);
+                result = try_load_path(interp, test_path, saved);
                 if (result)
                     return result;
             }
@@ -632,12 +796,12 @@ try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
             else if (STRING_equal(interp, orig_ext, bytecode_extension)) {
                 STRING * const without_ext = Parrot_str_chopn(interp, test_path, 4);
                 test_path = Parrot_str_concat(interp, without_ext, pir_extension);
-                result = try_load_path(interp, test_path);
+                result = try_load_path(interp, test_path, saved);
                 if (result)
                     return result;
 
                 test_path = Parrot_str_concat(interp, without_ext, pasm_extension);
-                result = try_load_path(interp, test_path);
+                result = try_load_path(interp, test_path, saved);
                 if (result)
                     return result;
             }
@@ -650,7 +814,7 @@ try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
             if (STRING_equal(interp, orig_ext, pasm_extension)) {
                 STRING * const without_ext = Parrot_str_chopn(interp, test_path, 5);
                 test_path = Parrot_str_concat(interp, without_ext, bytecode_extension);
-                result = try_load_path(interp, test_path);
+                result = try_load_path(interp, test_path, saved);
                 if (result)
                     return result;
             }
@@ -683,6 +847,7 @@ Parrot_lib_add_path(PARROT_INTERP,
         IGLOBALS_LIB_PATHS);
     PMC * const paths = VTABLE_get_pmc_keyed_int(interp, lib_paths, which);
     VTABLE_unshift_string(interp, paths, path_str);
+    clear_dir_cache(interp);
 }
 
 /*
@@ -709,6 +874,66 @@ Parrot_lib_add_path_from_cstring(PARROT_INTERP,
 
 /*
 
+=item C<static STRING* locate_in_paths(PARROT_INTERP, STRING *file, PMC *paths,
+enum_runtime_ft type, INTVAL *saved)>
+
+Looks for the relative path C<file> of the given file type(s) in the
+directories C<paths>, in the runtime prefix for relative ones, and finally
+in the current directory. Uses the directory cache if C<saved> isn't NULL.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING*
+locate_in_paths(PARROT_INTERP, ARGIN(STRING *file), ARGIN(PMC *paths),
+        enum_runtime_ft type, ARGMOD_NULLOK(INTVAL *saved))
+{
+    ASSERT_ARGS(locate_in_paths)
+    STRING * const prefix = Parrot_get_runtime_path(interp);
+    const INTVAL   n      = VTABLE_elements(interp, paths);
+    STRING        *full_name;
+    INTVAL         i;
+
+    for (i = 0; i < n; ++i) {
+        STRING * const path = VTABLE_get_string_keyed_int(interp, paths, i);
+        STRING *found_name;
+
+        full_name = path_concat(interp, path, file);
+
+        found_name =
+            (type & PARROT_RUNTIME_FT_DYNEXT)
+                ? try_load_path(interp, full_name, saved)
+                : try_bytecode_extensions(interp, full_name, saved);
+
+        if (found_name)
+            return found_name;
+
+        if (STRING_length(prefix) && !is_abs_path(interp, path)) {
+            full_name = path_concat(interp, prefix, full_name);
+
+            found_name =
+                (type & PARROT_RUNTIME_FT_DYNEXT)
+                    ? try_load_path(interp, full_name, saved)
+                    : try_bytecode_extensions(interp, full_name, saved);
+
+            if (found_name)
+                return found_name;
+        }
+    }
+
+    full_name =
+        (type & PARROT_RUNTIME_FT_DYNEXT)
+            ? try_load_path(interp, file, saved)
+            : try_bytecode_extensions(interp, file, saved);
+
+    return full_name;
+}
+
+/*
+
 =item C<STRING* Parrot_locate_runtime_file_str(PARROT_INTERP, STRING *file,
 enum_runtime_ft type)>
 
@@ -729,10 +954,9 @@ Parrot_locate_runtime_file_str(PARROT_INTERP, ARGIN(STRING *file),
         enum_runtime_ft type)
 {
     ASSERT_ARGS(Parrot_locate_runtime_file_str)
-    STRING *prefix;
     STRING *full_name;
     PMC    *paths;
-    INTVAL  i, n;
+    INTVAL  saved = 0;
 
     /* if this is an absolute path return it as is */
     if (is_abs_path(interp, file))
@@ -747,41 +971,21 @@ Parrot_locate_runtime_file_str(PARROT_INTERP, ARGIN(STRING *file),
     else
         paths = get_search_paths(interp, PARROT_LIB_PATH_INCLUDE);
 
-    prefix = Parrot_get_runtime_path(interp);
-    n = VTABLE_elements(interp, paths);
-
-    for (i = 0; i < n; ++i) {
-        STRING * const path = VTABLE_get_string_keyed_int(interp, paths, i);
-        STRING *found_name;
-
-        full_name = path_concat(interp, path, file);
+    full_name = locate_in_paths(interp, file, paths, type, &saved);
 
-        found_name =
-            (type & PARROT_RUNTIME_FT_DYNEXT)
-                ? try_load_path(interp, full_name)
-                : try_bytecode_extensions(interp, full_name);
-
-        if (found_name)
-            return found_name;
-
-        if (STRING_length(prefix) && !is_abs_path(interp, path)) {
-            full_name = path_concat(interp, prefix, full_name);
+    if (full_name) {
+        interp->lib_probes_saved += saved;
+        return full_name;
+    }
 
-            found_name =
-                (type & PARROT_RUNTIME_FT_DYNEXT)
-                    ? try_load_path(interp, full_name)
-                    : try_bytecode_extensions(interp, full_name);
+    /* a file may have been created since its directory was listed */
+    if (saved) {
+        full_name = locate_in_paths(interp, file, paths, type, NULL);
 
-            if (found_name)
-                return found_name;
-        }
+        if (full_name)
+            clear_dir_cache(interp);
     }
 
-    full_name =
-        (type & PARROT_RUNTIME_FT_DYNEXT)
-            ? try_load_path(interp, file)
-            : try_bytecode_extensions(interp, file);
-
     return full_name;
 }
 
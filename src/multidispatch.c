@@ -45,6 +45,7 @@ them, with default behaviour.
 #include "pmc/pmc_nativepccmethod.h"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_multisub.h"
 
 /* HEADERIZER HFILE: include/parrot/multidispatch.h */
 
@@ -74,13 +75,6 @@ static PMC* mmd_build_type_tuple_from_long_sig(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
-PARROT_CANNOT_RETURN_NULL
-PARROT_WARN_UNUSED_RESULT
-static PMC* mmd_build_type_tuple_from_type_list(PARROT_INTERP,
-    ARGIN(PMC *type_list))
-        __attribute__nonnull__(1)
-        __attribute__nonnull__(2);
-
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING * mmd_cache_key_from_types(PARROT_INTERP,
@@ -99,12 +93,91 @@ static STRING * mmd_cache_key_from_values(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_CAN_RETURN_NULL
+static PMC * mmd_candidate_signature(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC* mmd_cvt_to_types(PARROT_INTERP, ARGIN(PMC *multi_sig))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+static INTVAL mmd_dispatch_arity(PARROT_INTERP,
+    ARGIN(PMC **candidates),
+    INTVAL n)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CAN_RETURN_NULL
+static PMC * mmd_dispatch_builtin(PARROT_INTERP,
+    ARGIN(const char *name),
+    ARGIN(PMC *sig_obj))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static MMD_Dispatch_entry * mmd_dispatch_find(
+    ARGIN(const MMD_Dispatch_table *table),
+    ARGIN_NULLOK(const char *name),
+    UINTVAL hash,
+    ARGIN(const INTVAL *types),
+    INTVAL n_keyed,
+    INTVAL n_args)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(4);
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL mmd_dispatch_hash(
+    ARGIN_NULLOK(const char *name),
+    ARGIN(const INTVAL *types),
+    INTVAL n_keyed,
+    INTVAL n_args)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_dispatch_key(PARROT_INTERP,
+    ARGIN(PMC *sig_obj),
+    INTVAL arity,
+    ARGOUT(INTVAL *types),
+    ARGOUT(INTVAL *n_args))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*types)
+        FUNC_MODIFIES(*n_args);
+
+static void mmd_dispatch_store(PARROT_INTERP,
+    ARGMOD(MMD_Dispatch_table *table),
+    ARGIN_NULLOK(const char *name),
+    UINTVAL hash,
+    ARGIN(const INTVAL *types),
+    INTVAL n_keyed,
+    INTVAL n_args,
+    ARGIN(PMC *sub))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(5)
+        __attribute__nonnull__(8)
+        FUNC_MODIFIES(*table);
+
+static void mmd_dispatch_table_clear(PARROT_INTERP,
+    ARGMOD(MMD_Dispatch_table *table))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*table);
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static MMD_Dispatch_table * mmd_dispatch_table_create(PARROT_INTERP,
+    INTVAL arity)
+        __attribute__nonnull__(1);
+
 static UINTVAL mmd_distance(PARROT_INTERP,
     ARGIN(PMC *pmc),
     ARGIN(PMC *arg_tuple))
@@ -128,6 +201,11 @@ static void mmd_search_global(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL mmd_type_from_name(PARROT_INTERP, ARGIN(STRING *type_name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC * Parrot_mmd_get_cached_multi_sig(PARROT_INTERP,
@@ -163,10 +241,6 @@ static PMC * Parrot_mmd_sort_candidates(PARROT_INTERP,
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(long_sig))
-#define ASSERT_ARGS_mmd_build_type_tuple_from_type_list \
-     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(type_list))
 #define ASSERT_ARGS_mmd_cache_key_from_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name) \
@@ -175,9 +249,39 @@ static PMC * Parrot_mmd_sort_candidates(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(values))
+#define ASSERT_ARGS_mmd_candidate_signature __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_mmd_cvt_to_types __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(multi_sig))
+#define ASSERT_ARGS_mmd_dispatch_arity __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(candidates))
+#define ASSERT_ARGS_mmd_dispatch_builtin __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(sig_obj))
+#define ASSERT_ARGS_mmd_dispatch_find __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(table) \
+    , PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_dispatch_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(types))
+#define ASSERT_ARGS_mmd_dispatch_key __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sig_obj) \
+    , PARROT_ASSERT_ARG(types) \
+    , PARROT_ASSERT_ARG(n_args))
+#define ASSERT_ARGS_mmd_dispatch_store __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(table) \
+    , PARROT_ASSERT_ARG(types) \
+    , PARROT_ASSERT_ARG(sub))
+#define ASSERT_ARGS_mmd_dispatch_table_clear __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(table))
+#define ASSERT_ARGS_mmd_dispatch_table_create __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_mmd_distance __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc) \
@@ -191,6 +295,9 @@ static PMC * Parrot_mmd_sort_candidates(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(cl))
+#define ASSERT_ARGS_mmd_type_from_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(type_name))
 #define ASSERT_ARGS_Parrot_mmd_get_cached_multi_sig \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -271,18 +378,7 @@ Parrot_mmd_multi_dispatch_from_c_args(PARROT_INTERP,
     va_start(args, sig);
     call_obj = Parrot_pcc_build_call_from_varargs(interp, PMCNULL, arg_sig, &args);
 
-    /* Check the cache. */
-    sub = Parrot_mmd_cache_lookup_by_types(interp, interp->op_mmd_cache, name,
-            VTABLE_get_pmc(interp, call_obj));
-
-    if (PMC_IS_NULL(sub)) {
-        sub = Parrot_mmd_find_multi_from_sig_obj(interp,
-            Parrot_str_new_constant(interp, name), call_obj);
-
-        if (!PMC_IS_NULL(sub))
-            Parrot_mmd_cache_store_by_types(interp, interp->op_mmd_cache, name,
-                    VTABLE_get_pmc(interp, call_obj), sub);
-    }
+    sub = mmd_dispatch_builtin(interp, name, call_obj);
 
     if (PMC_IS_NULL(sub))
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_METHOD_NOT_FOUND,
@@ -371,46 +467,509 @@ Parrot_mmd_sort_manhattan_by_sig_pmc(PARROT_INTERP, ARGIN(PMC *candidates),
 
 /*
 
-=item C<static PMC* mmd_build_type_tuple_from_type_list(PARROT_INTERP, PMC
-*type_list)>
+=item C<PMC * Parrot_mmd_dispatch_multisub(PARROT_INTERP, PMC *multi, PMC
+*sig_obj)>
 
-Construct a FixedIntegerArray of type numbers from an array of
-type names. Used for multiple dispatch.
+Returns the candidate of the MultiSub C<multi> best matching the arguments in
+the CallContext C<sig_obj>, or C<PMCNULL> if none applies.
+
+The choice only depends on the type ids of the first few positional
+arguments, so it's remembered in a table on the MultiSub keyed by that type
+tuple. A hit costs a hash probe over native integers; only the first call
+with each tuple pays for the Manhattan distance search. The table is rebuilt
+if candidates are added, removed, or reordered, or new types are registered.
 
 =cut
 
 */
 
-PARROT_CANNOT_RETURN_NULL
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
-static PMC*
-mmd_build_type_tuple_from_type_list(PARROT_INTERP, ARGIN(PMC *type_list))
+PMC *
+Parrot_mmd_dispatch_multisub(PARROT_INTERP, ARGIN(PMC *multi), ARGIN(PMC *sig_obj))
 {
-    ASSERT_ARGS(mmd_build_type_tuple_from_type_list)
-    INTVAL param_count = VTABLE_elements(interp, type_list);
-    PMC   *multi_sig   = Parrot_pmc_new_init_int(interp,
-            enum_class_FixedIntegerArray, param_count);
+    ASSERT_ARGS(Parrot_mmd_dispatch_multisub)
+    Parrot_MultiSub_attributes * const attrs = PARROT_MULTISUB(multi);
+    MMD_Dispatch_table                *table;
+    MMD_Dispatch_entry                *entry;
+    PMC                              **candidates;
+    PMC                               *sub;
+    INTVAL                             types[PARROT_MMD_DISPATCH_MAX_ARGS];
+    INTVAL                             n_args, n_keyed;
+    UINTVAL                            hash;
+
+    if (multi->vtable->base_type != enum_class_MultiSub)
+        return Parrot_mmd_sort_manhattan_by_sig_pmc(interp, multi, sig_obj);
+
+    if (!attrs->size)
+        return PMCNULL;
+
+    candidates = attrs->pmc_array + attrs->offset;
+    table      = attrs->dispatch;
+
+    if (!table
+    ||  table->n_types      != interp->n_vtable_max
+    ||  table->n_candidates != attrs->size
+    ||  memcmp(table->candidates, candidates, attrs->size * sizeof (PMC *))) {
+        if (table)
+            Parrot_mmd_dispatch_table_destroy(interp, table);
+
+        table = attrs->dispatch = mmd_dispatch_table_create(interp,
+                    mmd_dispatch_arity(interp, candidates, attrs->size));
+
+        table->candidates   = mem_gc_allocate_n_typed(interp, attrs->size, PMC *);
+        table->n_candidates = attrs->size;
+        mem_copy_n_typed(table->candidates, candidates, attrs->size, PMC *);
+
+        /* the copied candidates are marked along with the MultiSub */
+        PObj_custom_mark_destroy_SETALL(multi);
+        PARROT_GC_WRITE_BARRIER(interp, multi);
+    }
+
+    if (!table->slots)
+        return Parrot_mmd_sort_candidates(interp,
+                VTABLE_get_pmc(interp, sig_obj), multi);
+
+    n_keyed = mmd_dispatch_key(interp, sig_obj, table->arity, types, &n_args);
+
+    if (n_keyed < 0)
+        return Parrot_mmd_sort_candidates(interp,
+                VTABLE_get_pmc(interp, sig_obj), multi);
+
+    hash  = mmd_dispatch_hash(NULL, types, n_keyed, n_args);
+    entry = mmd_dispatch_find(table, NULL, hash, types, n_keyed, n_args);
+
+    if (entry->sub)
+        return entry->sub;
+
+    sub = Parrot_mmd_sort_candidates(interp, VTABLE_get_pmc(interp, sig_obj), multi);
+
+    if (!PMC_IS_NULL(sub))
+        mmd_dispatch_store(interp, table, NULL, hash, types, n_keyed, n_args, sub);
+
+    return sub;
+}
+
+/*
+
+=item C<static PMC * mmd_dispatch_builtin(PARROT_INTERP, const char *name, PMC
+*sig_obj)>
+
+Finds the multi C<name> best matching the arguments in C<sig_obj> for
+C<Parrot_mmd_multi_dispatch_from_c_args>. Candidates are searched for by
+name, so the interpreter wide table is keyed by name as well as types.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static PMC *
+mmd_dispatch_builtin(PARROT_INTERP, ARGIN(const char *name), ARGIN(PMC *sig_obj))
+{
+    ASSERT_ARGS(mmd_dispatch_builtin)
+    MMD_Dispatch_table *table = interp->op_mmd_dispatch;
+    MMD_Dispatch_entry *entry;
+    PMC                *sub;
+    INTVAL              types[PARROT_MMD_DISPATCH_MAX_ARGS];
+    INTVAL              n_args, n_keyed;
+    UINTVAL             hash;
+
+    if (!table)
+        table = interp->op_mmd_dispatch = mmd_dispatch_table_create(interp, -1);
+    else if (table->n_types != interp->n_vtable_max)
+        mmd_dispatch_table_clear(interp, table);
+
+    n_keyed = mmd_dispatch_key(interp, sig_obj, -1, types, &n_args);
+
+    if (n_keyed < 0)
+        return Parrot_mmd_find_multi_from_sig_obj(interp,
+                Parrot_str_new_constant(interp, name), sig_obj);
+
+    hash  = mmd_dispatch_hash(name, types, n_keyed, n_args);
+    entry = mmd_dispatch_find(table, name, hash, types, n_keyed, n_args);
+
+    if (entry->sub)
+        return entry->sub;
+
+    sub = Parrot_mmd_find_multi_from_sig_obj(interp,
+            Parrot_str_new_constant(interp, name), sig_obj);
+
+    if (!PMC_IS_NULL(sub))
+        mmd_dispatch_store(interp, table, name, hash, types, n_keyed, n_args, sub);
+
+    return sub;
+}
+
+/*
+
+=item C<static INTVAL mmd_dispatch_arity(PARROT_INTERP, PMC **candidates, INTVAL
+n)>
+
+Returns the length of the longest signature among the C<n> C<candidates>,
+which is how many argument types a dispatch over them can look at.
+
+=cut
+
+*/
+
+static INTVAL
+mmd_dispatch_arity(PARROT_INTERP, ARGIN(PMC **candidates), INTVAL n)
+{
+    ASSERT_ARGS(mmd_dispatch_arity)
+    INTVAL arity = 0;
     INTVAL i;
 
-    for (i = 0; i < param_count; ++i) {
-        STRING *type_name = VTABLE_get_string_keyed_int(interp, type_list, i);
-        INTVAL  type;
-
-        if (STRING_equal(interp, type_name, CONST_STRING(interp, "DEFAULT")))
-            type = -enum_type_PMC;
-        else if (STRING_equal(interp, type_name, CONST_STRING(interp, "STRING")))
-            type = -enum_type_STRING;
-        else if (STRING_equal(interp, type_name, CONST_STRING(interp, "INTVAL")))
-            type = -enum_type_INTVAL;
-        else if (STRING_equal(interp, type_name, CONST_STRING(interp, "FLOATVAL")))
-            type = -enum_type_FLOATVAL;
-        else
-            type = Parrot_pmc_get_type_str(interp, type_name);
+    for (i = 0; i < n; ++i) {
+        PMC * const multi_sig = mmd_candidate_signature(interp, candidates[i]);
+
+        if (!PMC_IS_NULL(multi_sig)) {
+            const INTVAL elements = VTABLE_elements(interp, multi_sig);
 
-        VTABLE_set_integer_keyed_int(interp, multi_sig, i, type);
+            if (elements > arity)
+                arity = elements;
+        }
     }
 
-    return multi_sig;
+    return arity;
+}
+
+/*
+
+=item C<static INTVAL mmd_dispatch_key(PARROT_INTERP, PMC *sig_obj, INTVAL
+arity, INTVAL *types, INTVAL *n_args)>
+
+Fills C<types> with the type ids of the positional arguments in C<sig_obj>,
+the same ids C<Parrot_mmd_build_type_tuple_from_sig_obj> produces, but
+without building a tuple PMC. Only the first C<arity> are looked at, as no
+candidate looks further; past that only whether there are more arguments
+than invocants matters, so C<n_args> is clamped to C<arity + 1>. An
+C<arity> of -1 keys all positionals.
+
+Returns the number of type ids filled in, or -1 if the call can't be keyed.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_dispatch_key(PARROT_INTERP, ARGIN(PMC *sig_obj), INTVAL arity,
+        ARGOUT(INTVAL *types), ARGOUT(INTVAL *n_args))
+{
+    ASSERT_ARGS(mmd_dispatch_key)
+    Pcc_cell *cells;
+    INTVAL    n, i;
+
+    if (sig_obj->vtable->base_type != enum_class_CallContext)
+        return -1;
+
+    GETATTR_CallContext_positionals(interp, sig_obj, cells);
+    GETATTR_CallContext_num_positionals(interp, sig_obj, n);
+
+    *n_args = n;
+
+    if (arity < 0) {
+        if (n > PARROT_MMD_DISPATCH_MAX_ARGS)
+            return -1;
+    }
+    else if (n > arity) {
+        *n_args = arity + 1;
+        n       = arity;
+    }
+
+    for (i = 0; i < n; ++i) {
+        switch (cells[i].type) {
+          case INTCELL:    types[i] = -enum_type_INTVAL;   break;
+          case FLOATCELL:  types[i] = -enum_type_FLOATVAL; break;
+          case STRINGCELL: types[i] = -enum_type_STRING;   break;
+          case PMCCELL:
+            types[i] = PMC_IS_NULL(cells[i].u.p)
+                     ? (INTVAL)-enum_type_PMC
+                     : VTABLE_type(interp, cells[i].u.p);
+            break;
+          default:
+            return -1;
+        }
+    }
+
+    return n;
+}
+
+/*
+
+=item C<static UINTVAL mmd_dispatch_hash(const char *name, const INTVAL *types,
+INTVAL n_keyed, INTVAL n_args)>
+
+Hashes a dispatch key.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL
+mmd_dispatch_hash(ARGIN_NULLOK(const char *name), ARGIN(const INTVAL *types),
+        INTVAL n_keyed, INTVAL n_args)
+{
+    ASSERT_ARGS(mmd_dispatch_hash)
+    UINTVAL hash = (UINTVAL)n_args;
+    INTVAL  i;
+
+    if (name)
+        while (*name)
+            hash = hash * 33 + (unsigned char)*name++;
+
+    for (i = 0; i < n_keyed; ++i)
+        hash = (hash ^ (UINTVAL)types[i]) * 0x9E3779B1;
+
+    return hash ^ (hash >> 15);
+}
+
+/*
+
+=item C<static MMD_Dispatch_entry * mmd_dispatch_find(const MMD_Dispatch_table
+*table, const char *name, UINTVAL hash, const INTVAL *types, INTVAL n_keyed,
+INTVAL n_args)>
+
+Returns the slot of C<table> holding the given key, or the free slot it
+would go into.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static MMD_Dispatch_entry *
+mmd_dispatch_find(ARGIN(const MMD_Dispatch_table *table),
+        ARGIN_NULLOK(const char *name), UINTVAL hash,
+        ARGIN(const INTVAL *types), INTVAL n_keyed, INTVAL n_args)
+{
+    ASSERT_ARGS(mmd_dispatch_find)
+    UINTVAL i = hash & table->mask;
+
+    for (;;) {
+        MMD_Dispatch_entry * const entry = table->slots + i;
+
+        if (!entry->sub)
+            return entry;
+
+        if (entry->hash   == hash
+        &&  entry->n_args == n_args
+        &&  !memcmp(entry->types, types, n_keyed * sizeof (INTVAL))
+        &&  (!name || STREQ(entry->name, name)))
+            return entry;
+
+        i = (i + 1) & table->mask;
+    }
+}
+
+/*
+
+=item C<static void mmd_dispatch_store(PARROT_INTERP, MMD_Dispatch_table *table,
+const char *name, UINTVAL hash, const INTVAL *types, INTVAL n_keyed, INTVAL
+n_args, PMC *sub)>
+
+Remembers C<sub> as the candidate for the given key, growing C<table> to
+keep it at most half full.
+
+=cut
+
+*/
+
+static void
+mmd_dispatch_store(PARROT_INTERP, ARGMOD(MMD_Dispatch_table *table),
+        ARGIN_NULLOK(const char *name), UINTVAL hash,
+        ARGIN(const INTVAL *types), INTVAL n_keyed, INTVAL n_args,
+        ARGIN(PMC *sub))
+{
+    ASSERT_ARGS(mmd_dispatch_store)
+    MMD_Dispatch_entry *entry;
+
+    if ((table->used + 1) * 2 > table->mask + 1) {
+        MMD_Dispatch_entry * const old_slots = table->slots;
+        const UINTVAL              old_size  = table->mask + 1;
+        UINTVAL                    i;
+
+        table->mask  = old_size * 2 - 1;
+        table->slots = mem_gc_allocate_n_zeroed_typed(interp, old_size * 2,
+                            MMD_Dispatch_entry);
+
+        for (i = 0; i < old_size; ++i) {
+            if (old_slots[i].sub) {
+                UINTVAL j = old_slots[i].hash & table->mask;
+
+                while (table->slots[j].sub)
+                    j = (j + 1) & table->mask;
+
+                table->slots[j] = old_slots[i];
+            }
+        }
+
+        mem_gc_free(interp, old_slots);
+    }
+
+    entry = mmd_dispatch_find(table, name, hash, types, n_keyed, n_args);
+
+    if (!entry->sub) {
+        entry->name   = name ? mem_sys_strdup(name) : NULL;
+        entry->hash   = hash;
+        entry->n_args = n_args;
+        mem_copy_n_typed(entry->types, types, n_keyed, INTVAL);
+        ++table->used;
+    }
+
+    entry->sub = sub;
+}
+
+/*
+
+=item C<static MMD_Dispatch_table * mmd_dispatch_table_create(PARROT_INTERP,
+INTVAL arity)>
+
+Creates an empty dispatch table keying on the first C<arity> argument types,
+or all of them if C<arity> is -1. Multis with signatures too long to key on
+get a table without slots, which always falls back to the full search.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static MMD_Dispatch_table *
+mmd_dispatch_table_create(PARROT_INTERP, INTVAL arity)
+{
+    ASSERT_ARGS(mmd_dispatch_table_create)
+    MMD_Dispatch_table * const table =
+        mem_gc_allocate_zeroed_typed(interp, MMD_Dispatch_table);
+
+    table->arity   = arity;
+    table->n_types = interp->n_vtable_max;
+
+    if (arity <= PARROT_MMD_DISPATCH_MAX_ARGS) {
+        table->mask  = 7;
+        table->slots = mem_gc_allocate_n_zeroed_typed(interp, table->mask + 1,
+                            MMD_Dispatch_entry);
+    }
+
+    return table;
+}
+
+/*
+
+=item C<static void mmd_dispatch_table_clear(PARROT_INTERP, MMD_Dispatch_table
+*table)>
+
+Forgets all entries of C<table>, for when new types have been registered.
+
+=cut
+
+*/
+
+static void
+mmd_dispatch_table_clear(PARROT_INTERP, ARGMOD(MMD_Dispatch_table *table))
+{
+    ASSERT_ARGS(mmd_dispatch_table_clear)
+    UINTVAL i;
+
+    if (table->slots) {
+        for (i = 0; i <= table->mask; ++i)
+            if (table->slots[i].name)
+                mem_sys_free(table->slots[i].name);
+
+        memset(table->slots, 0, (table->mask + 1) * sizeof (MMD_Dispatch_entry));
+    }
+
+    table->used    = 0;
+    table->n_types = interp->n_vtable_max;
+}
+
+/*
+
+=item C<void Parrot_mmd_dispatch_table_destroy(PARROT_INTERP, MMD_Dispatch_table
+*table)>
+
+Frees a dispatch table.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_mmd_dispatch_table_destroy(PARROT_INTERP, ARGFREE(MMD_Dispatch_table *table))
+{
+    ASSERT_ARGS(Parrot_mmd_dispatch_table_destroy)
+
+    mmd_dispatch_table_clear(interp, table);
+
+    if (table->slots)
+        mem_gc_free(interp, table->slots);
+    if (table->candidates)
+        mem_gc_free(interp, table->candidates);
+
+    mem_gc_free(interp, table);
+}
+
+/*
+
+=item C<void Parrot_mmd_dispatch_table_mark(PARROT_INTERP, MMD_Dispatch_table
+*table)>
+
+GC-marks the candidates a dispatch table refers to.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_mmd_dispatch_table_mark(PARROT_INTERP, ARGIN(MMD_Dispatch_table *table))
+{
+    ASSERT_ARGS(Parrot_mmd_dispatch_table_mark)
+    UINTVAL i;
+
+    for (i = 0; i < (UINTVAL)table->n_candidates; ++i)
+        Parrot_gc_mark_PMC_alive(interp, table->candidates[i]);
+
+    if (table->slots)
+        for (i = 0; i <= table->mask; ++i)
+            if (table->slots[i].sub)
+                Parrot_gc_mark_PMC_alive(interp, table->slots[i].sub);
+}
+
+/*
+
+=item C<static INTVAL mmd_type_from_name(PARROT_INTERP, STRING *type_name)>
+
+Return the type number used for multiple dispatch for one type name of a long
+signature. C<DEFAULT>, C<STRING>, C<INTVAL> and C<FLOATVAL> name the native
+types, every other name is looked up as a PMC type.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+mmd_type_from_name(PARROT_INTERP, ARGIN(STRING *type_name))
+{
+    ASSERT_ARGS(mmd_type_from_name)
+
+    if (STRING_equal(interp, type_name, CONST_STRING(interp, "DEFAULT")))
+        return -enum_type_PMC;
+    else if (STRING_equal(interp, type_name, CONST_STRING(interp, "STRING")))
+        return -enum_type_STRING;
+    else if (STRING_equal(interp, type_name, CONST_STRING(interp, "INTVAL")))
+        return -enum_type_INTVAL;
+    else if (STRING_equal(interp, type_name, CONST_STRING(interp, "FLOATVAL")))
+        return -enum_type_FLOATVAL;
+    else
+        return Parrot_pmc_get_type_str(interp, type_name);
 }
 
 /*
@@ -421,6 +980,10 @@ mmd_build_type_tuple_from_type_list(PARROT_INTERP, ARGIN(PMC *type_list))
 Construct a FixedIntegerArray of type numbers from a comma-delimited string of
 type names. Used for multiple dispatch.
 
+Every PMC with C<MULTI> methods registers each of them through here when its
+class is initialized, so this walks the signature in place instead of
+splitting it into a string array first.
+
 =cut
 
 */
@@ -431,9 +994,35 @@ static PMC*
 mmd_build_type_tuple_from_long_sig(PARROT_INTERP, ARGIN(STRING *long_sig))
 {
     ASSERT_ARGS(mmd_build_type_tuple_from_long_sig)
-    PMC *type_list = Parrot_str_split(interp, CONST_STRING(interp, ","), long_sig);
+    STRING * const comma       = CONST_STRING(interp, ",");
+    const INTVAL   sig_length  = STRING_length(long_sig);
+    INTVAL         param_count = 0;
+    INTVAL         start       = 0;
+    INTVAL         i;
+    PMC           *multi_sig;
+
+    if (sig_length) {
+        INTVAL pos = STRING_index(interp, long_sig, comma, 0);
+
+        for (param_count = 1; pos >= 0; ++param_count)
+            pos = STRING_index(interp, long_sig, comma, pos + 1);
+    }
 
-    return mmd_build_type_tuple_from_type_list(interp, type_list);
+    multi_sig = Parrot_pmc_new_init_int(interp,
+            enum_class_FixedIntegerArray, param_count);
+
+    for (i = 0; i < param_count; ++i) {
+        INTVAL end = STRING_index(interp, long_sig, comma, start);
+
+        if (end < 0)
+            end = sig_length;
+
+        VTABLE_set_integer_keyed_int(interp, multi_sig, i, mmd_type_from_name(interp,
+                STRING_substr(interp, long_sig, start, end - start)));
+        start = end + 1;
+    }
+
+    return multi_sig;
 }
 
 /*
@@ -538,7 +1127,7 @@ static PMC *
 Parrot_mmd_get_cached_multi_sig(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 {
     ASSERT_ARGS(Parrot_mmd_get_cached_multi_sig)
-    if (VTABLE_isa(interp, sub_pmc, CONST_STRING(interp, "Sub"))) {
+    if (Parrot_pmc_isa_type(interp, sub_pmc, enum_class_Sub)) {
         Parrot_Sub_attributes *sub;
         PMC                   *multi_sig;
 
@@ -565,22 +1154,24 @@ Parrot_mmd_get_cached_multi_sig(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 
 /*
 
-=item C<static UINTVAL mmd_distance(PARROT_INTERP, PMC *pmc, PMC *arg_tuple)>
+=item C<static PMC * mmd_candidate_signature(PARROT_INTERP, PMC *pmc)>
 
-Create Manhattan Distance of sub C<pmc> against given argument types.
-0xffff is the maximum distance
+Return the type tuple candidate C<pmc> dispatches on, building and caching it
+on the candidate first if needed. Returns C<NULL> if C<pmc> is a plain Sub
+without a multi signature, and C<PMCNULL> if the signature names a type which
+doesn't exist yet.
 
 =cut
 
 */
 
-static UINTVAL
-mmd_distance(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(PMC *arg_tuple))
+PARROT_CAN_RETURN_NULL
+static PMC *
+mmd_candidate_signature(PARROT_INTERP, ARGIN(PMC *pmc))
 {
-    ASSERT_ARGS(mmd_distance)
-    PMC        *multi_sig, *mro;
+    ASSERT_ARGS(mmd_candidate_signature)
+    PMC                   *multi_sig;
     Parrot_Sub_attributes *sub;
-    INTVAL      args, dist, i, j, n, m;
 
     if (pmc->vtable->base_type == enum_class_NativePCCMethod) {
         GETATTR_NativePCCMethod_mmd_multi_sig(interp, pmc, multi_sig);
@@ -608,11 +1199,36 @@ mmd_distance(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(PMC *arg_tuple))
         PMC_get_sub(interp, pmc, sub);
 
         if (!sub->multi_signature)
-            return 0; /* not a multi; no distance */
+            return NULL;
 
         multi_sig = Parrot_mmd_get_cached_multi_sig(interp, pmc);
     }
 
+    return multi_sig;
+}
+
+/*
+
+=item C<static UINTVAL mmd_distance(PARROT_INTERP, PMC *pmc, PMC *arg_tuple)>
+
+Create Manhattan Distance of sub C<pmc> against given argument types.
+0xffff is the maximum distance
+
+=cut
+
+*/
+
+static UINTVAL
+mmd_distance(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(PMC *arg_tuple))
+{
+    ASSERT_ARGS(mmd_distance)
+    PMC * const multi_sig = mmd_candidate_signature(interp, pmc);
+    PMC        *mro;
+    INTVAL      args, dist, i, j, n, m;
+
+    if (!multi_sig)
+        return 0; /* not a multi; no distance */
+
     if (PMC_IS_NULL(multi_sig))
         return MMD_BIG_DISTANCE;
 
@@ -790,19 +1406,16 @@ static int
 Parrot_mmd_maybe_candidate(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(PMC *cl))
 {
     ASSERT_ARGS(Parrot_mmd_maybe_candidate)
-    STRING * const _sub       = CONST_STRING(interp, "Sub");
-    STRING * const _multi_sub = CONST_STRING(interp, "MultiSub");
-
     INTVAL i, n;
 
-    if (VTABLE_isa(interp, pmc, _sub)) {
+    if (Parrot_pmc_isa_type(interp, pmc, enum_class_Sub)) {
         /* a plain sub stops outer searches */
         VTABLE_push_pmc(interp, cl, pmc);
         return 1;
     }
 
     /* not a Sub or MultiSub - ignore */
-    if (!VTABLE_isa(interp, pmc, _multi_sub))
+    if (!Parrot_pmc_isa_type(interp, pmc, enum_class_MultiSub))
         return 0;
 
     /* ok we have a multi sub pmc, which is an array of candidates */
@@ -959,11 +1572,13 @@ Parrot_mmd_add_multi_from_long_sig(PARROT_INTERP,
     ASSERT_ARGS(Parrot_mmd_add_multi_from_long_sig)
     Parrot_Sub_attributes *sub;
     STRING     *sub_str     = CONST_STRING(interp, "Sub");
-    PMC        *type_list   = Parrot_str_split(interp, CONST_STRING(interp, ","), long_sig);
-    STRING     *ns_name     = VTABLE_get_string_keyed_int(interp, type_list, 0);
+    const INTVAL first_end  = STRING_index(interp, long_sig, CONST_STRING(interp, ","), 0);
+    STRING     *ns_name     = first_end < 0
+                            ? long_sig
+                            : STRING_substr(interp, long_sig, 0, first_end);
 
     /* Attach a type tuple array to the sub for multi dispatch */
-    PMC    *multi_sig = mmd_build_type_tuple_from_type_list(interp, type_list);
+    PMC    *multi_sig = mmd_build_type_tuple_from_long_sig(interp, long_sig);
 
     PARROT_GC_WRITE_BARRIER(interp, sub_obj);
 
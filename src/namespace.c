@@ -17,6 +17,7 @@ Common routines for storing and finding elements in namespaces
 #include "namespace.str"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_namespace.h"
 
 /* HEADERIZER HFILE: include/parrot/namespace.h */
 /* HEADERIZER BEGIN: static */
@@ -75,6 +76,13 @@ static void store_sub_in_multi(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+static INTVAL store_sub_in_namespace(PARROT_INTERP,
+    ARGIN(PMC *sub_pmc),
+    ARGIN(PMC *ns))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 #define ASSERT_ARGS_get_namespace_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
@@ -98,6 +106,10 @@ static void store_sub_in_multi(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc) \
     , PARROT_ASSERT_ARG(ns))
+#define ASSERT_ARGS_store_sub_in_namespace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub_pmc) \
+    , PARROT_ASSERT_ARG(ns))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -641,6 +653,12 @@ Parrot_ns_store_global(PARROT_INTERP, ARGIN_NULLOK(PMC *ns),
 If the global exists in the given namespace PMC, return it.  If not, return
 PMCNULL. Throw an exception if a NULL name is passed.
 
+C<next> identifies the op doing the lookup. Lookups of a constant name in a
+plain NameSpace are cached for each op, along with the stamp of the
+namespace. Any change to the namespace drops its stamp, and the next lookup
+hands out a new one, so the cached result is used only while the namespace
+is unchanged.
+
 =cut
 
 */
@@ -650,14 +668,43 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 PMC *
 Parrot_ns_find_global_from_op(PARROT_INTERP, ARGIN(PMC *ns),
-        ARGIN_NULLOK(STRING *globalname), SHIM(void *next))
+        ARGIN_NULLOK(STRING *globalname), ARGIN_NULLOK(void *next))
 {
     ASSERT_ARGS(Parrot_ns_find_global_from_op)
     if (STRING_IS_NULL(globalname))
         Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_GLOBAL_NOT_FOUND,
             "Tried to get null global");
     else {
-        PMC * const res = Parrot_ns_find_namespace_global(interp, ns, globalname);
+        Parrot_NameSpace_attributes *nsinfo;
+        Global_cache_entry          *entry;
+        PMC                         *res;
+
+        /* other names may be gone, and their address reused, by the next call */
+        if (!next || PMC_IS_NULL(ns)
+        ||  ns->vtable->base_type != enum_class_NameSpace
+        ||  !PObj_constant_TEST(globalname))
+            return Parrot_ns_find_namespace_global(interp, ns, globalname);
+
+        nsinfo = PARROT_NAMESPACE(ns);
+        entry  = &interp->caches->globals[GLOBAL_CACHE_SLOT(next)];
+
+        if (entry->site  == next
+        &&  entry->ns    == ns
+        &&  entry->name  == globalname
+        &&  entry->stamp == nsinfo->stamp)
+            return entry->value;
+
+        res = Parrot_ns_find_namespace_global(interp, ns, globalname);
+
+        if (!nsinfo->stamp)
+            nsinfo->stamp = ++interp->caches->ns_stamp;
+
+        entry->site  = next;
+        entry->ns    = ns;
+        entry->name  = globalname;
+        entry->stamp = nsinfo->stamp;
+        entry->value = res;
+
         return res;
     }
 }
@@ -707,30 +754,24 @@ Parrot_ns_find_named_item(PARROT_INTERP, ARGIN(STRING *name), ARGIN(SHIM(void *n
 
 /*
 
-=item C<void Parrot_ns_store_sub(PARROT_INTERP, PMC *sub_pmc)>
+=item C<static INTVAL store_sub_in_namespace(PARROT_INTERP, PMC *sub_pmc, PMC
+*ns)>
 
-Adds the PMC C<sub> into the current namespace. Adds the sub to a multi of the
-same name if it's defined as a multi.
+Stores the PMC C<sub> into the namespace C<ns>, or into a multi of the same
+name there if it's defined as a multi.  Returns true if the sub was stored
+under its own name, in which case method caches for the namespace are stale.
 
 =cut
 
 */
 
-PARROT_EXPORT
-void
-Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
+static INTVAL
+store_sub_in_namespace(PARROT_INTERP, ARGIN(PMC *sub_pmc), ARGIN(PMC *ns))
 {
-    ASSERT_ARGS(Parrot_ns_store_sub)
-    const INTVAL cur_id = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp));
-
-    PMC *ns;
+    ASSERT_ARGS(store_sub_in_namespace)
     Parrot_Sub_attributes *sub;
 
-    /* store relative to HLL namespace */
     PMC_get_sub(interp, sub_pmc, sub);
-    Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), sub->HLL_id);
-
-    ns = get_namespace_pmc(interp, sub_pmc);
 
     /* attach a namespace to the sub for lookups */
     sub->namespace_stash = ns;
@@ -742,10 +783,39 @@ Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
     /* store other subs (as long as they're not :anon) */
     else if (!(PObj_get_FLAGS(sub_pmc) & SUB_FLAG_PF_ANON)
         || sub->vtable_index != -1) {
-        STRING * const ns_entry_name = sub->ns_entry_name;
-        PMC    * const nsname        = sub->namespace_name;
+        Parrot_ns_store_global(interp, ns, sub->ns_entry_name, sub_pmc);
+        return 1;
+    }
 
-        Parrot_ns_store_global(interp, ns, ns_entry_name, sub_pmc);
+    return 0;
+}
+
+/*
+
+=item C<void Parrot_ns_store_sub(PARROT_INTERP, PMC *sub_pmc)>
+
+Adds the PMC C<sub> into the current namespace. Adds the sub to a multi of the
+same name if it's defined as a multi.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
+{
+    ASSERT_ARGS(Parrot_ns_store_sub)
+    const INTVAL cur_id = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp));
+
+    Parrot_Sub_attributes *sub;
+
+    /* store relative to HLL namespace */
+    PMC_get_sub(interp, sub_pmc, sub);
+    Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), sub->HLL_id);
+
+    if (store_sub_in_namespace(interp, sub_pmc, get_namespace_pmc(interp, sub_pmc))) {
+        PMC * const nsname = sub->namespace_name;
 
         /* TT #1224:
            TEMPORARY HACK - cache invalidation should be a namespace function
@@ -762,6 +832,63 @@ Parrot_ns_store_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
 
 /*
 
+=item C<void Parrot_ns_store_subs(PARROT_INTERP, PMC **pmcs, INTVAL n)>
+
+Adds every Sub among the C<n> PMCs in C<pmcs> to its namespace, as
+C<Parrot_ns_store_sub> would, in order.  Consecutive subs usually share their
+namespace name PMC, so this resolves each namespace and invalidates its method
+caches once per run of such subs rather than once per sub.  Used to register
+the subs of a packfile constant table as it's loaded.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_ns_store_subs(PARROT_INTERP, ARGIN(PMC **pmcs), INTVAL n)
+{
+    ASSERT_ARGS(Parrot_ns_store_subs)
+    const INTVAL cur_id      = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp));
+    PMC         *ns          = PMCNULL;
+    PMC         *ns_name     = PMCNULL;
+    PMC         *invalidated = PMCNULL;
+    INTVAL       ns_hll      = -1;
+    INTVAL       i;
+
+    for (i = 0; i < n; ++i) {
+        PMC * const sub_pmc = pmcs[i];
+        Parrot_Sub_attributes *sub;
+
+        if (!Parrot_pmc_isa_type(interp, sub_pmc, enum_class_Sub))
+            continue;
+
+        /* store relative to HLL namespace */
+        PMC_get_sub(interp, sub_pmc, sub);
+        Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), sub->HLL_id);
+
+        if (PMC_IS_NULL(ns) || sub->namespace_name != ns_name || sub->HLL_id != ns_hll) {
+            ns      = get_namespace_pmc(interp, sub_pmc);
+            ns_name = sub->namespace_name;
+            ns_hll  = sub->HLL_id;
+        }
+
+        /* nothing can have filled the method cache since the last sub was
+         * stored, so one invalidation covers a run of subs */
+        if (store_sub_in_namespace(interp, sub_pmc, ns)
+        && !PMC_IS_NULL(ns_name) && ns_name != invalidated) {
+            STRING * const nsname_s = VTABLE_get_string(interp, ns_name);
+            Parrot_invalidate_method_cache(interp, nsname_s);
+            invalidated = ns_name;
+        }
+    }
+
+    /* restore HLL_id */
+    Parrot_pcc_set_HLL(interp, CURRENT_CONTEXT(interp), cur_id);
+}
+
+/*
+
 =item C<Parrot_PMC Parrot_ns_get_root_namespace(PARROT_INTERP)>
 
 Return the root namespace
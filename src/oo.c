@@ -61,6 +61,11 @@ static void invalidate_all_caches(PARROT_INTERP)
 static void invalidate_type_caches(PARROT_INTERP, UINTVAL type)
         __attribute__nonnull__(1);
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL registered_class_type(PARROT_INTERP, ARGIN(PMC *classobj))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 #define ASSERT_ARGS_C3_merge __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(merge_list))
@@ -77,6 +82,9 @@ static void invalidate_type_caches(PARROT_INTERP, UINTVAL type)
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_invalidate_type_caches __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_registered_class_type __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(classobj))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -734,6 +742,139 @@ Parrot_oo_register_type(PARROT_INTERP, ARGIN(PMC *name), ARGIN(PMC *_namespace))
 
 /*
 
+=item C<UINTVAL * Parrot_oo_new_type_bits(PARROT_INTERP, INTVAL n_types)>
+
+Allocates an empty set of the type ids below C<n_types>. Test and fill it with
+the C<PARROT_TYPE_BITS_*> macros and free it with C<mem_internal_free>.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+UINTVAL *
+Parrot_oo_new_type_bits(SHIM_INTERP, INTVAL n_types)
+{
+    ASSERT_ARGS(Parrot_oo_new_type_bits)
+    const size_t    n_words = 1 + (n_types + PARROT_TYPE_BITS_PER_WORD - 1)
+                                / PARROT_TYPE_BITS_PER_WORD;
+    UINTVAL * const bits    = mem_internal_allocate_n_zeroed_typed(n_words, UINTVAL);
+
+    bits[0] = n_types;
+    return bits;
+}
+
+/*
+
+=item C<void Parrot_oo_build_ancestor_bits(PARROT_INTERP, PMC *_class)>
+
+Records the type ids of C<_class> and of all its parents in its C<isa_bits>,
+so C<Parrot_oo_has_ancestor> can answer without walking the MRO. Called once
+the MRO is final, when the class is first instantiated.
+
+=cut
+
+*/
+
+void
+Parrot_oo_build_ancestor_bits(PARROT_INTERP, ARGIN(PMC *_class))
+{
+    ASSERT_ARGS(Parrot_oo_build_ancestor_bits)
+    Parrot_Class_attributes * const class_info = PARROT_CLASS(_class);
+    const INTVAL   num_classes = VTABLE_elements(interp, class_info->all_parents);
+    UINTVAL * const bits       = Parrot_oo_new_type_bits(interp, interp->n_vtable_max);
+    INTVAL         i;
+
+    for (i = 0; i < num_classes; ++i) {
+        PMC * const cur_class =
+            VTABLE_get_pmc_keyed_int(interp, class_info->all_parents, i);
+        const INTVAL type = registered_class_type(interp, cur_class);
+
+        if (type)
+            PARROT_TYPE_BITS_SET(bits, type);
+    }
+
+    if (class_info->isa_bits)
+        mem_internal_free(class_info->isa_bits);
+
+    class_info->isa_bits = bits;
+}
+
+/*
+
+=item C<INTVAL Parrot_oo_has_ancestor(PARROT_INTERP, PMC *_class, PMC *lookup)>
+
+Checks whether the class object C<lookup> is C<_class> or one of its parents,
+from the type ids recorded by C<Parrot_oo_build_ancestor_bits>. Returns 1 or 0,
+or -1 if that can't tell: C<_class> is no C<Class> with ids recorded, or
+C<lookup> isn't the registered class of its type.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_oo_has_ancestor(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(PMC *lookup))
+{
+    ASSERT_ARGS(Parrot_oo_has_ancestor)
+    const UINTVAL *bits;
+    INTVAL         type;
+
+    if (_class->vtable->base_type != enum_class_Class)
+        return -1;
+
+    bits = PARROT_CLASS(_class)->isa_bits;
+
+    if (!bits)
+        return -1;
+
+    type = registered_class_type(interp, lookup);
+
+    if (!type)
+        return -1;
+
+    /* Types registered after the ids were recorded aren't parents. */
+    return PARROT_TYPE_BITS_COVERS(bits, type)
+         ? (INTVAL)PARROT_TYPE_BITS_TEST(bits, type)
+         : 0;
+}
+
+/*
+
+=item C<static INTVAL registered_class_type(PARROT_INTERP, PMC *classobj)>
+
+Returns the type id of C<classobj> if it is a C<Class> registered as the class
+of that type, so that comparing type ids is the same as comparing the class
+objects, or 0 otherwise.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+registered_class_type(PARROT_INTERP, ARGIN(PMC *classobj))
+{
+    ASSERT_ARGS(registered_class_type)
+    INTVAL type;
+
+    if (classobj->vtable->base_type != enum_class_Class)
+        return 0;
+
+    type = PARROT_CLASS(classobj)->id;
+
+    if (type <= 0 || type >= interp->n_vtable_max
+    ||  !interp->vtables[type]
+    ||  interp->vtables[type]->pmc_class != classobj)
+        return 0;
+
+    return type;
+}
+
+/*
+
 =item C<void mark_object_cache(PARROT_INTERP)>
 
 Marks all PMCs in the object method cache as live.  This shouldn't strictly be
@@ -1361,7 +1502,8 @@ Parrot_ComposeRole(PARROT_INTERP, ARGIN(PMC *role),
                 /* Conflicts with something already in the class, unless it's a
                  * multi-method. */
                 PMC * const cur_entry = VTABLE_get_pmc_keyed_str(interp, methods_hash, method_name);
-                if (PMC_IS_NULL(cur_entry) || !VTABLE_isa(interp, cur_entry, CONST_STRING(interp, "MultiSub")))
+                if (PMC_IS_NULL(cur_entry)
+                ||  !Parrot_pmc_isa_type(interp, cur_entry, enum_class_MultiSub))
                     Parrot_ex_throw_from_c_args(interp, NULL,
                         EXCEPTION_ROLE_COMPOSITION_METHOD_CONFLICT,
                         "A conflict occurred during role composition "
@@ -1394,7 +1536,8 @@ Parrot_ComposeRole(PARROT_INTERP, ARGIN(PMC *role),
              * not a multi-method, error. */
             if (VTABLE_exists_keyed_str(interp, methods_hash, alias_name)) {
                 PMC * const cur_entry = VTABLE_get_pmc_keyed_str(interp, methods_hash, alias_name);
-                if (PMC_IS_NULL(cur_entry) || !VTABLE_isa(interp, cur_entry, CONST_STRING(interp, "MultiSub")))
+                if (PMC_IS_NULL(cur_entry)
+                ||  !Parrot_pmc_isa_type(interp, cur_entry, enum_class_MultiSub))
                     /* Conflicts with something already in the class. */
                     Parrot_ex_throw_from_c_args(interp, NULL,
                         EXCEPTION_ROLE_COMPOSITION_METHOD_CONFLICT,
@@ -1431,10 +1574,11 @@ Parrot_ComposeRole(PARROT_INTERP, ARGIN(PMC *role),
 
         /* Add it to the methods of the class. */
         PMC * const cur_entry = VTABLE_get_pmc_keyed_str(interp, methods_hash, method_name);
-        if (VTABLE_isa(interp, cur_method, CONST_STRING(interp, "MultiSub"))) {
+        if (Parrot_pmc_isa_type(interp, cur_method, enum_class_MultiSub)) {
             /* The thing we're adding is a multi-sub, but is the thing in the
              * class already a multi-sub? */
-            if (!PMC_IS_NULL(cur_entry) && VTABLE_isa(interp, cur_entry, CONST_STRING(interp, "MultiSub"))) {
+            if (!PMC_IS_NULL(cur_entry)
+            &&  Parrot_pmc_isa_type(interp, cur_entry, enum_class_MultiSub)) {
                 /* Class already has a multi-sub; need to merge our methods into it. */
                 const INTVAL num_subs = VTABLE_elements(interp, cur_method);
                 INTVAL j;
@@ -1449,7 +1593,8 @@ Parrot_ComposeRole(PARROT_INTERP, ARGIN(PMC *role),
         }
         else {
             /* Are we adding into a multi-sub? */
-            if (!PMC_IS_NULL(cur_entry) && VTABLE_isa(interp, cur_entry, CONST_STRING(interp, "MultiSub")))
+            if (!PMC_IS_NULL(cur_entry)
+            &&  Parrot_pmc_isa_type(interp, cur_entry, enum_class_MultiSub))
                 VTABLE_push_pmc(interp, cur_entry, cur_method);
             else
                 VTABLE_set_pmc_keyed_str(interp, methods_hash, method_name, cur_method);
@@ -76,16 +76,22 @@ extern op_lib_t core_op_lib;
 
 #include "parrot/scheduler_private.h"
 #include "pmc/pmc_task.h"
+#include "pmc/pmc_integer.h"
+#include "pmc/pmc_float.h"
 
+/* operand guards of the quickened ops */
+#define QUICK_INTEGER(p) ((p)->vtable->base_type == enum_class_Integer)
+#define QUICK_FLOAT(p)   ((p)->vtable->base_type == enum_class_Float)
 
 
-INTVAL core_numops = 1132;
+
+INTVAL core_numops = 1176;
 
 /*
 ** Op Function Table:
 */
 
-static op_func_t core_op_func_table[1132] = {
+static op_func_t core_op_func_table[1176] = {
   Parrot_end,                                        /*      0 */
   Parrot_noop,                                       /*      1 */
   Parrot_check_events,                               /*      2 */
@@ -1217,6 +1223,50 @@ static op_func_t core_op_func_table[1132] = {
   Parrot_disable_preemption,                         /*   1128 */
   Parrot_enable_preemption,                          /*   1129 */
   Parrot_terminate,                                  /*   1130 */
+  Parrot_find_lex_slot_p_sc_ic_ic_pc,                /*   1131 */
+  Parrot_find_lex_slot_s_sc_ic_ic_pc,                /*   1132 */
+  Parrot_find_lex_slot_i_sc_ic_ic_pc,                /*   1133 */
+  Parrot_find_lex_slot_n_sc_ic_ic_pc,                /*   1134 */
+  Parrot_store_lex_slot_sc_p_ic_ic_pc,               /*   1135 */
+  Parrot_store_lex_slot_sc_s_ic_ic_pc,               /*   1136 */
+  Parrot_store_lex_slot_sc_sc_ic_ic_pc,              /*   1137 */
+  Parrot_store_lex_slot_sc_i_ic_ic_pc,               /*   1138 */
+  Parrot_store_lex_slot_sc_ic_ic_ic_pc,              /*   1139 */
+  Parrot_store_lex_slot_sc_n_ic_ic_pc,               /*   1140 */
+  Parrot_store_lex_slot_sc_nc_ic_ic_pc,              /*   1141 */
+  Parrot_add_int_int_p_p_p,                          /*   1142 */
+  Parrot_sub_int_int_p_p_p,                          /*   1143 */
+  Parrot_mul_int_int_p_p_p,                          /*   1144 */
+  Parrot_mod_int_int_p_p_p,                          /*   1145 */
+  Parrot_add_int_p_p_i,                              /*   1146 */
+  Parrot_add_int_p_p_ic,                             /*   1147 */
+  Parrot_sub_int_p_p_i,                              /*   1148 */
+  Parrot_sub_int_p_p_ic,                             /*   1149 */
+  Parrot_add_num_num_p_p_p,                          /*   1150 */
+  Parrot_sub_num_num_p_p_p,                          /*   1151 */
+  Parrot_mul_num_num_p_p_p,                          /*   1152 */
+  Parrot_inc_int_p,                                  /*   1153 */
+  Parrot_dec_int_p,                                  /*   1154 */
+  Parrot_inc_num_p,                                  /*   1155 */
+  Parrot_dec_num_p,                                  /*   1156 */
+  Parrot_eq_int_p_i_ic,                              /*   1157 */
+  Parrot_eq_int_p_ic_ic,                             /*   1158 */
+  Parrot_ne_int_p_i_ic,                              /*   1159 */
+  Parrot_ne_int_p_ic_ic,                             /*   1160 */
+  Parrot_lt_int_p_i_ic,                              /*   1161 */
+  Parrot_lt_int_p_ic_ic,                             /*   1162 */
+  Parrot_le_int_p_i_ic,                              /*   1163 */
+  Parrot_le_int_p_ic_ic,                             /*   1164 */
+  Parrot_gt_int_p_i_ic,                              /*   1165 */
+  Parrot_gt_int_p_ic_ic,                             /*   1166 */
+  Parrot_ge_int_p_i_ic,                              /*   1167 */
+  Parrot_ge_int_p_ic_ic,                             /*   1168 */
+  Parrot_eq_int_int_p_p_ic,                          /*   1169 */
+  Parrot_ne_int_int_p_p_ic,                          /*   1170 */
+  Parrot_lt_int_int_p_p_ic,                          /*   1171 */
+  Parrot_le_int_int_p_p_ic,                          /*   1172 */
+  Parrot_gt_int_int_p_p_ic,                          /*   1173 */
+  Parrot_ge_int_int_p_p_ic,                          /*   1174 */
 
   NULL /* NULL function pointer */
 };
@@ -1227,7 +1277,7 @@ static op_func_t core_op_func_table[1132] = {
 ** Op Info Table:
 */
 
-static op_info_t core_op_info_table[1132] = {
+static op_info_t core_op_info_table[1176] = {
   { /* 0 */
     "end",
     "end",
@@ -13669,261 +13719,745 @@ static op_info_t core_op_info_table[1132] = {
     { 0 },
     &core_op_lib
   },
-
-};
-
-
-/*
-** Op Function Definitions:
-*/
-
-opcode_t *
-Parrot_end(opcode_t *cur_opcode, PARROT_INTERP) {
-    UNUSED(interp);
-    UNUSED(cur_opcode);
-    return (opcode_t *)0;
-}
-
-opcode_t *
-Parrot_noop(opcode_t *cur_opcode, PARROT_INTERP) {
-    UNUSED(interp);
-    return cur_opcode + 1;
-}
-
-opcode_t *
-Parrot_check_events(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * next =  cur_opcode + 1;
-
-    next = Parrot_cx_check_scheduler(interp, next);
-    return (opcode_t *)next;
-}
-
-opcode_t *
-Parrot_check_events__(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * const  _this = CUR_OPCODE;
-    opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, _this, EXCEPTION_INVALID_OPERATION, "check_events__ opcode doesn't do anything useful");
-
-    return (opcode_t *)handler;
-    Parrot_runcore_disable_event_checking(interp);
-    return (opcode_t *)_this;
-}
-
-opcode_t *
-Parrot_load_bytecode_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_load_bytecode(interp, SREG(1));
-    return cur_opcode + 2;
-}
-
-opcode_t *
-Parrot_load_bytecode_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_load_bytecode(interp, SCONST(1));
-    return cur_opcode + 2;
-}
-
-opcode_t *
-Parrot_load_bytecode_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pf_load_bytecode_search(interp, SREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_load_bytecode_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pf_load_bytecode_search(interp, SCONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_load_language_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_load_language(interp, SREG(1));
-    return cur_opcode + 2;
-}
-
-opcode_t *
-Parrot_load_language_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_load_language(interp, SCONST(1));
-    return cur_opcode + 2;
-}
-
-opcode_t *
-Parrot_branch_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (Parrot_cx_check_scheduler(interp, (cur_opcode + IREG(1))) == NULL) {
-        return (opcode_t *)0;
-    }
-
-    return cur_opcode + IREG(1);
-}
-
-opcode_t *
-Parrot_branch_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(1))) == NULL) {
-        return (opcode_t *)0;
-    }
-
-    return cur_opcode + ICONST(1);
-}
-
-opcode_t *
-Parrot_local_branch_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    INTVAL   return_addr;
-    opcode_t  * const  dest =  cur_opcode + 3;
-
-    if (PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_branch'");
-
-        return (opcode_t *)handler;
-    }
-
-    (return_addr) = PTR2INTVAL(dest);
-    VTABLE_push_integer(interp, PREG(1), (return_addr));
-    return cur_opcode + IREG(2);
-}
-
-opcode_t *
-Parrot_local_branch_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    INTVAL   return_addr;
-    opcode_t  * const  dest =  cur_opcode + 3;
-
-    if (PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_branch'");
-
-        return (opcode_t *)handler;
-    }
-
-    (return_addr) = PTR2INTVAL(dest);
-    VTABLE_push_integer(interp, PREG(1), (return_addr));
-    return cur_opcode + ICONST(2);
-}
-
-opcode_t *
-Parrot_local_return_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    INTVAL   return_addr;
-    opcode_t  * next;
-    opcode_t  * const  dest =  cur_opcode + 2;
-
-    if (PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_return'");
-
-        return (opcode_t *)handler;
-    }
-
-    (return_addr) = VTABLE_pop_integer(interp, PREG(1));
-    next = INTVAL2PTR(opcode_t *, (return_addr));
-    if (!(((next >= interp->code->base.data) && (next < ((interp->code->base.data + interp->code->base.size)))))) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Address for 'local_return' must be within the current code segment");
-
-        return (opcode_t *)handler;
-    }
-
-    return (opcode_t *)next;
-}
-
-opcode_t *
-Parrot_jump_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, IREG(1));
-
-    UNUSED(interp);
-    UNUSED(cur_opcode);
-    return (opcode_t *)loc;
-}
-
-opcode_t *
-Parrot_jump_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, ICONST(1));
-
-    UNUSED(interp);
-    UNUSED(cur_opcode);
-    return (opcode_t *)loc;
-}
-
-opcode_t *
-Parrot_if_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (IREG(1) != 0) {
-        return cur_opcode + ICONST(2);
-    }
-
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_if_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (!FLOAT_IS_ZERO(NREG(1))) {
-        return cur_opcode + ICONST(2);
-    }
-
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_if_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (Parrot_str_boolean(interp, SREG(1))) {
-        return cur_opcode + ICONST(2);
-    }
-
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_if_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (VTABLE_get_bool(interp, PREG(1))) {
-        return cur_opcode + ICONST(2);
-    }
-
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_unless_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (IREG(1) == 0) {
-        return cur_opcode + ICONST(2);
-    }
-
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_unless_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (FLOAT_IS_ZERO(NREG(1))) {
-        return cur_opcode + ICONST(2);
-    }
-
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_unless_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (!Parrot_str_boolean(interp, SREG(1))) {
-        return cur_opcode + ICONST(2);
-    }
-
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_unless_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (!VTABLE_get_bool(interp, PREG(1))) {
-        return cur_opcode + ICONST(2);
-    }
-
-    return cur_opcode + 3;
-}
-
-opcode_t *
-Parrot_invokecc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC       * const  p = PREG(1);
-    opcode_t  * dest =  cur_opcode + 2;
-    PMC       * const  ctx = CURRENT_CONTEXT(interp);
-
-    Parrot_pcc_set_pc(interp, ctx, dest);
-    Parrot_pcc_reuse_continuation(interp, ctx, dest);
-    dest = VTABLE_invoke(interp, p, dest);
-    return (opcode_t *)dest;
-}
-
-opcode_t *
-Parrot_invoke_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t    * dest =  cur_opcode + 3;
+  { /* 1131 */
+    "find_lex_slot",
+    "find_lex_slot_p_sc_ic_ic_pc",
+    "Parrot_find_lex_slot_p_sc_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1132 */
+    "find_lex_slot",
+    "find_lex_slot_s_sc_ic_ic_pc",
+    "Parrot_find_lex_slot_s_sc_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1133 */
+    "find_lex_slot",
+    "find_lex_slot_i_sc_ic_ic_pc",
+    "Parrot_find_lex_slot_i_sc_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_I, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1134 */
+    "find_lex_slot",
+    "find_lex_slot_n_sc_ic_ic_pc",
+    "Parrot_find_lex_slot_n_sc_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_N, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1135 */
+    "store_lex_slot",
+    "store_lex_slot_sc_p_ic_ic_pc",
+    "Parrot_store_lex_slot_sc_p_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1136 */
+    "store_lex_slot",
+    "store_lex_slot_sc_s_ic_ic_pc",
+    "Parrot_store_lex_slot_sc_s_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_S, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1137 */
+    "store_lex_slot",
+    "store_lex_slot_sc_sc_ic_ic_pc",
+    "Parrot_store_lex_slot_sc_sc_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1138 */
+    "store_lex_slot",
+    "store_lex_slot_sc_i_ic_ic_pc",
+    "Parrot_store_lex_slot_sc_i_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1139 */
+    "store_lex_slot",
+    "store_lex_slot_sc_ic_ic_ic_pc",
+    "Parrot_store_lex_slot_sc_ic_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1140 */
+    "store_lex_slot",
+    "store_lex_slot_sc_n_ic_ic_pc",
+    "Parrot_store_lex_slot_sc_n_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_N, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1141 */
+    "store_lex_slot",
+    "store_lex_slot_sc_nc_ic_ic_pc",
+    "Parrot_store_lex_slot_sc_nc_ic_ic_pc",
+    0,
+    6,
+    { PARROT_ARG_SC, PARROT_ARG_NC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_PC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1142 */
+    "add_int_int",
+    "add_int_int_p_p_p",
+    "Parrot_add_int_int_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1143 */
+    "sub_int_int",
+    "sub_int_int_p_p_p",
+    "Parrot_sub_int_int_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1144 */
+    "mul_int_int",
+    "mul_int_int_p_p_p",
+    "Parrot_mul_int_int_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1145 */
+    "mod_int_int",
+    "mod_int_int_p_p_p",
+    "Parrot_mod_int_int_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1146 */
+    "add_int",
+    "add_int_p_p_i",
+    "Parrot_add_int_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1147 */
+    "add_int",
+    "add_int_p_p_ic",
+    "Parrot_add_int_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1148 */
+    "sub_int",
+    "sub_int_p_p_i",
+    "Parrot_sub_int_p_p_i",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_I },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1149 */
+    "sub_int",
+    "sub_int_p_p_ic",
+    "Parrot_sub_int_p_p_ic",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1150 */
+    "add_num_num",
+    "add_num_num_p_p_p",
+    "Parrot_add_num_num_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1151 */
+    "sub_num_num",
+    "sub_num_num_p_p_p",
+    "Parrot_sub_num_num_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1152 */
+    "mul_num_num",
+    "mul_num_num_p_p_p",
+    "Parrot_mul_num_num_p_p_p",
+    0,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1153 */
+    "inc_int",
+    "inc_int_p",
+    "Parrot_inc_int_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1154 */
+    "dec_int",
+    "dec_int_p",
+    "Parrot_dec_int_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1155 */
+    "inc_num",
+    "inc_num_p",
+    "Parrot_inc_num_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1156 */
+    "dec_num",
+    "dec_num_p",
+    "Parrot_dec_num_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_IN },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1157 */
+    "eq_int",
+    "eq_int_p_i_ic",
+    "Parrot_eq_int_p_i_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1158 */
+    "eq_int",
+    "eq_int_p_ic_ic",
+    "Parrot_eq_int_p_ic_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1159 */
+    "ne_int",
+    "ne_int_p_i_ic",
+    "Parrot_ne_int_p_i_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1160 */
+    "ne_int",
+    "ne_int_p_ic_ic",
+    "Parrot_ne_int_p_ic_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1161 */
+    "lt_int",
+    "lt_int_p_i_ic",
+    "Parrot_lt_int_p_i_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1162 */
+    "lt_int",
+    "lt_int_p_ic_ic",
+    "Parrot_lt_int_p_ic_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1163 */
+    "le_int",
+    "le_int_p_i_ic",
+    "Parrot_le_int_p_i_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1164 */
+    "le_int",
+    "le_int_p_ic_ic",
+    "Parrot_le_int_p_ic_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1165 */
+    "gt_int",
+    "gt_int_p_i_ic",
+    "Parrot_gt_int_p_i_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1166 */
+    "gt_int",
+    "gt_int_p_ic_ic",
+    "Parrot_gt_int_p_ic_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1167 */
+    "ge_int",
+    "ge_int_p_i_ic",
+    "Parrot_ge_int_p_i_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_I, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1168 */
+    "ge_int",
+    "ge_int_p_ic_ic",
+    "Parrot_ge_int_p_ic_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1169 */
+    "eq_int_int",
+    "eq_int_int_p_p_ic",
+    "Parrot_eq_int_int_p_p_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1170 */
+    "ne_int_int",
+    "ne_int_int_p_p_ic",
+    "Parrot_ne_int_int_p_p_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1171 */
+    "lt_int_int",
+    "lt_int_int_p_p_ic",
+    "Parrot_lt_int_int_p_p_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1172 */
+    "le_int_int",
+    "le_int_int_p_p_ic",
+    "Parrot_le_int_int_p_p_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1173 */
+    "gt_int_int",
+    "gt_int_int_p_p_ic",
+    "Parrot_gt_int_int_p_p_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+  { /* 1174 */
+    "ge_int_int",
+    "ge_int_int_p_p_ic",
+    "Parrot_ge_int_int_p_p_ic",
+    PARROT_JUMP_RELATIVE,
+    4,
+    { PARROT_ARG_P, PARROT_ARG_P, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 1 },
+    &core_op_lib
+  },
+
+};
+
+
+/*
+** Op Function Definitions:
+*/
+
+opcode_t *
+Parrot_end(opcode_t *cur_opcode, PARROT_INTERP) {
+    UNUSED(interp);
+    UNUSED(cur_opcode);
+    return (opcode_t *)0;
+}
+
+opcode_t *
+Parrot_noop(opcode_t *cur_opcode, PARROT_INTERP) {
+    UNUSED(interp);
+    return cur_opcode + 1;
+}
+
+opcode_t *
+Parrot_check_events(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * next =  cur_opcode + 1;
+
+    next = Parrot_cx_check_scheduler(interp, next);
+    return (opcode_t *)next;
+}
+
+opcode_t *
+Parrot_check_events__(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  _this = CUR_OPCODE;
+    opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, _this, EXCEPTION_INVALID_OPERATION, "check_events__ opcode doesn't do anything useful");
+
+    return (opcode_t *)handler;
+    Parrot_runcore_disable_event_checking(interp);
+    return (opcode_t *)_this;
+}
+
+opcode_t *
+Parrot_load_bytecode_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_load_bytecode(interp, SREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_load_bytecode_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_load_bytecode(interp, SCONST(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_load_bytecode_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pf_load_bytecode_search(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_load_bytecode_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pf_load_bytecode_search(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_load_language_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_load_language(interp, SREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_load_language_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_load_language(interp, SCONST(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_branch_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (Parrot_cx_check_scheduler(interp, (cur_opcode + IREG(1))) == NULL) {
+        return (opcode_t *)0;
+    }
+
+    return cur_opcode + IREG(1);
+}
+
+opcode_t *
+Parrot_branch_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (Parrot_cx_check_scheduler(interp, (cur_opcode + ICONST(1))) == NULL) {
+        return (opcode_t *)0;
+    }
+
+    return cur_opcode + ICONST(1);
+}
+
+opcode_t *
+Parrot_local_branch_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   return_addr;
+    opcode_t  * const  dest =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_branch'");
+
+        return (opcode_t *)handler;
+    }
+
+    (return_addr) = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), (return_addr));
+    return cur_opcode + IREG(2);
+}
+
+opcode_t *
+Parrot_local_branch_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   return_addr;
+    opcode_t  * const  dest =  cur_opcode + 3;
+
+    if (PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_branch'");
+
+        return (opcode_t *)handler;
+    }
+
+    (return_addr) = PTR2INTVAL(dest);
+    VTABLE_push_integer(interp, PREG(1), (return_addr));
+    return cur_opcode + ICONST(2);
+}
+
+opcode_t *
+Parrot_local_return_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    INTVAL   return_addr;
+    opcode_t  * next;
+    opcode_t  * const  dest =  cur_opcode + 2;
+
+    if (PMC_IS_NULL(PREG(1)) || (PREG(1)->vtable->base_type != enum_class_ResizableIntegerArray)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Must pass a valid integer array to 'local_return'");
+
+        return (opcode_t *)handler;
+    }
+
+    (return_addr) = VTABLE_pop_integer(interp, PREG(1));
+    next = INTVAL2PTR(opcode_t *, (return_addr));
+    if (!(((next >= interp->code->base.data) && (next < ((interp->code->base.data + interp->code->base.size)))))) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_INVALID_OPERATION, "Address for 'local_return' must be within the current code segment");
+
+        return (opcode_t *)handler;
+    }
+
+    return (opcode_t *)next;
+}
+
+opcode_t *
+Parrot_jump_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, IREG(1));
+
+    UNUSED(interp);
+    UNUSED(cur_opcode);
+    return (opcode_t *)loc;
+}
+
+opcode_t *
+Parrot_jump_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  loc = INTVAL2PTR(opcode_t *, ICONST(1));
+
+    UNUSED(interp);
+    UNUSED(cur_opcode);
+    return (opcode_t *)loc;
+}
+
+opcode_t *
+Parrot_if_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (IREG(1) != 0) {
+        return cur_opcode + ICONST(2);
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_if_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!FLOAT_IS_ZERO(NREG(1))) {
+        return cur_opcode + ICONST(2);
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_if_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (Parrot_str_boolean(interp, SREG(1))) {
+        return cur_opcode + ICONST(2);
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_if_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (VTABLE_get_bool(interp, PREG(1))) {
+        return cur_opcode + ICONST(2);
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_unless_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (IREG(1) == 0) {
+        return cur_opcode + ICONST(2);
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_unless_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (FLOAT_IS_ZERO(NREG(1))) {
+        return cur_opcode + ICONST(2);
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_unless_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!Parrot_str_boolean(interp, SREG(1))) {
+        return cur_opcode + ICONST(2);
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_unless_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!VTABLE_get_bool(interp, PREG(1))) {
+        return cur_opcode + ICONST(2);
+    }
+
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_invokecc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC       * const  p = PREG(1);
+    opcode_t  * dest =  cur_opcode + 2;
+    PMC       * const  ctx = CURRENT_CONTEXT(interp);
+
+    Parrot_pcc_set_pc(interp, ctx, dest);
+    Parrot_pcc_reuse_continuation(interp, ctx, dest);
+    dest = VTABLE_invoke(interp, p, dest);
+    return (opcode_t *)dest;
+}
+
+opcode_t *
+Parrot_invoke_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t    * dest =  cur_opcode + 3;
     PMC  * const  p = PREG(1);
     PMC  * const  ctx = CURRENT_CONTEXT(interp);
 
@@ -13997,18 +14531,11 @@ Parrot_get_params_pc(opcode_t *cur_opcode, PARROT_INTERP) {
     opcode_t  * const  raw_params = CUR_OPCODE;
     PMC       * const  signature = PCONST(1);
     PMC       * const  ctx = CURRENT_CONTEXT(interp);
-    PMC       * const  ccont = Parrot_pcc_get_continuation(interp, ctx);
     PMC       * const  caller_ctx = Parrot_pcc_get_caller_ctx(interp, ctx);
     PMC       * const  call_object = Parrot_pcc_get_signature(interp, caller_ctx);
     INTVAL   argc;
 
     Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params, PARROT_ERRORS_PARAM_COUNT_FLAG);
-    if (PObj_get_FLAGS(ccont) & SUB_FLAG_TAILCALL) {
-        (PObj_get_FLAGS(ccont) &= (~SUB_FLAG_TAILCALL));
-        Parrot_pcc_dec_recursion_depth(interp, ctx);
-        Parrot_pcc_set_caller_ctx(interp, ctx, Parrot_pcc_get_caller_ctx(interp, caller_ctx));
-    }
-
     GETATTR_FixedIntegerArray_size(interp, signature, argc);
     return cur_opcode + (argc + 2);
 }
@@ -15398,6 +15925,10 @@ Parrot_eq_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_eq_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(1)) && QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     if (VTABLE_is_equal(interp, PREG(1), PREG(2))) {
         return cur_opcode + ICONST(3);
     }
@@ -15407,8 +15938,13 @@ Parrot_eq_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_eq_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if (VTABLE_is_equal(interp, PREG(1), temp)) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -15421,8 +15957,13 @@ Parrot_eq_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_eq_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if (VTABLE_is_equal(interp, PREG(1), temp)) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -15615,6 +16156,10 @@ Parrot_ne_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_ne_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(1)) && QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     if (!VTABLE_is_equal(interp, PREG(1), PREG(2))) {
         return cur_opcode + ICONST(3);
     }
@@ -15624,8 +16169,13 @@ Parrot_ne_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_ne_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if (!VTABLE_is_equal(interp, PREG(1), temp)) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -15638,8 +16188,13 @@ Parrot_ne_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_ne_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if (!VTABLE_is_equal(interp, PREG(1), temp)) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -15832,6 +16387,10 @@ Parrot_lt_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_lt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(1)) && QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     if (VTABLE_cmp(interp, PREG(1), PREG(2)) < 0) {
         return cur_opcode + ICONST(3);
     }
@@ -15841,8 +16400,13 @@ Parrot_lt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_lt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if (VTABLE_cmp(interp, PREG(1), temp) < 0) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -15855,8 +16419,13 @@ Parrot_lt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_lt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if (VTABLE_cmp(interp, PREG(1), temp) < 0) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -16004,6 +16573,10 @@ Parrot_le_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_le_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(1)) && QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     if (VTABLE_cmp(interp, PREG(1), PREG(2)) <= 0) {
         return cur_opcode + ICONST(3);
     }
@@ -16013,8 +16586,13 @@ Parrot_le_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_le_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if (VTABLE_cmp(interp, PREG(1), temp) <= 0) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -16027,8 +16605,13 @@ Parrot_le_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_le_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if (VTABLE_cmp(interp, PREG(1), temp) <= 0) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -16095,6 +16678,10 @@ Parrot_le_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_gt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(1)) && QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     if (VTABLE_cmp(interp, PREG(1), PREG(2)) > 0) {
         return cur_opcode + ICONST(3);
     }
@@ -16104,8 +16691,13 @@ Parrot_gt_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_gt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if (VTABLE_cmp(interp, PREG(1), temp) > 0) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -16118,8 +16710,13 @@ Parrot_gt_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_gt_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if (VTABLE_cmp(interp, PREG(1), temp) > 0) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -16186,6 +16783,10 @@ Parrot_gt_num_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_ge_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(1)) && QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     if (VTABLE_cmp(interp, PREG(1), PREG(2)) >= 0) {
         return cur_opcode + ICONST(3);
     }
@@ -16195,8 +16796,13 @@ Parrot_ge_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_ge_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, IREG(2));
     if (VTABLE_cmp(interp, PREG(1), temp) >= 0) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -16209,8 +16815,13 @@ Parrot_ge_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_ge_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
+    PMC  * temp;
+
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
 
+    temp = Parrot_pmc_new_temporary(interp, enum_class_Integer);
     VTABLE_set_integer_native(interp, temp, ICONST(2));
     if (VTABLE_cmp(interp, PREG(1), temp) >= 0) {
         Parrot_pmc_free_temporary(interp, temp);
@@ -17499,18 +18110,36 @@ Parrot_add_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_add_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(2)) && QUICK_INTEGER(PREG(3))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+    else {
+        if (QUICK_FLOAT(PREG(2)) && QUICK_FLOAT(PREG(3))) {
+            Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Float);
+        }
+
+    }
+
     PREG(1) = VTABLE_add(interp, PREG(2), PREG(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
 Parrot_add_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     PREG(1) = VTABLE_add_int(interp, PREG(2), IREG(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
 Parrot_add_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     PREG(1) = VTABLE_add_int(interp, PREG(2), ICONST(3), PREG(1));
     return cur_opcode + 4;
 }
@@ -17541,6 +18170,16 @@ Parrot_dec_n(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_dec_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+    else {
+        if (QUICK_FLOAT(PREG(1))) {
+            Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Float);
+        }
+
+    }
+
     VTABLE_decrement(interp, PREG(1));
     return cur_opcode + 2;
 }
@@ -18163,6 +18802,16 @@ Parrot_inc_n(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_inc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(1))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+    else {
+        if (QUICK_FLOAT(PREG(1))) {
+            Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Float);
+        }
+
+    }
+
     VTABLE_increment(interp, PREG(1));
     return cur_opcode + 2;
 }
@@ -18319,6 +18968,10 @@ Parrot_mod_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_mod_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(2)) && QUICK_INTEGER(PREG(3))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     PREG(1) = VTABLE_modulus(interp, PREG(2), PREG(3), PREG(1));
     return cur_opcode + 4;
 }
@@ -18439,6 +19092,16 @@ Parrot_mul_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_mul_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(2)) && QUICK_INTEGER(PREG(3))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+    else {
+        if (QUICK_FLOAT(PREG(2)) && QUICK_FLOAT(PREG(3))) {
+            Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Float);
+        }
+
+    }
+
     PREG(1) = VTABLE_multiply(interp, PREG(2), PREG(3), PREG(1));
     return cur_opcode + 4;
 }
@@ -18596,18 +19259,36 @@ Parrot_sub_n_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_sub_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(2)) && QUICK_INTEGER(PREG(3))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+    else {
+        if (QUICK_FLOAT(PREG(2)) && QUICK_FLOAT(PREG(3))) {
+            Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Float);
+        }
+
+    }
+
     PREG(1) = VTABLE_subtract(interp, PREG(2), PREG(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
 Parrot_sub_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     PREG(1) = VTABLE_subtract_int(interp, PREG(2), IREG(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
 Parrot_sub_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (QUICK_INTEGER(PREG(2))) {
+        Parrot_runcore_quicken_op(interp, CUR_OPCODE, enum_class_Integer);
+    }
+
     PREG(1) = VTABLE_subtract_int(interp, PREG(2), ICONST(3), PREG(1));
     return cur_opcode + 4;
 }
@@ -19572,7 +20253,157 @@ Parrot_new_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
         const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
 
         if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_new_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if (type <= 0) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
+
+        PREG(1) = Parrot_pmc_new(interp, type);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_new_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if (type <= 0) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_new_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if (type <= 0) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_new_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if (type <= 0) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_new_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+
+    if (!PMC_IS_NULL(_class)) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if (type <= 0) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
+
+        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_new_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  name_key = PREG(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+    if (!PMC_IS_NULL(_class)) {
+        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+        if (type <= 0) {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
             PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
             return (opcode_t *)dest;
@@ -19586,18 +20417,18 @@ Parrot_new_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
 }
 
 opcode_t *
-Parrot_new_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  name = SCONST(2);
-    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+Parrot_new_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  name_key = PCONST(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
 
     if (!PMC_IS_NULL(_class)) {
         PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
 
         if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
             PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
             return (opcode_t *)dest;
@@ -19611,18 +20442,18 @@ Parrot_new_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
 }
 
 opcode_t *
-Parrot_new_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  name = SREG(2);
-    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+Parrot_new_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  name_key = PREG(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
 
     if (!PMC_IS_NULL(_class)) {
         PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
 
         if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
             PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
             return (opcode_t *)dest;
@@ -19636,18 +20467,18 @@ Parrot_new_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
 }
 
 opcode_t *
-Parrot_new_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  name = SCONST(2);
-    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+Parrot_new_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  name_key = PCONST(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
 
     if (!PMC_IS_NULL(_class)) {
         PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
 
         if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
             PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
             return (opcode_t *)dest;
@@ -19661,18 +20492,18 @@ Parrot_new_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
 }
 
 opcode_t *
-Parrot_new_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  name = SREG(2);
-    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+Parrot_new_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  name_key = PREG(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
 
     if (!PMC_IS_NULL(_class)) {
         PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
 
         if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
             PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
             return (opcode_t *)dest;
@@ -19686,18 +20517,18 @@ Parrot_new_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
 }
 
 opcode_t *
-Parrot_new_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  name = SCONST(2);
-    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+Parrot_new_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  name_key = PCONST(2);
+    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
 
     if (!PMC_IS_NULL(_class)) {
         PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
 
         if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
             PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
             return (opcode_t *)dest;
@@ -19711,24 +20542,49 @@ Parrot_new_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
 }
 
 opcode_t *
-Parrot_new_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  name_key = PREG(2);
-    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+Parrot_root_new_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  key = PREG(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
 
-    if (!PMC_IS_NULL(_class)) {
-        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    if (!PMC_IS_NULL(ns)) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if (!PMC_IS_NULL(classobj)) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
 
-        if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)dest;
+    }
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
 
-        PREG(1) = Parrot_pmc_new(interp, type);
+opcode_t *
+Parrot_root_new_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  key = PCONST(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if (!PMC_IS_NULL(ns)) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if (!PMC_IS_NULL(classobj)) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)dest;
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
@@ -19736,5214 +20592,5799 @@ Parrot_new_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
 }
 
 opcode_t *
-Parrot_new_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  name_key = PCONST(2);
-    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+Parrot_root_new_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  key = PREG(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
 
-    if (!PMC_IS_NULL(_class)) {
-        PREG(1) = VTABLE_instantiate(interp, _class, PMCNULL);
+    if (!PMC_IS_NULL(ns)) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if (!PMC_IS_NULL(classobj)) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
 
-        if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)dest;
+    }
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_root_new_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  key = PCONST(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if (!PMC_IS_NULL(ns)) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if (!PMC_IS_NULL(classobj)) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)dest;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_root_new_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  key = PREG(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if (!PMC_IS_NULL(ns)) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if (!PMC_IS_NULL(classobj)) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)dest;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_root_new_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  key = PCONST(2);
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
+    PMC  *  classobj = PMCNULL;
+
+    if (!PMC_IS_NULL(ns)) {
+        classobj = Parrot_oo_get_class(interp, ns);
+    }
+
+    if (!PMC_IS_NULL(classobj)) {
+        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
+    }
+    else {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)dest;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_typeof_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_name(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_typeof_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_class(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_get_repr_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_get_repr(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_find_method_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  resume =  cur_opcode + 4;
+
+    PREG(1) = VTABLE_find_method(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1)))) {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SREG(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)dest;
+    }
+
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)resume;
+    }
+
+}
+
+opcode_t *
+Parrot_find_method_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  resume =  cur_opcode + 4;
+
+    PREG(1) = VTABLE_find_method(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1)))) {
+        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SCONST(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)dest;
+    }
 
-        PREG(1) = Parrot_pmc_new(interp, type);
+    {
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)resume;
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+}
+
+opcode_t *
+Parrot_defined_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined(interp, PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_new_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  name_key = PREG(2);
-    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+Parrot_defined_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), IREG(3));
+    return cur_opcode + 4;
+}
 
-    if (!PMC_IS_NULL(_class)) {
-        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
-    }
-    else {
-        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+opcode_t *
+Parrot_defined_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), ICONST(3));
+    return cur_opcode + 4;
+}
 
-        if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+opcode_t *
+Parrot_defined_i_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PREG(3));
+    return cur_opcode + 4;
+}
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
-        }
+opcode_t *
+Parrot_defined_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PCONST(3));
+    return cur_opcode + 4;
+}
 
-        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
-    }
+opcode_t *
+Parrot_exists_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), IREG(3));
+    return cur_opcode + 4;
+}
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+opcode_t *
+Parrot_exists_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), ICONST(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_new_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  name_key = PCONST(2);
-    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+Parrot_exists_i_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed(interp, PREG(2), PREG(3));
+    return cur_opcode + 4;
+}
 
-    if (!PMC_IS_NULL(_class)) {
-        PREG(1) = VTABLE_instantiate(interp, _class, PREG(3));
-    }
-    else {
-        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+opcode_t *
+Parrot_exists_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed(interp, PREG(2), PCONST(3));
+    return cur_opcode + 4;
+}
 
-        if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+opcode_t *
+Parrot_delete_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_delete_keyed(interp, PREG(1), PREG(2));
+    return cur_opcode + 3;
+}
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
-        }
+opcode_t *
+Parrot_delete_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_delete_keyed(interp, PREG(1), PCONST(2));
+    return cur_opcode + 3;
+}
 
-        PREG(1) = Parrot_pmc_new_init(interp, type, PREG(3));
-    }
+opcode_t *
+Parrot_delete_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_delete_keyed_int(interp, PREG(1), IREG(2));
+    return cur_opcode + 3;
+}
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+opcode_t *
+Parrot_delete_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_delete_keyed_int(interp, PREG(1), ICONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_new_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  name_key = PREG(2);
-    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+Parrot_elements_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = VTABLE_elements(interp, PREG(2));
+    return cur_opcode + 3;
+}
 
-    if (!PMC_IS_NULL(_class)) {
-        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
-    }
-    else {
-        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+opcode_t *
+Parrot_push_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_push_integer(interp, PREG(1), IREG(2));
+    return cur_opcode + 3;
+}
 
-        if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+opcode_t *
+Parrot_push_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_push_integer(interp, PREG(1), ICONST(2));
+    return cur_opcode + 3;
+}
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
-        }
+opcode_t *
+Parrot_push_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_push_float(interp, PREG(1), NREG(2));
+    return cur_opcode + 3;
+}
 
-        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
-    }
+opcode_t *
+Parrot_push_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_push_float(interp, PREG(1), NCONST(2));
+    return cur_opcode + 3;
+}
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+opcode_t *
+Parrot_push_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_push_string(interp, PREG(1), SREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_new_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  name_key = PCONST(2);
-    PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+Parrot_push_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_push_string(interp, PREG(1), SCONST(2));
+    return cur_opcode + 3;
+}
 
-    if (!PMC_IS_NULL(_class)) {
-        PREG(1) = VTABLE_instantiate(interp, _class, PCONST(3));
-    }
-    else {
-        const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+opcode_t *
+Parrot_push_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_push_pmc(interp, PREG(1), PREG(2));
+    return cur_opcode + 3;
+}
 
-        if (type <= 0) {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
+opcode_t *
+Parrot_pop_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = VTABLE_pop_integer(interp, PREG(2));
+    return cur_opcode + 3;
+}
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
-        }
+opcode_t *
+Parrot_pop_n_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = VTABLE_pop_float(interp, PREG(2));
+    return cur_opcode + 3;
+}
 
-        PREG(1) = Parrot_pmc_new_init(interp, type, PCONST(3));
-    }
+opcode_t *
+Parrot_pop_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_pop_string(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
 
+opcode_t *
+Parrot_pop_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_pop_pmc(interp, PREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_root_new_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  key = PREG(2);
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC  *  classobj = PMCNULL;
+Parrot_unshift_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_unshift_integer(interp, PREG(1), IREG(2));
+    return cur_opcode + 3;
+}
 
-    if (!PMC_IS_NULL(ns)) {
-        classobj = Parrot_oo_get_class(interp, ns);
-    }
+opcode_t *
+Parrot_unshift_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_unshift_integer(interp, PREG(1), ICONST(2));
+    return cur_opcode + 3;
+}
 
-    if (!PMC_IS_NULL(classobj)) {
-        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-    }
-    else {
-        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+opcode_t *
+Parrot_unshift_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_unshift_float(interp, PREG(1), NREG(2));
+    return cur_opcode + 3;
+}
 
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_unshift_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_unshift_float(interp, PREG(1), NCONST(2));
+    return cur_opcode + 3;
+}
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+opcode_t *
+Parrot_unshift_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_unshift_string(interp, PREG(1), SREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_root_new_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  key = PCONST(2);
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC  *  classobj = PMCNULL;
+Parrot_unshift_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_unshift_string(interp, PREG(1), SCONST(2));
+    return cur_opcode + 3;
+}
 
-    if (!PMC_IS_NULL(ns)) {
-        classobj = Parrot_oo_get_class(interp, ns);
-    }
+opcode_t *
+Parrot_unshift_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_unshift_pmc(interp, PREG(1), PREG(2));
+    return cur_opcode + 3;
+}
 
-    if (!PMC_IS_NULL(classobj)) {
-        PREG(1) = VTABLE_instantiate(interp, classobj, PMCNULL);
-    }
-    else {
-        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 3, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+opcode_t *
+Parrot_shift_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = VTABLE_shift_integer(interp, PREG(2));
+    return cur_opcode + 3;
+}
 
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_shift_n_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = VTABLE_shift_float(interp, PREG(2));
+    return cur_opcode + 3;
+}
 
+opcode_t *
+Parrot_shift_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_shift_string(interp, PREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_root_new_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  key = PREG(2);
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC  *  classobj = PMCNULL;
-
-    if (!PMC_IS_NULL(ns)) {
-        classobj = Parrot_oo_get_class(interp, ns);
-    }
-
-    if (!PMC_IS_NULL(classobj)) {
-        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
-    }
-    else {
-        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)dest;
-    }
-
+Parrot_shift_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_shift_pmc(interp, PREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_root_new_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  key = PCONST(2);
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC  *  classobj = PMCNULL;
+Parrot_splice_p_p_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), IREG(4));
+    return cur_opcode + 5;
+}
 
-    if (!PMC_IS_NULL(ns)) {
-        classobj = Parrot_oo_get_class(interp, ns);
-    }
+opcode_t *
+Parrot_splice_p_p_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), IREG(4));
+    return cur_opcode + 5;
+}
 
-    if (!PMC_IS_NULL(classobj)) {
-        PREG(1) = VTABLE_instantiate(interp, classobj, PREG(3));
-    }
-    else {
-        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
+opcode_t *
+Parrot_splice_p_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), ICONST(4));
+    return cur_opcode + 5;
+}
 
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)dest;
-    }
+opcode_t *
+Parrot_splice_p_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), ICONST(4));
+    return cur_opcode + 5;
+}
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+opcode_t *
+Parrot_setprop_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_pmc_setprop(interp, PREG(1), SREG(2), PREG(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_root_new_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  key = PREG(2);
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC  *  classobj = PMCNULL;
-
-    if (!PMC_IS_NULL(ns)) {
-        classobj = Parrot_oo_get_class(interp, ns);
-    }
-
-    if (!PMC_IS_NULL(classobj)) {
-        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
-    }
-    else {
-        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)dest;
-    }
+Parrot_setprop_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_pmc_setprop(interp, PREG(1), SCONST(2), PREG(3));
+    return cur_opcode + 4;
+}
 
+opcode_t *
+Parrot_getprop_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_warn_deprecated(interp, "getprop_p_s_p is deprecated. Use getprop_p_p_s instead");
+    PREG(1) = Parrot_pmc_getprop(interp, PREG(3), SREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_root_new_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  key = PCONST(2);
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, key);
-    PMC  *  classobj = PMCNULL;
-
-    if (!PMC_IS_NULL(ns)) {
-        classobj = Parrot_oo_get_class(interp, ns);
-    }
-
-    if (!PMC_IS_NULL(classobj)) {
-        PREG(1) = VTABLE_instantiate(interp, classobj, PCONST(3));
-    }
-    else {
-        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, key));
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)dest;
-    }
+Parrot_getprop_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_warn_deprecated(interp, "getprop_p_s_p is deprecated. Use getprop_p_p_s instead");
+    PREG(1) = Parrot_pmc_getprop(interp, PREG(3), SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
 
+opcode_t *
+Parrot_getprop_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pmc_getprop(interp, PREG(2), SREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_typeof_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_name(interp, PREG(2));
+Parrot_getprop_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pmc_getprop(interp, PREG(2), SCONST(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_delprop_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_pmc_delprop(interp, PREG(1), SREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_typeof_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_class(interp, PREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_delprop_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_pmc_delprop(interp, PREG(1), SCONST(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_get_repr_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_get_repr(interp, PREG(2));
+Parrot_prophash_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pmc_getprops(interp, PREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_method_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * const  resume =  cur_opcode + 4;
-
-    PREG(1) = VTABLE_find_method(interp, PREG(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1)))) {
-        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SREG(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)dest;
-    }
-
-    {
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)resume;
-    }
-
+Parrot_freeze_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_freeze(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_method_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * const  resume =  cur_opcode + 4;
-
-    PREG(1) = VTABLE_find_method(interp, PREG(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1)) || (!VTABLE_defined(interp, PREG(1)))) {
-        opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp, resume, EXCEPTION_METHOD_NOT_FOUND, "Method '%Ss' not found for invocant of class '%Ss'", SCONST(3), VTABLE_get_string(interp, VTABLE_get_class(interp, PREG(2))));
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)dest;
-    }
-
-    {
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)resume;
-    }
-
+Parrot_thaw_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_thaw(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_defined_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined(interp, PREG(2));
+Parrot_thaw_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_thaw(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_defined_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), IREG(3));
+Parrot_add_multi_s_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SREG(2), PREG(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_defined_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed_int(interp, PREG(2), ICONST(3));
+Parrot_add_multi_sc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SREG(2), PREG(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_defined_i_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PREG(3));
+Parrot_add_multi_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SCONST(2), PREG(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_defined_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_defined_keyed(interp, PREG(2), PCONST(3));
+Parrot_add_multi_sc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SCONST(2), PREG(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_exists_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), IREG(3));
+Parrot_find_multi_p_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_exists_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed_int(interp, PREG(2), ICONST(3));
+Parrot_find_multi_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_exists_i_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed(interp, PREG(2), PREG(3));
+Parrot_find_multi_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_exists_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = PMC_IS_NULL(PREG(2)) ? 0 : VTABLE_exists_keyed(interp, PREG(2), PCONST(3));
+Parrot_find_multi_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_delete_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_delete_keyed(interp, PREG(1), PREG(2));
+Parrot_register_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_pmc_gc_register(interp, PREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_unregister_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_pmc_gc_unregister(interp, PREG(1));
+    return cur_opcode + 2;
+}
+
+opcode_t *
+Parrot_box_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pmc_box_integer(interp, IREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_delete_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_delete_keyed(interp, PREG(1), PCONST(2));
+Parrot_box_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pmc_box_integer(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_box_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pmc_box_number(interp, NREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_delete_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_delete_keyed_int(interp, PREG(1), IREG(2));
+Parrot_box_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pmc_box_number(interp, NCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_delete_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_delete_keyed_int(interp, PREG(1), ICONST(2));
+Parrot_box_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pmc_box_string(interp, SREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_elements_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = VTABLE_elements(interp, PREG(2));
+Parrot_box_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pmc_box_string(interp, SCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_push_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_push_integer(interp, PREG(1), IREG(2));
+Parrot_iter_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_iter(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_push_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_push_integer(interp, PREG(1), ICONST(2));
+Parrot_morph_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_morph(interp, PREG(1), PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_push_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_push_float(interp, PREG(1), NREG(2));
+Parrot_morph_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_morph(interp, PREG(1), PCONST(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_push_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_push_float(interp, PREG(1), NCONST(2));
+Parrot_clone_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_IS_NULL(SREG(2)) ? Parrot_str_new(interp, NULL, 0) : SREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_push_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_push_string(interp, PREG(1), SREG(2));
+Parrot_clone_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_IS_NULL(SCONST(2)) ? Parrot_str_new(interp, NULL, 0) : SCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_push_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_push_string(interp, PREG(1), SCONST(2));
+Parrot_set_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = IREG(2);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_push_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_push_pmc(interp, PREG(1), PREG(2));
+Parrot_set_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ICONST(2);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_pop_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = VTABLE_pop_integer(interp, PREG(2));
+Parrot_set_i_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = (INTVAL)NREG(2);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_pop_n_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = VTABLE_pop_float(interp, PREG(2));
+Parrot_set_i_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = (INTVAL)NCONST(2);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_pop_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_pop_string(interp, PREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_set_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_to_int(interp, SREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_pop_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_pop_pmc(interp, PREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_set_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_to_int(interp, SCONST(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_unshift_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_unshift_integer(interp, PREG(1), IREG(2));
+Parrot_set_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = NREG(2);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_unshift_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_unshift_integer(interp, PREG(1), ICONST(2));
+Parrot_set_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = NCONST(2);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_unshift_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_unshift_float(interp, PREG(1), NREG(2));
+Parrot_set_n_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (FLOATVAL)IREG(2);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_unshift_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_unshift_float(interp, PREG(1), NCONST(2));
+Parrot_set_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = (FLOATVAL)ICONST(2);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_unshift_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_unshift_string(interp, PREG(1), SREG(2));
+Parrot_set_n_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = Parrot_str_to_num(interp, SREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_unshift_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_unshift_string(interp, PREG(1), SCONST(2));
+Parrot_set_n_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = Parrot_str_to_num(interp, SCONST(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_unshift_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_unshift_pmc(interp, PREG(1), PREG(2));
+Parrot_set_n_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = VTABLE_get_number(interp, PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_shift_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = VTABLE_shift_integer(interp, PREG(2));
+Parrot_set_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_get_string(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_shift_n_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = VTABLE_shift_float(interp, PREG(2));
+Parrot_set_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = SREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_shift_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_shift_string(interp, PREG(2));
+Parrot_set_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = SCONST(2);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_shift_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_shift_pmc(interp, PREG(2));
+Parrot_set_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_from_int(interp, IREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_splice_p_p_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), IREG(4));
-    return cur_opcode + 5;
+Parrot_set_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_from_int(interp, ICONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_splice_p_p_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), IREG(4));
-    return cur_opcode + 5;
+Parrot_set_s_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_from_num(interp, NREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_splice_p_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_splice(interp, PREG(1), PREG(2), IREG(3), ICONST(4));
-    return cur_opcode + 5;
+Parrot_set_s_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_from_num(interp, NCONST(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_splice_p_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_splice(interp, PREG(1), PREG(2), ICONST(3), ICONST(4));
-    return cur_opcode + 5;
+Parrot_set_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PARROT_ASSERT(((cur_opcode[2] >= 0) || (!"Empty PMC in set_p_pc")));
+    PREG(1) = PCONST(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_setprop_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_pmc_setprop(interp, PREG(1), SREG(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_set_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PARROT_ASSERT(((cur_opcode[2] >= 0) || (!"Empty PMC in set_p_p")));
+    PREG(1) = PREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_setprop_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_pmc_setprop(interp, PREG(1), SCONST(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_set_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_getprop_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_warn_deprecated(interp, "getprop_p_s_p is deprecated. Use getprop_p_p_s instead");
-    PREG(1) = Parrot_pmc_getprop(interp, PREG(3), SREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_set_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_getprop_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_warn_deprecated(interp, "getprop_p_s_p is deprecated. Use getprop_p_p_s instead");
-    PREG(1) = Parrot_pmc_getprop(interp, PREG(3), SCONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_set_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_getprop_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pmc_getprop(interp, PREG(2), SREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_set_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_getprop_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pmc_getprop(interp, PREG(2), SCONST(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_set_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_native(interp, PREG(1), SREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_delprop_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_pmc_delprop(interp, PREG(1), SREG(2));
+Parrot_set_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_native(interp, PREG(1), SCONST(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_delprop_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_pmc_delprop(interp, PREG(1), SCONST(2));
+Parrot_set_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = VTABLE_get_integer(interp, PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_prophash_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pmc_getprops(interp, PREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_assign_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_assign_pmc(interp, PREG(1), PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_freeze_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_freeze(interp, PREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_assign_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_thaw_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_thaw(interp, SREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_assign_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_thaw_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_thaw(interp, SCONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_assign_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_native(interp, PREG(1), NREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_add_multi_s_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SREG(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_assign_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_add_multi_sc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SREG(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_assign_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_assign_string_native(interp, PREG(1), SREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_add_multi_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SCONST(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_assign_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_assign_string_native(interp, PREG(1), SCONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_add_multi_sc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_mmd_add_multi_from_long_sig(interp, SCONST(1), SCONST(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_assign_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = SREG(2);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_multi_p_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SREG(3));
+Parrot_assign_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = SCONST(2);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_multi_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_setref_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_pmc(interp, PREG(1), PREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_multi_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SREG(2), SCONST(3));
+Parrot_deref_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc(interp, PREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_multi_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_mmd_find_multi_from_long_sig(interp, SCONST(2), SCONST(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_set_p_ki_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), IREG(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_register_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_pmc_gc_register(interp, PREG(1));
-    return cur_opcode + 2;
+Parrot_set_p_kic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), IREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_unregister_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_pmc_gc_unregister(interp, PREG(1));
-    return cur_opcode + 2;
+Parrot_set_p_ki_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), ICONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_box_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pmc_box_integer(interp, IREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), ICONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_box_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pmc_box_integer(interp, ICONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_ki_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_box_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pmc_box_number(interp, NREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kic_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_box_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pmc_box_number(interp, NCONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_ki_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_box_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pmc_box_string(interp, SREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kic_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_box_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pmc_box_string(interp, SCONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_ki_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_iter_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_iter(interp, PREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kic_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_morph_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_morph(interp, PREG(1), PREG(2));
-    return cur_opcode + 3;
+Parrot_set_p_ki_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_morph_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_morph(interp, PREG(1), PCONST(2));
-    return cur_opcode + 3;
+Parrot_set_p_kic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_clone_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_IS_NULL(SREG(2)) ? Parrot_str_new(interp, NULL, 0) : SREG(2);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_ki_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), IREG(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_clone_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_IS_NULL(SCONST(2)) ? Parrot_str_new(interp, NULL, 0) : SCONST(2);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kic_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_pmc_keyed_int(interp, PREG(1), ICONST(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = IREG(2);
-    return cur_opcode + 3;
+Parrot_set_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), IREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ICONST(2);
-    return cur_opcode + 3;
+Parrot_set_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), ICONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_i_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = (INTVAL)NREG(2);
-    return cur_opcode + 3;
+Parrot_set_n_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), IREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_i_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = (INTVAL)NCONST(2);
-    return cur_opcode + 3;
+Parrot_set_n_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), ICONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_to_int(interp, SREG(2));
-    return cur_opcode + 3;
+Parrot_set_s_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_to_int(interp, SCONST(2));
-    return cur_opcode + 3;
+Parrot_set_s_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = NREG(2);
-    return cur_opcode + 3;
+Parrot_set_p_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = NCONST(2);
-    return cur_opcode + 3;
+Parrot_set_p_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = (FLOATVAL)IREG(2);
-    return cur_opcode + 3;
+Parrot_set_p_k_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), IREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = (FLOATVAL)ICONST(2);
-    return cur_opcode + 3;
+Parrot_set_p_kc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), IREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = Parrot_str_to_num(interp, SREG(2));
-    return cur_opcode + 3;
+Parrot_set_p_k_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), ICONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = Parrot_str_to_num(interp, SCONST(2));
-    return cur_opcode + 3;
+Parrot_set_p_kc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), ICONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = VTABLE_get_number(interp, PREG(2));
-    return cur_opcode + 3;
+Parrot_set_p_k_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_get_string(interp, PREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kc_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = SREG(2);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_k_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = SCONST(2);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_from_int(interp, IREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_k_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_from_int(interp, ICONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_from_num(interp, NREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_k_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_from_num(interp, NCONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PARROT_ASSERT(((cur_opcode[2] >= 0) || (!"Empty PMC in set_p_pc")));
-    PREG(1) = PCONST(2);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_k_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_pmc_keyed(interp, PREG(1), PREG(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PARROT_ASSERT(((cur_opcode[2] >= 0) || (!"Empty PMC in set_p_p")));
-    PREG(1) = PREG(2);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_set_p_kc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_pmc_keyed(interp, PREG(1), PCONST(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
-    return cur_opcode + 3;
+Parrot_set_i_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
-    return cur_opcode + 3;
+Parrot_set_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_native(interp, PREG(1), NREG(2));
-    return cur_opcode + 3;
+Parrot_set_n_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
-    return cur_opcode + 3;
+Parrot_set_n_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PCONST(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_native(interp, PREG(1), SREG(2));
-    return cur_opcode + 3;
+Parrot_set_s_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_native(interp, PREG(1), SCONST(2));
-    return cur_opcode + 3;
+Parrot_set_s_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = VTABLE_get_integer(interp, PREG(2));
-    return cur_opcode + 3;
+Parrot_set_p_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_assign_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_assign_pmc(interp, PREG(1), PREG(2));
-    return cur_opcode + 3;
+Parrot_set_p_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_assign_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_native(interp, PREG(1), IREG(2));
+Parrot_clone_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_clone(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_assign_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_native(interp, PREG(1), ICONST(2));
-    return cur_opcode + 3;
+Parrot_clone_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_assign_p_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_native(interp, PREG(1), NREG(2));
-    return cur_opcode + 3;
+Parrot_clone_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_assign_p_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_native(interp, PREG(1), NCONST(2));
+Parrot_copy_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (PMC_IS_NULL(PREG(1))) {
+        opcode_t  * const  dest =  cur_opcode + 3;
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_NULL_REG_ACCESS, "Null PMC in copy");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+    else {
+        PMC    * const  clone = VTABLE_clone(interp, PREG(2));
+        PMC    * const  meta = Parrot_pmc_getprops(interp, PREG(1));
+        const Parrot_UInt   gc_flags = (PREG(1)->flags & PObj_GC_all_FLAGS);
+
+        Parrot_pmc_destroy(interp, PREG(1));
+        memmove(PREG(1), clone, sizeof(PMC));
+        (PREG(1)->flags |= gc_flags);
+        PARROT_GC_WRITE_BARRIER(interp, PREG(1));
+        PObj_custom_destroy_CLEAR(clone);
+        PMC_metadata(clone) = NULL;
+        if (PREG(1)->vtable->attr_size && PMC_data(clone)) {
+            Parrot_gc_allocate_pmc_attributes(interp, PREG(1));
+            memcpy(PMC_data(PREG(1)), PMC_data(clone), PREG(1)->vtable->attr_size);
+        }
+        else {
+            PMC_data(clone) = NULL;
+        }
+
+        if (!PMC_IS_NULL(meta)) {
+            PMC  * const  iter = VTABLE_get_iter(interp, meta);
+
+            while (VTABLE_get_bool(interp, iter)) {
+                STRING  * const  key = VTABLE_shift_string(interp, iter);
+                PMC  * const  value = VTABLE_get_pmc_keyed_str(interp, meta, key);
+
+                Parrot_pmc_setprop(interp, PREG(1), key, value);
+            }
+
+        }
+
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_assign_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_assign_string_native(interp, PREG(1), SREG(2));
-    return cur_opcode + 3;
+Parrot_null_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRINGNULL;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_assign_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_assign_string_native(interp, PREG(1), SCONST(2));
-    return cur_opcode + 3;
+Parrot_null_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = 0;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_assign_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = SREG(2);
+Parrot_null_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = PMCNULL;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_assign_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = SCONST(2);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+Parrot_null_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = 0;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_setref_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_pmc(interp, PREG(1), PREG(2));
+Parrot_ord_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = STRING_ord(interp, SREG(2), 0);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_deref_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc(interp, PREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_ord_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = STRING_ord(interp, SCONST(2), 0);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_ki_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), IREG(3));
+Parrot_ord_i_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = STRING_ord(interp, SREG(2), IREG(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_kic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), IREG(3));
+Parrot_ord_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = STRING_ord(interp, SCONST(2), IREG(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_ki_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_keyed_int(interp, PREG(1), IREG(2), ICONST(3));
+Parrot_ord_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = STRING_ord(interp, SREG(2), ICONST(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_kic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_keyed_int(interp, PREG(1), ICONST(2), ICONST(3));
+Parrot_ord_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = STRING_ord(interp, SCONST(2), ICONST(3));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_ki_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NREG(3));
-    return cur_opcode + 4;
-}
+Parrot_chr_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  s = Parrot_str_chr(interp, (UINTVAL)IREG(2));
 
-opcode_t *
-Parrot_set_p_kic_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NREG(3));
-    return cur_opcode + 4;
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_ki_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_keyed_int(interp, PREG(1), IREG(2), NCONST(3));
-    return cur_opcode + 4;
+Parrot_chr_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  s = Parrot_str_chr(interp, (UINTVAL)ICONST(2));
+
+    SREG(1) = s;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_kic_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_keyed_int(interp, PREG(1), ICONST(2), NCONST(3));
+Parrot_chopn_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_ki_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SREG(3));
+Parrot_chopn_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_kic_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SREG(3));
+Parrot_chopn_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_chopn(interp, SREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_ki_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_keyed_int(interp, PREG(1), IREG(2), SCONST(3));
+Parrot_chopn_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_chopn(interp, SCONST(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_kic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_keyed_int(interp, PREG(1), ICONST(2), SCONST(3));
-    return cur_opcode + 4;
+Parrot_concat_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_i_concatenate(interp, PREG(1), PREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_ki_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_pmc_keyed_int(interp, PREG(1), IREG(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_concat_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_i_concatenate_str(interp, PREG(1), SREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_kic_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_pmc_keyed_int(interp, PREG(1), ICONST(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_concat_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_i_concatenate_str(interp, PREG(1), SCONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_i_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), IREG(3));
+Parrot_concat_s_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_i_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = VTABLE_get_integer_keyed_int(interp, PREG(2), ICONST(3));
+Parrot_concat_s_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_concat(interp, SCONST(2), SREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), IREG(3));
+Parrot_concat_s_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_concat(interp, SREG(2), SCONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = VTABLE_get_number_keyed_int(interp, PREG(2), ICONST(3));
+Parrot_concat_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SREG(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), IREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_concat_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SCONST(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_get_string_keyed_int(interp, PREG(2), ICONST(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_concat_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_concatenate(interp, PREG(2), PREG(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_p_ki(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+Parrot_repeat_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (IREG(3) < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)IREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_p_kic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+Parrot_repeat_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (IREG(3) < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)IREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_k_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), IREG(3));
-    return cur_opcode + 4;
-}
+Parrot_repeat_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (ICONST(3) < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
 
-opcode_t *
-Parrot_set_p_kc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), IREG(3));
-    return cur_opcode + 4;
-}
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_set_p_k_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_keyed(interp, PREG(1), PREG(2), ICONST(3));
+    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_kc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_integer_keyed(interp, PREG(1), PCONST(2), ICONST(3));
+Parrot_repeat_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (ICONST(3) < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+
+    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_k_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NREG(3));
+Parrot_repeat_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (IREG(3) < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        return (opcode_t *)handler;
+    }
+
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), IREG(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_kc_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NREG(3));
+Parrot_repeat_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (ICONST(3) < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        return (opcode_t *)handler;
+    }
+
+    PREG(1) = VTABLE_repeat_int(interp, PREG(2), ICONST(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_k_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_keyed(interp, PREG(1), PREG(2), NCONST(3));
+Parrot_repeat_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (VTABLE_get_integer(interp, PREG(3)) < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
+
+        return (opcode_t *)handler;
+    }
+
+    PREG(1) = VTABLE_repeat(interp, PREG(2), PREG(3), PREG(1));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_kc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_number_keyed(interp, PREG(1), PCONST(2), NCONST(3));
-    return cur_opcode + 4;
+Parrot_repeat_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_i_repeat_int(interp, PREG(1), IREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_k_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SREG(3));
-    return cur_opcode + 4;
+Parrot_repeat_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_i_repeat_int(interp, PREG(1), ICONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_kc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SREG(3));
-    return cur_opcode + 4;
+Parrot_repeat_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_i_repeat(interp, PREG(1), PREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_k_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_keyed(interp, PREG(1), PREG(2), SCONST(3));
-    return cur_opcode + 4;
+Parrot_length_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_length(interp, SREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_kc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_keyed(interp, PREG(1), PCONST(2), SCONST(3));
-    return cur_opcode + 4;
+Parrot_length_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_length(interp, SCONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_k_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_pmc_keyed(interp, PREG(1), PREG(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_bytelength_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_byte_length(interp, SREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_p_kc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_pmc_keyed(interp, PREG(1), PCONST(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_bytelength_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_byte_length(interp, SCONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_set_i_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PREG(3));
-    return cur_opcode + 4;
+Parrot_pin_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_str_pin(interp, SREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_set_i_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = VTABLE_get_integer_keyed(interp, PREG(2), PCONST(3));
-    return cur_opcode + 4;
+Parrot_unpin_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_str_unpin(interp, SREG(1));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_set_n_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PREG(3));
+Parrot_substr_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   len = Parrot_str_byte_length(interp, SREG(2));
+
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_n_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = VTABLE_get_number_keyed(interp, PREG(2), PCONST(3));
+Parrot_substr_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   len = Parrot_str_byte_length(interp, SCONST(2));
+
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), len);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PREG(3));
+Parrot_substr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   len = Parrot_str_byte_length(interp, SREG(2));
+
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), len);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_s_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_get_string_keyed(interp, PREG(2), PCONST(3));
+Parrot_substr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   len = Parrot_str_byte_length(interp, SCONST(2));
+
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), len);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_set_p_p_k(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+Parrot_substr_s_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), IREG(4));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_p_p_kc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+Parrot_substr_s_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), IREG(4));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_clone_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_clone(interp, PREG(2));
+Parrot_substr_s_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), IREG(4));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_clone_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PREG(3));
+Parrot_substr_s_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), IREG(4));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_clone_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_clone_pmc(interp, PREG(2), PCONST(3));
+Parrot_substr_s_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), ICONST(4));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_copy_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (PMC_IS_NULL(PREG(1))) {
-        opcode_t  * const  dest =  cur_opcode + 3;
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_NULL_REG_ACCESS, "Null PMC in copy");
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)handler;
-    }
-    else {
-        PMC    * const  clone = VTABLE_clone(interp, PREG(2));
-        PMC    * const  meta = Parrot_pmc_getprops(interp, PREG(1));
-        const Parrot_UInt   gc_flags = (PREG(1)->flags & PObj_GC_all_FLAGS);
-
-        Parrot_pmc_destroy(interp, PREG(1));
-        memmove(PREG(1), clone, sizeof(PMC));
-        (PREG(1)->flags |= gc_flags);
-        PARROT_GC_WRITE_BARRIER(interp, PREG(1));
-        PObj_custom_destroy_CLEAR(clone);
-        PMC_data(clone) = NULL;
-        PMC_metadata(clone) = NULL;
-        if (!PMC_IS_NULL(meta)) {
-            PMC  * const  iter = VTABLE_get_iter(interp, meta);
-
-            while (VTABLE_get_bool(interp, iter)) {
-                STRING  * const  key = VTABLE_shift_string(interp, iter);
-                PMC  * const  value = VTABLE_get_pmc_keyed_str(interp, meta, key);
-
-                Parrot_pmc_setprop(interp, PREG(1), key, value);
-            }
-
-        }
-
-    }
-
+Parrot_substr_s_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), ICONST(4));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_null_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRINGNULL;
+Parrot_substr_s_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), ICONST(4));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_null_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = 0;
-    return cur_opcode + 2;
+Parrot_substr_s_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_null_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = PMCNULL;
+Parrot_substr_s_p_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_substr(interp, PREG(2), IREG(3), IREG(4));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_null_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = 0;
-    return cur_opcode + 2;
+Parrot_substr_s_p_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_substr(interp, PREG(2), ICONST(3), IREG(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_ord_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = STRING_ord(interp, SREG(2), 0);
-    return cur_opcode + 3;
+Parrot_substr_s_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_substr(interp, PREG(2), IREG(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_ord_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = STRING_ord(interp, SCONST(2), 0);
-    return cur_opcode + 3;
+Parrot_substr_s_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = VTABLE_substr(interp, PREG(2), ICONST(3), ICONST(4));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_ord_i_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = STRING_ord(interp, SREG(2), IREG(3));
-    return cur_opcode + 4;
+Parrot_replace_s_s_i_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_ord_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = STRING_ord(interp, SCONST(2), IREG(3));
-    return cur_opcode + 4;
+Parrot_replace_s_sc_i_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_ord_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = STRING_ord(interp, SREG(2), ICONST(3));
-    return cur_opcode + 4;
+Parrot_replace_s_s_ic_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_ord_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = STRING_ord(interp, SCONST(2), ICONST(3));
-    return cur_opcode + 4;
+Parrot_replace_s_sc_ic_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SREG(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_chr_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  s = Parrot_str_chr(interp, (UINTVAL)IREG(2));
-
-    SREG(1) = s;
+Parrot_replace_s_s_i_ic_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SREG(5));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_chr_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  s = Parrot_str_chr(interp, (UINTVAL)ICONST(2));
-
-    SREG(1) = s;
+Parrot_replace_s_sc_i_ic_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SREG(5));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_chopn_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_chopn(interp, SREG(2), IREG(3));
+Parrot_replace_s_s_ic_ic_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SREG(5));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_chopn_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_chopn(interp, SCONST(2), IREG(3));
+Parrot_replace_s_sc_ic_ic_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SREG(5));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_chopn_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_chopn(interp, SREG(2), ICONST(3));
+Parrot_replace_s_s_i_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SCONST(5));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_chopn_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_chopn(interp, SCONST(2), ICONST(3));
+Parrot_replace_s_sc_i_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SCONST(5));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_concat_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_i_concatenate(interp, PREG(1), PREG(2));
-    return cur_opcode + 3;
+Parrot_replace_s_s_ic_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_concat_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_i_concatenate_str(interp, PREG(1), SREG(2));
-    return cur_opcode + 3;
+Parrot_replace_s_sc_ic_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_concat_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_i_concatenate_str(interp, PREG(1), SCONST(2));
-    return cur_opcode + 3;
+Parrot_replace_s_s_i_ic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SCONST(5));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_concat_s_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_concat(interp, SREG(2), SREG(3));
+Parrot_replace_s_sc_i_ic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SCONST(5));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_concat_s_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_concat(interp, SCONST(2), SREG(3));
+Parrot_replace_s_s_ic_ic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SCONST(5));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_concat_s_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_concat(interp, SREG(2), SCONST(3));
+Parrot_replace_s_sc_ic_ic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SCONST(5));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_concat_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SREG(3), PREG(1));
+Parrot_index_i_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), 0) : (-1);
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_concat_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_concatenate_str(interp, PREG(2), SCONST(3), PREG(1));
+Parrot_index_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), 0) : (-1);
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_concat_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_concatenate(interp, PREG(2), PREG(3), PREG(1));
+Parrot_index_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), 0) : (-1);
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_repeat_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (IREG(3) < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)handler;
-    }
-
-    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)IREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_index_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), 0) : (-1);
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_repeat_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (IREG(3) < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)handler;
-    }
-
-    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)IREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_index_i_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), IREG(4)) : (-1);
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_repeat_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (ICONST(3) < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)handler;
-    }
-
-    SREG(1) = Parrot_str_repeat(interp, SREG(2), (UINTVAL)ICONST(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_index_i_sc_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), IREG(4)) : (-1);
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_repeat_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (ICONST(3) < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
-
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)handler;
-    }
-
-    SREG(1) = Parrot_str_repeat(interp, SCONST(2), (UINTVAL)ICONST(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_index_i_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), IREG(4)) : (-1);
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_repeat_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (IREG(3) < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
-
-        return (opcode_t *)handler;
-    }
-
-    PREG(1) = VTABLE_repeat_int(interp, PREG(2), IREG(3), PREG(1));
-    return cur_opcode + 4;
+Parrot_index_i_sc_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), IREG(4)) : (-1);
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_repeat_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (ICONST(3) < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
-
-        return (opcode_t *)handler;
-    }
-
-    PREG(1) = VTABLE_repeat_int(interp, PREG(2), ICONST(3), PREG(1));
-    return cur_opcode + 4;
+Parrot_index_i_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), ICONST(4)) : (-1);
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_repeat_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (VTABLE_get_integer(interp, PREG(3)) < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_NEG_REPEAT, "Cannot repeat with negative arg");
-
-        return (opcode_t *)handler;
-    }
-
-    PREG(1) = VTABLE_repeat(interp, PREG(2), PREG(3), PREG(1));
-    return cur_opcode + 4;
+Parrot_index_i_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), ICONST(4)) : (-1);
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_repeat_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_i_repeat_int(interp, PREG(1), IREG(2));
-    return cur_opcode + 3;
+Parrot_index_i_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), ICONST(4)) : (-1);
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_repeat_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_i_repeat_int(interp, PREG(1), ICONST(2));
-    return cur_opcode + 3;
+Parrot_index_i_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), ICONST(4)) : (-1);
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_repeat_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_i_repeat(interp, PREG(1), PREG(2));
-    return cur_opcode + 3;
+Parrot_rindex_i_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), STRING_length(str));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_length_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_length(interp, SREG(2));
-    return cur_opcode + 3;
+Parrot_rindex_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), STRING_length(str));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_length_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_length(interp, SCONST(2));
-    return cur_opcode + 3;
+Parrot_rindex_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), STRING_length(str));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_bytelength_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_byte_length(interp, SREG(2));
-    return cur_opcode + 3;
+Parrot_rindex_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), STRING_length(str));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_bytelength_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_byte_length(interp, SCONST(2));
-    return cur_opcode + 3;
+Parrot_rindex_i_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), IREG(4));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_pin_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_str_pin(interp, SREG(1));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+Parrot_rindex_i_sc_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), IREG(4));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_unpin_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_str_unpin(interp, SREG(1));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+Parrot_rindex_i_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SREG(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), IREG(4));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_substr_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    const INTVAL   len = Parrot_str_byte_length(interp, SREG(2));
+Parrot_rindex_i_sc_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SCONST(2);
 
-    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), len);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), IREG(4));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_substr_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    const INTVAL   len = Parrot_str_byte_length(interp, SCONST(2));
+Parrot_rindex_i_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SREG(2);
 
-    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), len);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), ICONST(4));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_substr_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    const INTVAL   len = Parrot_str_byte_length(interp, SREG(2));
+Parrot_rindex_i_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SCONST(2);
 
-    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), len);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), ICONST(4));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_substr_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    const INTVAL   len = Parrot_str_byte_length(interp, SCONST(2));
+Parrot_rindex_i_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SREG(2);
 
-    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), len);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), ICONST(4));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_substr_s_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), IREG(4));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_rindex_i_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  str = SCONST(2);
+
+    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), ICONST(4));
     return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_substr_s_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), IREG(4));
+Parrot_sprintf_s_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_psprintf(interp, SREG(2), PREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_substr_s_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), IREG(4));
+Parrot_sprintf_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_psprintf(interp, SCONST(2), PREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_substr_s_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), IREG(4));
+Parrot_sprintf_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_string_native(interp, PREG(1), Parrot_psprintf(interp, VTABLE_get_string(interp, PREG(2)), PREG(3)));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_substr_s_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_substr(interp, SREG(2), IREG(3), ICONST(4));
+Parrot_new_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_new_noinit(interp, 0);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_substr_s_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_substr(interp, SCONST(2), IREG(3), ICONST(4));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+Parrot_stringinfo_i_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (SREG(2) == NULL) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", IREG(3));
+
+                return (opcode_t *)handler;
+            }
+
+        }
+
+    }
+
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_substr_s_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_substr(interp, SREG(2), ICONST(3), ICONST(4));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+Parrot_stringinfo_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (SCONST(2) == NULL) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (IREG(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", IREG(3));
+
+                return (opcode_t *)handler;
+            }
+
+        }
+
+    }
+
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_substr_s_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = STRING_substr(interp, SCONST(2), ICONST(3), ICONST(4));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+Parrot_stringinfo_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (SREG(2) == NULL) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SREG(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SREG(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SREG(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SREG(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SREG(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", ICONST(3));
+
+                return (opcode_t *)handler;
+            }
+
+        }
+
+    }
+
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_substr_s_p_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_substr(interp, PREG(2), IREG(3), IREG(4));
+Parrot_stringinfo_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (SCONST(2) == NULL) {
+        IREG(1) = 0;
+    }
+    else {
+        switch (ICONST(3)) {
+          case STRINGINFO_HEADER:
+            IREG(1) = PTR2UINTVAL(SCONST(2));
+            break;
+          case STRINGINFO_STRSTART:
+            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
+            break;
+          case STRINGINFO_BUFLEN:
+            IREG(1) = Buffer_buflen(SCONST(2));
+            break;
+          case STRINGINFO_FLAGS:
+            IREG(1) = PObj_get_FLAGS(SCONST(2));
+            break;
+          case STRINGINFO_BUFUSED:
+            IREG(1) = SCONST(2)->bufused;
+            break;
+          case STRINGINFO_STRLEN:
+            IREG(1) = SCONST(2)->strlen;
+            break;
+          default:
+            {
+                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", ICONST(3));
+
+                return (opcode_t *)handler;
+            }
+
+        }
+
+    }
+
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_upcase_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_upcase(interp, SREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_substr_s_p_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_substr(interp, PREG(2), ICONST(3), IREG(4));
+Parrot_upcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_upcase(interp, SCONST(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_substr_s_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_substr(interp, PREG(2), IREG(3), ICONST(4));
+Parrot_downcase_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_downcase(interp, SREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_substr_s_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = VTABLE_substr(interp, PREG(2), ICONST(3), ICONST(4));
+Parrot_downcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_downcase(interp, SCONST(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_s_i_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SREG(5));
+Parrot_titlecase_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_titlecase(interp, SREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_sc_i_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SREG(5));
+Parrot_titlecase_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_titlecase(interp, SCONST(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_s_ic_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SREG(5));
+Parrot_foldcase_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_foldcase(interp, SREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_sc_ic_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SREG(5));
+Parrot_foldcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_foldcase(interp, SCONST(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_s_i_ic_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SREG(5));
+Parrot_join_s_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_join(interp, SREG(2), PREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_replace_s_sc_i_ic_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SREG(5));
+Parrot_join_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_join(interp, SCONST(2), PREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_replace_s_s_ic_ic_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SREG(5));
+Parrot_split_p_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_str_split(interp, SREG(2), SREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_replace_s_sc_ic_ic_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SREG(5));
+Parrot_split_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SREG(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_replace_s_s_i_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), IREG(4), SCONST(5));
+Parrot_split_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_str_split(interp, SREG(2), SCONST(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_replace_s_sc_i_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), IREG(4), SCONST(5));
+Parrot_split_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_str_split(interp, SCONST(2), SCONST(3));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_replace_s_s_ic_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), IREG(4), SCONST(5));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+Parrot_encoding_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_encoding_number_of_str(interp, SREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_sc_ic_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), IREG(4), SCONST(5));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+Parrot_encoding_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_encoding_number_of_str(interp, SCONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_s_i_ic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SREG(2), IREG(3), ICONST(4), SCONST(5));
+Parrot_encodingname_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_encoding_name(interp, IREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_sc_i_ic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), IREG(3), ICONST(4), SCONST(5));
+Parrot_encodingname_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_encoding_name(interp, ICONST(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_s_ic_ic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SREG(2), ICONST(3), ICONST(4), SCONST(5));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+Parrot_find_encoding_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   n = Parrot_encoding_number(interp, SREG(2));
+
+    if (n < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_ENCODING, "encoding '%Ss' not found", SREG(2));
+
+        return (opcode_t *)handler;
+    }
+
+    IREG(1) = n;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_replace_s_sc_ic_ic_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_replace(interp, SCONST(2), ICONST(3), ICONST(4), SCONST(5));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 6;
+Parrot_find_encoding_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    const INTVAL   n = Parrot_encoding_number(interp, SCONST(2));
+
+    if (n < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_ENCODING, "encoding '%Ss' not found", SCONST(2));
+
+        return (opcode_t *)handler;
+    }
+
+    IREG(1) = n;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_index_i_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), 0) : (-1);
+Parrot_trans_encoding_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_index_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), 0) : (-1);
+Parrot_trans_encoding_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), IREG(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_index_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), 0) : (-1);
+Parrot_trans_encoding_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_index_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), 0) : (-1);
+Parrot_trans_encoding_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), ICONST(3));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_index_i_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), IREG(4)) : (-1);
+Parrot_is_cclass_i_i_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), IREG(4));
     return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_index_i_sc_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), IREG(4)) : (-1);
+Parrot_is_cclass_i_ic_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), IREG(4));
     return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_index_i_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), IREG(4)) : (-1);
+Parrot_is_cclass_i_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), IREG(4));
     return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_index_i_sc_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), IREG(4)) : (-1);
+Parrot_is_cclass_i_ic_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), IREG(4));
     return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_index_i_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SREG(2) && SREG(3))) ? STRING_index(interp, SREG(2), SREG(3), ICONST(4)) : (-1);
+Parrot_is_cclass_i_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), ICONST(4));
     return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_index_i_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SCONST(2) && SREG(3))) ? STRING_index(interp, SCONST(2), SREG(3), ICONST(4)) : (-1);
+Parrot_is_cclass_i_ic_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), ICONST(4));
     return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_index_i_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SREG(2) && SCONST(3))) ? STRING_index(interp, SREG(2), SCONST(3), ICONST(4)) : (-1);
+Parrot_is_cclass_i_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), ICONST(4));
     return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_index_i_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = ((SCONST(2) && SCONST(3))) ? STRING_index(interp, SCONST(2), SCONST(3), ICONST(4)) : (-1);
+Parrot_is_cclass_i_ic_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), ICONST(4));
     return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_rindex_i_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SREG(2);
+Parrot_find_cclass_i_i_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+    return cur_opcode + 6;
+}
 
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), STRING_length(str));
-    return cur_opcode + 4;
+opcode_t *
+Parrot_find_cclass_i_ic_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SCONST(2);
+Parrot_find_cclass_i_i_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+    return cur_opcode + 6;
+}
 
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), STRING_length(str));
-    return cur_opcode + 4;
+opcode_t *
+Parrot_find_cclass_i_ic_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SREG(2);
+Parrot_find_cclass_i_i_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+    return cur_opcode + 6;
+}
 
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), STRING_length(str));
-    return cur_opcode + 4;
+opcode_t *
+Parrot_find_cclass_i_ic_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_cclass_i_i_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_cclass_i_ic_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_cclass_i_i_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_cclass_i_ic_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_cclass_i_i_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_cclass_i_ic_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_find_cclass_i_i_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SCONST(2);
-
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), STRING_length(str));
-    return cur_opcode + 4;
+Parrot_find_cclass_i_ic_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SREG(2);
-
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), IREG(4));
-    return cur_opcode + 5;
+Parrot_find_cclass_i_i_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_sc_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SCONST(2);
-
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), IREG(4));
-    return cur_opcode + 5;
+Parrot_find_cclass_i_ic_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SREG(2);
-
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), IREG(4));
-    return cur_opcode + 5;
+Parrot_find_not_cclass_i_i_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_sc_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SCONST(2);
-
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), IREG(4));
-    return cur_opcode + 5;
+Parrot_find_not_cclass_i_ic_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SREG(2);
-
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), ICONST(4));
-    return cur_opcode + 5;
+Parrot_find_not_cclass_i_i_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_sc_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SCONST(2);
-
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SREG(3), ICONST(4));
-    return cur_opcode + 5;
+Parrot_find_not_cclass_i_ic_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SREG(2);
-
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), ICONST(4));
-    return cur_opcode + 5;
+Parrot_find_not_cclass_i_i_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_rindex_i_sc_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  str = SCONST(2);
-
-    IREG(1) = Parrot_str_find_reverse_index(interp, str, SCONST(3), ICONST(4));
-    return cur_opcode + 5;
+Parrot_find_not_cclass_i_ic_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_sprintf_s_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_psprintf(interp, SREG(2), PREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_find_not_cclass_i_i_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_sprintf_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_psprintf(interp, SCONST(2), PREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_find_not_cclass_i_ic_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_sprintf_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_string_native(interp, PREG(1), Parrot_psprintf(interp, VTABLE_get_string(interp, PREG(2)), PREG(3)));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_find_not_cclass_i_i_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_new_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_new_noinit(interp, 0);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+Parrot_find_not_cclass_i_ic_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_stringinfo_i_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (SREG(2) == NULL) {
-        IREG(1) = 0;
-    }
-    else {
-        switch (IREG(3)) {
-          case STRINGINFO_HEADER:
-            IREG(1) = PTR2UINTVAL(SREG(2));
-            break;
-          case STRINGINFO_STRSTART:
-            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
-            break;
-          case STRINGINFO_BUFLEN:
-            IREG(1) = Buffer_buflen(SREG(2));
-            break;
-          case STRINGINFO_FLAGS:
-            IREG(1) = PObj_get_FLAGS(SREG(2));
-            break;
-          case STRINGINFO_BUFUSED:
-            IREG(1) = SREG(2)->bufused;
-            break;
-          case STRINGINFO_STRLEN:
-            IREG(1) = SREG(2)->strlen;
-            break;
-          default:
-            {
-                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", IREG(3));
-
-                return (opcode_t *)handler;
-            }
-
-        }
-
-    }
-
-    return cur_opcode + 4;
+Parrot_find_not_cclass_i_i_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_stringinfo_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (SCONST(2) == NULL) {
-        IREG(1) = 0;
-    }
-    else {
-        switch (IREG(3)) {
-          case STRINGINFO_HEADER:
-            IREG(1) = PTR2UINTVAL(SCONST(2));
-            break;
-          case STRINGINFO_STRSTART:
-            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
-            break;
-          case STRINGINFO_BUFLEN:
-            IREG(1) = Buffer_buflen(SCONST(2));
-            break;
-          case STRINGINFO_FLAGS:
-            IREG(1) = PObj_get_FLAGS(SCONST(2));
-            break;
-          case STRINGINFO_BUFUSED:
-            IREG(1) = SCONST(2)->bufused;
-            break;
-          case STRINGINFO_STRLEN:
-            IREG(1) = SCONST(2)->strlen;
-            break;
-          default:
-            {
-                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", IREG(3));
-
-                return (opcode_t *)handler;
-            }
-
-        }
-
-    }
-
-    return cur_opcode + 4;
+Parrot_find_not_cclass_i_ic_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_stringinfo_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (SREG(2) == NULL) {
-        IREG(1) = 0;
-    }
-    else {
-        switch (ICONST(3)) {
-          case STRINGINFO_HEADER:
-            IREG(1) = PTR2UINTVAL(SREG(2));
-            break;
-          case STRINGINFO_STRSTART:
-            IREG(1) = PTR2UINTVAL(SREG(2)->strstart);
-            break;
-          case STRINGINFO_BUFLEN:
-            IREG(1) = Buffer_buflen(SREG(2));
-            break;
-          case STRINGINFO_FLAGS:
-            IREG(1) = PObj_get_FLAGS(SREG(2));
-            break;
-          case STRINGINFO_BUFUSED:
-            IREG(1) = SREG(2)->bufused;
-            break;
-          case STRINGINFO_STRLEN:
-            IREG(1) = SREG(2)->strlen;
-            break;
-          default:
-            {
-                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", ICONST(3));
-
-                return (opcode_t *)handler;
-            }
-
-        }
-
-    }
-
-    return cur_opcode + 4;
+Parrot_find_not_cclass_i_i_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_stringinfo_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (SCONST(2) == NULL) {
-        IREG(1) = 0;
-    }
-    else {
-        switch (ICONST(3)) {
-          case STRINGINFO_HEADER:
-            IREG(1) = PTR2UINTVAL(SCONST(2));
-            break;
-          case STRINGINFO_STRSTART:
-            IREG(1) = PTR2UINTVAL(SCONST(2)->strstart);
-            break;
-          case STRINGINFO_BUFLEN:
-            IREG(1) = Buffer_buflen(SCONST(2));
-            break;
-          case STRINGINFO_FLAGS:
-            IREG(1) = PObj_get_FLAGS(SCONST(2));
-            break;
-          case STRINGINFO_BUFUSED:
-            IREG(1) = SCONST(2)->bufused;
-            break;
-          case STRINGINFO_STRLEN:
-            IREG(1) = SCONST(2)->strlen;
-            break;
-          default:
-            {
-                opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "stringinfo: unknown info type: %d", ICONST(3));
-
-                return (opcode_t *)handler;
-            }
-
-        }
+Parrot_find_not_cclass_i_ic_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
+    return cur_opcode + 6;
+}
 
-    }
+opcode_t *
+Parrot_find_not_cclass_i_i_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
+    return cur_opcode + 6;
+}
 
-    return cur_opcode + 4;
+opcode_t *
+Parrot_find_not_cclass_i_ic_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_upcase_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_upcase(interp, SREG(2));
+Parrot_escape_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_escape(interp, SREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_upcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_upcase(interp, SCONST(2));
+Parrot_compose_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_compose(interp, SREG(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_downcase_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_downcase(interp, SREG(2));
+Parrot_compose_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    SREG(1) = Parrot_str_compose(interp, SCONST(2));
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_downcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_downcase(interp, SCONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_find_codepoint_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_internal_find_codepoint(interp, SREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_titlecase_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_titlecase(interp, SREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_find_codepoint_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_str_internal_find_codepoint(interp, SCONST(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_titlecase_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_titlecase(interp, SCONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_spawnw_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_Run_OS_Command(interp, SREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_foldcase_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_foldcase(interp, SREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_spawnw_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_Run_OS_Command(interp, SCONST(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_foldcase_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_foldcase(interp, SCONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_spawnw_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_Run_OS_Command_Argv(interp, PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_join_s_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_join(interp, SREG(2), PREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_err_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = errno;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_join_s_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_join(interp, SCONST(2), PREG(3));
+Parrot_err_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    const char  * const  tmp = strerror(errno);
+
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_split_p_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_str_split(interp, SREG(2), SREG(3));
+Parrot_err_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    const char  * const  tmp = strerror(IREG(2));
+
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_split_p_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_str_split(interp, SCONST(2), SREG(3));
+Parrot_err_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    const char  * const  tmp = strerror(ICONST(2));
+
+    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_split_p_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_str_split(interp, SREG(2), SCONST(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_time_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_intval_time();
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_split_p_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_str_split(interp, SCONST(2), SCONST(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+Parrot_time_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    NREG(1) = Parrot_floatval_time();
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_encoding_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_encoding_number_of_str(interp, SREG(2));
+Parrot_sleep_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * next =  cur_opcode + 2;
+
+    if (IREG(1) < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        return (opcode_t *)handler;
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL)IREG(1), next);
+    return (opcode_t *)next;
+}
+
+opcode_t *
+Parrot_sleep_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * next =  cur_opcode + 2;
+
+    if (ICONST(1) < 0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        return (opcode_t *)handler;
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL)ICONST(1), next);
+    return (opcode_t *)next;
+}
+
+opcode_t *
+Parrot_sleep_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * next =  cur_opcode + 2;
+
+    if (NREG(1) < 0.0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        return (opcode_t *)handler;
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NREG(1), next);
+    return (opcode_t *)next;
+}
+
+opcode_t *
+Parrot_sleep_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * next =  cur_opcode + 2;
+
+    if (NCONST(1) < 0.0) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+
+        return (opcode_t *)handler;
+    }
+
+    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NCONST(1), next);
+    return (opcode_t *)next;
+}
+
+opcode_t *
+Parrot_store_lex_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        return (opcode_t *)handler;
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_encoding_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_encoding_number_of_str(interp, SCONST(2));
+Parrot_store_lex_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        return (opcode_t *)handler;
+    }
+
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_encodingname_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_encoding_name(interp, IREG(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_store_lex_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        return (opcode_t *)handler;
+    }
+
+    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_encodingname_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_encoding_name(interp, ICONST(2));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_store_lex_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        return (opcode_t *)handler;
+    }
+
+    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_encoding_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    const INTVAL   n = Parrot_encoding_number(interp, SREG(2));
+Parrot_store_lex_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
 
-    if (n < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_ENCODING, "encoding '%Ss' not found", SREG(2));
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
         return (opcode_t *)handler;
     }
 
-    IREG(1) = n;
+    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_encoding_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    const INTVAL   n = Parrot_encoding_number(interp, SCONST(2));
+Parrot_store_lex_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        return (opcode_t *)handler;
+    }
+
+    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_store_lex_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+        return (opcode_t *)handler;
+    }
+
+    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_store_lex_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
 
-    if (n < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_ENCODING, "encoding '%Ss' not found", SCONST(2));
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
         return (opcode_t *)handler;
     }
 
-    IREG(1) = n;
+    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_trans_encoding_s_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), IREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
-}
-
-opcode_t *
-Parrot_trans_encoding_s_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), IREG(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
-}
+Parrot_store_lex_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
 
-opcode_t *
-Parrot_trans_encoding_s_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_change_encoding(interp, SREG(2), ICONST(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
-}
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-opcode_t *
-Parrot_trans_encoding_s_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_change_encoding(interp, SCONST(2), ICONST(3));
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
-}
+        return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_is_cclass_i_i_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), IREG(4));
-    return cur_opcode + 5;
+    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_is_cclass_i_ic_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), IREG(4));
-    return cur_opcode + 5;
-}
+Parrot_store_lex_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
 
-opcode_t *
-Parrot_is_cclass_i_i_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), IREG(4));
-    return cur_opcode + 5;
-}
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-opcode_t *
-Parrot_is_cclass_i_ic_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), IREG(4));
-    return cur_opcode + 5;
-}
+        return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_is_cclass_i_i_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SREG(3), ICONST(4));
-    return cur_opcode + 5;
+    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_is_cclass_i_ic_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SREG(3), ICONST(4));
-    return cur_opcode + 5;
-}
+Parrot_store_lex_s_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
 
-opcode_t *
-Parrot_is_cclass_i_i_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_is_cclass(interp, IREG(2), SCONST(3), ICONST(4));
-    return cur_opcode + 5;
-}
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-opcode_t *
-Parrot_is_cclass_i_ic_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_is_cclass(interp, ICONST(2), SCONST(3), ICONST(4));
-    return cur_opcode + 5;
-}
+        return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_find_cclass_i_i_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
-    return cur_opcode + 6;
+    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_cclass_i_ic_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
-    return cur_opcode + 6;
-}
+Parrot_store_lex_sc_n(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
 
-opcode_t *
-Parrot_find_cclass_i_i_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
-    return cur_opcode + 6;
-}
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-opcode_t *
-Parrot_find_cclass_i_ic_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
-    return cur_opcode + 6;
-}
+        return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_find_cclass_i_i_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
-    return cur_opcode + 6;
+    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_cclass_i_ic_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
-    return cur_opcode + 6;
-}
+Parrot_store_lex_s_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
 
-opcode_t *
-Parrot_find_cclass_i_i_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
-    return cur_opcode + 6;
-}
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-opcode_t *
-Parrot_find_cclass_i_ic_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
-    return cur_opcode + 6;
-}
+        return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_find_cclass_i_i_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
-    return cur_opcode + 6;
+    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_cclass_i_ic_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
-    return cur_opcode + 6;
-}
+Parrot_store_lex_sc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
 
-opcode_t *
-Parrot_find_cclass_i_i_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
-    return cur_opcode + 6;
-}
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-opcode_t *
-Parrot_find_cclass_i_ic_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
-    return cur_opcode + 6;
-}
+        return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_find_cclass_i_i_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
-    return cur_opcode + 6;
+    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_cclass_i_ic_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
-    return cur_opcode + 6;
-}
+Parrot_store_dynamic_lex_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING   * const  lex_name = SREG(1);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
 
-opcode_t *
-Parrot_find_cclass_i_i_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
-    return cur_opcode + 6;
-}
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found in dynamic scope", lex_name);
 
-opcode_t *
-Parrot_find_cclass_i_ic_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
-    return cur_opcode + 6;
-}
+        return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_find_not_cclass_i_i_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), IREG(5));
-    return cur_opcode + 6;
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_s_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), IREG(5));
-    return cur_opcode + 6;
-}
+Parrot_store_dynamic_lex_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING   * const  lex_name = SCONST(1);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
 
-opcode_t *
-Parrot_find_not_cclass_i_i_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), IREG(5));
-    return cur_opcode + 6;
-}
+    if (PMC_IS_NULL(lex_pad)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found in dynamic scope", lex_name);
 
-opcode_t *
-Parrot_find_not_cclass_i_ic_sc_i_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), IREG(5));
-    return cur_opcode + 6;
-}
+        return (opcode_t *)handler;
+    }
 
-opcode_t *
-Parrot_find_not_cclass_i_i_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), IREG(5));
-    return cur_opcode + 6;
+    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_s_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), IREG(5));
-    return cur_opcode + 6;
-}
+Parrot_find_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    PMC  * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
 
-opcode_t *
-Parrot_find_not_cclass_i_i_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), IREG(5));
-    return cur_opcode + 6;
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_sc_ic_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), IREG(5));
-    return cur_opcode + 6;
+Parrot_find_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    PMC  * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_i_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), IREG(4), ICONST(5));
-    return cur_opcode + 6;
+Parrot_find_lex_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    STRING  * const  result = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+
+    SREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_s_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), IREG(4), ICONST(5));
-    return cur_opcode + 6;
+Parrot_find_lex_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    STRING  * const  result = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+
+    SREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_i_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), IREG(4), ICONST(5));
-    return cur_opcode + 6;
+Parrot_find_lex_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL   result = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+
+    IREG(1) = result;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_sc_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), IREG(4), ICONST(5));
-    return cur_opcode + 6;
+Parrot_find_lex_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    INTVAL   result = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+
+    IREG(1) = result;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_i_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SREG(3), ICONST(4), ICONST(5));
-    return cur_opcode + 6;
+Parrot_find_lex_n_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    FLOATVAL   result = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+
+    NREG(1) = result;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SREG(3), ICONST(4), ICONST(5));
-    return cur_opcode + 6;
+Parrot_find_lex_n_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC      * const  ctx = CURRENT_CONTEXT(interp);
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+    FLOATVAL   result = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+
+    NREG(1) = result;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_i_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, IREG(2), SCONST(3), ICONST(4), ICONST(5));
-    return cur_opcode + 6;
+Parrot_find_dynamic_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING   * const  lex_name = SREG(2);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC      * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_not_cclass_i_ic_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_find_not_cclass(interp, ICONST(2), SCONST(3), ICONST(4), ICONST(5));
-    return cur_opcode + 6;
+Parrot_find_dynamic_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING   * const  lex_name = SCONST(2);
+    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
+    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+    PMC      * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+
+    PREG(1) = result;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_escape_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_escape(interp, SREG(2));
+Parrot_find_caller_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING   * const  lex_name = SREG(2);
+    PMC      *  ctx = CURRENT_CONTEXT(interp);
+    PMC      *  result = PMCNULL;
+
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx); ((!PMC_IS_NULL(ctx)) && PMC_IS_NULL(result)); ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (!PMC_IS_NULL(lex_pad)) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+
+        if (!result) {
+            result = PMCNULL;
+        }
+
+    }
+
+    PREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_compose_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_compose(interp, SREG(2));
+Parrot_find_caller_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING   * const  lex_name = SCONST(2);
+    PMC      *  ctx = CURRENT_CONTEXT(interp);
+    PMC      *  result = PMCNULL;
+
+    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx); ((!PMC_IS_NULL(ctx)) && PMC_IS_NULL(result)); ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
+        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (!PMC_IS_NULL(lex_pad)) {
+            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+        }
+
+        if (!result) {
+            result = PMCNULL;
+        }
+
+    }
+
+    PREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_compose_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    SREG(1) = Parrot_str_compose(interp, SCONST(2));
+Parrot_get_namespace_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+
+    PREG(1) = cur_ns;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_find_codepoint_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_internal_find_codepoint(interp, SREG(2));
+Parrot_get_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_codepoint_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_str_internal_find_codepoint(interp, SCONST(2));
+Parrot_get_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_spawnw_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_Run_OS_Command(interp, SREG(2));
-    return cur_opcode + 3;
+Parrot_get_hll_namespace_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    PREG(1) = hll_ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_spawnw_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_Run_OS_Command(interp, SCONST(2));
+Parrot_get_hll_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_spawnw_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_Run_OS_Command_Argv(interp, PREG(2));
+Parrot_get_hll_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_err_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = errno;
+Parrot_get_root_namespace_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    PREG(1) = root_ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_err_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    const char  * const  tmp = strerror(errno);
+Parrot_get_root_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+
+        PREG(1) = ns;
+    }
 
-    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_err_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    const char  * const  tmp = strerror(IREG(2));
+Parrot_get_root_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
+
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+
+        PREG(1) = ns;
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_get_global_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    STRING  * const  name = SREG(2);
+    PMC  * const  result = Parrot_ns_find_global_from_op(interp, cur_ns, name,  cur_opcode + 3);
 
-    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
+    PARROT_ASSERT_INTERP(result, interp);
+    PREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_err_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    const char  * const  tmp = strerror(ICONST(2));
+Parrot_get_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    STRING  * const  name = SCONST(2);
+    PMC  * const  result = Parrot_ns_find_global_from_op(interp, cur_ns, name,  cur_opcode + 3);
 
-    SREG(1) = Parrot_str_new_init(interp, tmp, strlen(tmp), Parrot_ascii_encoding_ptr, 0);
+    PARROT_ASSERT_INTERP(result, interp);
+    PREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_time_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_intval_time();
-    return cur_opcode + 2;
-}
-
-opcode_t *
-Parrot_time_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    NREG(1) = Parrot_floatval_time();
-    return cur_opcode + 2;
-}
+Parrot_get_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
 
-opcode_t *
-Parrot_sleep_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * next =  cur_opcode + 2;
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
 
-    if (IREG(1) < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL)IREG(1), next);
-    return (opcode_t *)next;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_sleep_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * next =  cur_opcode + 2;
+Parrot_get_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
 
-    if (ICONST(1) < 0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, (FLOATVAL)ICONST(1), next);
-    return (opcode_t *)next;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_sleep_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * next =  cur_opcode + 2;
+Parrot_get_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
 
-    if (NREG(1) < 0.0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NREG(1), next);
-    return (opcode_t *)next;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_sleep_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * next =  cur_opcode + 2;
+Parrot_get_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
 
-    if (NCONST(1) < 0.0) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, next, EXCEPTION_NEG_SLEEP, "Cannot go back in time");
+    if (PMC_IS_NULL(cur_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    next = (opcode_t *)Parrot_cx_schedule_sleep(interp, NCONST(1), next);
-    return (opcode_t *)next;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
-
-        return (opcode_t *)handler;
-    }
+Parrot_get_hll_global_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
 
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_store_lex_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
-
-        return (opcode_t *)handler;
-    }
+Parrot_get_hll_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
 
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_store_lex_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_get_hll_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_sc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_get_hll_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_get_hll_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_sc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_get_hll_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if (PMC_IS_NULL(hll_ns)) {
+        PREG(1) = hll_ns;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_get_root_global_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SREG(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
 
-        return (opcode_t *)handler;
-    }
+opcode_t *
+Parrot_get_root_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
 
-    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
+    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SCONST(2),  cur_opcode + 3);
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_store_lex_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_get_root_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_get_root_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_get_root_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_s_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_get_root_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    if (PMC_IS_NULL(root_ns)) {
+        PREG(1) = PMCNULL;
+    }
+    else {
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
+
+        if (PMC_IS_NULL(ns)) {
+            PREG(1) = PMCNULL;
+        }
+        else {
+            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
+        }
 
-        return (opcode_t *)handler;
     }
 
-    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_sc_n(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_set_global_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    Parrot_ns_set_global(interp, cur_ns, SREG(1), PREG(2));
+    return cur_opcode + 3;
+}
 
-        return (opcode_t *)handler;
-    }
+opcode_t *
+Parrot_set_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
 
-    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
+    Parrot_ns_set_global(interp, cur_ns, SCONST(1), PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_store_lex_s_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_set_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    return cur_opcode + 4;
+}
 
-        return (opcode_t *)handler;
-    }
+opcode_t *
+Parrot_set_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
 
-    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
-    return cur_opcode + 3;
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_lex_sc_nc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(1);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_set_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    return cur_opcode + 4;
+}
 
-        return (opcode_t *)handler;
-    }
+opcode_t *
+Parrot_set_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
 
-    VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
-    return cur_opcode + 3;
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_store_dynamic_lex_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING   * const  lex_name = SREG(1);
-    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
-    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+Parrot_set_hll_global_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found in dynamic scope", lex_name);
+    Parrot_ns_set_global(interp, hll_ns, SREG(1), PREG(2));
+    return cur_opcode + 3;
+}
 
-        return (opcode_t *)handler;
-    }
+opcode_t *
+Parrot_set_hll_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
 
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    Parrot_ns_set_global(interp, hll_ns, SCONST(1), PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_store_dynamic_lex_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING   * const  lex_name = SCONST(1);
-    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
-    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
+Parrot_set_hll_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
 
-    if (PMC_IS_NULL(lex_pad)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found in dynamic scope", lex_name);
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    return cur_opcode + 4;
+}
 
-        return (opcode_t *)handler;
-    }
+opcode_t *
+Parrot_set_hll_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
 
-    VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
-    return cur_opcode + 3;
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    PMC  * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+Parrot_set_hll_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
 
-    PREG(1) = result;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    PMC  * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+Parrot_set_hll_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
 
-    PREG(1) = result;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_lex_s_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    STRING  * const  result = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+Parrot_set_root_global_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
 
-    SREG(1) = result;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    Parrot_ns_set_global(interp, root_ns, SREG(1), PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_lex_s_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    STRING  * const  result = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+Parrot_set_root_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
 
-    SREG(1) = result;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    Parrot_ns_set_global(interp, root_ns, SCONST(1), PREG(2));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_lex_i_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    INTVAL   result = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+Parrot_set_root_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
 
-    IREG(1) = result;
-    return cur_opcode + 3;
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_lex_i_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    INTVAL   result = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+Parrot_set_root_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
 
-    IREG(1) = result;
-    return cur_opcode + 3;
+    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_lex_n_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SREG(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    FLOATVAL   result = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+Parrot_set_root_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
 
-    NREG(1) = result;
-    return cur_opcode + 3;
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_lex_n_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC      * const  ctx = CURRENT_CONTEXT(interp);
-    STRING   * const  lex_name = SCONST(2);
-    PMC      * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
-    FLOATVAL   result = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+Parrot_set_root_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  root_ns = interp->root_namespace;
+    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
 
-    NREG(1) = result;
-    return cur_opcode + 3;
+    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_dynamic_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING   * const  lex_name = SREG(2);
-    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
-    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
-    PMC      * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+Parrot_find_name_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!SREG(2)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Tried to find null name");
 
-    PREG(1) = result;
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+
+    PREG(1) = Parrot_ns_find_named_item(interp, SREG(2),  cur_opcode + 3);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_dynamic_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING   * const  lex_name = SCONST(2);
-    PMC      * const  ctx = Parrot_pcc_get_caller_ctx(interp, CURRENT_CONTEXT(interp));
-    PMC      * const  lex_pad = PMC_IS_NULL(ctx) ? PMCNULL : Parrot_sub_find_dynamic_pad(interp, lex_name, ctx);
-    PMC      * const  result = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+Parrot_find_name_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!SCONST(2)) {
+        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Tried to find null name");
 
-    PREG(1) = result;
+        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+        return (opcode_t *)handler;
+    }
+
+    PREG(1) = Parrot_ns_find_named_item(interp, SCONST(2),  cur_opcode + 3);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_caller_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING   * const  lex_name = SREG(2);
-    PMC      *  ctx = CURRENT_CONTEXT(interp);
-    PMC      *  result = PMCNULL;
-
-    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx); ((!PMC_IS_NULL(ctx)) && PMC_IS_NULL(result)); ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
-        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_find_sub_not_null_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  dest =  cur_opcode + 3;
+    PMC       * const  sub = Parrot_ns_find_named_item(interp, SREG(2), dest);
 
-        if (!PMC_IS_NULL(lex_pad)) {
-            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
-        }
+    if (PMC_IS_NULL(sub)) {
+        opcode_t  * handler;
 
-        if (!result) {
-            result = PMCNULL;
+        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_GLOBAL_NOT_FOUND, "Could not find sub %Ss", SREG(2));
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)handler;
         }
 
     }
 
-    PREG(1) = result;
+    PREG(1) = sub;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_find_caller_lex_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING   * const  lex_name = SCONST(2);
-    PMC      *  ctx = CURRENT_CONTEXT(interp);
-    PMC      *  result = PMCNULL;
-
-    for (ctx = Parrot_pcc_get_caller_ctx(interp, ctx); ((!PMC_IS_NULL(ctx)) && PMC_IS_NULL(result)); ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
-        PMC  * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+Parrot_find_sub_not_null_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  * const  dest =  cur_opcode + 3;
+    PMC       * const  sub = Parrot_ns_find_named_item(interp, SCONST(2), dest);
 
-        if (!PMC_IS_NULL(lex_pad)) {
-            result = VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
-        }
+    if (PMC_IS_NULL(sub)) {
+        opcode_t  * handler;
 
-        if (!result) {
-            result = PMCNULL;
+        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+        handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_GLOBAL_NOT_FOUND, "Could not find sub %Ss", SCONST(2));
+        {
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)handler;
         }
 
     }
 
-    PREG(1) = result;
+    PREG(1) = sub;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_get_namespace_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+Parrot_trap(opcode_t *cur_opcode, PARROT_INTERP) {
+    UNUSED(interp);
+    #if defined(__GNUC__) && (defined(i386) || defined(__x86_64__)) && !defined(sun)
+        __asm__("int3");
 
-    PREG(1) = cur_ns;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+#endif
+;
+    #if defined(__GNUC__) && defined(PPC)
+        __asm__("trap");
+
+#endif
+;
+    return cur_opcode + 1;
 }
 
 opcode_t *
-Parrot_get_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
-
-    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_set_label_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    VTABLE_set_pointer(interp, PREG(1), ((CUR_OPCODE + ICONST(2))));
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_get_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
+Parrot_get_label_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    void  * const  ptr = VTABLE_get_pointer(interp, PREG(2));
 
-    PREG(1) = PMC_IS_NULL(ns) ? PMCNULL : ns;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    IREG(1) = PTR2INTVAL(ptr);
     return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_get_hll_namespace_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-
-    PREG(1) = hll_ns;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+Parrot_get_id_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_hash_pointer((void *)PREG(2), interp->hash_seed);
+    return cur_opcode + 3;
 }
 
 opcode_t *
-Parrot_get_hll_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
+Parrot_get_id_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    IREG(1) = Parrot_hash_pointer((void *)PCONST(2), interp->hash_seed);
+    return cur_opcode + 3;
+}
 
-        PREG(1) = ns;
+opcode_t *
+Parrot_fetch_p_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_hll_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
-
-        PREG(1) = ns;
+Parrot_fetch_p_pc_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_root_namespace_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
+Parrot_fetch_p_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
 
-    PREG(1) = root_ns;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_root_namespace_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-
-    if (PMC_IS_NULL(root_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
-
-        PREG(1) = ns;
+Parrot_fetch_p_pc_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_root_namespace_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-
-    if (PMC_IS_NULL(root_ns)) {
-        PREG(1) = PMCNULL;
+Parrot_fetch_p_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
 
-        PREG(1) = ns;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_fetch_p_pc_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_global_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    STRING  * const  name = SREG(2);
-    PMC  * const  result = Parrot_ns_find_global_from_op(interp, cur_ns, name,  cur_opcode + 3);
+Parrot_fetch_p_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
 
-    PARROT_ASSERT_INTERP(result, interp);
-    PREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    STRING  * const  name = SCONST(2);
-    PMC  * const  result = Parrot_ns_find_global_from_op(interp, cur_ns, name,  cur_opcode + 3);
+Parrot_fetch_p_pc_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+    }
 
-    PARROT_ASSERT_INTERP(result, interp);
-    PREG(1) = result;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-
-    if (PMC_IS_NULL(cur_ns)) {
-        PREG(1) = PMCNULL;
+Parrot_fetch_p_p_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
 
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
 
+opcode_t *
+Parrot_fetch_p_pc_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-
-    if (PMC_IS_NULL(cur_ns)) {
-        PREG(1) = PMCNULL;
+Parrot_fetch_p_p_ic_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
 
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
 
+opcode_t *
+Parrot_fetch_p_pc_ic_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-
-    if (PMC_IS_NULL(cur_ns)) {
-        PREG(1) = PMCNULL;
+Parrot_fetch_p_p_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PREG(2));
 
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
 
+opcode_t *
+Parrot_fetch_p_pc_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-
-    if (PMC_IS_NULL(cur_ns)) {
-        PREG(1) = PMCNULL;
+Parrot_fetch_p_p_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, cur_ns, PCONST(2));
 
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
 
+opcode_t *
+Parrot_fetch_p_pc_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_hll_global_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+Parrot_fetch_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
 
-    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SREG(2),  cur_opcode + 3);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_hll_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+Parrot_fetch_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+    }
 
-    PREG(1) = Parrot_ns_find_global_from_op(interp, hll_ns, SCONST(2),  cur_opcode + 3);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_hll_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = hll_ns;
+Parrot_fetch_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
 
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
 
+opcode_t *
+Parrot_fetch_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_hll_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = hll_ns;
+Parrot_fetch_p_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
 
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
 
+opcode_t *
+Parrot_fetch_p_pc_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_hll_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = hll_ns;
+Parrot_fetch_p_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PREG(2));
 
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
 
+opcode_t *
+Parrot_fetch_p_pc_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_hll_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-
-    if (PMC_IS_NULL(hll_ns)) {
-        PREG(1) = hll_ns;
+Parrot_vivify_p_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, hll_ns, PCONST(2));
 
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
 
+opcode_t *
+Parrot_vivify_p_pc_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_root_global_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
+Parrot_vivify_p_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+    }
 
-    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SREG(2),  cur_opcode + 3);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_root_global_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
+Parrot_vivify_p_pc_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
+    }
 
-    PREG(1) = Parrot_ns_find_global_from_op(interp, root_ns, SCONST(2),  cur_opcode + 3);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_root_global_p_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-
-    if (PMC_IS_NULL(root_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
-
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
-        }
-
+Parrot_vivify_p_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_root_global_p_pc_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-
-    if (PMC_IS_NULL(root_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
-
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SREG(3),  cur_opcode + 4);
-        }
-
+Parrot_vivify_p_pc_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_root_global_p_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-
-    if (PMC_IS_NULL(root_ns)) {
-        PREG(1) = PMCNULL;
-    }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PREG(2));
-
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
-        }
-
+Parrot_vivify_p_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_get_root_global_p_pc_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-
-    if (PMC_IS_NULL(root_ns)) {
-        PREG(1) = PMCNULL;
+Parrot_vivify_p_pc_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
     }
-    else {
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, PCONST(2));
 
-        if (PMC_IS_NULL(ns)) {
-            PREG(1) = PMCNULL;
-        }
-        else {
-            PREG(1) = Parrot_ns_find_global_from_op(interp, ns, SCONST(3),  cur_opcode + 4);
-        }
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
 
+opcode_t *
+Parrot_vivify_p_p_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_global_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+Parrot_vivify_p_pc_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, cur_ns, SREG(1), PREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
+Parrot_vivify_p_p_ic_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, cur_ns, SCONST(1), PREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+Parrot_vivify_p_pc_ic_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
-    return cur_opcode + 4;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+Parrot_vivify_p_p_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
-    return cur_opcode + 4;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PREG(1));
+Parrot_vivify_p_pc_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
-    return cur_opcode + 4;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  cur_ns = Parrot_pcc_get_namespace(interp, CURRENT_CONTEXT(interp));
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, cur_ns, PCONST(1));
+Parrot_vivify_p_p_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
-    return cur_opcode + 4;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_hll_global_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+Parrot_vivify_p_pc_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, hll_ns, SREG(1), PREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_hll_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
+Parrot_vivify_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, hll_ns, SCONST(1), PREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_hll_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+Parrot_vivify_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
-    return cur_opcode + 4;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_hll_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+Parrot_vivify_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
-    return cur_opcode + 4;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_hll_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PREG(1));
+Parrot_vivify_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
-    return cur_opcode + 4;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_hll_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  hll_ns = Parrot_hll_get_ctx_HLL_namespace(interp);
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, hll_ns, PCONST(1));
+Parrot_vivify_p_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
-    return cur_opcode + 4;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_root_global_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
+Parrot_vivify_p_pc_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, root_ns, SREG(1), PREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_root_global_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
+Parrot_vivify_p_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, root_ns, SCONST(1), PREG(2));
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_root_global_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+Parrot_vivify_p_pc_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
+    if (PMC_IS_NULL(PREG(1))) {
+        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+    }
 
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
-    return cur_opcode + 4;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
 }
 
 opcode_t *
-Parrot_set_root_global_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
+Parrot_new_p_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
 
-    Parrot_ns_set_global(interp, ns, SREG(2), PREG(3));
-    return cur_opcode + 4;
-}
+    if (!PMC_IS_NULL(_class)) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
 
-opcode_t *
-Parrot_set_root_global_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PREG(1));
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
 
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
-    return cur_opcode + 4;
-}
+        if (type <= 0) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
 
-opcode_t *
-Parrot_set_root_global_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  root_ns = interp->root_namespace;
-    PMC  * const  ns = Parrot_ns_make_namespace_keyed(interp, root_ns, PCONST(1));
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-    Parrot_ns_set_global(interp, ns, SCONST(2), PREG(3));
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_name_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (!SREG(2)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Tried to find null name");
+Parrot_new_p_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
 
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)handler;
+    if (!PMC_IS_NULL(_class)) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, IREG(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
     }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
 
-    PREG(1) = Parrot_ns_find_named_item(interp, SREG(2),  cur_opcode + 3);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
-}
+        if (type <= 0) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
 
-opcode_t *
-Parrot_find_name_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    if (!SCONST(2)) {
-        opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_INVALID_OPERATION, "Tried to find null name");
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-        PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-        return (opcode_t *)handler;
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
     }
 
-    PREG(1) = Parrot_ns_find_named_item(interp, SCONST(2),  cur_opcode + 3);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_sub_not_null_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * const  dest =  cur_opcode + 3;
-    PMC       * const  sub = Parrot_ns_find_named_item(interp, SREG(2), dest);
+Parrot_new_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  name = SREG(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
 
-    if (PMC_IS_NULL(sub)) {
-        opcode_t  * handler;
+    if (!PMC_IS_NULL(_class)) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if (type <= 0) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
 
-        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
-        handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_GLOBAL_NOT_FOUND, "Could not find sub %Ss", SREG(2));
-        {
             PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)handler;
+            return (opcode_t *)dest;
         }
 
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
     }
 
-    PREG(1) = sub;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_find_sub_not_null_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  * const  dest =  cur_opcode + 3;
-    PMC       * const  sub = Parrot_ns_find_named_item(interp, SCONST(2), dest);
+Parrot_new_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    STRING  * const  name = SCONST(2);
+    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
 
-    if (PMC_IS_NULL(sub)) {
-        opcode_t  * handler;
+    if (!PMC_IS_NULL(_class)) {
+        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+        VTABLE_set_integer_native(interp, initial, ICONST(3));
+        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    }
+    else {
+        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+
+        if (type <= 0) {
+            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
 
-        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
-        handler = Parrot_ex_throw_from_op_args(interp, dest, EXCEPTION_GLOBAL_NOT_FOUND, "Could not find sub %Ss", SCONST(2));
-        {
             PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)handler;
+            return (opcode_t *)dest;
         }
 
+        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
     }
 
-    PREG(1) = sub;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 3;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_trap(opcode_t *cur_opcode, PARROT_INTERP) {
-    UNUSED(interp);
-    #if defined(__GNUC__) && (defined(i386) || defined(__x86_64__)) && !defined(sun)
-        __asm__("int3");
+Parrot_new_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
 
-#endif
-;
-    #if defined(__GNUC__) && defined(PPC)
-        __asm__("trap");
+    if (type > enum_class_core_max) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
 
-#endif
-;
-    return cur_opcode + 1;
-}
+        if (!PMC_IS_NULL(_class)) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
 
-opcode_t *
-Parrot_set_label_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    VTABLE_set_pointer(interp, PREG(1), ((CUR_OPCODE + ICONST(2))));
-    return cur_opcode + 3;
-}
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
 
-opcode_t *
-Parrot_get_label_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    void  * const  ptr = VTABLE_get_pointer(interp, PREG(2));
+    }
+    else {
+        if (type > enum_class_default) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
-    IREG(1) = PTR2INTVAL(ptr);
-    return cur_opcode + 3;
-}
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-opcode_t *
-Parrot_get_id_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_hash_pointer((void *)PREG(2), interp->hash_seed);
-    return cur_opcode + 3;
-}
+    }
 
-opcode_t *
-Parrot_get_id_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    IREG(1) = Parrot_hash_pointer((void *)PCONST(2), interp->hash_seed);
-    return cur_opcode + 3;
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+Parrot_new_p_pc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if (type > enum_class_core_max) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if (!PMC_IS_NULL(_class)) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
     }
+    else {
+        if (type > enum_class_default) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-opcode_t *
-Parrot_fetch_p_pc_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-    }
+Parrot_new_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+    if (type > enum_class_core_max) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
 
-opcode_t *
-Parrot_fetch_p_pc_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-    }
+        if (!PMC_IS_NULL(_class)) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
 
-opcode_t *
-Parrot_fetch_p_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
+    else {
+        if (type > enum_class_default) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-opcode_t *
-Parrot_fetch_p_pc_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+Parrot_new_p_pc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if (type > enum_class_core_max) {
+        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+
+        if (!PMC_IS_NULL(_class)) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
     }
+    else {
+        if (type > enum_class_default) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-opcode_t *
-Parrot_fetch_p_pc_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_p_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+Parrot_root_new_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if (type > enum_class_core_max) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if (!PMC_IS_NULL(_class)) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
     }
+    else {
+        if (type > enum_class_default) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-opcode_t *
-Parrot_fetch_p_pc_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_p_ic_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
+Parrot_root_new_p_pc_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if (type > enum_class_core_max) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if (!PMC_IS_NULL(_class)) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, IREG(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
     }
+    else {
+        if (type > enum_class_default) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-opcode_t *
-Parrot_fetch_p_pc_ic_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_p_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+Parrot_root_new_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const   name_key = PREG(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if (type > enum_class_core_max) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if (!PMC_IS_NULL(_class)) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
     }
+    else {
+        if (type > enum_class_default) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-opcode_t *
-Parrot_fetch_p_pc_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_p_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+Parrot_root_new_p_pc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const   name_key = PCONST(2);
+    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+
+    if (type > enum_class_core_max) {
+        PMC  * const  root_ns = interp->root_namespace;
+        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
+        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+
+        if (!PMC_IS_NULL(_class)) {
+            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+
+            VTABLE_set_integer_native(interp, initial, ICONST(3));
+            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+        }
+
     }
+    else {
+        if (type > enum_class_default) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        }
+        else {
+            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+            return (opcode_t *)dest;
+        }
 
-opcode_t *
-Parrot_fetch_p_pc_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-    }
-
+Parrot_get_context_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = CURRENT_CONTEXT(interp);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_fetch_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-    }
-
+Parrot_new_call_context_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_pcc_new_call_object(interp);
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_fetch_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-    }
+Parrot_invokecc_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC       * const  p = PREG(1);
+    opcode_t  * dest =  cur_opcode + 3;
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
+    Parrot_pcc_reuse_continuation(interp, CURRENT_CONTEXT(interp), dest);
+    dest = VTABLE_invoke(interp, p, dest);
+    return (opcode_t *)dest;
 }
 
 opcode_t *
-Parrot_fetch_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-    }
+Parrot_flatten_array_into_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  dest = PREG(1);
+    PMC  * const  src = PREG(2);
+    const INTVAL   overwrite = IREG(3);
+    INTVAL   i;
+    INTVAL   start_idx = overwrite ? 0 : VTABLE_elements(interp, dest);
+    INTVAL   src_elems = VTABLE_elements(interp, src);
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+    for (i = 0; (i < src_elems); (i++)) {
+        PMC  * const  val = VTABLE_get_pmc_keyed_int(interp, dest, i);
 
-opcode_t *
-Parrot_fetch_p_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, dest, (i + start_idx), val);
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_pc_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-    }
+Parrot_flatten_array_into_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  dest = PREG(1);
+    PMC  * const  src = PREG(2);
+    const INTVAL   overwrite = ICONST(3);
+    INTVAL   i;
+    INTVAL   start_idx = overwrite ? 0 : VTABLE_elements(interp, dest);
+    INTVAL   src_elems = VTABLE_elements(interp, src);
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+    for (i = 0; (i < src_elems); (i++)) {
+        PMC  * const  val = VTABLE_get_pmc_keyed_int(interp, dest, i);
 
-opcode_t *
-Parrot_fetch_p_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
+        VTABLE_set_pmc_keyed_int(interp, dest, (i + start_idx), val);
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_fetch_p_pc_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-    }
+Parrot_flatten_hash_into_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  dest = PREG(1);
+    PMC  * const  src = PREG(2);
+    const INTVAL   overwrite = IREG(3);
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    Parrot_hash_flatten_hash_into(interp, dest, src, overwrite);
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_vivify_p_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
-    }
+Parrot_flatten_hash_into_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  dest = PREG(1);
+    PMC  * const  src = PREG(2);
+    const INTVAL   overwrite = ICONST(3);
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    Parrot_hash_flatten_hash_into(interp, dest, src, overwrite);
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_vivify_p_pc_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
-    }
+Parrot_slurp_array_from_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  dest = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PMC  * const  src = PREG(2);
+    const INTVAL   src_elems = VTABLE_elements(interp, src);
+    INTVAL   i;
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+    for (i = IREG(3); (i < src_elems); (i++)) {
+        PMC  * const  value = VTABLE_get_pmc_keyed_int(interp, src, i);
 
-opcode_t *
-Parrot_vivify_p_p_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
+        VTABLE_push_pmc(interp, src, value);
     }
 
+    PREG(1) = dest;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_vivify_p_pc_pc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
-    }
+Parrot_slurp_array_from_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  dest = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    PMC  * const  src = PREG(2);
+    const INTVAL   src_elems = VTABLE_elements(interp, src);
+    INTVAL   i;
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+    for (i = ICONST(3); (i < src_elems); (i++)) {
+        PMC  * const  value = VTABLE_get_pmc_keyed_int(interp, src, i);
 
-opcode_t *
-Parrot_vivify_p_p_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed(interp, PREG(2), PREG(3), PREG(1));
+        VTABLE_push_pmc(interp, src, value);
     }
 
+    PREG(1) = dest;
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_vivify_p_pc_p_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed(interp, PCONST(2), PREG(3), PREG(1));
-    }
+Parrot_receive_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  *const  dest =  cur_opcode + 2;
+    PMC  * cur_task = Parrot_cx_current_task(interp);
+    Parrot_Task_attributes  * tdata = PARROT_TASK(cur_task);
+    int   msg_count;
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+    if (tdata->partner) {
+        Parrot_Task_attributes  * const  pdata = PARROT_TASK(tdata->partner);
 
-opcode_t *
-Parrot_vivify_p_p_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PREG(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed(interp, PREG(2), PCONST(3), PREG(1));
-    }
+        LOCK(pdata->mailbox_lock);
+        Parrot_block_GC_mark(interp);
+        if (PMC_IS_NULL(pdata->mailbox)) {
+            msg_count = 0;
+        }
+        else {
+            msg_count = VTABLE_elements(interp, pdata->mailbox);
+        }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+        if (msg_count > 0) {
+            PREG(1) = VTABLE_shift_pmc(pdata->interp, pdata->mailbox);
+            Parrot_unblock_GC_mark(interp);
+            UNLOCK(pdata->mailbox_lock);
+            {
+                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+                return (opcode_t *)dest;
+            }
+
+        }
+        else {
+            Parrot_unblock_GC_mark(interp);
+            TASK_recv_block_SET(cur_task);
+            (void)Parrot_cx_stop_task(interp, cur_opcode);
+            UNLOCK(pdata->mailbox_lock);
+            {
+                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+                return (opcode_t *)0;
+            }
+
+        }
 
-opcode_t *
-Parrot_vivify_p_pc_pc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed(interp, PCONST(2), PCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed(interp, PCONST(2), PCONST(3), PREG(1));
     }
+    else {
+        if (PMC_IS_NULL(tdata->mailbox)) {
+            msg_count = 0;
+        }
+        else {
+            msg_count = VTABLE_elements(interp, tdata->mailbox);
+        }
+
+        if (msg_count > 0) {
+            PREG(1) = VTABLE_shift_pmc(interp, tdata->mailbox);
+            {
+                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+                return (opcode_t *)dest;
+            }
+
+        }
+        else {
+            TASK_recv_block_SET(cur_task);
+            (void)Parrot_cx_stop_task(interp, cur_opcode);
+            {
+                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+                return (opcode_t *)0;
+            }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+        }
 
-opcode_t *
-Parrot_vivify_p_p_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_vivify_p_pc_i_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
+Parrot_wait_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  *const  next =  cur_opcode + 2;
+    PMC  * task = PREG(1);
+    PMC  * cur_task;
+    Parrot_Task_attributes  * tdata;
+
+    if (!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task"))) {
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task");
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+    tdata = PARROT_TASK(task);
+    LOCK(tdata->waiters_lock);
+    if (tdata->killed) {
+        UNLOCK(tdata->waiters_lock);
+        return (opcode_t *)next;
+    }
 
-opcode_t *
-Parrot_vivify_p_p_ic_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
+    cur_task = Parrot_cx_stop_task(interp, next);
+    if (PMC_IS_NULL(tdata->waiters)) {
+        tdata->waiters = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        PARROT_GC_WRITE_BARRIER(interp, task);
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    VTABLE_push_pmc(interp, tdata->waiters, cur_task);
+    UNLOCK(tdata->waiters_lock);
+    return (opcode_t *)0;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_vivify_p_pc_ic_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
+Parrot_wait_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  *const  next =  cur_opcode + 2;
+    PMC  * task = PCONST(1);
+    PMC  * cur_task;
+    Parrot_Task_attributes  * tdata;
+
+    if (!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task"))) {
+        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task");
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+    tdata = PARROT_TASK(task);
+    LOCK(tdata->waiters_lock);
+    if (tdata->killed) {
+        UNLOCK(tdata->waiters_lock);
+        return (opcode_t *)next;
+    }
 
-opcode_t *
-Parrot_vivify_p_p_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed_int(interp, PREG(2), IREG(3), PREG(1));
+    cur_task = Parrot_cx_stop_task(interp, next);
+    if (PMC_IS_NULL(tdata->waiters)) {
+        tdata->waiters = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+        PARROT_GC_WRITE_BARRIER(interp, task);
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    VTABLE_push_pmc(interp, tdata->waiters, cur_task);
+    UNLOCK(tdata->waiters_lock);
+    return (opcode_t *)0;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_vivify_p_pc_i_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), IREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed_int(interp, PCONST(2), IREG(3), PREG(1));
-    }
+Parrot_pass(opcode_t *cur_opcode, PARROT_INTERP) {
+    opcode_t  *const  next =  cur_opcode + 1;
+    opcode_t  *const  addr = Parrot_cx_preempt_task(interp, interp->scheduler, next);
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return (opcode_t *)addr;
+    return cur_opcode + 1;
 }
 
 opcode_t *
-Parrot_vivify_p_p_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PREG(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed_int(interp, PREG(2), ICONST(3), PREG(1));
-    }
-
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+Parrot_disable_preemption(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_cx_disable_preemption(interp);
+    return cur_opcode + 1;
 }
 
 opcode_t *
-Parrot_vivify_p_pc_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_int(interp, PCONST(2), ICONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed_int(interp, PCONST(2), ICONST(3), PREG(1));
-    }
+Parrot_enable_preemption(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_cx_enable_preemption(interp);
+    return cur_opcode + 1;
+}
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+opcode_t *
+Parrot_terminate(opcode_t *cur_opcode, PARROT_INTERP) {
+    UNUSED(interp);
+    UNUSED(cur_opcode);
+    return (opcode_t *)0;
+    return cur_opcode + 1;
 }
 
 opcode_t *
-Parrot_vivify_p_p_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+Parrot_find_lex_slot_p_sc_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
+
+    if (!PMC_IS_NULL(ctx)) {
+        PREG(1) = CTX_REG_PMC(interp, ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SCONST(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
+
+        PREG(1) = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_vivify_p_pc_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+Parrot_find_lex_slot_s_sc_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
+
+    if (!PMC_IS_NULL(ctx)) {
+        SREG(1) = CTX_REG_STR(interp, ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SCONST(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
+
+        SREG(1) = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
     }
 
     PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_vivify_p_p_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+Parrot_find_lex_slot_i_sc_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
+
+    if (!PMC_IS_NULL(ctx)) {
+        IREG(1) = CTX_REG_INT(interp, ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SCONST(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
+
+        IREG(1) = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_vivify_p_pc_sc_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PREG(4));
-        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+Parrot_find_lex_slot_n_sc_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
+
+    if (!PMC_IS_NULL(ctx)) {
+        NREG(1) = CTX_REG_NUM(interp, ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SCONST(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
+
+        NREG(1) = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_vivify_p_p_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed_str(interp, PREG(2), SREG(3), PREG(1));
+Parrot_store_lex_slot_sc_p_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
+
+    if (!PMC_IS_NULL(ctx)) {
+        PARROT_GC_WRITE_BARRIER(interp, ctx);
+        CTX_REG_PMC(interp, ctx, ICONST(4)) = PREG(2);
     }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-opcode_t *
-Parrot_vivify_p_pc_s_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SREG(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SREG(3), PREG(1));
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_vivify_p_p_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PREG(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed_str(interp, PREG(2), SCONST(3), PREG(1));
+Parrot_store_lex_slot_sc_s_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
+
+    if (!PMC_IS_NULL(ctx)) {
+        PARROT_GC_WRITE_BARRIER(interp, ctx);
+        CTX_REG_STR(interp, ctx, ICONST(4)) = SREG(2);
     }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
-}
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-opcode_t *
-Parrot_vivify_p_pc_sc_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = VTABLE_get_pmc_keyed_str(interp, PCONST(2), SCONST(3));
-    if (PMC_IS_NULL(PREG(1))) {
-        PREG(1) = Parrot_pmc_new_from_type(interp, PCONST(4));
-        VTABLE_set_pmc_keyed_str(interp, PCONST(2), SCONST(3), PREG(1));
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 5;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_new_p_s_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  name = SREG(2);
-    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+Parrot_store_lex_slot_sc_sc_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
 
-    if (!PMC_IS_NULL(_class)) {
-        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-
-        VTABLE_set_integer_native(interp, initial, IREG(3));
-        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    if (!PMC_IS_NULL(ctx)) {
+        PARROT_GC_WRITE_BARRIER(interp, ctx);
+        CTX_REG_STR(interp, ctx, ICONST(4)) = SCONST(2);
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
 
-        if (type <= 0) {
-            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            return (opcode_t *)handler;
         }
 
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_new_p_sc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  name = SCONST(2);
-    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
-
-    if (!PMC_IS_NULL(_class)) {
-        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+Parrot_store_lex_slot_sc_i_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
 
-        VTABLE_set_integer_native(interp, initial, IREG(3));
-        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    if (!PMC_IS_NULL(ctx)) {
+        CTX_REG_INT(interp, ctx, ICONST(4)) = IREG(2);
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
 
-        if (type <= 0) {
-            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            return (opcode_t *)handler;
         }
 
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_new_p_s_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  name = SREG(2);
-    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
+Parrot_store_lex_slot_sc_ic_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
 
-    if (!PMC_IS_NULL(_class)) {
-        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-
-        VTABLE_set_integer_native(interp, initial, ICONST(3));
-        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    if (!PMC_IS_NULL(ctx)) {
+        CTX_REG_INT(interp, ctx, ICONST(4)) = ICONST(2);
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
 
-        if (type <= 0) {
-            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            return (opcode_t *)handler;
         }
 
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_new_p_sc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    STRING  * const  name = SCONST(2);
-    PMC     * const  _class = Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp)) ? Parrot_oo_get_class_str(interp, name) : PMCNULL;
-
-    if (!PMC_IS_NULL(_class)) {
-        PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+Parrot_store_lex_slot_sc_n_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
 
-        VTABLE_set_integer_native(interp, initial, ICONST(3));
-        PREG(1) = VTABLE_instantiate(interp, _class, initial);
+    if (!PMC_IS_NULL(ctx)) {
+        CTX_REG_NUM(interp, ctx, ICONST(4)) = NREG(2);
     }
     else {
-        const INTVAL   type = Parrot_pmc_get_type_str(interp, name);
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
 
-        if (type <= 0) {
-            opcode_t  * dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", name);
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            return (opcode_t *)handler;
         }
 
-        PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 6;
 }
 
 opcode_t *
-Parrot_new_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const   name_key = PREG(2);
-    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+Parrot_store_lex_slot_sc_nc_ic_ic_pc(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = Parrot_sub_find_indexed_ctx(interp, CURRENT_CONTEXT(interp), ICONST(3), PCONST(5));
 
-    if (type > enum_class_core_max) {
-        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+    if (!PMC_IS_NULL(ctx)) {
+        CTX_REG_NUM(interp, ctx, ICONST(4)) = NCONST(2);
+    }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, CURRENT_CONTEXT(interp));
 
-        if (!PMC_IS_NULL(_class)) {
-            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
 
-            VTABLE_set_integer_native(interp, initial, IREG(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
+            return (opcode_t *)handler;
         }
 
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
+    }
+
+    return cur_opcode + 6;
+}
+
+opcode_t *
+Parrot_add_int_int_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(2))) || (!QUICK_INTEGER(PREG(3)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
     else {
-        if (type > enum_class_default) {
-            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        const INTVAL   a = PARROT_INTEGER(PREG(2))->iv;
+        const INTVAL   b = PARROT_INTEGER(PREG(3))->iv;
+        const INTVAL   c = (a + b);
+
+        if ((((c ^ a)) >= 0) || (((c ^ b)) >= 0)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, enum_class_Integer, c);
         }
         else {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
-
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            PREG(1) = VTABLE_add(interp, PREG(2), PREG(3), PREG(1));
         }
 
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_new_p_pc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const   name_key = PCONST(2);
-    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
-
-    if (type > enum_class_core_max) {
-        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
-
-        if (!PMC_IS_NULL(_class)) {
-            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-
-            VTABLE_set_integer_native(interp, initial, IREG(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-
+Parrot_sub_int_int_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(2))) || (!QUICK_INTEGER(PREG(3)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
     else {
-        if (type > enum_class_default) {
-            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        const INTVAL   a = PARROT_INTEGER(PREG(2))->iv;
+        const INTVAL   b = PARROT_INTEGER(PREG(3))->iv;
+        const INTVAL   c = (a - b);
+
+        if ((((c ^ a)) >= 0) || (((c ^ (~b))) >= 0)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, enum_class_Integer, c);
         }
         else {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
-
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            PREG(1) = VTABLE_subtract(interp, PREG(2), PREG(3), PREG(1));
         }
 
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_new_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const   name_key = PREG(2);
-    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+Parrot_mul_int_int_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(2))) || (!QUICK_INTEGER(PREG(3)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+    else {
+        const INTVAL   a = PARROT_INTEGER(PREG(2))->iv;
+        const INTVAL   b = PARROT_INTEGER(PREG(3))->iv;
+        const INTVAL   c = (a * b);
+        const double   cf = ((double)a * (double)b);
 
-    if (type > enum_class_core_max) {
-        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+        if ((double)c == cf) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, enum_class_Integer, c);
+        }
+        else {
+            PREG(1) = VTABLE_multiply(interp, PREG(2), PREG(3), PREG(1));
+        }
 
-        if (!PMC_IS_NULL(_class)) {
-            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+    }
 
-            VTABLE_set_integer_native(interp, initial, ICONST(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
+    return cur_opcode + 4;
+}
 
+opcode_t *
+Parrot_mod_int_int_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(2))) || (!QUICK_INTEGER(PREG(3)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
     else {
-        if (type > enum_class_default) {
-            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        const INTVAL   m = PARROT_INTEGER(PREG(2))->iv;
+        const INTVAL   d = PARROT_INTEGER(PREG(3))->iv;
+
+        if ((m > 0) && (d > 0)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, enum_class_Integer, (m % d));
         }
         else {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
-
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            PREG(1) = VTABLE_modulus(interp, PREG(2), PREG(3), PREG(1));
         }
 
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_new_p_pc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const   name_key = PCONST(2);
-    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+Parrot_add_int_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(2))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+    else {
+        const INTVAL   a = PARROT_INTEGER(PREG(2))->iv;
+        const INTVAL   b = IREG(3);
+        const INTVAL   c = (a + b);
 
-    if (type > enum_class_core_max) {
-        PMC  * const  _class = Parrot_oo_get_class(interp, name_key);
+        if ((((c ^ a)) >= 0) || (((c ^ b)) >= 0)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, enum_class_Integer, c);
+        }
+        else {
+            PREG(1) = VTABLE_add_int(interp, PREG(2), b, PREG(1));
+        }
 
-        if (!PMC_IS_NULL(_class)) {
-            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+    }
 
-            VTABLE_set_integer_native(interp, initial, ICONST(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
+    return cur_opcode + 4;
+}
 
+opcode_t *
+Parrot_add_int_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(2))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
     else {
-        if (type > enum_class_default) {
-            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        const INTVAL   a = PARROT_INTEGER(PREG(2))->iv;
+        const INTVAL   b = ICONST(3);
+        const INTVAL   c = (a + b);
+
+        if ((((c ^ a)) >= 0) || (((c ^ b)) >= 0)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, enum_class_Integer, c);
         }
         else {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
-
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            PREG(1) = VTABLE_add_int(interp, PREG(2), b, PREG(1));
         }
 
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_root_new_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const   name_key = PREG(2);
-    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
+Parrot_sub_int_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(2))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+    else {
+        const INTVAL   a = PARROT_INTEGER(PREG(2))->iv;
+        const INTVAL   b = IREG(3);
+        const INTVAL   c = (a - b);
 
-    if (type > enum_class_core_max) {
-        PMC  * const  root_ns = interp->root_namespace;
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
-        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+        if ((((c ^ a)) >= 0) || (((c ^ (~b))) >= 0)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, enum_class_Integer, c);
+        }
+        else {
+            PREG(1) = VTABLE_subtract_int(interp, PREG(2), b, PREG(1));
+        }
 
-        if (!PMC_IS_NULL(_class)) {
-            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+    }
 
-            VTABLE_set_integer_native(interp, initial, IREG(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
+    return cur_opcode + 4;
+}
 
+opcode_t *
+Parrot_sub_int_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(2))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
     else {
-        if (type > enum_class_default) {
-            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
+        const INTVAL   a = PARROT_INTEGER(PREG(2))->iv;
+        const INTVAL   b = ICONST(3);
+        const INTVAL   c = (a - b);
+
+        if ((((c ^ a)) >= 0) || (((c ^ (~b))) >= 0)) {
+            PREG(1) = Parrot_pmc_new_init_int(interp, enum_class_Integer, c);
         }
         else {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
-
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            PREG(1) = VTABLE_subtract_int(interp, PREG(2), b, PREG(1));
         }
 
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_root_new_p_pc_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const   name_key = PCONST(2);
-    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
-
-    if (type > enum_class_core_max) {
-        PMC  * const  root_ns = interp->root_namespace;
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
-        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+Parrot_add_num_num_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_FLOAT(PREG(2))) || (!QUICK_FLOAT(PREG(3)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+    else {
+        PMC  * const  dest = Parrot_pmc_new(interp, enum_class_Float);
 
-        if (!PMC_IS_NULL(_class)) {
-            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        PARROT_FLOAT(dest)->fv = (PARROT_FLOAT(PREG(2))->fv + PARROT_FLOAT(PREG(3))->fv);
+        PREG(1) = dest;
+    }
 
-            VTABLE_set_integer_native(interp, initial, IREG(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
+    return cur_opcode + 4;
+}
 
+opcode_t *
+Parrot_sub_num_num_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_FLOAT(PREG(2))) || (!QUICK_FLOAT(PREG(3)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
     else {
-        if (type > enum_class_default) {
-            PREG(1) = Parrot_pmc_new_init_int(interp, type, IREG(3));
-        }
-        else {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
-
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
-        }
+        PMC  * const  dest = Parrot_pmc_new(interp, enum_class_Float);
 
+        PARROT_FLOAT(dest)->fv = (PARROT_FLOAT(PREG(2))->fv - PARROT_FLOAT(PREG(3))->fv);
+        PREG(1) = dest;
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_root_new_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const   name_key = PREG(2);
-    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
-
-    if (type > enum_class_core_max) {
-        PMC  * const  root_ns = interp->root_namespace;
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
-        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
+Parrot_mul_num_num_p_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_FLOAT(PREG(2))) || (!QUICK_FLOAT(PREG(3)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+    else {
+        PMC  * const  dest = Parrot_pmc_new(interp, enum_class_Float);
 
-        if (!PMC_IS_NULL(_class)) {
-            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
+        PARROT_FLOAT(dest)->fv = (PARROT_FLOAT(PREG(2))->fv * PARROT_FLOAT(PREG(3))->fv);
+        PREG(1) = dest;
+    }
 
-            VTABLE_set_integer_native(interp, initial, ICONST(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
+    return cur_opcode + 4;
+}
 
+opcode_t *
+Parrot_inc_int_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
     else {
-        if (type > enum_class_default) {
-            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        const INTVAL   a = PARROT_INTEGER(PREG(1))->iv;
+
+        if (a != PARROT_INTVAL_MAX) {
+            PARROT_INTEGER(PREG(1))->iv = (a + 1);
+            PARROT_GC_WRITE_BARRIER(interp, PREG(1));
         }
         else {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
-
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            VTABLE_increment(interp, PREG(1));
         }
 
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_root_new_p_pc_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const   name_key = PCONST(2);
-    const INTVAL   type = Parrot_pmc_get_type(interp, name_key);
-
-    if (type > enum_class_core_max) {
-        PMC  * const  root_ns = interp->root_namespace;
-        PMC  * const  ns = Parrot_ns_get_namespace_keyed(interp, root_ns, name_key);
-        PMC  * const  _class = Parrot_oo_get_class(interp, ns);
-
-        if (!PMC_IS_NULL(_class)) {
-            PMC  * const  initial = Parrot_pmc_new(interp, Parrot_hll_get_ctx_HLL_type(interp, enum_class_Integer));
-
-            VTABLE_set_integer_native(interp, initial, ICONST(3));
-            PREG(1) = VTABLE_instantiate(interp, _class, initial);
-        }
-
+Parrot_dec_int_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
     else {
-        if (type > enum_class_default) {
-            PREG(1) = Parrot_pmc_new_init_int(interp, type, ICONST(3));
+        const INTVAL   a = PARROT_INTEGER(PREG(1))->iv;
+
+        if (a != PARROT_INTVAL_MIN) {
+            PARROT_INTEGER(PREG(1))->iv = (a - 1);
+            PARROT_GC_WRITE_BARRIER(interp, PREG(1));
         }
         else {
-            opcode_t  * const  dest = Parrot_ex_throw_from_op_args(interp,  cur_opcode + 4, EXCEPTION_NO_CLASS, "Class '%Ss' not found", VTABLE_get_repr(interp, name_key));
-
-            PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-            return (opcode_t *)dest;
+            VTABLE_decrement(interp, PREG(1));
         }
 
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 4;
+    return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_get_context_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = CURRENT_CONTEXT(interp);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_inc_num_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_FLOAT(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+
+    (PARROT_FLOAT(PREG(1))->fv += 1.0);
+    PARROT_GC_WRITE_BARRIER(interp, PREG(1));
     return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_new_call_context_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PREG(1) = Parrot_pcc_new_call_object(interp);
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+Parrot_dec_num_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_FLOAT(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+
+    (PARROT_FLOAT(PREG(1))->fv -= 1.0);
+    PARROT_GC_WRITE_BARRIER(interp, PREG(1));
     return cur_opcode + 2;
 }
 
 opcode_t *
-Parrot_invokecc_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC       * const  p = PREG(1);
-    opcode_t  * dest =  cur_opcode + 3;
+Parrot_eq_int_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-    Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), dest);
-    Parrot_pcc_reuse_continuation(interp, CURRENT_CONTEXT(interp), dest);
-    dest = VTABLE_invoke(interp, p, dest);
-    return (opcode_t *)dest;
+    if (PARROT_INTEGER(PREG(1))->iv == IREG(2)) {
+        return cur_opcode + ICONST(3);
+    }
+
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_flatten_array_into_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  dest = PREG(1);
-    PMC  * const  src = PREG(2);
-    const INTVAL   overwrite = IREG(3);
-    INTVAL   i;
-    INTVAL   start_idx = overwrite ? 0 : VTABLE_elements(interp, dest);
-    INTVAL   src_elems = VTABLE_elements(interp, src);
-
-    for (i = 0; (i < src_elems); (i++)) {
-        PMC  * const  val = VTABLE_get_pmc_keyed_int(interp, dest, i);
+Parrot_eq_int_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-        VTABLE_set_pmc_keyed_int(interp, dest, (i + start_idx), val);
+    if (PARROT_INTEGER(PREG(1))->iv == ICONST(2)) {
+        return cur_opcode + ICONST(3);
     }
 
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_flatten_array_into_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  dest = PREG(1);
-    PMC  * const  src = PREG(2);
-    const INTVAL   overwrite = ICONST(3);
-    INTVAL   i;
-    INTVAL   start_idx = overwrite ? 0 : VTABLE_elements(interp, dest);
-    INTVAL   src_elems = VTABLE_elements(interp, src);
-
-    for (i = 0; (i < src_elems); (i++)) {
-        PMC  * const  val = VTABLE_get_pmc_keyed_int(interp, dest, i);
+Parrot_ne_int_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-        VTABLE_set_pmc_keyed_int(interp, dest, (i + start_idx), val);
+    if (PARROT_INTEGER(PREG(1))->iv != IREG(2)) {
+        return cur_opcode + ICONST(3);
     }
 
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_flatten_hash_into_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  dest = PREG(1);
-    PMC  * const  src = PREG(2);
-    const INTVAL   overwrite = IREG(3);
+Parrot_ne_int_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+
+    if (PARROT_INTEGER(PREG(1))->iv != ICONST(2)) {
+        return cur_opcode + ICONST(3);
+    }
 
-    Parrot_hash_flatten_hash_into(interp, dest, src, overwrite);
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_flatten_hash_into_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  dest = PREG(1);
-    PMC  * const  src = PREG(2);
-    const INTVAL   overwrite = ICONST(3);
+Parrot_lt_int_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+
+    if (PARROT_INTEGER(PREG(1))->iv < IREG(2)) {
+        return cur_opcode + ICONST(3);
+    }
 
-    Parrot_hash_flatten_hash_into(interp, dest, src, overwrite);
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_slurp_array_from_p_p_i(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  dest = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
-    PMC  * const  src = PREG(2);
-    const INTVAL   src_elems = VTABLE_elements(interp, src);
-    INTVAL   i;
-
-    for (i = IREG(3); (i < src_elems); (i++)) {
-        PMC  * const  value = VTABLE_get_pmc_keyed_int(interp, src, i);
+Parrot_lt_int_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-        VTABLE_push_pmc(interp, src, value);
+    if (PARROT_INTEGER(PREG(1))->iv < ICONST(2)) {
+        return cur_opcode + ICONST(3);
     }
 
-    PREG(1) = dest;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_slurp_array_from_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  dest = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
-    PMC  * const  src = PREG(2);
-    const INTVAL   src_elems = VTABLE_elements(interp, src);
-    INTVAL   i;
-
-    for (i = ICONST(3); (i < src_elems); (i++)) {
-        PMC  * const  value = VTABLE_get_pmc_keyed_int(interp, src, i);
+Parrot_le_int_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-        VTABLE_push_pmc(interp, src, value);
+    if (PARROT_INTEGER(PREG(1))->iv <= IREG(2)) {
+        return cur_opcode + ICONST(3);
     }
 
-    PREG(1) = dest;
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
     return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_receive_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  *const  dest =  cur_opcode + 2;
-    PMC  * cur_task = Parrot_cx_current_task(interp);
-    Parrot_Task_attributes  * tdata = PARROT_TASK(cur_task);
-    int   msg_count;
+Parrot_le_int_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-    if (tdata->partner) {
-        Parrot_Task_attributes  * const  pdata = PARROT_TASK(tdata->partner);
+    if (PARROT_INTEGER(PREG(1))->iv <= ICONST(2)) {
+        return cur_opcode + ICONST(3);
+    }
 
-        LOCK(pdata->mailbox_lock);
-        Parrot_block_GC_mark(interp);
-        if (PMC_IS_NULL(pdata->mailbox)) {
-            msg_count = 0;
-        }
-        else {
-            msg_count = VTABLE_elements(interp, pdata->mailbox);
-        }
+    return cur_opcode + 4;
+}
 
-        if (msg_count > 0) {
-            PREG(1) = VTABLE_shift_pmc(pdata->interp, pdata->mailbox);
-            Parrot_unblock_GC_mark(interp);
-            UNLOCK(pdata->mailbox_lock);
-            {
-                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)dest;
-            }
+opcode_t *
+Parrot_gt_int_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-        }
-        else {
-            Parrot_unblock_GC_mark(interp);
-            TASK_recv_block_SET(cur_task);
-            (void)Parrot_cx_stop_task(interp, cur_opcode);
-            UNLOCK(pdata->mailbox_lock);
-            {
-                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)0;
-            }
+    if (PARROT_INTEGER(PREG(1))->iv > IREG(2)) {
+        return cur_opcode + ICONST(3);
+    }
 
-        }
+    return cur_opcode + 4;
+}
 
+opcode_t *
+Parrot_gt_int_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
-    else {
-        if (PMC_IS_NULL(tdata->mailbox)) {
-            msg_count = 0;
-        }
-        else {
-            msg_count = VTABLE_elements(interp, tdata->mailbox);
-        }
 
-        if (msg_count > 0) {
-            PREG(1) = VTABLE_shift_pmc(interp, tdata->mailbox);
-            {
-                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)dest;
-            }
+    if (PARROT_INTEGER(PREG(1))->iv > ICONST(2)) {
+        return cur_opcode + ICONST(3);
+    }
 
-        }
-        else {
-            TASK_recv_block_SET(cur_task);
-            (void)Parrot_cx_stop_task(interp, cur_opcode);
-            {
-                PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-                return (opcode_t *)0;
-            }
+    return cur_opcode + 4;
+}
 
-        }
+opcode_t *
+Parrot_ge_int_p_i_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
+    if (PARROT_INTEGER(PREG(1))->iv >= IREG(2)) {
+        return cur_opcode + ICONST(3);
     }
 
-    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
-    return cur_opcode + 2;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_wait_p(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  *const  next =  cur_opcode + 2;
-    PMC  * task = PREG(1);
-    PMC  * cur_task;
-    Parrot_Task_attributes  * tdata;
+Parrot_ge_int_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if (!QUICK_INTEGER(PREG(1))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-    if (!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task"))) {
-        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task");
+    if (PARROT_INTEGER(PREG(1))->iv >= ICONST(2)) {
+        return cur_opcode + ICONST(3);
     }
 
-    tdata = PARROT_TASK(task);
-    LOCK(tdata->waiters_lock);
-    if (tdata->killed) {
-        UNLOCK(tdata->waiters_lock);
-        return (opcode_t *)next;
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_eq_int_int_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(1))) || (!QUICK_INTEGER(PREG(2)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
 
-    cur_task = Parrot_cx_stop_task(interp, next);
-    if (PMC_IS_NULL(tdata->waiters)) {
-        tdata->waiters = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
-        PARROT_GC_WRITE_BARRIER(interp, task);
+    if (PARROT_INTEGER(PREG(1))->iv == PARROT_INTEGER(PREG(2))->iv) {
+        return cur_opcode + ICONST(3);
     }
 
-    VTABLE_push_pmc(interp, tdata->waiters, cur_task);
-    UNLOCK(tdata->waiters_lock);
-    return (opcode_t *)0;
-    return cur_opcode + 2;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_wait_pc(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  *const  next =  cur_opcode + 2;
-    PMC  * task = PCONST(1);
-    PMC  * cur_task;
-    Parrot_Task_attributes  * tdata;
+Parrot_ne_int_int_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(1))) || (!QUICK_INTEGER(PREG(2)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-    if (!VTABLE_isa(interp, task, Parrot_str_new_constant(interp, "Task"))) {
-        Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION, "Argument to wait op must be a Task");
+    if (PARROT_INTEGER(PREG(1))->iv != PARROT_INTEGER(PREG(2))->iv) {
+        return cur_opcode + ICONST(3);
     }
 
-    tdata = PARROT_TASK(task);
-    LOCK(tdata->waiters_lock);
-    if (tdata->killed) {
-        UNLOCK(tdata->waiters_lock);
-        return (opcode_t *)next;
+    return cur_opcode + 4;
+}
+
+opcode_t *
+Parrot_lt_int_int_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(1))) || (!QUICK_INTEGER(PREG(2)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
     }
 
-    cur_task = Parrot_cx_stop_task(interp, next);
-    if (PMC_IS_NULL(tdata->waiters)) {
-        tdata->waiters = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
-        PARROT_GC_WRITE_BARRIER(interp, task);
+    if (PARROT_INTEGER(PREG(1))->iv < PARROT_INTEGER(PREG(2))->iv) {
+        return cur_opcode + ICONST(3);
     }
 
-    VTABLE_push_pmc(interp, tdata->waiters, cur_task);
-    UNLOCK(tdata->waiters_lock);
-    return (opcode_t *)0;
-    return cur_opcode + 2;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_pass(opcode_t *cur_opcode, PARROT_INTERP) {
-    opcode_t  *const  next =  cur_opcode + 1;
-    opcode_t  *const  addr = Parrot_cx_preempt_task(interp, interp->scheduler, next);
+Parrot_le_int_int_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(1))) || (!QUICK_INTEGER(PREG(2)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
 
-    return (opcode_t *)addr;
-    return cur_opcode + 1;
-}
+    if (PARROT_INTEGER(PREG(1))->iv <= PARROT_INTEGER(PREG(2))->iv) {
+        return cur_opcode + ICONST(3);
+    }
 
-opcode_t *
-Parrot_disable_preemption(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_cx_disable_preemption(interp);
-    return cur_opcode + 1;
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_enable_preemption(opcode_t *cur_opcode, PARROT_INTERP) {
-    Parrot_cx_enable_preemption(interp);
-    return cur_opcode + 1;
+Parrot_gt_int_int_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(1))) || (!QUICK_INTEGER(PREG(2)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+
+    if (PARROT_INTEGER(PREG(1))->iv > PARROT_INTEGER(PREG(2))->iv) {
+        return cur_opcode + ICONST(3);
+    }
+
+    return cur_opcode + 4;
 }
 
 opcode_t *
-Parrot_terminate(opcode_t *cur_opcode, PARROT_INTERP) {
-    UNUSED(interp);
-    UNUSED(cur_opcode);
-    return (opcode_t *)0;
-    return cur_opcode + 1;
+Parrot_ge_int_int_p_p_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    if ((!QUICK_INTEGER(PREG(1))) || (!QUICK_INTEGER(PREG(2)))) {
+        return (opcode_t *)Parrot_runcore_deopt_op(interp, CUR_OPCODE);
+    }
+
+    if (PARROT_INTEGER(PREG(1))->iv >= PARROT_INTEGER(PREG(2))->iv) {
+        return cur_opcode + ICONST(3);
+    }
+
+    return cur_opcode + 4;
 }
 
 
@@ -24959,7 +26400,7 @@ op_lib_t core_op_lib = {
   0,                                /* flags */
   PARROT_PBC_MAJOR,
   PARROT_PBC_MINOR,
-  1131,             /* op_count */
+  1175,             /* op_count */
   core_op_info_table,       /* op_info_table */
   core_op_func_table,       /* op_func_table */
   get_op          /* op_code() */ 
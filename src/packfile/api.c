@@ -2227,7 +2227,7 @@ compile_file(PARROT_INTERP, ARGIN(STRING *path), INTVAL is_pasm)
     else
         compiler = Parrot_interp_get_compiler(interp, CONST_STRING(interp, "PIR"));
     {
-        PMC * const pf_pmc = Parrot_interp_compile_file(interp, compiler, path);
+        PMC * const pf_pmc = Parrot_pf_cache_compile_file(interp, compiler, path);
         PMC * const pbc_cache = VTABLE_get_pmc_keyed_int(interp,
             interp->iglobals, IGLOBALS_LOADED_PBCS);
         PackFile * const pf = (PackFile*) VTABLE_get_pointer(interp, pf_pmc);
@@ -2768,9 +2768,9 @@ read_pbc_file_packfile(PARROT_INTERP, ARGIN(STRING * const fullname),
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
                 "Can't open %Ss, code %i", fullname, errno);
 
-    /* TODO: Who frees program_code? We don't do it here (And don't need to
-             if we've mmapped it. Figure out where this is handled and
-             document it here.
+    /* Nobody frees program_code unless it's mmapped: string constants of the
+       packfile point into it (see PFOPT_KEEP_SRC), so it has to stay around
+       as long as they may.
     */
 
 #ifndef PARROT_HAS_HEADER_SYSMAN
@@ -2796,7 +2796,9 @@ read_pbc_file_packfile(PARROT_INTERP, ARGIN(STRING * const fullname),
 #endif
 
     pf = Parrot_pf_new(interp, is_mapped);
-    pf->options = 0;
+
+    /* a mapping is unmapped when the packfile is destroyed */
+    pf->options = is_mapped ? PFOPT_NONE : PFOPT_KEEP_SRC;
 
     /* XXX -Wcast-align Need to check alignment for RISC, or memcpy */
     if (!Parrot_pf_unpack(interp, pf, (opcode_t *)program_code, (size_t)program_size))
@@ -0,0 +1,717 @@
+/*
+Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+src/packfile/cache.c - Cache of the bytecode of compiled source files
+
+=head1 DESCRIPTION
+
+When the environment variable C<PARROT_PBC_CACHE> names a directory,
+C<load_bytecode> and C<load_language> keep the bytecode they compile from
+F<.pir> and F<.pasm> files there, and load it from there instead of
+compiling the file again as long as nothing it was compiled from changed.
+
+An entry is named after a hash of everything that goes into the bytecode:
+the compiler, the Parrot version and bytecode format, the ops of the core
+oplib, the path of the file, its contents and the contents of the files it
+C<.include>s. A changed file or a different Parrot thus makes for a
+different entry, and the old one is left to be evicted: after a new entry
+is written, the oldest ones are removed until the directory holds at most
+C<PARROT_PBC_CACHE_SIZE> kilobytes of entries, 64 megabytes by default.
+
+Entries are plain bytecode files, written under a temporary name first so
+that other processes never see half of one. Failing to read or write the
+cache only means compiling the file.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/packfile.h"
+#include "parrot/events.h"
+#include "parrot/oplib/core_ops.h"
+#include "cache.str"
+
+/* HEADERIZER HFILE: include/parrot/packfile.h */
+
+/* the size of the cache if PARROT_PBC_CACHE_SIZE doesn't say, in kilobytes */
+#define PBC_CACHE_DEFAULT_SIZE (64 * 1024)
+
+/* the most files, including the source file, hashed for one key */
+#define PBC_CACHE_MAX_FILES 64
+
+/* the length of an entry name: 32 hex digits and ".pbc" */
+#define PBC_CACHE_NAME_LENGTH 36
+
+/* Two 64 bit hashes of the key material, FNV-1a and a multiply-xorshift. */
+typedef struct pbc_cache_key_t {
+    UHUGEINTVAL h1;
+    UHUGEINTVAL h2;
+} pbc_cache_key_t;
+
+/* An entry found in the cache directory while evicting. */
+typedef struct pbc_cache_entry_t {
+    INTVAL mtime;
+    INTVAL size;
+    INTVAL index;           /* in the directory listing */
+} pbc_cache_entry_t;
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING * cache_dir(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int cache_entry_cmp(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING * cache_entry_name(PARROT_INTERP,
+    ARGIN(STRING *dir),
+    ARGIN(PMC *compiler),
+    ARGIN(STRING *path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+static void cache_evict(PARROT_INTERP,
+    ARGIN(STRING *dir),
+    ARGIN(STRING *keep))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * cache_fetch(PARROT_INTERP,
+    ARGIN(STRING *entry),
+    ARGIN(STRING *path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void cache_hash(
+    ARGMOD(pbc_cache_key_t *key),
+    ARGIN_NULLOK(const char *buf),
+    size_t len)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*key);
+
+static int cache_hash_source(PARROT_INTERP,
+    ARGMOD(pbc_cache_key_t *key),
+    ARGIN(STRING *path),
+    ARGMOD(int *n_files))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*key)
+        FUNC_MODIFIES(*n_files);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static char * cache_read_file(PARROT_INTERP,
+    ARGIN(STRING *path),
+    ARGOUT(size_t *len))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*len);
+
+static void cache_store(PARROT_INTERP,
+    ARGIN(STRING *dir),
+    ARGIN(STRING *entry),
+    ARGIN(PMC *pf_pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
+static void cache_unlink(PARROT_INTERP, ARGIN(STRING *file))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_cache_dir __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_cache_entry_cmp __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_cache_entry_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(dir) \
+    , PARROT_ASSERT_ARG(compiler) \
+    , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_cache_evict __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(dir) \
+    , PARROT_ASSERT_ARG(keep))
+#define ASSERT_ARGS_cache_fetch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(entry) \
+    , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_cache_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(key))
+#define ASSERT_ARGS_cache_hash_source __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(key) \
+    , PARROT_ASSERT_ARG(path) \
+    , PARROT_ASSERT_ARG(n_files))
+#define ASSERT_ARGS_cache_read_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(path) \
+    , PARROT_ASSERT_ARG(len))
+#define ASSERT_ARGS_cache_store __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(dir) \
+    , PARROT_ASSERT_ARG(entry) \
+    , PARROT_ASSERT_ARG(pf_pmc))
+#define ASSERT_ARGS_cache_unlink __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(file))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<static void cache_hash(pbc_cache_key_t *key, const char *buf, size_t
+len)>
+
+Adds the C<len> bytes at C<buf> to the hashes of C<key>, preceded by their
+length so that consecutive pieces can't run into each other.
+
+=cut
+
+*/
+
+static void
+cache_hash(ARGMOD(pbc_cache_key_t *key), ARGIN_NULLOK(const char *buf), size_t len)
+{
+    ASSERT_ARGS(cache_hash)
+    const UHUGEINTVAL fnv_prime = ((UHUGEINTVAL)0x100 << 32) | 0x1b3;
+    const UHUGEINTVAL golden    = ((UHUGEINTVAL)0x9e3779b9 << 32) | 0x7f4a7c15;
+    UHUGEINTVAL h1 = key->h1;
+    UHUGEINTVAL h2 = key->h2;
+    size_t      n  = len;
+    size_t      i;
+
+    for (i = 0; i < sizeof (n); i++) {
+        const unsigned char c = (unsigned char)(n >> (8 * i));
+        h1 = (h1 ^ c) * fnv_prime;
+        h2 = (h2 ^ c) * golden;
+        h2 ^= h2 >> 29;
+    }
+
+    for (i = 0; i < len; i++) {
+        const unsigned char c = (unsigned char)buf[i];
+        h1 = (h1 ^ c) * fnv_prime;
+        h2 = (h2 ^ c) * golden;
+        h2 ^= h2 >> 29;
+    }
+
+    key->h1 = h1;
+    key->h2 = h2;
+}
+
+/*
+
+=item C<static char * cache_read_file(PARROT_INTERP, STRING *path, size_t *len)>
+
+Returns the contents of the file C<path>, to be freed with
+C<mem_sys_free>, and their length in C<len>, or NULL if the file can't be
+read.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static char *
+cache_read_file(PARROT_INTERP, ARGIN(STRING *path), ARGOUT(size_t *len))
+{
+    ASSERT_ARGS(cache_read_file)
+    INTVAL          size;
+    PIOHANDLE       io;
+    char           *buf;
+    size_t          got = 0;
+
+    if (!Parrot_file_stat_intval(interp, path, STAT_EXISTS)
+    ||  !Parrot_file_stat_intval(interp, path, STAT_ISREG))
+        return NULL;
+
+    size = Parrot_file_stat_intval(interp, path, STAT_FILESIZE);
+
+    io = Parrot_io_internal_open(interp, path, PIO_F_READ);
+
+    if (io == PIO_INVALID_HANDLE)
+        return NULL;
+
+    buf = (char *)mem_sys_allocate((size_t)size + 1);
+
+    while (got < (size_t)size) {
+        const size_t n = Parrot_io_internal_read(interp, io, buf + got,
+                (size_t)size - got);
+
+        if (n == 0 || n == (size_t)-1)
+            break;
+
+        got += n;
+    }
+
+    Parrot_io_internal_close(interp, io);
+
+    if (got != (size_t)size) {
+        mem_sys_free(buf);
+        return NULL;
+    }
+
+    buf[got] = '\0';
+    *len     = got;
+
+    return buf;
+}
+
+/*
+
+=item C<static int cache_hash_source(PARROT_INTERP, pbc_cache_key_t *key, STRING
+*path, int *n_files)>
+
+Adds the path and contents of the source file C<path> to C<key>, and
+those of every file it C<.include>s, found the way IMCC finds them.
+Returns 0 if a file can't be read or found, or if there are more than
+C<PBC_CACHE_MAX_FILES> of them as counted in C<n_files>.
+
+Anything that looks like an C<.include> directive counts, even in a
+comment or a string: that only adds a file to the key.
+
+=cut
+
+*/
+
+static int
+cache_hash_source(PARROT_INTERP, ARGMOD(pbc_cache_key_t *key),
+        ARGIN(STRING *path), ARGMOD(int *n_files))
+{
+    ASSERT_ARGS(cache_hash_source)
+    size_t      len;
+    char       *buf;
+    const char *p;
+    int         ok = 1;
+
+    if (++*n_files > PBC_CACHE_MAX_FILES)
+        return 0;
+
+    buf = cache_read_file(interp, path, &len);
+
+    if (!buf)
+        return 0;
+
+    cache_hash(key, path->strstart, path->bufused);
+    cache_hash(key, buf, len);
+
+    for (p = buf; ok && (p = strstr(p, ".include")) != NULL;) {
+        const char *name;
+        const char *end;
+        char        quote;
+
+        p += 8;
+
+        while (*p == ' ' || *p == '\t')
+            p++;
+
+        if (*p != '"' && *p != '\'')
+            continue;
+
+        quote = *p;
+        name  = p + 1;
+
+        for (end = name; *end && *end != quote && *end != '\n'; end++)
+            ;
+
+        if (*end == quote) {
+            STRING * const file = Parrot_str_new(interp, name, end - name);
+            STRING * const found = Parrot_locate_runtime_file_str(interp, file,
+                    PARROT_RUNTIME_FT_INCLUDE);
+
+            ok = !STRING_IS_NULL(found)
+              && cache_hash_source(interp, key, found, n_files);
+            p  = end + 1;
+        }
+    }
+
+    mem_sys_free(buf);
+
+    return ok;
+}
+
+/*
+
+=item C<static STRING * cache_entry_name(PARROT_INTERP, STRING *dir, PMC
+*compiler, STRING *path)>
+
+Returns the path in the cache directory C<dir> of the entry for the
+source file C<path> compiled by C<compiler>, or NULL if the file can't be
+cached. C<Parrot_interp_compile_file> resets the compiler, so its options
+don't go into the key.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING *
+cache_entry_name(PARROT_INTERP, ARGIN(STRING *dir), ARGIN(PMC *compiler),
+        ARGIN(STRING *path))
+{
+    ASSERT_ARGS(cache_entry_name)
+    static const char hex[] = "0123456789abcdef";
+    const op_lib_t * const core = PARROT_CORE_OPLIB_INIT(interp, 1);
+    STRING * const compiler_name = VTABLE_get_string(interp, compiler);
+    pbc_cache_key_t key;
+    char            name[PBC_CACHE_NAME_LENGTH + 1];
+    char            version[64];
+    opcode_t        i;
+    int             n_files = 0;
+
+    key.h1 = ((UHUGEINTVAL)0xcbf29ce4 << 32) | 0x84222325;
+    key.h2 = 0;
+
+    if (STRING_IS_NULL(compiler_name))
+        return NULL;
+
+    cache_hash(&key, compiler_name->strstart, compiler_name->bufused);
+
+    snprintf(version, sizeof (version), "%s %d.%d", PARROT_VERSION,
+            PARROT_PBC_MAJOR, PARROT_PBC_MINOR);
+    cache_hash(&key, version, strlen(version));
+
+    for (i = 0; i < core->op_count; i++) {
+        const char * const op = core->op_info_table[i].full_name;
+        cache_hash(&key, op, strlen(op));
+    }
+
+    if (!cache_hash_source(interp, &key, path, &n_files))
+        return NULL;
+
+    for (i = 0; i < 16; i++) {
+        name[i]      = hex[(key.h1 >> (60 - 4 * i)) & 0xf];
+        name[16 + i] = hex[(key.h2 >> (60 - 4 * i)) & 0xf];
+    }
+
+    strcpy(name + 32, ".pbc");
+
+    return Parrot_sprintf_c(interp, "%Ss/%s", dir, name);
+}
+
+/*
+
+=item C<static STRING * cache_dir(PARROT_INTERP)>
+
+Returns the cache directory named by C<PARROT_PBC_CACHE>, creating it if
+it doesn't exist, or NULL if there is none to use.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING *
+cache_dir(PARROT_INTERP)
+{
+    ASSERT_ARGS(cache_dir)
+    STRING * const dir = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_PBC_CACHE"));
+
+    if (STRING_IS_NULL(dir) || STRING_IS_EMPTY(dir))
+        return NULL;
+
+    if (!Parrot_file_stat_intval(interp, dir, STAT_EXISTS)) {
+        Parrot_runloop jmp;
+
+        if (setjmp(jmp.resume)) {
+            /* someone else may have just created it */
+            Parrot_cx_delete_handler_local(interp);
+        }
+        else {
+            Parrot_ex_add_c_handler(interp, &jmp);
+            Parrot_file_mkdir(interp, dir, 0777);
+            Parrot_cx_delete_handler_local(interp);
+        }
+    }
+
+    if (!Parrot_file_stat_intval(interp, dir, STAT_EXISTS)
+    ||  !Parrot_file_stat_intval(interp, dir, STAT_ISDIR))
+        return NULL;
+
+    return dir;
+}
+
+/*
+
+=item C<static PMC * cache_fetch(PARROT_INTERP, STRING *entry, STRING *path)>
+
+Returns the bytecode of the cache entry C<entry> as a packfile for the
+source file C<path>, or PMCNULL if there is no such entry or it can't be
+loaded.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+cache_fetch(PARROT_INTERP, ARGIN(STRING *entry), ARGIN(STRING *path))
+{
+    ASSERT_ARGS(cache_fetch)
+    Parrot_runloop jmp;
+    PMC           *pf_pmc;
+
+    if (!Parrot_file_stat_intval(interp, entry, STAT_EXISTS)
+    ||  !Parrot_file_stat_intval(interp, entry, STAT_ISREG))
+        return PMCNULL;
+
+    if (setjmp(jmp.resume)) {
+        /* a damaged entry is compiled again and replaced */
+        Parrot_cx_delete_handler_local(interp);
+        return PMCNULL;
+    }
+
+    Parrot_ex_add_c_handler(interp, &jmp);
+    pf_pmc = Parrot_pf_get_packfile_pmc(interp,
+                Parrot_pf_read_pbc_file(interp, entry), path);
+    Parrot_cx_delete_handler_local(interp);
+
+    return pf_pmc;
+}
+
+/*
+
+=item C<static int cache_entry_cmp(const void *a, const void *b)>
+
+Orders cache entries oldest first, for C<qsort>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+cache_entry_cmp(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(cache_entry_cmp)
+    const pbc_cache_entry_t * const ea = (const pbc_cache_entry_t *)a;
+    const pbc_cache_entry_t * const eb = (const pbc_cache_entry_t *)b;
+
+    if (ea->mtime != eb->mtime)
+        return ea->mtime < eb->mtime ? -1 : 1;
+
+    return ea->index < eb->index ? -1 : ea->index > eb->index;
+}
+
+/*
+
+=item C<static void cache_evict(PARROT_INTERP, STRING *dir, STRING *keep)>
+
+Removes the oldest entries of the cache directory C<dir> but C<keep> until
+the rest fit into C<PARROT_PBC_CACHE_SIZE>.
+
+=cut
+
+*/
+
+static void
+cache_evict(PARROT_INTERP, ARGIN(STRING *dir), ARGIN(STRING *keep))
+{
+    ASSERT_ARGS(cache_evict)
+    STRING * const      suffix   = CONST_STRING(interp, ".pbc");
+    STRING * const      size_env = CONST_STRING(interp, "PARROT_PBC_CACHE_SIZE");
+    STRING * const      size_var = Parrot_getenv(interp, size_env);
+    const INTVAL        limit    = STRING_IS_NULL(size_var) || STRING_IS_EMPTY(size_var)
+                                 ? PBC_CACHE_DEFAULT_SIZE
+                                 : Parrot_str_to_int(interp, size_var);
+    PMC                *names;
+    pbc_cache_entry_t  *entries;
+    INTVAL              n, i, n_entries = 0, total = 0;
+
+    names   = Parrot_file_readdir(interp, dir);
+    n       = VTABLE_elements(interp, names);
+    entries = mem_gc_allocate_n_typed(interp, n + 1, pbc_cache_entry_t);
+
+    for (i = 0; i < n; i++) {
+        STRING * const name = VTABLE_get_string_keyed_int(interp, names, i);
+        STRING        *file;
+
+        if (STRING_length(name) != PBC_CACHE_NAME_LENGTH
+        ||  STRING_index(interp, name, suffix, 0) != 32)
+            continue;
+
+        file = Parrot_sprintf_c(interp, "%Ss/%Ss", dir, name);
+
+        if (!Parrot_file_stat_intval(interp, file, STAT_EXISTS)
+        ||  !Parrot_file_stat_intval(interp, file, STAT_ISREG))
+            continue;
+
+        entries[n_entries].mtime = Parrot_file_stat_intval(interp, file, STAT_MODIFYTIME);
+        entries[n_entries].size  = Parrot_file_stat_intval(interp, file, STAT_FILESIZE);
+        entries[n_entries].index = i;
+        total += entries[n_entries].size;
+        n_entries++;
+    }
+
+    qsort(entries, (size_t)n_entries, sizeof (pbc_cache_entry_t), cache_entry_cmp);
+
+    for (i = 0; i < n_entries && total > limit * 1024; i++) {
+        STRING * const file = Parrot_sprintf_c(interp, "%Ss/%Ss", dir,
+                VTABLE_get_string_keyed_int(interp, names, entries[i].index));
+
+        if (STRING_equal(interp, file, keep))
+            continue;
+
+        Parrot_file_unlink(interp, file);
+        total -= entries[i].size;
+    }
+
+    mem_gc_free(interp, entries);
+}
+
+/*
+
+=item C<static void cache_unlink(PARROT_INTERP, STRING *file)>
+
+Removes C<file> if it exists, ignoring any failure.
+
+=cut
+
+*/
+
+static void
+cache_unlink(PARROT_INTERP, ARGIN(STRING *file))
+{
+    ASSERT_ARGS(cache_unlink)
+    Parrot_runloop jmp;
+
+    if (!Parrot_file_stat_intval(interp, file, STAT_EXISTS))
+        return;
+
+    if (setjmp(jmp.resume)) {
+        Parrot_cx_delete_handler_local(interp);
+        return;
+    }
+
+    Parrot_ex_add_c_handler(interp, &jmp);
+    Parrot_file_unlink(interp, file);
+    Parrot_cx_delete_handler_local(interp);
+}
+
+/*
+
+=item C<static void cache_store(PARROT_INTERP, STRING *dir, STRING *entry, PMC
+*pf_pmc)>
+
+Writes the packfile C<pf_pmc> to the cache entry C<entry> in C<dir>, and
+makes room for it.
+
+=cut
+
+*/
+
+static void
+cache_store(PARROT_INTERP, ARGIN(STRING *dir), ARGIN(STRING *entry),
+        ARGIN(PMC *pf_pmc))
+{
+    ASSERT_ARGS(cache_store)
+    STRING * const tmp = Parrot_sprintf_c(interp, "%Ss.%d.tmp", entry,
+                                (int)Parrot_getpid());
+    Parrot_runloop jmp;
+
+    if (setjmp(jmp.resume)) {
+        Parrot_cx_delete_handler_local(interp);
+
+        cache_unlink(interp, tmp);
+        return;
+    }
+
+    Parrot_ex_add_c_handler(interp, &jmp);
+    Parrot_pf_write_pbc_file(interp, pf_pmc, tmp);
+    Parrot_file_rename(interp, tmp, entry);
+    cache_evict(interp, dir, entry);
+    Parrot_cx_delete_handler_local(interp);
+}
+
+/*
+
+=item C<PMC * Parrot_pf_cache_compile_file(PARROT_INTERP, PMC *compiler, STRING
+*path)>
+
+Returns the packfile C<compiler> compiles from the source file C<path>,
+taking it from the cache directory named by C<PARROT_PBC_CACHE> if the
+file was compiled before, or else compiling it and keeping it there.
+Without a cache directory, this is C<Parrot_interp_compile_file>.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_pf_cache_compile_file(PARROT_INTERP, ARGIN(PMC *compiler),
+        ARGIN(STRING *path))
+{
+    ASSERT_ARGS(Parrot_pf_cache_compile_file)
+    STRING * const dir = cache_dir(interp);
+    STRING        *entry;
+    PMC           *pf_pmc;
+
+    if (!dir)
+        return Parrot_interp_compile_file(interp, compiler, path);
+
+    entry = cache_entry_name(interp, dir, compiler, path);
+
+    if (!entry)
+        return Parrot_interp_compile_file(interp, compiler, path);
+
+    pf_pmc = cache_fetch(interp, entry, path);
+
+    if (!PMC_IS_NULL(pf_pmc))
+        return pf_pmc;
+
+    pf_pmc = Parrot_interp_compile_file(interp, compiler, path);
+    cache_store(interp, dir, entry, pf_pmc);
+
+    return pf_pmc;
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<src/packfile/api.c>, F<src/library.c>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
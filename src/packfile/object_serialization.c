@@ -269,6 +269,39 @@ Parrot_thaw_pbc(PARROT_INTERP, ARGIN(PackFile_ConstTable *ct), ARGMOD(const opco
 }
 
 
+/*
+
+=item C<void Parrot_thaw_pbc_constants(PARROT_INTERP, PackFile_ConstTable *ct,
+const opcode_t **cursor)>
+
+Thaw all the PMC constants of C<ct> into its constant array, as
+C<Parrot_thaw_pbc> would one at a time, but through a single C<ImageIOThaw>.
+Each slot gets the list of all PMCs thawed from that constant's image.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_thaw_pbc_constants(PARROT_INTERP, ARGMOD(PackFile_ConstTable *ct),
+        ARGMOD(const opcode_t **cursor))
+{
+    ASSERT_ARGS(Parrot_thaw_pbc_constants)
+    PackFile * const pf   = ct->base.pf;
+    PMC *      const info = Parrot_pmc_new(interp, enum_class_ImageIOThaw);
+    opcode_t         i;
+
+    VTABLE_set_pointer(interp, info, ct);
+
+    for (i = 0; i < ct->pmc.const_count; ++i) {
+        STRING * const image = PF_fetch_buf(interp, pf, cursor);
+        VTABLE_set_string_native(interp, info, image);
+        ct->pmc.constants[i] = VTABLE_get_pmc(interp, info);
+    }
+}
+
+
 /*
 
 =item C<PMC* Parrot_thaw_constants(PARROT_INTERP, STRING *image)>
@@ -1417,6 +1417,9 @@ Opcode format is:
 
 When used for freeze/thaw the C<pf> argument might be NULL.
 
+If C<pf> was read into a buffer that is never freed (C<PFOPT_KEEP_SRC>), the
+C<STRING> is external and points into that buffer instead of holding a copy.
+
 =cut
 
 */
@@ -1450,6 +1453,10 @@ PF_fetch_string(PARROT_INTERP, ARGIN_NULLOK(PackFile *pf), ARGIN(const opcode_t
             Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_UNIMPLEMENTED,
                     "Invalid encoding number '%d' specified", encoding_nr);
 
+    /* point into a source buffer that is kept around instead of copying */
+    if (pf && (pf->options & PFOPT_KEEP_SRC))
+        flags |= PObj_external_FLAG;
+
     if (size || (encoding != CONST_STRING(interp, "")->encoding))
         s = Parrot_str_new_init(interp, (const char *)*cursor, size,
                 encoding, flags);
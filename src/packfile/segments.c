@@ -125,14 +125,14 @@ static const opcode_t * const_unpack(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*seg);
 
-PARROT_WARN_UNUSED_RESULT
-PARROT_CANNOT_RETURN_NULL
-static PMC * const_unpack_pmc(PARROT_INTERP,
-    ARGIN(PackFile_ConstTable *constt),
-    ARGIN(const opcode_t **cursor))
+static void const_unpack_pmcs(PARROT_INTERP,
+    ARGMOD(PackFile_ConstTable *constt),
+    ARGMOD(const opcode_t **cursor))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        __attribute__nonnull__(3);
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*constt)
+        FUNC_MODIFIES(*cursor);
 
 static void default_destroy(PARROT_INTERP,
     ARGFREE_NOTNULL(PackFile_Segment *self))
@@ -323,7 +323,7 @@ static void sort_segs(ARGMOD(PackFile_Directory *dir))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(seg) \
     , PARROT_ASSERT_ARG(cursor))
-#define ASSERT_ARGS_const_unpack_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_const_unpack_pmcs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(constt) \
     , PARROT_ASSERT_ARG(cursor))
@@ -649,9 +649,8 @@ const_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
              ARGIN(const opcode_t *cursor))
 {
     ASSERT_ARGS(const_unpack)
-    STRING              * const sub_str = CONST_STRING(interp, "Sub");
-    PackFile_ConstTable * const self    = (PackFile_ConstTable *)seg;
-    PackFile            * const pf      = seg->pf;
+    PackFile_ConstTable * const self = (PackFile_ConstTable *)seg;
+    PackFile            * const pf   = seg->pf;
     opcode_t                    i;
 
     const_clear(interp, self);
@@ -687,8 +686,8 @@ const_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
     for (i = 0; i < self->str.const_count; i++)
         self->str.constants[i] = PF_fetch_string(interp, pf, &cursor);
 
-    for (i = 0; i < self->pmc.const_count; i++)
-        self->pmc.constants[i] = const_unpack_pmc(interp, self, &cursor);
+    if (self->pmc.const_count)
+        const_unpack_pmcs(interp, self, &cursor);
 
     for (i = 0; i < self->pmc.const_count; i++) {
         /* XXX unpack returned the lists of all objects in the object graph
@@ -697,13 +696,13 @@ const_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
                               = VTABLE_get_pmc_keyed_int(interp, self->pmc.constants[i], 0);
 
         PObj_is_shared_SET(pmc); /* packfile constants will be shared among threads */
-
-        /* magically place subs into namespace stashes
-         * XXX make this explicit with :load subs in PBC */
-        if (VTABLE_isa(interp, pmc, sub_str))
-            Parrot_ns_store_sub(interp, pmc);
     }
 
+    /* magically place subs into namespace stashes
+     * XXX make this explicit with :load subs in PBC */
+    if (self->pmc.const_count)
+        Parrot_ns_store_subs(interp, self->pmc.constants, self->pmc.const_count);
+
     self->ntags = PF_fetch_opcode(pf, &cursor);
     self->tag_map = mem_gc_allocate_n_zeroed_typed(interp, self->ntags, PackFile_ConstTagPair);
     for (i = 0; i < self->ntags; i++) {
@@ -763,32 +762,27 @@ const_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
 
 /*
 
-=item C<static PMC * const_unpack_pmc(PARROT_INTERP, PackFile_ConstTable
+=item C<static void const_unpack_pmcs(PARROT_INTERP, PackFile_ConstTable
 *constt, const opcode_t **cursor)>
 
-Unpacks a constant PMC.
+Unpacks all the constant PMCs of C<constt>.
 
 =cut
 
 */
 
-PARROT_WARN_UNUSED_RESULT
-PARROT_CANNOT_RETURN_NULL
-static PMC *
-const_unpack_pmc(PARROT_INTERP, ARGIN(PackFile_ConstTable *constt),
-        ARGIN(const opcode_t **cursor))
+static void
+const_unpack_pmcs(PARROT_INTERP, ARGMOD(PackFile_ConstTable *constt),
+        ARGMOD(const opcode_t **cursor))
 {
-    ASSERT_ARGS(const_unpack_pmc)
+    ASSERT_ARGS(const_unpack_pmcs)
     PackFile * const pf         = constt->base.pf;
-    PMC             *pmc;
-    /* thawing the PMC needs the real packfile in place */
+    /* thawing the PMCs needs the real packfile in place */
     PackFile_ByteCode * const cs_save = interp->code;
     interp->code                      = pf->cur_cs;
-    pmc                               = Parrot_thaw_pbc(interp, constt, cursor);
+    Parrot_thaw_pbc_constants(interp, constt, cursor);
     /* restore code */
     interp->code = cs_save;
-
-    return pmc;
 }
 
 
@@ -2140,6 +2134,9 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     if (byte_code->libdeps)
         mem_gc_free(interp, byte_code->libdeps);
 
+    if (byte_code->deopt_sites)
+        Parrot_hash_destroy(interp, byte_code->deopt_sites);
+
     if (byte_code->annotations)
         annotations_destroy(interp, (PackFile_Segment *)byte_code->annotations);
 
@@ -2149,6 +2146,7 @@ byte_code_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     byte_code->op_func_table   = NULL;
     byte_code->op_info_table   = NULL;
     byte_code->op_mapping.libs = NULL;
+    byte_code->deopt_sites     = NULL;
     byte_code->libdeps         = NULL;
 }
 
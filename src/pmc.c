@@ -29,6 +29,11 @@ The base vtable calling functions
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static void build_isa_bits(PARROT_INTERP, ARGMOD(VTABLE *vtable))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*vtable);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC* check_get_std_props(PARROT_INTERP,
@@ -94,6 +99,9 @@ static void propagate_std_props(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+#define ASSERT_ARGS_build_isa_bits __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(vtable))
 #define ASSERT_ARGS_check_get_std_props __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(self) \
@@ -1159,6 +1167,81 @@ Parrot_pmc_type_does(PARROT_INTERP, ARGIN(const STRING *role), INTVAL type)
     } while (1);
 }
 
+/*
+
+=item C<INTVAL Parrot_pmc_isa_type(PARROT_INTERP, PMC *pmc, INTVAL type)>
+
+Checks whether C<pmc> isa PMC of the given C<type>. Gives the same answer as
+calling C<VTABLE_isa> with the name of the type, but PMCs which don't override
+C<isa> are answered by the set of type ids built once for their vtable.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_HOT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_pmc_isa_type(PARROT_INTERP, ARGIN(PMC *pmc), INTVAL type)
+{
+    ASSERT_ARGS(Parrot_pmc_isa_type)
+    VTABLE * const vtable = pmc->vtable;
+
+    PARROT_ASSERT(type > 0 && type < interp->n_vtable_max);
+
+    if (vtable->isa == interp->vtables[enum_class_default]->isa) {
+        if (vtable->base_type == type)
+            return 1;
+
+        if (!vtable->isa_bits)
+            build_isa_bits(interp, vtable);
+
+        if (PARROT_TYPE_BITS_COVERS(vtable->isa_bits, type))
+            return PARROT_TYPE_BITS_TEST(vtable->isa_bits, type);
+    }
+
+    return VTABLE_isa(interp, pmc, interp->vtables[type]->whoami);
+}
+
+/*
+
+=item C<static void build_isa_bits(PARROT_INTERP, VTABLE *vtable)>
+
+Records in C<< vtable->isa_bits >> the ids of all types the default C<isa>
+of C<vtable> accepts by name.
+
+=cut
+
+*/
+
+static void
+build_isa_bits(PARROT_INTERP, ARGMOD(VTABLE *vtable))
+{
+    ASSERT_ARGS(build_isa_bits)
+    const INTVAL    n_types  = interp->n_vtable_max;
+    const Hash     *isa_hash = vtable->isa_hash;
+    UINTVAL * const bits     = Parrot_oo_new_type_bits(interp, n_types);
+    INTVAL          type;
+
+    for (type = 1; type < n_types; ++type) {
+        const VTABLE * const other = interp->vtables[type];
+        STRING              *name;
+
+        if (!other)
+            continue;
+
+        name = other->whoami;
+
+        if (vtable->whoami == name
+        || (isa_hash ? Parrot_hash_exists(interp, isa_hash, name)
+                     : STRING_equal(interp, vtable->whoami, name)))
+            PARROT_TYPE_BITS_SET(bits, type);
+    }
+
+    vtable->isa_bits = bits;
+}
+
 
 /*
 
@@ -348,6 +348,7 @@ Parrot_runcore_slow_init(PARROT_INTERP)
     coredata->flags            = 0;
 
     PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+    PARROT_RUNCORE_QUICKEN_SET(coredata);
 
     Parrot_runcore_register(interp, coredata);
 }
@@ -378,6 +379,7 @@ Parrot_runcore_fast_init(PARROT_INTERP)
     coredata->flags            = 0;
 
     PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+    PARROT_RUNCORE_QUICKEN_SET(coredata);
 
     Parrot_runcore_register(interp, coredata);
 }
@@ -33,17 +33,81 @@ The runcore API handles running the operations.
 /* HEADERIZER HFILE: include/parrot/runcore_api.h */
 /* XXX Needs to get done at the same time as the other interpreter files */
 
+/* A generic op and the op it is quickened to for operands of a type */
+typedef struct quick_op_t {
+    INTVAL   base_type;
+    opcode_t generic;
+    opcode_t quick;
+} quick_op_t;
+
+static const quick_op_t quick_ops[] = {
+    { enum_class_Integer, PARROT_OP_add_p_p_p,   PARROT_OP_add_int_int_p_p_p },
+    { enum_class_Integer, PARROT_OP_sub_p_p_p,   PARROT_OP_sub_int_int_p_p_p },
+    { enum_class_Integer, PARROT_OP_mul_p_p_p,   PARROT_OP_mul_int_int_p_p_p },
+    { enum_class_Integer, PARROT_OP_mod_p_p_p,   PARROT_OP_mod_int_int_p_p_p },
+    { enum_class_Integer, PARROT_OP_add_p_p_i,   PARROT_OP_add_int_p_p_i },
+    { enum_class_Integer, PARROT_OP_add_p_p_ic,  PARROT_OP_add_int_p_p_ic },
+    { enum_class_Integer, PARROT_OP_sub_p_p_i,   PARROT_OP_sub_int_p_p_i },
+    { enum_class_Integer, PARROT_OP_sub_p_p_ic,  PARROT_OP_sub_int_p_p_ic },
+    { enum_class_Integer, PARROT_OP_inc_p,       PARROT_OP_inc_int_p },
+    { enum_class_Integer, PARROT_OP_dec_p,       PARROT_OP_dec_int_p },
+    { enum_class_Integer, PARROT_OP_eq_p_i_ic,   PARROT_OP_eq_int_p_i_ic },
+    { enum_class_Integer, PARROT_OP_eq_p_ic_ic,  PARROT_OP_eq_int_p_ic_ic },
+    { enum_class_Integer, PARROT_OP_eq_p_p_ic,   PARROT_OP_eq_int_int_p_p_ic },
+    { enum_class_Integer, PARROT_OP_ne_p_i_ic,   PARROT_OP_ne_int_p_i_ic },
+    { enum_class_Integer, PARROT_OP_ne_p_ic_ic,  PARROT_OP_ne_int_p_ic_ic },
+    { enum_class_Integer, PARROT_OP_ne_p_p_ic,   PARROT_OP_ne_int_int_p_p_ic },
+    { enum_class_Integer, PARROT_OP_lt_p_i_ic,   PARROT_OP_lt_int_p_i_ic },
+    { enum_class_Integer, PARROT_OP_lt_p_ic_ic,  PARROT_OP_lt_int_p_ic_ic },
+    { enum_class_Integer, PARROT_OP_lt_p_p_ic,   PARROT_OP_lt_int_int_p_p_ic },
+    { enum_class_Integer, PARROT_OP_le_p_i_ic,   PARROT_OP_le_int_p_i_ic },
+    { enum_class_Integer, PARROT_OP_le_p_ic_ic,  PARROT_OP_le_int_p_ic_ic },
+    { enum_class_Integer, PARROT_OP_le_p_p_ic,   PARROT_OP_le_int_int_p_p_ic },
+    { enum_class_Integer, PARROT_OP_gt_p_i_ic,   PARROT_OP_gt_int_p_i_ic },
+    { enum_class_Integer, PARROT_OP_gt_p_ic_ic,  PARROT_OP_gt_int_p_ic_ic },
+    { enum_class_Integer, PARROT_OP_gt_p_p_ic,   PARROT_OP_gt_int_int_p_p_ic },
+    { enum_class_Integer, PARROT_OP_ge_p_i_ic,   PARROT_OP_ge_int_p_i_ic },
+    { enum_class_Integer, PARROT_OP_ge_p_ic_ic,  PARROT_OP_ge_int_p_ic_ic },
+    { enum_class_Integer, PARROT_OP_ge_p_p_ic,   PARROT_OP_ge_int_int_p_p_ic },
+    { enum_class_Float,   PARROT_OP_add_p_p_p,   PARROT_OP_add_num_num_p_p_p },
+    { enum_class_Float,   PARROT_OP_sub_p_p_p,   PARROT_OP_sub_num_num_p_p_p },
+    { enum_class_Float,   PARROT_OP_mul_p_p_p,   PARROT_OP_mul_num_num_p_p_p },
+    { enum_class_Float,   PARROT_OP_inc_p,       PARROT_OP_inc_num_p },
+    { enum_class_Float,   PARROT_OP_dec_p,       PARROT_OP_dec_num_p }
+};
+
+#define N_QUICK_OPS (sizeof (quick_ops) / sizeof (quick_ops[0]))
+
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+static int can_quicken(PARROT_INTERP, ARGIN(const opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static oplib_init_f get_dynamic_op_lib_init(PARROT_INTERP,
     ARGIN(const PMC *lib))
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+static opcode_t map_core_op(PARROT_INTERP,
+    ARGMOD(PackFile_ByteCode *cs),
+    opcode_t op)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*cs);
+
+#define ASSERT_ARGS_can_quicken __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pc))
 #define ASSERT_ARGS_get_dynamic_op_lib_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(lib))
+#define ASSERT_ARGS_map_core_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(cs))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -313,7 +377,10 @@ Parrot_dynop_register(PARROT_INTERP, ARGIN(PMC *lib_pmc))
     && (STREQ(interp->all_op_libs[interp->n_libs-2]->name, lib->name)))
         return;
 
-    parrot_hash_oplib(interp, lib);
+    /* without an op hash yet, Parrot_runcore_build_op_hash picks the lib up
+     * from all_op_libs when something first asks for an op by name */
+    if (interp->op_hash)
+        parrot_hash_oplib(interp, lib);
 }
 
 /*
@@ -366,6 +433,50 @@ parrot_hash_oplib(PARROT_INTERP, ARGIN(op_lib_t *lib))
 }
 
 
+/*
+
+=item C<void Parrot_runcore_build_op_hash(PARROT_INTERP)>
+
+Build the global name => op_info hash from the core ops and all dynamic oplibs
+loaded so far, unless it exists already. Only the compilers look ops up by
+name, so interpreters that just run bytecode never pay for hashing every op.
+A child interpreter shares the hash of its parent.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_runcore_build_op_hash(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_build_op_hash)
+    op_lib_t *core_ops;
+    INTVAL    i;
+
+    if (interp->op_hash)
+        return;
+
+    if (interp->parent_interpreter) {
+        Parrot_runcore_build_op_hash(interp->parent_interpreter);
+        interp->op_hash = interp->parent_interpreter->op_hash;
+        return;
+    }
+
+    core_ops        = PARROT_CORE_OPLIB_INIT(interp, 1);
+    interp->op_hash = Parrot_hash_create_sized(interp, enum_type_ptr,
+                            Hash_key_type_cstring, core_ops->op_count);
+    parrot_hash_oplib(interp, core_ops);
+
+    /* skip op_lib variants, as Parrot_dynop_register does */
+    for (i = 0; i < interp->n_libs; ++i) {
+        op_lib_t * const lib = interp->all_op_libs[i];
+
+        if (i == 0 || !STREQ(interp->all_op_libs[i - 1]->name, lib->name))
+            parrot_hash_oplib(interp, lib);
+    }
+}
+
 /*
 
 =item C<void Parrot_runcore_disable_event_checking(PARROT_INTERP)>
@@ -441,6 +552,184 @@ Parrot_runcore_enable_event_checking(PARROT_INTERP)
 }
 
 
+/*
+
+=item C<void Parrot_runcore_quicken_op(PARROT_INTERP, opcode_t *pc, INTVAL
+base_type)>
+
+Rewrites the generic op at C<pc> in the current code segment to the op
+specialized for operands of type C<base_type>, if there is one. Generic ops
+call this when they see such operands; the next time the op site runs, the
+specialized op runs instead.
+
+Sites that were deoptimized, see C<Parrot_runcore_deopt_op>, are not quickened
+again. Nothing is rewritten while the run core doesn't allow quickening, while
+event checking swapped the op function table, or once the interpreter went
+multi threaded, as threads share the code segments.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_quicken_op(PARROT_INTERP, ARGMOD(opcode_t *pc), INTVAL base_type)
+{
+    ASSERT_ARGS(Parrot_runcore_quicken_op)
+    PackFile_ByteCode * const cs = interp->code;
+    opcode_t op;
+    size_t   i;
+
+    if (!can_quicken(interp, pc)
+    || (cs->deopt_sites && Parrot_hash_exists(interp, cs->deopt_sites, pc)))
+        return;
+
+    op = OP_INFO_OPNUM(cs->op_info_table[*pc]);
+
+    for (i = 0; i < N_QUICK_OPS; ++i) {
+        if (quick_ops[i].generic == op && quick_ops[i].base_type == base_type) {
+            *pc = map_core_op(interp, cs, quick_ops[i].quick);
+            return;
+        }
+    }
+}
+
+
+/*
+
+=item C<opcode_t * Parrot_runcore_deopt_op(PARROT_INTERP, opcode_t *pc)>
+
+Called by a quickened op at C<pc> whose operands don't have the types it was
+specialized for. Puts the generic op back at C<pc>, marks the site so it isn't
+quickened again, runs the generic op and returns the next op address.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+opcode_t *
+Parrot_runcore_deopt_op(PARROT_INTERP, ARGMOD(opcode_t *pc))
+{
+    ASSERT_ARGS(Parrot_runcore_deopt_op)
+    PackFile_ByteCode * const cs   = interp->code;
+    op_info_t        * const info = cs->op_info_table[*pc];
+    const opcode_t           op   = OP_INFO_OPNUM(info);
+    opcode_t                 generic = -1;
+    size_t                   i;
+
+    for (i = 0; i < N_QUICK_OPS; ++i) {
+        if (quick_ops[i].quick == op) {
+            generic = quick_ops[i].generic;
+            break;
+        }
+    }
+
+    PARROT_ASSERT(generic >= 0);
+
+    if (can_quicken(interp, pc)) {
+        if (!cs->deopt_sites)
+            cs->deopt_sites = Parrot_hash_new_pointer_hash(interp);
+
+        Parrot_hash_put(interp, cs->deopt_sites, pc, pc);
+        *pc = map_core_op(interp, cs, generic);
+    }
+
+    return (info->lib->op_func_table[generic])(pc, interp);
+}
+
+
+/*
+
+=item C<static int can_quicken(PARROT_INTERP, const opcode_t *pc)>
+
+Returns true if the op at C<pc> may be rewritten.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+can_quicken(PARROT_INTERP, ARGIN(const opcode_t *pc))
+{
+    ASSERT_ARGS(can_quicken)
+    const PackFile_ByteCode * const cs = interp->code;
+
+    return PARROT_RUNCORE_QUICKEN_TEST(interp->run_core)
+        && !cs->save_func_table
+        && !interp->thread_data
+        && pc >= cs->base.data
+        && pc <  cs->base.data + cs->base.size;
+}
+
+
+/*
+
+=item C<static opcode_t map_core_op(PARROT_INTERP, PackFile_ByteCode *cs,
+opcode_t op)>
+
+Returns the index of the core op C<op> in the op table of the code segment
+C<cs>, adding it to the table if the segment doesn't use it yet.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static opcode_t
+map_core_op(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs), opcode_t op)
+{
+    ASSERT_ARGS(map_core_op)
+    op_lib_t * const core_lib = PARROT_CORE_OPLIB_INIT(interp, 1);
+    PackFile_ByteCode_OpMappingEntry *om = NULL;
+    opcode_t i;
+
+    for (i = 0; i < cs->op_mapping.n_libs; ++i) {
+        if (cs->op_mapping.libs[i].lib == core_lib) {
+            om = &cs->op_mapping.libs[i];
+            break;
+        }
+    }
+
+    if (om) {
+        for (i = 0; i < om->n_ops; ++i)
+            if (om->lib_ops[i] == op)
+                return om->table_ops[i];
+    }
+    else {
+        cs->op_mapping.n_libs++;
+        cs->op_mapping.libs = mem_gc_realloc_n_typed_zeroed(interp,
+                                cs->op_mapping.libs,
+                                cs->op_mapping.n_libs, cs->op_mapping.n_libs - 1,
+                                PackFile_ByteCode_OpMappingEntry);
+
+        om            = &cs->op_mapping.libs[cs->op_mapping.n_libs - 1];
+        om->lib       = core_lib;
+        om->n_ops     = 0;
+        om->lib_ops   = mem_gc_allocate_n_zeroed_typed(interp, 0, opcode_t);
+        om->table_ops = mem_gc_allocate_n_zeroed_typed(interp, 0, opcode_t);
+    }
+
+    cs->op_count++;
+    cs->op_func_table = mem_gc_realloc_n_typed_zeroed(interp,
+                cs->op_func_table, cs->op_count, cs->op_count - 1, op_func_t);
+    cs->op_func_table[cs->op_count - 1] = core_lib->op_func_table[op];
+    cs->op_info_table = mem_gc_realloc_n_typed_zeroed(interp,
+                cs->op_info_table, cs->op_count, cs->op_count - 1, op_info_t *);
+    cs->op_info_table[cs->op_count - 1] = &core_lib->op_info_table[op];
+
+    om->n_ops++;
+    om->lib_ops   = mem_gc_realloc_n_typed_zeroed(interp, om->lib_ops,
+                        om->n_ops, om->n_ops - 1, opcode_t);
+    om->table_ops = mem_gc_realloc_n_typed_zeroed(interp, om->table_ops,
+                        om->n_ops, om->n_ops - 1, opcode_t);
+    om->lib_ops[om->n_ops - 1]   = op;
+    om->table_ops[om->n_ops - 1] = cs->op_count - 1;
+
+    return cs->op_count - 1;
+}
+
+
 /*
 
 =back
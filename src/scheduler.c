@@ -217,7 +217,7 @@ Parrot_cx_next_task(PARROT_INTERP, ARGIN(PMC *scheduler))
 
     interp->cur_task = task;
 
-    if (!VTABLE_isa(interp, task, CONST_STRING(interp, "Task")))
+    if (!Parrot_pmc_isa_type(interp, task, enum_class_Task))
         Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
             "Found a non-Task in the task queue");
 
@@ -347,7 +347,7 @@ Parrot_cx_stop_task(PARROT_INTERP, ARGIN(opcode_t *next))
 
     /* TODO: This check seems expensive. Do we need to have this active at all
        times, or can we make this conditional on NDEBUG? */
-    if (PMC_IS_NULL(task) || !VTABLE_isa(interp, task, CONST_STRING(interp, "Task")))
+    if (PMC_IS_NULL(task) || !Parrot_pmc_isa_type(interp, task, enum_class_Task))
         Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_OPERATION,
             "Attempt to stop invalid interp->current_task");
 
@@ -427,9 +427,9 @@ Parrot_cx_schedule_task(PARROT_INTERP, ARGIN(PMC *task_or_sub))
             "Scheduler was not initialized for this interpreter");
 
     /* TODO: Can we do anything less expensive than an ISA check here? */
-    if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Task")))
+    if (Parrot_pmc_isa_type(interp, task_or_sub, enum_class_Task))
         task = task_or_sub;
-    else if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Sub"))) {
+    else if (Parrot_pmc_isa_type(interp, task_or_sub, enum_class_Sub)) {
         Parrot_Task_attributes *tdata;
         task  = Parrot_pmc_new(interp, enum_class_Task);
         tdata = PARROT_TASK(task);
@@ -509,9 +509,9 @@ Parrot_cx_schedule_immediate(PARROT_INTERP, ARGIN(PMC *task_or_sub))
     PMC *task;
 
     /* TODO: Can we do something less expensive than ISA? */
-    if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Task")))
+    if (Parrot_pmc_isa_type(interp, task_or_sub, enum_class_Task))
         task = task_or_sub;
-    else if (VTABLE_isa(interp, task_or_sub, CONST_STRING(interp, "Sub"))) {
+    else if (Parrot_pmc_isa_type(interp, task_or_sub, enum_class_Sub)) {
         Parrot_Task_attributes *tdata;
         task  = Parrot_pmc_new(interp, enum_class_Task);
         tdata = PARROT_TASK(task);
@@ -43,6 +43,19 @@ STRING *STRINGNULL;
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL str_to_int_bytes(PARROT_INTERP, ARGIN(const STRING *s))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static int str_to_num_bytes(
+    ARGIN(const STRING *s),
+    ARGOUT(FLOATVAL *result))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*result);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_PURE_FUNCTION
 static INTVAL string_max_bytes(PARROT_INTERP,
@@ -74,6 +87,12 @@ static void throw_illegal_escape_char(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+#define ASSERT_ARGS_str_to_int_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_str_to_num_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(s) \
+    , PARROT_ASSERT_ARG(result))
 #define ASSERT_ARGS_string_max_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(s))
 #define ASSERT_ARGS_string_rep_compatible __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -425,6 +444,12 @@ Parrot_str_copy(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
     /* Clear live flag. It might be set on constant strings */
     PObj_live_CLEAR(d);
 
+    /* Inline contents belong to the source header; point at our own copy */
+    if (STRING_is_inline(s)) {
+        Buffer_bufstart(d) = d->inline_buf;
+        d->strstart        = d->inline_buf + (s->strstart - s->inline_buf);
+    }
+
     /* Set the string copy flag */
     PObj_is_string_copy_SET(d);
 
@@ -1912,6 +1937,37 @@ typedef enum number_parse_state {
     parse_end
 } number_parse_state;
 
+/* Powers of ten that are exactly representable as a FLOATVAL. Together with
+   a mantissa of at most MAX_EXACT_DIGITS digits, multiplying or dividing by
+   one of these is a single correctly rounded operation. */
+
+#define MAX_EXACT_DIGITS 15
+#define MAX_EXACT_POW10  22
+
+/* Longest digit string passed to strtod by the byte-wise number parser */
+
+#define MAX_PARSE_DIGITS 360
+
+static const FLOATVAL exact_powers_of_ten[MAX_EXACT_POW10 + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/* Two ASCII digits for every value below 100, used to format integers
+   two digits at a time. */
+
+static const char decimal_digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
 
 /*
 
@@ -1944,6 +2000,8 @@ Parrot_str_to_int(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
     ASSERT_ARGS(Parrot_str_to_int)
     if (STRING_IS_NULL(s))
         return 0;
+    else if (s->bufused == s->strlen)
+        return str_to_int_bytes(interp, s);
     else {
         const UINTVAL       max_safe  = -(UINTVAL)PARROT_INTVAL_MIN / 10;
         const UINTVAL       last_dig  = (-(UINTVAL)PARROT_INTVAL_MIN) % 10;
@@ -1990,12 +2048,175 @@ Parrot_str_to_int(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
 }
 
 
+/*
+
+=item C<static INTVAL str_to_int_bytes(PARROT_INTERP, const STRING *s)>
+
+Fast path of C<Parrot_str_to_int> for strings with one byte per character,
+which are scanned directly instead of through a string iterator.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+str_to_int_bytes(PARROT_INTERP, ARGIN(const STRING *s))
+{
+    ASSERT_ARGS(str_to_int_bytes)
+    const UINTVAL              max_safe = -(UINTVAL)PARROT_INTVAL_MIN / 10;
+    const UINTVAL              last_dig = (-(UINTVAL)PARROT_INTVAL_MIN) % 10;
+    const unsigned char       *p        = (const unsigned char *)s->strstart;
+    const unsigned char * const end     = p + s->bufused;
+    int                        sign     = 1;
+    UINTVAL                    i        = 0;
+
+    while (p < end && *p == ' ')
+        ++p;
+
+    if (p < end && (*p == '-' || *p == '+')) {
+        if (*p == '-')
+            sign = -1;
+        ++p;
+    }
+
+    for (; p < end; ++p) {
+        const UINTVAL nextval = *p - (UINTVAL)'0';
+        if (nextval > 9)
+            break;
+        if (i < max_safe || (i == max_safe && nextval <= last_dig))
+            i = i * 10 + nextval;
+        else
+            Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_ERR_OVERFLOW,
+                "Integer value of String '%S' too big", s);
+    }
+
+    if (sign == 1 && i > (UINTVAL)PARROT_INTVAL_MAX)
+        Parrot_ex_throw_from_c_args(interp, NULL,
+                EXCEPTION_ERR_OVERFLOW,
+                "Integer value of String '%S' too big", s);
+    return sign == -1 ? -i : i;
+}
+
+
+/*
+
+=item C<static int str_to_num_bytes(const STRING *s, FLOATVAL *result)>
+
+Fast path of C<Parrot_str_to_num> for strings with one byte per character,
+which accepts the same syntax as the general parser but rounds correctly.
+
+Numbers with at most C<MAX_EXACT_DIGITS> significant digits and a decimal
+exponent within C<MAX_EXACT_POW10> are computed by a single multiplication
+or division. Longer numbers are handed to C<strtod> as a string of
+significant digits and an exponent, without a locale-dependent decimal
+point.
+
+Returns 0 if the number has to go through the general parser, which
+includes empty strings, NaN, Inf and numbers with more than
+C<MAX_PARSE_DIGITS> significant digits.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+str_to_num_bytes(ARGIN(const STRING *s), ARGOUT(FLOATVAL *result))
+{
+    ASSERT_ARGS(str_to_num_bytes)
+    const char       *p          = s->strstart;
+    const char * const end       = p + s->bufused;
+    char              digits[MAX_PARSE_DIGITS + 16];
+    int               n_digits   = 0;
+    int               seen_digit = 0;
+    int               negative   = 0;
+    UHUGEINTVAL       m          = 0;
+    INTVAL            exp10      = 0;
+    FLOATVAL          f;
+
+    while (p < end && isspace((unsigned char)*p))
+        ++p;
+
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+
+    for (; p < end && isdigit((unsigned char)*p); ++p) {
+        seen_digit = 1;
+        if (n_digits == 0 && *p == '0')
+            continue;
+        if (n_digits == MAX_PARSE_DIGITS)
+            return 0;
+        digits[n_digits++] = *p;
+        m = m * 10 + (*p - '0');
+    }
+
+    if (p < end && *p == '.') {
+        for (++p; p < end && isdigit((unsigned char)*p); ++p) {
+            seen_digit = 1;
+            --exp10;
+            if (n_digits == 0 && *p == '0')
+                continue;
+            if (n_digits == MAX_PARSE_DIGITS)
+                return 0;
+            digits[n_digits++] = *p;
+            m = m * 10 + (*p - '0');
+        }
+    }
+
+    if (!seen_digit)
+        return 0;
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        INTVAL e          = 0;
+        int    e_negative = 0;
+
+        ++p;
+        if (p < end && (*p == '-' || *p == '+')) {
+            e_negative = *p == '-';
+            ++p;
+        }
+
+        for (; p < end && isdigit((unsigned char)*p); ++p) {
+            e = e * 10 + (*p - '0');
+            if (e > 99999)
+                return 0;
+        }
+
+        exp10 += e_negative ? -e : e;
+    }
+
+    if (n_digits == 0)
+        f = 0.0;
+    else if (n_digits <= MAX_EXACT_DIGITS
+         &&  exp10 >= -MAX_EXACT_POW10 && exp10 <= MAX_EXACT_POW10) {
+        if (exp10 < 0)
+            f = (FLOATVAL)m / exact_powers_of_ten[-exp10];
+        else
+            f = (FLOATVAL)m * exact_powers_of_ten[exp10];
+    }
+    else {
+        sprintf(digits + n_digits, "e%d", (int)exp10);
+        f = strtod(digits, NULL);
+    }
+
+    *result = negative ? -f : f;
+    return 1;
+}
+
+
 /*
 
 =item C<FLOATVAL Parrot_str_to_num(PARROT_INTERP, const STRING *s)>
 
 Converts a numeric Parrot STRING to a floating point number.
 
+Strings with one byte per character are tried with C<str_to_num_bytes>
+first; everything else goes through a general state machine.
+
 =cut
 
 */
@@ -2026,6 +2247,9 @@ Parrot_str_to_num(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
     if (STRING_IS_NULL(s))
         return 0.0;
 
+    if (s->bufused == s->strlen && str_to_num_bytes(s, &f))
+        return f;
+
     STRING_ITER_INIT(interp, &iter);
 
     /* Handcrafted FSM to read float value */
@@ -2201,6 +2425,11 @@ Parrot_str_from_int(PARROT_INTERP, INTVAL i)
 
 Returns a Parrot string representation of the specified floating-point value.
 
+Integral values are formatted like integers, and other values that don't
+need an exponent are formatted directly with C<FLOATVAL_FMT>. Everything
+else (exponents, NaN and Inf) goes through C<Parrot_sprintf_c>, which
+canonicalizes them.
+
 =cut
 
 */
@@ -2212,10 +2441,31 @@ STRING *
 Parrot_str_from_num(PARROT_INTERP, FLOATVAL f)
 {
     ASSERT_ARGS(Parrot_str_from_num)
-    /* Too damn hard--hand it off to Parrot_sprintf, which'll probably
-       use the system sprintf anyway, but has gigantic buffers that are
-       awfully hard to overflow. */
-    return Parrot_sprintf_c(interp, FLOATVAL_FMT, f);
+    char buf[128];
+
+    if (PARROT_FLOATVAL_IS_INF_OR_NAN(f))
+        return Parrot_sprintf_c(interp, FLOATVAL_FMT, f);
+
+    /* Below 10**MAX_EXACT_DIGITS an integral value prints all its digits */
+    if (f != 0.0 && f > -exact_powers_of_ten[MAX_EXACT_DIGITS]
+                 && f <  exact_powers_of_ten[MAX_EXACT_DIGITS]) {
+        const HUGEINTVAL i = (HUGEINTVAL)f;
+
+        if ((FLOATVAL)i == f)
+            return Parrot_str_from_int_base(interp, buf, i, 10);
+    }
+
+#ifdef PARROT_HAS_SNPRINTF
+    snprintf(buf, sizeof (buf), FLOATVAL_FMT, f);
+#else
+    sprintf(buf, FLOATVAL_FMT, f);
+#endif
+
+    if (strchr(buf, 'e'))
+        return Parrot_sprintf_c(interp, FLOATVAL_FMT, f);
+
+    return Parrot_str_new_init(interp, buf, strlen(buf),
+            Parrot_default_encoding_ptr, 0);
 }
 
 
@@ -3335,15 +3585,34 @@ Parrot_str_from_uint(PARROT_INTERP, ARGOUT(char *tc), UHUGEINTVAL num,
 
     PARROT_ASSERT(base >= 2 && base <= 36);
 
-    do {
-        const char cur = (char)(num % base);
+    if (base == 10) {
+        /* Division by a constant is cheap, and a pair at a time halves it */
+        while (num >= 100) {
+            const unsigned int pair = (unsigned int)(num % 100) * 2;
+            num /= 100;
+            *--p = decimal_digit_pairs[pair + 1];
+            *--p = decimal_digit_pairs[pair];
+        }
 
-        if (cur < 10)
-            *--p = (char)('0' + cur);
+        if (num >= 10) {
+            const unsigned int pair = (unsigned int)num * 2;
+            *--p = decimal_digit_pairs[pair + 1];
+            *--p = decimal_digit_pairs[pair];
+        }
         else
-            *--p = (char)('a' + cur - 10);
+            *--p = (char)('0' + num);
+    }
+    else {
+        do {
+            const char cur = (char)(num % base);
 
-    } while (num /= base);
+            if (cur < 10)
+                *--p = (char)('0' + cur);
+            else
+                *--p = (char)('a' + cur - 10);
+
+        } while (num /= base);
+    }
 
     if (minus)
         *--p = '-';
@@ -21,34 +21,55 @@ Functions starting with unicode_ work with unicode strings.
 
 #include "parrot/parrot.h"
 #include "tables.h"
+#include "unicode.h"
+#include "unicode_tables.h"
 #include "shared.h"
 
 #if PARROT_HAS_ICU
 #  include <unicode/ucnv.h>
 #  include <unicode/utypes.h>
 #  include <unicode/uchar.h>
-#  include <unicode/ustring.h>
-#  include <unicode/unorm.h>
 #endif
 
+/* Hangul syllable (de)composition, see section 3.12 of the Unicode standard */
+#define HANGUL_S_BASE   0xAC00
+#define HANGUL_L_BASE   0x1100
+#define HANGUL_V_BASE   0x1161
+#define HANGUL_T_BASE   0x11A7
+#define HANGUL_L_COUNT  19
+#define HANGUL_V_COUNT  21
+#define HANGUL_T_COUNT  28
+#define HANGUL_N_COUNT  (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT  (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+/* room for the longest case mapping of one codepoint in UTF-8 */
+#define CASE_MAX_BYTES  (PARROT_UNICODE_MAX_CASE * UTF8_MAXLEN)
+
 /* HEADERIZER HFILE: src/string/encoding/shared.h */
 
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
-static size_t convert_case_buf(PARROT_INTERP,
-    ARGMOD_NULLOK(char *dest_buf),
-    size_t dest_len,
-    ARGIN(const char *src_buf),
-    size_t src_len,
-    int mode)
-        __attribute__nonnull__(1)
-        __attribute__nonnull__(4)
-        FUNC_MODIFIES(*dest_buf);
-
 static int u_iscclass(PARROT_INTERP, UINTVAL codepoint, INTVAL flags)
         __attribute__nonnull__(1);
 
+PARROT_PURE_FUNCTION
+PARROT_CANNOT_RETURN_NULL
+static const Parrot_unicode_case_t * unicode_case_record(UINTVAL c);
+
+static int unicode_cased_follows(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    ARGIN(const String_iter *pos))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_PURE_FUNCTION
+static unsigned int unicode_ccc(UINTVAL c);
+
+PARROT_PURE_FUNCTION
+static Parrot_UInt4 unicode_compose_pair(UINTVAL first, UINTVAL second);
+
 PARROT_CANNOT_RETURN_NULL
 static STRING* unicode_convert_case(PARROT_INTERP,
     ARGIN(const STRING *src),
@@ -56,14 +77,71 @@ static STRING* unicode_convert_case(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
-#define ASSERT_ARGS_convert_case_buf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(interp) \
-    , PARROT_ASSERT_ARG(src_buf))
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Parrot_UInt4 * unicode_decompose_buf(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    ARGOUT(UINTVAL *len))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*len);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * unicode_from_buf(PARROT_INTERP,
+    ARGIN(const Parrot_UInt4 *buf),
+    UINTVAL len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static int unicode_is_normalized(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    unsigned int maybe)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static UINTVAL unicode_next(PARROT_INTERP,
+    ARGIN(const STRING *src),
+    ARGMOD(String_iter *iter))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*iter);
+
+PARROT_CANNOT_RETURN_NULL
+static char * unicode_put_utf8(ARGOUT(char *p), UINTVAL c)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*p);
+
 #define ASSERT_ARGS_u_iscclass __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_unicode_case_record __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_unicode_cased_follows __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src) \
+    , PARROT_ASSERT_ARG(pos))
+#define ASSERT_ARGS_unicode_ccc __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_unicode_compose_pair __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_unicode_convert_case __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_unicode_decompose_buf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src) \
+    , PARROT_ASSERT_ARG(len))
+#define ASSERT_ARGS_unicode_from_buf __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_unicode_is_normalized __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src))
+#define ASSERT_ARGS_unicode_next __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(src) \
+    , PARROT_ASSERT_ARG(iter))
+#define ASSERT_ARGS_unicode_put_utf8 __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(p))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -759,20 +837,31 @@ encoding_get_graphemes(PARROT_INTERP, ARGIN(const STRING *src), UINTVAL offset,
 
 =item C<STRING* encoding_decompose(PARROT_INTERP, const STRING *src)>
 
-Decompose function. This function is not yet implemented.
+Decomposes the STRING C<src> into Normalization Form D (NFD), using the
+built-in Unicode tables.  The result is UTF-8 encoded unless C<src> is
+already decomposed.
 
 =cut
 
 */
 
-PARROT_DOES_NOT_RETURN
+PARROT_CANNOT_RETURN_NULL
 STRING*
-encoding_decompose(PARROT_INTERP, SHIM(const STRING *src))
+encoding_decompose(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(encoding_decompose)
-    /* TODO: https://trac.parrot.org/parrot/wiki/StringsTasklist Implement this. */
-    Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_UNIMPLEMENTED,
-        "Decompose not implemented");
+    STRING       *dest;
+    Parrot_UInt4 *buf;
+    UINTVAL       len;
+
+    if (unicode_is_normalized(interp, src, PARROT_UNICODE_NFD_MAYBE))
+        return Parrot_str_copy(interp, src);
+
+    buf  = unicode_decompose_buf(interp, src, &len);
+    dest = unicode_from_buf(interp, buf, len);
+    mem_gc_free(interp, buf);
+
+    return dest;
 }
 
 
@@ -1374,10 +1463,8 @@ unicode_chr(PARROT_INTERP, UINTVAL codepoint)
 
 =item C<STRING* unicode_compose(PARROT_INTERP, const STRING *src)>
 
-If Parrot is built with ICU, composes the STRING C<src>. Attempts to
-denormalize the STRING into the ICU default, NFC.
-
-If Parrot does not have ICU included, throws an exception.
+Composes the STRING C<src> into Normalization Form C (NFC), using the
+built-in Unicode tables.  The result is UTF-8 encoded.
 
 =cut
 
@@ -1388,152 +1475,444 @@ STRING*
 unicode_compose(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(unicode_compose)
-#if PARROT_HAS_ICU
-    STRING *dest;
-    int src_len, dest_len;
-    UErrorCode err;
-    /*
-       U_STABLE int32_t U_EXPORT2
-       unorm_normalize(const UChar *source, int32_t sourceLength,
-       UNormalizationMode mode, int32_t options,
-       UChar *result, int32_t resultLength,
-       UErrorCode *status);
-       */
-    dest_len = src_len = src->strlen;
-    dest     = Parrot_str_new_init(interp, NULL, src_len * sizeof (UChar),
-            src->encoding, 0);
-
-    err      = U_ZERO_ERROR;
-    dest_len = unorm_normalize((UChar *)src->strstart, src_len,
-            UNORM_DEFAULT,      /* default is NFC */
-            0,                  /* options 0 default - no specific icu
-                                 * version */
-            (UChar *)dest->strstart, dest_len, &err);
-
-    dest->bufused = dest_len * sizeof (UChar);
-
-    if (!U_SUCCESS(err)) {
-        err = U_ZERO_ERROR;
-        Parrot_gc_reallocate_string_storage(interp, dest, dest->bufused);
-        dest_len = unorm_normalize((UChar *)src->strstart, src_len,
-                UNORM_DEFAULT,      /* default is NFC */
-                0,                  /* options 0 default - no specific
-                                     * icu version */
-                (UChar *)dest->strstart, dest_len, &err);
-        PARROT_ASSERT(U_SUCCESS(err));
-        dest->bufused = dest_len * sizeof (UChar);
+    STRING       *dest;
+    Parrot_UInt4 *buf;
+    UINTVAL       len, i, out, starter;
+    unsigned int  last_ccc;
+
+    if (unicode_is_normalized(interp, src, PARROT_UNICODE_NFC_MAYBE))
+        return Parrot_str_copy(interp, src);
+
+    buf = unicode_decompose_buf(interp, src, &len);
+
+    /* canonical composition, see section 3.11 of the Unicode standard */
+    starter  = 0;
+    last_ccc = unicode_ccc(buf[0]) ? 256 : 0;
+    out      = 1;
+
+    for (i = 1; i < len; ++i) {
+        const Parrot_UInt4 c   = buf[i];
+        const unsigned int ccc = unicode_ccc(c);
+
+        if (last_ccc < ccc || last_ccc == 0) {
+            const Parrot_UInt4 composite = unicode_compose_pair(buf[starter], c);
+
+            if (composite) {
+                buf[starter] = composite;
+                continue;
+            }
+        }
+
+        if (ccc == 0)
+            starter = out;
+
+        last_ccc   = ccc;
+        buf[out++] = c;
     }
-    dest->strlen = dest_len;
+
+    dest = unicode_from_buf(interp, buf, out);
+    mem_gc_free(interp, buf);
+
     return dest;
-#else
-    UNUSED(src);
-    Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_LIBRARY_ERROR,
-        "no ICU lib loaded");
-#endif
 }
 
 
-#define ENCODING_UPCASE     1
-#define ENCODING_DOWNCASE   2
-#define ENCODING_TITLECASE  3
-#define ENCODING_FOLDCASE   4
+/*
+
+=item C<static UINTVAL unicode_next(PARROT_INTERP, const STRING *src,
+String_iter *iter)>
+
+Returns the codepoint of C<src> at C<iter> and advances C<iter>.  UTF-8 is
+decoded in place; other encodings go through their iterator.
+
+=cut
+
+*/
+
+static UINTVAL
+unicode_next(PARROT_INTERP, ARGIN(const STRING *src), ARGMOD(String_iter *iter))
+{
+    ASSERT_ARGS(unicode_next)
+
+    if (src->encoding == Parrot_utf8_encoding_ptr) {
+        const unsigned char * const p =
+            (const unsigned char *)src->strstart + iter->bytepos;
+        UINTVAL c = *p;
+        UINTVAL len, i;
+
+        ++iter->charpos;
+
+        if (c < 0x80) {
+            ++iter->bytepos;
+            return c;
+        }
+
+        len = c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+        c  &= UTF8_START_MASK(len);
+
+        for (i = 1; i < len; ++i)
+            c = UTF8_ACCUMULATE(c, p[i]);
+
+        iter->bytepos += len;
+        return c;
+    }
+
+    return STRING_iter_get_and_advance(interp, src, iter);
+}
+
 
 /*
 
-=item C<static size_t convert_case_buf(PARROT_INTERP, char *dest_buf, size_t
-dest_len, const char *src_buf, size_t src_len, int mode)>
+=item C<static int unicode_is_normalized(PARROT_INTERP, const STRING *src,
+unsigned int maybe)>
+
+Runs the quick check of UAX #15 over C<src>.  C<maybe> selects the form,
+C<PARROT_UNICODE_NFC_MAYBE> or C<PARROT_UNICODE_NFD_MAYBE>.  Returns true if
+C<src> is known to be in that form already, false if it must be normalized.
+
+=cut
+
+*/
+
+static int
+unicode_is_normalized(PARROT_INTERP, ARGIN(const STRING *src), unsigned int maybe)
+{
+    ASSERT_ARGS(unicode_is_normalized)
+    const UINTVAL limit = maybe == PARROT_UNICODE_NFC_MAYBE
+                        ? PARROT_UNICODE_NFC_QUICK_LIMIT
+                        : PARROT_UNICODE_NFD_QUICK_LIMIT;
+    unsigned int  last_ccc = 0;
+    String_iter   iter;
+
+    if (src->bufused == src->strlen
+    &&  src->encoding == Parrot_utf8_encoding_ptr)
+        return 1;
 
-Converts a UTF-16 buffer to upper, lower or title case using the ICU library.
+    STRING_ITER_INIT(interp, &iter);
+
+    while (iter.charpos < src->strlen) {
+        const UINTVAL c = unicode_next(interp, src, &iter);
+        unsigned int  ccc;
+
+        if (c < limit) {
+            last_ccc = 0;
+            continue;
+        }
 
-Throws an exception if ICU is not installed.
+        ccc = unicode_ccc(c);
+
+        if (ccc && last_ccc > ccc)
+            return 0;
+
+        if (c < PARROT_UNICODE_QC_LIMIT && (PARROT_UNICODE_LOOKUP(qc, c) & maybe))
+            return 0;
+
+        last_ccc = ccc;
+    }
+
+    return 1;
+}
+
+
+/*
+
+=item C<static unsigned int unicode_ccc(UINTVAL c)>
+
+Returns the canonical combining class of the codepoint C<c>.
 
 =cut
 
 */
 
-static size_t
-convert_case_buf(PARROT_INTERP, ARGMOD_NULLOK(char *dest_buf), size_t dest_len,
-    ARGIN(const char *src_buf), size_t src_len, int mode)
+PARROT_PURE_FUNCTION
+static unsigned int
+unicode_ccc(UINTVAL c)
 {
-    ASSERT_ARGS(convert_case_buf)
-#if PARROT_HAS_ICU
-    UErrorCode err = U_ZERO_ERROR;
-    int        res;
-    UNUSED(interp);
+    ASSERT_ARGS(unicode_ccc)
 
-    switch (mode) {
-      case ENCODING_UPCASE:
-        res = u_strToUpper((UChar *)dest_buf, dest_len / 2,
-                           (const UChar *)src_buf, src_len / 2, NULL, &err);
-        break;
-      case ENCODING_DOWNCASE:
-        res = u_strToLower((UChar *)dest_buf, dest_len / 2,
-                           (const UChar *)src_buf, src_len / 2, NULL, &err);
-        break;
-      case ENCODING_TITLECASE:
-        res = u_strToTitle((UChar *)dest_buf, dest_len / 2,
-                           (const UChar *)src_buf, src_len / 2,
-                           NULL, NULL, &err);
-        break;
-      case ENCODING_FOLDCASE:
-        res = u_strFoldCase((UChar *)dest_buf, dest_len / 2,
-                            (const UChar *)src_buf, src_len / 2,
-                            U_FOLD_CASE_DEFAULT, &err);
-        break;
-      default:
-        res = 0; /* Should never happen, just to avoid a warning */
-        break;
+    return c < PARROT_UNICODE_CCC_LIMIT ? PARROT_UNICODE_LOOKUP(ccc, c) : 0;
+}
+
+
+/*
+
+=item C<static Parrot_UInt4 unicode_compose_pair(UINTVAL first, UINTVAL second)>
+
+Returns the primary composite of the codepoints C<first> and C<second>, or 0
+if they do not compose.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+static Parrot_UInt4
+unicode_compose_pair(UINTVAL first, UINTVAL second)
+{
+    ASSERT_ARGS(unicode_compose_pair)
+    INTVAL lo = 0;
+    INTVAL hi = PARROT_UNICODE_N_COMPOSITIONS - 1;
+
+    /* <L, V> */
+    if (first  - HANGUL_L_BASE < HANGUL_L_COUNT
+    &&  second - HANGUL_V_BASE < HANGUL_V_COUNT)
+        return HANGUL_S_BASE + HANGUL_T_COUNT *
+            ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + second - HANGUL_V_BASE);
+
+    /* <LV, T> */
+    if (first - HANGUL_S_BASE < HANGUL_S_COUNT
+    && (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0
+    &&  second - HANGUL_T_BASE - 1 < HANGUL_T_COUNT - 1)
+        return first + second - HANGUL_T_BASE;
+
+    while (lo <= hi) {
+        const INTVAL mid = (lo + hi) / 2;
+        const Parrot_unicode_composition_t * const comp =
+            &Parrot_unicode_compositions[mid];
+
+        if (comp->first < first
+        || (comp->first == first && comp->second < second))
+            lo = mid + 1;
+        else if (comp->first == first && comp->second == second)
+            return comp->composite;
+        else
+            hi = mid - 1;
     }
 
-    if (dest_buf != NULL)
-        PARROT_ASSERT(U_SUCCESS(err));
+    return 0;
+}
 
-    return res * 2;
-#else
-    if (mode == ENCODING_TITLECASE)
-        Parrot_ex_throw_from_c_noargs(interp,
-            EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");
-    else if (dest_buf) {
-        const Parrot_UInt2 *s = (const Parrot_UInt2 *)src_buf;
-        Parrot_UInt2       *d = (Parrot_UInt2 *)dest_buf;
-        UINTVAL len = src_len / 2;
-        UINTVAL i;
-
-        for (i = 0; i < len; ++i) {
-            unsigned int c = s[i];
-            if (c > 255) {
-                Parrot_ex_throw_from_c_noargs(interp,
-                     EXCEPTION_LIBRARY_ERROR, "no ICU lib loaded");
-            }
-            switch (mode) {
-              case ENCODING_UPCASE:
-                d[i] = (c >= 0xe0 && c != 0xf7)
-                         ? c & ~0x20
-                         : (Parrot_UInt2)toupper((unsigned char)c);
-                break;
-              case ENCODING_DOWNCASE:
-                d[i] = (c >= 0xc0 && c != 0xd7 && c <= 0xde)
-                         ? c | 0x20
-                         : (Parrot_UInt2)tolower((unsigned char)c);
-                break;
-              default:
-                d[i] = s[i];
-            }
+
+/*
+
+=item C<static Parrot_UInt4 * unicode_decompose_buf(PARROT_INTERP, const STRING
+*src, UINTVAL *len)>
+
+Returns a newly allocated buffer holding the canonically ordered, fully
+decomposed (NFD) codepoints of C<src> and stores their number in C<len>.  The
+caller must free the buffer.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Parrot_UInt4 *
+unicode_decompose_buf(PARROT_INTERP, ARGIN(const STRING *src), ARGOUT(UINTVAL *len))
+{
+    ASSERT_ARGS(unicode_decompose_buf)
+    Parrot_UInt4 * const buf = mem_gc_allocate_n_typed(interp,
+            src->strlen * PARROT_UNICODE_MAX_DECOMP + 1, Parrot_UInt4);
+    String_iter  iter;
+    UINTVAL      n = 0;
+    UINTVAL      i;
+
+    STRING_ITER_INIT(interp, &iter);
+
+    while (iter.charpos < src->strlen) {
+        const UINTVAL c = unicode_next(interp, src, &iter);
+        UINTVAL       offset;
+
+        if (c - HANGUL_S_BASE < HANGUL_S_COUNT) {
+            const UINTVAL s = c - HANGUL_S_BASE;
+
+            buf[n++] = HANGUL_L_BASE + s / HANGUL_N_COUNT;
+            buf[n++] = HANGUL_V_BASE + (s % HANGUL_N_COUNT) / HANGUL_T_COUNT;
+
+            if (s % HANGUL_T_COUNT)
+                buf[n++] = HANGUL_T_BASE + s % HANGUL_T_COUNT;
         }
+        else if (c < PARROT_UNICODE_DECOMP_LIMIT
+             && (offset = PARROT_UNICODE_LOOKUP(decomp, c)) != 0) {
+            const Parrot_UInt4 *d     = &Parrot_unicode_decomp_data[offset];
+            UINTVAL             count = *d++;
+
+            while (count--)
+                buf[n++] = *d++;
+        }
+        else
+            buf[n++] = c;
     }
 
-    UNUSED(dest_len);
-    return src_len;
-#endif
+    /* canonical ordering: stable sort of each run of non-starters */
+    for (i = 1; i < n; ++i) {
+        const Parrot_UInt4 c   = buf[i];
+        const unsigned int ccc = unicode_ccc(c);
+        UINTVAL            j   = i;
+
+        if (ccc == 0)
+            continue;
+
+        while (j > 0 && unicode_ccc(buf[j - 1]) > ccc) {
+            buf[j] = buf[j - 1];
+            --j;
+        }
+
+        buf[j] = c;
+    }
+
+    *len = n;
+    return buf;
+}
+
+
+/*
+
+=item C<static STRING * unicode_from_buf(PARROT_INTERP, const Parrot_UInt4 *buf,
+UINTVAL len)>
+
+Creates a UTF-8 STRING from the C<len> codepoints in C<buf>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+unicode_from_buf(PARROT_INTERP, ARGIN(const Parrot_UInt4 *buf), UINTVAL len)
+{
+    ASSERT_ARGS(unicode_from_buf)
+    STRING *dest;
+    char   *p;
+    UINTVAL size = 0;
+    UINTVAL i;
+
+    for (i = 0; i < len; ++i)
+        size += UNISKIP(buf[i]);
+
+    dest = Parrot_str_new_init(interp, NULL, size, Parrot_utf8_encoding_ptr, 0);
+    p    = dest->strstart;
+
+    for (i = 0; i < len; ++i)
+        p = unicode_put_utf8(p, buf[i]);
+
+    dest->bufused = size;
+    dest->strlen  = len;
+
+    return dest;
 }
 
 
+/*
+
+=item C<static char * unicode_put_utf8(char *p, UINTVAL c)>
+
+Writes the UTF-8 encoding of the codepoint C<c> to C<p> and returns the
+position after it.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static char *
+unicode_put_utf8(ARGOUT(char *p), UINTVAL c)
+{
+    ASSERT_ARGS(unicode_put_utf8)
+    UINTVAL  len;
+    char    *end;
+
+    if (c < 0x80) {
+        *p = (char)c;
+        return p + 1;
+    }
+
+    len = UNISKIP(c);
+    end = p + len - 1;
+
+    while (end > p) {
+        *end-- = (char)((c & UTF8_CONTINUATION_MASK) | UTF8_CONTINUATION_MARK);
+        c >>= UTF8_ACCUMULATION_SHIFT;
+    }
+
+    *end = (char)(c | UTF8_START_MARK(len));
+
+    return p + len;
+}
+
+
+/*
+
+=item C<static const Parrot_unicode_case_t * unicode_case_record(UINTVAL c)>
+
+Returns the case mapping record of the codepoint C<c>.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_CANNOT_RETURN_NULL
+static const Parrot_unicode_case_t *
+unicode_case_record(UINTVAL c)
+{
+    ASSERT_ARGS(unicode_case_record)
+
+    if (c >= PARROT_UNICODE_CASE_LIMIT)
+        return &Parrot_unicode_case_records[0];
+
+    return &Parrot_unicode_case_records[PARROT_UNICODE_LOOKUP(case, c)];
+}
+
+
+/*
+
+=item C<static int unicode_cased_follows(PARROT_INTERP, const STRING *src, const
+String_iter *pos)>
+
+Returns true if the first codepoint of C<src> after C<pos> that is not case
+ignorable is cased.  Used for the Final_Sigma condition.
+
+=cut
+
+*/
+
+static int
+unicode_cased_follows(PARROT_INTERP, ARGIN(const STRING *src),
+        ARGIN(const String_iter *pos))
+{
+    ASSERT_ARGS(unicode_cased_follows)
+    String_iter iter = *pos;
+
+    while (iter.charpos < src->strlen) {
+        const UINTVAL      c     = unicode_next(interp, src, &iter);
+        const unsigned int flags = unicode_case_record(c)->flags;
+
+        if (!(flags & PARROT_UNICODE_CASE_IGNORABLE))
+            return flags & PARROT_UNICODE_CASED;
+    }
+
+    return 0;
+}
+
+
+#define ENCODING_UPCASE     PARROT_UNICODE_UPPER
+#define ENCODING_DOWNCASE   PARROT_UNICODE_LOWER
+#define ENCODING_TITLECASE  PARROT_UNICODE_TITLE
+#define ENCODING_FOLDCASE   PARROT_UNICODE_FOLD
+
+#define GREEK_CAPITAL_SIGMA 0x03A3
+#define GREEK_FINAL_SIGMA   0x03C2
+
+/* the case ignorable ASCII characters */
+#define ASCII_CASE_IGNORABLE(c) \
+    ((c) == '\'' || (c) == '.' || (c) == ':' || (c) == '^' || (c) == '`')
+
 /*
 
 =item C<static STRING* unicode_convert_case(PARROT_INTERP, const STRING *src,
 int mode)>
 
-Converts the string to upper, lower or title case.
+Converts the string to upper, lower, title or fold case using the full case
+mappings from the built-in Unicode tables.  The source is read one codepoint
+at a time and the UTF-8 result is written directly; ASCII bytes of UTF-8
+sources skip the table lookup.
+
+Title case maps each cased character that does not follow another cased
+character (ignoring case ignorable ones) to title case, and the rest to lower
+case.
 
 =cut
 
@@ -1544,28 +1923,97 @@ static STRING*
 unicode_convert_case(PARROT_INTERP, ARGIN(const STRING *src), int mode)
 {
     ASSERT_ARGS(unicode_convert_case)
-    STRING *dest;
-    size_t  dest_len;
+    const unsigned char * const bytes =
+        src->encoding == Parrot_utf8_encoding_ptr
+            ? (const unsigned char *)src->strstart
+            : NULL;
+    STRING      *dest;
+    char        *p, *end;
+    String_iter  iter;
+    UINTVAL      len   = 0;
+    int          cased = 0;
+
+    dest = Parrot_str_new_init(interp, NULL, src->bufused + CASE_MAX_BYTES,
+            Parrot_utf8_encoding_ptr, 0);
+    p    = dest->strstart;
+    end  = (char *)Buffer_bufstart(dest) + Buffer_buflen(dest);
+
+    STRING_ITER_INIT(interp, &iter);
 
-    if (src->encoding != Parrot_utf16_encoding_ptr
-    &&  src->encoding != Parrot_ucs2_encoding_ptr)
-        src = Parrot_utf16_encoding_ptr->to_encoding(interp, src);
+    while (iter.charpos < src->strlen) {
+        const Parrot_unicode_case_t *rec;
+        UINTVAL                      c;
+        int                          map;
 
-    /* In-place operation is not safe for old ICU versions */
-    dest_len = convert_case_buf(interp, NULL, 0, src->strstart, src->bufused,
-                                mode);
+        if (end - p < CASE_MAX_BYTES) {
+            const size_t used = p - dest->strstart;
 
-    dest = Parrot_str_new_init(interp, NULL, dest_len, src->encoding, 0);
+            dest->bufused = used;
+            Parrot_gc_reallocate_string_storage(interp, dest,
+                    2 * Buffer_buflen(dest));
+            p   = dest->strstart + used;
+            end = (char *)Buffer_bufstart(dest) + Buffer_buflen(dest);
+        }
 
-    dest->bufused = convert_case_buf(interp, dest->strstart, dest_len,
-                                     src->strstart, src->bufused, mode);
-    STRING_scan(interp, dest);
+        if (bytes && bytes[iter.bytepos] < 0x80) {
+            c = bytes[iter.bytepos];
+            ++iter.bytepos;
+            ++iter.charpos;
 
-    /* downgrade if possible */
-    if (dest->bufused == dest->strlen * 2)
-        dest->encoding = Parrot_ucs2_encoding_ptr;
-    else
-        dest->encoding = Parrot_utf16_encoding_ptr;
+            if (c - 'a' < 26) {
+                if (mode == ENCODING_UPCASE
+                || (mode == ENCODING_TITLECASE && !cased))
+                    c -= 0x20;
+                cased = 1;
+            }
+            else if (c - 'A' < 26) {
+                if (mode == ENCODING_DOWNCASE || mode == ENCODING_FOLDCASE
+                || (mode == ENCODING_TITLECASE && cased))
+                    c += 0x20;
+                cased = 1;
+            }
+            else if (!ASCII_CASE_IGNORABLE(c))
+                cased = 0;
+
+            *p++ = (char)c;
+            ++len;
+            continue;
+        }
+
+        c = unicode_next(interp, src, &iter);
+
+        if (UNICODE_IS_INVALID(c))
+            Parrot_ex_throw_from_c_noargs(interp, EXCEPTION_INVALID_CHARACTER,
+                    "Invalid character for UTF-8 encoding");
+
+        rec = unicode_case_record(c);
+        map = mode == ENCODING_TITLECASE && cased ? PARROT_UNICODE_LOWER : mode;
+
+        if (c == GREEK_CAPITAL_SIGMA && map == PARROT_UNICODE_LOWER && cased
+        &&  !unicode_cased_follows(interp, src, &iter)) {
+            p = unicode_put_utf8(p, GREEK_FINAL_SIGMA);
+            ++len;
+        }
+        else if (rec->special[map]) {
+            const Parrot_UInt4 *s     = &Parrot_unicode_case_special[rec->special[map]];
+            UINTVAL             count = *s++;
+
+            len += count;
+
+            while (count--)
+                p = unicode_put_utf8(p, *s++);
+        }
+        else {
+            p = unicode_put_utf8(p, c + rec->delta[map]);
+            ++len;
+        }
+
+        if (!(rec->flags & PARROT_UNICODE_CASE_IGNORABLE))
+            cased = rec->flags & PARROT_UNICODE_CASED;
+    }
+
+    dest->bufused = p - dest->strstart;
+    dest->strlen  = len;
 
     return dest;
 }
@@ -1658,8 +2106,7 @@ STRING *
 unicode_foldcase(PARROT_INTERP, ARGIN(const STRING *src))
 {
     ASSERT_ARGS(unicode_foldcase)
-    /* This forces an up-convertion to utf16, which might not be desirable
-       in all cases */
+
     return unicode_convert_case(interp, src, ENCODING_FOLDCASE);
 }
 
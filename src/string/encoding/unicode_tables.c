@@ -0,0 +1,9130 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'tools/dev/gen_unicode_tables.pl'.
+ *
+ * Unicode 14.0.0 case mapping and canonical normalization tables
+ * for the built-in string case conversion and NFC/NFD support.
+ *
+ * Copyright (C) 2016, Parrot Foundation.
+ */
+
+/* HEADERIZER HFILE: none */
+
+
+#include "unicode_tables.h"
+
+const Parrot_unicode_case_t Parrot_unicode_case_records[282] = {
+    { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, 0 },
+    { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, 2 },
+    { { 0, 32, 0, 32 }, { 0, 0, 0, 0 }, 1 },
+    { { -32, 0, -32, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 743, 0, 743, 775 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 1, 0, 4, 7 }, 1 },
+    { { 121, 0, 121, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 1, 0, 1 }, { 0, 0, 0, 0 }, 1 },
+    { { -1, 0, -1, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 0, 10, 0, 10 }, 1 },
+    { { -232, 0, -232, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 13, 0, 13, 16 }, 1 },
+    { { 0, -121, 0, -121 }, { 0, 0, 0, 0 }, 1 },
+    { { -300, 0, -300, -268 }, { 0, 0, 0, 0 }, 1 },
+    { { 195, 0, 195, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 210, 0, 210 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 206, 0, 206 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 205, 0, 205 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 79, 0, 79 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 202, 0, 202 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 203, 0, 203 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 207, 0, 207 }, { 0, 0, 0, 0 }, 1 },
+    { { 97, 0, 97, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 211, 0, 211 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 209, 0, 209 }, { 0, 0, 0, 0 }, 1 },
+    { { 163, 0, 163, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 213, 0, 213 }, { 0, 0, 0, 0 }, 1 },
+    { { 130, 0, 130, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 214, 0, 214 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 218, 0, 218 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 217, 0, 217 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 219, 0, 219 }, { 0, 0, 0, 0 }, 1 },
+    { { 56, 0, 56, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 2, 1, 2 }, { 0, 0, 0, 0 }, 1 },
+    { { -1, 1, 0, 1 }, { 0, 0, 0, 0 }, 1 },
+    { { -2, 0, -1, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -79, 0, -79, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 19, 0, 19, 22 }, 1 },
+    { { 0, -97, 0, -97 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -56, 0, -56 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -130, 0, -130 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 10795, 0, 10795 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -163, 0, -163 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 10792, 0, 10792 }, { 0, 0, 0, 0 }, 1 },
+    { { 10815, 0, 10815, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -195, 0, -195 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 69, 0, 69 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 71, 0, 71 }, { 0, 0, 0, 0 }, 1 },
+    { { 10783, 0, 10783, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 10780, 0, 10780, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 10782, 0, 10782, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -210, 0, -210, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -206, 0, -206, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -205, 0, -205, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -202, 0, -202, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -203, 0, -203, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 42319, 0, 42319, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 42315, 0, 42315, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -207, 0, -207, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 42280, 0, 42280, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 42308, 0, 42308, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -209, 0, -209, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -211, 0, -211, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 10743, 0, 10743, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 42305, 0, 42305, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 10749, 0, 10749, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -213, 0, -213, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -214, 0, -214, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 10727, 0, 10727, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -218, 0, -218, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 42307, 0, 42307, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 42282, 0, 42282, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -69, 0, -69, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -217, 0, -217, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -71, 0, -71, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -219, 0, -219, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 42261, 0, 42261, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 42258, 0, 42258, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, 3 },
+    { { 84, 0, 84, 116 }, { 0, 0, 0, 0 }, 3 },
+    { { 0, 116, 0, 116 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 38, 0, 38 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 37, 0, 37 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 64, 0, 64 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 63, 0, 63 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 25, 0, 25, 29 }, 1 },
+    { { -38, 0, -38, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -37, 0, -37, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 33, 0, 33, 37 }, 1 },
+    { { -31, 0, -31, 1 }, { 0, 0, 0, 0 }, 1 },
+    { { -64, 0, -64, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -63, 0, -63, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 8, 0, 8 }, { 0, 0, 0, 0 }, 1 },
+    { { -62, 0, -62, -30 }, { 0, 0, 0, 0 }, 1 },
+    { { -57, 0, -57, -25 }, { 0, 0, 0, 0 }, 1 },
+    { { -47, 0, -47, -15 }, { 0, 0, 0, 0 }, 1 },
+    { { -54, 0, -54, -22 }, { 0, 0, 0, 0 }, 1 },
+    { { -8, 0, -8, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -86, 0, -86, -54 }, { 0, 0, 0, 0 }, 1 },
+    { { -80, 0, -80, -48 }, { 0, 0, 0, 0 }, 1 },
+    { { 7, 0, 7, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -116, 0, -116, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -60, 0, -60 }, { 0, 0, 0, 0 }, 1 },
+    { { -96, 0, -96, -64 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -7, 0, -7 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 80, 0, 80 }, { 0, 0, 0, 0 }, 1 },
+    { { -80, 0, -80, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 15, 0, 15 }, { 0, 0, 0, 0 }, 1 },
+    { { -15, 0, -15, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 48, 0, 48 }, { 0, 0, 0, 0 }, 1 },
+    { { -48, 0, -48, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 41, 0, 44, 47 }, 1 },
+    { { 0, 7264, 0, 7264 }, { 0, 0, 0, 0 }, 1 },
+    { { 3008, 0, 0, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 38864, 0, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 8, 0, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -8, 0, -8, -8 }, { 0, 0, 0, 0 }, 1 },
+    { { -6254, 0, -6254, -6222 }, { 0, 0, 0, 0 }, 1 },
+    { { -6253, 0, -6253, -6221 }, { 0, 0, 0, 0 }, 1 },
+    { { -6244, 0, -6244, -6212 }, { 0, 0, 0, 0 }, 1 },
+    { { -6242, 0, -6242, -6210 }, { 0, 0, 0, 0 }, 1 },
+    { { -6243, 0, -6243, -6211 }, { 0, 0, 0, 0 }, 1 },
+    { { -6236, 0, -6236, -6204 }, { 0, 0, 0, 0 }, 1 },
+    { { -6181, 0, -6181, -6180 }, { 0, 0, 0, 0 }, 1 },
+    { { 35266, 0, 35266, 35267 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -3008, 0, -3008 }, { 0, 0, 0, 0 }, 1 },
+    { { 35332, 0, 35332, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 3814, 0, 3814, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 35384, 0, 35384, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 50, 0, 50, 53 }, 1 },
+    { { 0, 0, 0, 0 }, { 56, 0, 56, 59 }, 1 },
+    { { 0, 0, 0, 0 }, { 62, 0, 62, 65 }, 1 },
+    { { 0, 0, 0, 0 }, { 68, 0, 68, 71 }, 1 },
+    { { 0, 0, 0, 0 }, { 74, 0, 74, 77 }, 1 },
+    { { -59, 0, -59, -58 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -7615, 0, 0 }, { 0, 0, 0, 7 }, 1 },
+    { { 8, 0, 8, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -8, 0, -8 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 80, 0, 80, 83 }, 1 },
+    { { 0, 0, 0, 0 }, { 86, 0, 86, 90 }, 1 },
+    { { 0, 0, 0, 0 }, { 94, 0, 94, 98 }, 1 },
+    { { 0, 0, 0, 0 }, { 102, 0, 102, 106 }, 1 },
+    { { 74, 0, 74, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 86, 0, 86, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 100, 0, 100, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 128, 0, 128, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 112, 0, 112, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 126, 0, 126, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 8, 0 }, { 110, 0, 0, 113 }, 1 },
+    { { 0, 0, 8, 0 }, { 116, 0, 0, 119 }, 1 },
+    { { 0, 0, 8, 0 }, { 122, 0, 0, 125 }, 1 },
+    { { 0, 0, 8, 0 }, { 128, 0, 0, 131 }, 1 },
+    { { 0, 0, 8, 0 }, { 134, 0, 0, 137 }, 1 },
+    { { 0, 0, 8, 0 }, { 140, 0, 0, 143 }, 1 },
+    { { 0, 0, 8, 0 }, { 146, 0, 0, 149 }, 1 },
+    { { 0, 0, 8, 0 }, { 152, 0, 0, 155 }, 1 },
+    { { 0, -8, 0, 0 }, { 110, 0, 0, 113 }, 1 },
+    { { 0, -8, 0, 0 }, { 116, 0, 0, 119 }, 1 },
+    { { 0, -8, 0, 0 }, { 122, 0, 0, 125 }, 1 },
+    { { 0, -8, 0, 0 }, { 128, 0, 0, 131 }, 1 },
+    { { 0, -8, 0, 0 }, { 134, 0, 0, 137 }, 1 },
+    { { 0, -8, 0, 0 }, { 140, 0, 0, 143 }, 1 },
+    { { 0, -8, 0, 0 }, { 146, 0, 0, 149 }, 1 },
+    { { 0, -8, 0, 0 }, { 152, 0, 0, 155 }, 1 },
+    { { 0, 0, 8, 0 }, { 158, 0, 0, 161 }, 1 },
+    { { 0, 0, 8, 0 }, { 164, 0, 0, 167 }, 1 },
+    { { 0, 0, 8, 0 }, { 170, 0, 0, 173 }, 1 },
+    { { 0, 0, 8, 0 }, { 176, 0, 0, 179 }, 1 },
+    { { 0, 0, 8, 0 }, { 182, 0, 0, 185 }, 1 },
+    { { 0, 0, 8, 0 }, { 188, 0, 0, 191 }, 1 },
+    { { 0, 0, 8, 0 }, { 194, 0, 0, 197 }, 1 },
+    { { 0, 0, 8, 0 }, { 200, 0, 0, 203 }, 1 },
+    { { 0, -8, 0, 0 }, { 158, 0, 0, 161 }, 1 },
+    { { 0, -8, 0, 0 }, { 164, 0, 0, 167 }, 1 },
+    { { 0, -8, 0, 0 }, { 170, 0, 0, 173 }, 1 },
+    { { 0, -8, 0, 0 }, { 176, 0, 0, 179 }, 1 },
+    { { 0, -8, 0, 0 }, { 182, 0, 0, 185 }, 1 },
+    { { 0, -8, 0, 0 }, { 188, 0, 0, 191 }, 1 },
+    { { 0, -8, 0, 0 }, { 194, 0, 0, 197 }, 1 },
+    { { 0, -8, 0, 0 }, { 200, 0, 0, 203 }, 1 },
+    { { 0, 0, 8, 0 }, { 206, 0, 0, 209 }, 1 },
+    { { 0, 0, 8, 0 }, { 212, 0, 0, 215 }, 1 },
+    { { 0, 0, 8, 0 }, { 218, 0, 0, 221 }, 1 },
+    { { 0, 0, 8, 0 }, { 224, 0, 0, 227 }, 1 },
+    { { 0, 0, 8, 0 }, { 230, 0, 0, 233 }, 1 },
+    { { 0, 0, 8, 0 }, { 236, 0, 0, 239 }, 1 },
+    { { 0, 0, 8, 0 }, { 242, 0, 0, 245 }, 1 },
+    { { 0, 0, 8, 0 }, { 248, 0, 0, 251 }, 1 },
+    { { 0, -8, 0, 0 }, { 206, 0, 0, 209 }, 1 },
+    { { 0, -8, 0, 0 }, { 212, 0, 0, 215 }, 1 },
+    { { 0, -8, 0, 0 }, { 218, 0, 0, 221 }, 1 },
+    { { 0, -8, 0, 0 }, { 224, 0, 0, 227 }, 1 },
+    { { 0, -8, 0, 0 }, { 230, 0, 0, 233 }, 1 },
+    { { 0, -8, 0, 0 }, { 236, 0, 0, 239 }, 1 },
+    { { 0, -8, 0, 0 }, { 242, 0, 0, 245 }, 1 },
+    { { 0, -8, 0, 0 }, { 248, 0, 0, 251 }, 1 },
+    { { 0, 0, 0, 0 }, { 254, 0, 257, 260 }, 1 },
+    { { 0, 0, 9, 0 }, { 263, 0, 0, 266 }, 1 },
+    { { 0, 0, 0, 0 }, { 269, 0, 272, 275 }, 1 },
+    { { 0, 0, 0, 0 }, { 278, 0, 278, 281 }, 1 },
+    { { 0, 0, 0, 0 }, { 284, 0, 288, 292 }, 1 },
+    { { 0, -74, 0, -74 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -9, 0, 0 }, { 263, 0, 0, 266 }, 1 },
+    { { -7205, 0, -7205, -7173 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 296, 0, 299, 302 }, 1 },
+    { { 0, 0, 9, 0 }, { 305, 0, 0, 308 }, 1 },
+    { { 0, 0, 0, 0 }, { 311, 0, 314, 317 }, 1 },
+    { { 0, 0, 0, 0 }, { 320, 0, 320, 323 }, 1 },
+    { { 0, 0, 0, 0 }, { 326, 0, 330, 334 }, 1 },
+    { { 0, -86, 0, -86 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -9, 0, 0 }, { 305, 0, 0, 308 }, 1 },
+    { { 0, 0, 0, 0 }, { 338, 0, 338, 342 }, 1 },
+    { { 0, 0, 0, 0 }, { 346, 0, 346, 349 }, 1 },
+    { { 0, 0, 0, 0 }, { 352, 0, 352, 356 }, 1 },
+    { { 0, -100, 0, -100 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 360, 0, 360, 364 }, 1 },
+    { { 0, 0, 0, 0 }, { 368, 0, 368, 371 }, 1 },
+    { { 0, 0, 0, 0 }, { 374, 0, 374, 377 }, 1 },
+    { { 0, 0, 0, 0 }, { 380, 0, 380, 384 }, 1 },
+    { { 0, -112, 0, -112 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 388, 0, 391, 394 }, 1 },
+    { { 0, 0, 9, 0 }, { 397, 0, 0, 400 }, 1 },
+    { { 0, 0, 0, 0 }, { 403, 0, 406, 409 }, 1 },
+    { { 0, 0, 0, 0 }, { 412, 0, 412, 415 }, 1 },
+    { { 0, 0, 0, 0 }, { 418, 0, 422, 426 }, 1 },
+    { { 0, -128, 0, -128 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -126, 0, -126 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -9, 0, 0 }, { 397, 0, 0, 400 }, 1 },
+    { { 0, -7517, 0, -7517 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -8383, 0, -8383 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -8262, 0, -8262 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 28, 0, 28 }, { 0, 0, 0, 0 }, 1 },
+    { { -28, 0, -28, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 16, 0, 16 }, { 0, 0, 0, 0 }, 1 },
+    { { -16, 0, -16, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 26, 0, 26 }, { 0, 0, 0, 0 }, 1 },
+    { { -26, 0, -26, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -10743, 0, -10743 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -3814, 0, -3814 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -10727, 0, -10727 }, { 0, 0, 0, 0 }, 1 },
+    { { -10795, 0, -10795, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -10792, 0, -10792, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -10780, 0, -10780 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -10749, 0, -10749 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -10783, 0, -10783 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -10782, 0, -10782 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -10815, 0, -10815 }, { 0, 0, 0, 0 }, 1 },
+    { { -7264, 0, -7264, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -35332, 0, -35332 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -42280, 0, -42280 }, { 0, 0, 0, 0 }, 1 },
+    { { 48, 0, 48, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -42308, 0, -42308 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -42319, 0, -42319 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -42315, 0, -42315 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -42305, 0, -42305 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -42258, 0, -42258 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -42282, 0, -42282 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -42261, 0, -42261 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 928, 0, 928 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -48, 0, -48 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -42307, 0, -42307 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, -35384, 0, -35384 }, { 0, 0, 0, 0 }, 1 },
+    { { -928, 0, -928, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { -38864, 0, -38864, -38864 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 0, 0, 0 }, { 430, 0, 433, 436 }, 1 },
+    { { 0, 0, 0, 0 }, { 439, 0, 442, 445 }, 1 },
+    { { 0, 0, 0, 0 }, { 448, 0, 451, 454 }, 1 },
+    { { 0, 0, 0, 0 }, { 457, 0, 461, 465 }, 1 },
+    { { 0, 0, 0, 0 }, { 469, 0, 473, 477 }, 1 },
+    { { 0, 0, 0, 0 }, { 481, 0, 484, 487 }, 1 },
+    { { 0, 0, 0, 0 }, { 490, 0, 493, 496 }, 1 },
+    { { 0, 0, 0, 0 }, { 499, 0, 502, 505 }, 1 },
+    { { 0, 0, 0, 0 }, { 508, 0, 511, 514 }, 1 },
+    { { 0, 0, 0, 0 }, { 517, 0, 520, 523 }, 1 },
+    { { 0, 0, 0, 0 }, { 526, 0, 529, 532 }, 1 },
+    { { 0, 40, 0, 40 }, { 0, 0, 0, 0 }, 1 },
+    { { -40, 0, -40, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 39, 0, 39 }, { 0, 0, 0, 0 }, 1 },
+    { { -39, 0, -39, 0 }, { 0, 0, 0, 0 }, 1 },
+    { { 0, 34, 0, 34 }, { 0, 0, 0, 0 }, 1 },
+    { { -34, 0, -34, 0 }, { 0, 0, 0, 0 }, 1 },
+};
+
+const Parrot_UInt4 Parrot_unicode_case_special[535] = {
+    0x0000, 0x0002, 0x0053, 0x0053, 0x0002, 0x0053, 0x0073, 0x0002,
+    0x0073, 0x0073, 0x0002, 0x0069, 0x0307, 0x0002, 0x02bc, 0x004e,
+    0x0002, 0x02bc, 0x006e, 0x0002, 0x004a, 0x030c, 0x0002, 0x006a,
+    0x030c, 0x0003, 0x0399, 0x0308, 0x0301, 0x0003, 0x03b9, 0x0308,
+    0x0301, 0x0003, 0x03a5, 0x0308, 0x0301, 0x0003, 0x03c5, 0x0308,
+    0x0301, 0x0002, 0x0535, 0x0552, 0x0002, 0x0535, 0x0582, 0x0002,
+    0x0565, 0x0582, 0x0002, 0x0048, 0x0331, 0x0002, 0x0068, 0x0331,
+    0x0002, 0x0054, 0x0308, 0x0002, 0x0074, 0x0308, 0x0002, 0x0057,
+    0x030a, 0x0002, 0x0077, 0x030a, 0x0002, 0x0059, 0x030a, 0x0002,
+    0x0079, 0x030a, 0x0002, 0x0041, 0x02be, 0x0002, 0x0061, 0x02be,
+    0x0002, 0x03a5, 0x0313, 0x0002, 0x03c5, 0x0313, 0x0003, 0x03a5,
+    0x0313, 0x0300, 0x0003, 0x03c5, 0x0313, 0x0300, 0x0003, 0x03a5,
+    0x0313, 0x0301, 0x0003, 0x03c5, 0x0313, 0x0301, 0x0003, 0x03a5,
+    0x0313, 0x0342, 0x0003, 0x03c5, 0x0313, 0x0342, 0x0002, 0x1f08,
+    0x0399, 0x0002, 0x1f00, 0x03b9, 0x0002, 0x1f09, 0x0399, 0x0002,
+    0x1f01, 0x03b9, 0x0002, 0x1f0a, 0x0399, 0x0002, 0x1f02, 0x03b9,
+    0x0002, 0x1f0b, 0x0399, 0x0002, 0x1f03, 0x03b9, 0x0002, 0x1f0c,
+    0x0399, 0x0002, 0x1f04, 0x03b9, 0x0002, 0x1f0d, 0x0399, 0x0002,
+    0x1f05, 0x03b9, 0x0002, 0x1f0e, 0x0399, 0x0002, 0x1f06, 0x03b9,
+    0x0002, 0x1f0f, 0x0399, 0x0002, 0x1f07, 0x03b9, 0x0002, 0x1f28,
+    0x0399, 0x0002, 0x1f20, 0x03b9, 0x0002, 0x1f29, 0x0399, 0x0002,
+    0x1f21, 0x03b9, 0x0002, 0x1f2a, 0x0399, 0x0002, 0x1f22, 0x03b9,
+    0x0002, 0x1f2b, 0x0399, 0x0002, 0x1f23, 0x03b9, 0x0002, 0x1f2c,
+    0x0399, 0x0002, 0x1f24, 0x03b9, 0x0002, 0x1f2d, 0x0399, 0x0002,
+    0x1f25, 0x03b9, 0x0002, 0x1f2e, 0x0399, 0x0002, 0x1f26, 0x03b9,
+    0x0002, 0x1f2f, 0x0399, 0x0002, 0x1f27, 0x03b9, 0x0002, 0x1f68,
+    0x0399, 0x0002, 0x1f60, 0x03b9, 0x0002, 0x1f69, 0x0399, 0x0002,
+    0x1f61, 0x03b9, 0x0002, 0x1f6a, 0x0399, 0x0002, 0x1f62, 0x03b9,
+    0x0002, 0x1f6b, 0x0399, 0x0002, 0x1f63, 0x03b9, 0x0002, 0x1f6c,
+    0x0399, 0x0002, 0x1f64, 0x03b9, 0x0002, 0x1f6d, 0x0399, 0x0002,
+    0x1f65, 0x03b9, 0x0002, 0x1f6e, 0x0399, 0x0002, 0x1f66, 0x03b9,
+    0x0002, 0x1f6f, 0x0399, 0x0002, 0x1f67, 0x03b9, 0x0002, 0x1fba,
+    0x0399, 0x0002, 0x1fba, 0x0345, 0x0002, 0x1f70, 0x03b9, 0x0002,
+    0x0391, 0x0399, 0x0002, 0x03b1, 0x03b9, 0x0002, 0x0386, 0x0399,
+    0x0002, 0x0386, 0x0345, 0x0002, 0x03ac, 0x03b9, 0x0002, 0x0391,
+    0x0342, 0x0002, 0x03b1, 0x0342, 0x0003, 0x0391, 0x0342, 0x0399,
+    0x0003, 0x0391, 0x0342, 0x0345, 0x0003, 0x03b1, 0x0342, 0x03b9,
+    0x0002, 0x1fca, 0x0399, 0x0002, 0x1fca, 0x0345, 0x0002, 0x1f74,
+    0x03b9, 0x0002, 0x0397, 0x0399, 0x0002, 0x03b7, 0x03b9, 0x0002,
+    0x0389, 0x0399, 0x0002, 0x0389, 0x0345, 0x0002, 0x03ae, 0x03b9,
+    0x0002, 0x0397, 0x0342, 0x0002, 0x03b7, 0x0342, 0x0003, 0x0397,
+    0x0342, 0x0399, 0x0003, 0x0397, 0x0342, 0x0345, 0x0003, 0x03b7,
+    0x0342, 0x03b9, 0x0003, 0x0399, 0x0308, 0x0300, 0x0003, 0x03b9,
+    0x0308, 0x0300, 0x0002, 0x0399, 0x0342, 0x0002, 0x03b9, 0x0342,
+    0x0003, 0x0399, 0x0308, 0x0342, 0x0003, 0x03b9, 0x0308, 0x0342,
+    0x0003, 0x03a5, 0x0308, 0x0300, 0x0003, 0x03c5, 0x0308, 0x0300,
+    0x0002, 0x03a1, 0x0313, 0x0002, 0x03c1, 0x0313, 0x0002, 0x03a5,
+    0x0342, 0x0002, 0x03c5, 0x0342, 0x0003, 0x03a5, 0x0308, 0x0342,
+    0x0003, 0x03c5, 0x0308, 0x0342, 0x0002, 0x1ffa, 0x0399, 0x0002,
+    0x1ffa, 0x0345, 0x0002, 0x1f7c, 0x03b9, 0x0002, 0x03a9, 0x0399,
+    0x0002, 0x03c9, 0x03b9, 0x0002, 0x038f, 0x0399, 0x0002, 0x038f,
+    0x0345, 0x0002, 0x03ce, 0x03b9, 0x0002, 0x03a9, 0x0342, 0x0002,
+    0x03c9, 0x0342, 0x0003, 0x03a9, 0x0342, 0x0399, 0x0003, 0x03a9,
+    0x0342, 0x0345, 0x0003, 0x03c9, 0x0342, 0x03b9, 0x0002, 0x0046,
+    0x0046, 0x0002, 0x0046, 0x0066, 0x0002, 0x0066, 0x0066, 0x0002,
+    0x0046, 0x0049, 0x0002, 0x0046, 0x0069, 0x0002, 0x0066, 0x0069,
+    0x0002, 0x0046, 0x004c, 0x0002, 0x0046, 0x006c, 0x0002, 0x0066,
+    0x006c, 0x0003, 0x0046, 0x0046, 0x0049, 0x0003, 0x0046, 0x0066,
+    0x0069, 0x0003, 0x0066, 0x0066, 0x0069, 0x0003, 0x0046, 0x0046,
+    0x004c, 0x0003, 0x0046, 0x0066, 0x006c, 0x0003, 0x0066, 0x0066,
+    0x006c, 0x0002, 0x0053, 0x0054, 0x0002, 0x0053, 0x0074, 0x0002,
+    0x0073, 0x0074, 0x0002, 0x0544, 0x0546, 0x0002, 0x0544, 0x0576,
+    0x0002, 0x0574, 0x0576, 0x0002, 0x0544, 0x0535, 0x0002, 0x0544,
+    0x0565, 0x0002, 0x0574, 0x0565, 0x0002, 0x0544, 0x053b, 0x0002,
+    0x0544, 0x056b, 0x0002, 0x0574, 0x056b, 0x0002, 0x054e, 0x0546,
+    0x0002, 0x054e, 0x0576, 0x0002, 0x057e, 0x0576, 0x0002, 0x0544,
+    0x053d, 0x0002, 0x0544, 0x056d, 0x0002, 0x0574, 0x056d,
+};
+
+const unsigned short Parrot_unicode_case_index[7172] = {
+    0, 1, 2, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 34, 34, 34, 35, 36,
+    34, 34, 34, 34, 34, 34, 37, 38,
+    39, 40, 41, 34, 42, 43, 44, 45,
+    46, 47, 48, 49, 50, 51, 52, 53,
+    54, 55, 56, 57, 34, 34, 34, 34,
+    34, 58, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    59, 60, 61, 62, 63, 34, 34, 34,
+    64, 65, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    66, 34, 34, 34, 34, 34, 34, 34,
+    34, 67, 34, 34, 68, 69, 70, 71,
+    72, 73, 74, 75, 76, 77, 78, 79,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 80, 81,
+    34, 34, 34, 34, 82, 83, 84, 85,
+    34, 34, 34, 86, 34, 87, 88, 34,
+    89, 90, 91, 92, 34, 34, 34, 93,
+    34, 34, 34, 34, 94, 95, 34, 34,
+    34, 96, 97, 34, 34, 98, 99, 100,
+    101, 102, 103, 104, 105, 106, 107, 34,
+    108, 109, 34, 110, 111, 112, 113, 34,
+    114, 115, 116, 117, 118, 119, 34, 34,
+    120, 121, 122, 123, 34, 124, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    125, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 126, 127, 34,
+    34, 34, 34, 34, 128, 34, 129, 130,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 131,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 132, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 133, 34,
+    34, 34, 134, 135, 136, 34, 34, 34,
+    137, 138, 139, 140, 140, 141, 142, 143,
+    34, 34, 34, 34, 144, 145, 34, 34,
+    34, 34, 34, 34, 34, 34, 146, 34,
+    147, 34, 148, 34, 34, 149, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 150, 151, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 152, 153, 34, 34, 34, 154,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34,
+    155, 34, 156, 157,
+};
+
+const unsigned short Parrot_unicode_case_blocks[20224] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 0, 0, 0, 1, 0,
+    1, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 4, 0, 0, 1, 0, 1,
+    0, 0, 0, 0, 1, 5, 0, 1,
+    1, 0, 4, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 2, 2, 2, 6,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0,
+    3, 3, 3, 3, 3, 3, 3, 7,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    10, 11, 8, 9, 8, 9, 8, 9,
+    4, 8, 9, 8, 9, 8, 9, 8,
+    9, 8, 9, 8, 9, 8, 9, 8,
+    9, 12, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    13, 8, 9, 8, 9, 8, 9, 14,
+    15, 16, 8, 9, 8, 9, 17, 8,
+    9, 18, 18, 8, 9, 4, 19, 20,
+    21, 8, 9, 18, 22, 23, 24, 25,
+    8, 9, 26, 4, 24, 27, 28, 29,
+    8, 9, 8, 9, 8, 9, 30, 8,
+    9, 30, 4, 4, 8, 9, 30, 8,
+    9, 31, 31, 8, 9, 8, 9, 32,
+    8, 9, 4, 0, 8, 9, 4, 33,
+    0, 0, 0, 0, 34, 35, 36, 34,
+    35, 36, 34, 35, 36, 8, 9, 8,
+    9, 8, 9, 8, 9, 8, 9, 8,
+    9, 8, 9, 8, 9, 37, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    38, 34, 35, 36, 8, 9, 39, 40,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    41, 4, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 4, 4, 4, 4,
+    4, 4, 42, 8, 9, 43, 44, 45,
+    45, 8, 9, 46, 47, 48, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    49, 50, 51, 52, 53, 4, 54, 54,
+    4, 55, 4, 56, 57, 4, 4, 4,
+    54, 58, 4, 59, 4, 60, 61, 4,
+    62, 63, 61, 64, 65, 4, 4, 63,
+    4, 66, 67, 4, 4, 68, 4, 4,
+    4, 4, 4, 4, 4, 69, 4, 4,
+    70, 4, 71, 70, 4, 4, 4, 72,
+    70, 73, 74, 74, 75, 4, 4, 4,
+    4, 4, 76, 4, 0, 4, 4, 4,
+    4, 4, 4, 4, 4, 77, 78, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 1, 1, 1, 1, 1, 1, 1,
+    79, 79, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    79, 79, 79, 79, 79, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 80, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    8, 9, 8, 9, 1, 1, 8, 9,
+    0, 0, 79, 28, 28, 28, 0, 81,
+    0, 0, 0, 0, 1, 1, 82, 1,
+    83, 83, 83, 0, 84, 0, 85, 85,
+    86, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 0, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 87, 88, 88, 88,
+    89, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 90, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 91, 92, 92, 93,
+    94, 95, 4, 4, 4, 96, 97, 98,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    99, 100, 101, 102, 103, 104, 0, 8,
+    9, 105, 8, 9, 4, 41, 41, 41,
+    106, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 107,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 0, 1, 1, 1, 1, 1,
+    1, 1, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    108, 8, 9, 8, 9, 8, 9, 8,
+    9, 8, 9, 8, 9, 8, 9, 109,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    0, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 0,
+    0, 1, 0, 0, 0, 0, 0, 1,
+    4, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 112,
+    4, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 1,
+    0, 1, 1, 0, 1, 1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 1, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 1, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 1, 0, 0, 0, 0, 1,
+    1, 0, 0, 1, 1, 1, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 0, 1,
+    1, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1,
+    0, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 1, 1,
+    1, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 0, 0, 0,
+    0, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 1,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 0, 1, 1,
+    0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 0, 113,
+    0, 0, 0, 0, 0, 113, 0, 0,
+    114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 0, 1, 114, 114, 114,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115,
+    116, 116, 116, 116, 116, 116, 0, 0,
+    117, 117, 117, 117, 117, 117, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    1, 0, 1, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 1, 1,
+    1, 1, 1, 0, 1, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0,
+    1, 1, 0, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    1, 1, 0, 0, 0, 1, 0, 1,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    118, 119, 120, 121, 121, 122, 123, 124,
+    125, 0, 0, 0, 0, 0, 0, 0,
+    126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 0, 0, 126, 126, 126,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    79, 127, 4, 4, 4, 128, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 129, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 130, 131,
+    132, 133, 134, 135, 4, 4, 136, 4,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    137, 137, 137, 137, 137, 137, 137, 137,
+    138, 138, 138, 138, 138, 138, 138, 138,
+    137, 137, 137, 137, 137, 137, 0, 0,
+    138, 138, 138, 138, 138, 138, 0, 0,
+    137, 137, 137, 137, 137, 137, 137, 137,
+    138, 138, 138, 138, 138, 138, 138, 138,
+    137, 137, 137, 137, 137, 137, 137, 137,
+    138, 138, 138, 138, 138, 138, 138, 138,
+    137, 137, 137, 137, 137, 137, 0, 0,
+    138, 138, 138, 138, 138, 138, 0, 0,
+    139, 137, 140, 137, 141, 137, 142, 137,
+    0, 138, 0, 138, 0, 138, 0, 138,
+    137, 137, 137, 137, 137, 137, 137, 137,
+    138, 138, 138, 138, 138, 138, 138, 138,
+    143, 143, 144, 144, 144, 144, 145, 145,
+    146, 146, 147, 147, 148, 148, 0, 0,
+    149, 150, 151, 152, 153, 154, 155, 156,
+    157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172,
+    173, 174, 175, 176, 177, 178, 179, 180,
+    181, 182, 183, 184, 185, 186, 187, 188,
+    189, 190, 191, 192, 193, 194, 195, 196,
+    137, 137, 197, 198, 199, 0, 200, 201,
+    138, 138, 202, 202, 203, 1, 204, 1,
+    1, 1, 205, 206, 207, 0, 208, 209,
+    210, 210, 210, 210, 211, 1, 1, 1,
+    137, 137, 212, 86, 0, 0, 213, 214,
+    138, 138, 215, 215, 0, 1, 1, 1,
+    137, 137, 216, 89, 217, 101, 218, 219,
+    138, 138, 220, 220, 105, 1, 1, 1,
+    0, 0, 221, 222, 223, 0, 224, 225,
+    226, 226, 227, 227, 228, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1,
+    0, 0, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 79, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 79,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 4,
+    0, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 4, 0, 0,
+    0, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 4, 0, 229, 0,
+    4, 0, 230, 231, 4, 4, 0, 4,
+    4, 4, 232, 4, 4, 0, 0, 0,
+    0, 4, 0, 0, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 4, 4, 4,
+    4, 4, 0, 0, 0, 0, 233, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234,
+    235, 235, 235, 235, 235, 235, 235, 235,
+    235, 235, 235, 235, 235, 235, 235, 235,
+    0, 0, 0, 8, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 236, 236,
+    236, 236, 236, 236, 236, 236, 236, 236,
+    236, 236, 236, 236, 236, 236, 236, 236,
+    236, 236, 236, 236, 236, 236, 236, 236,
+    237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110,
+    111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111,
+    8, 9, 238, 239, 240, 241, 242, 8,
+    9, 8, 9, 8, 9, 243, 244, 245,
+    246, 4, 8, 9, 4, 8, 9, 4,
+    4, 4, 4, 4, 79, 79, 247, 247,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 4, 0, 0, 0,
+    0, 0, 0, 8, 9, 8, 9, 1,
+    1, 1, 8, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 0, 248,
+    0, 0, 0, 0, 0, 248, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0,
+    0, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 0, 1,
+    1, 1, 1, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 1,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 79, 79, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    4, 4, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    79, 4, 4, 4, 4, 4, 4, 4,
+    4, 8, 9, 8, 9, 249, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    1, 1, 1, 8, 9, 250, 4, 0,
+    8, 9, 8, 9, 251, 4, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 252, 253, 254, 255, 252, 4,
+    256, 257, 258, 259, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 260, 261, 262, 8,
+    9, 8, 9, 0, 0, 0, 0, 0,
+    8, 9, 0, 4, 0, 4, 8, 9,
+    8, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 8, 9, 0,
+    79, 79, 4, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 1, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 1, 1,
+    1, 1, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 0,
+    0, 1, 1, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 1, 1, 1, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 1, 1,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 1, 1, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 263, 4, 4, 4, 4,
+    4, 4, 4, 1, 79, 79, 79, 79,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 1, 1, 1, 0, 0, 0, 0,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    1, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    265, 266, 267, 268, 269, 270, 270, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 271, 272, 273, 274, 275,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 0, 0, 0, 1, 0,
+    1, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276,
+    277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 0, 0, 0, 0,
+    277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    278, 278, 278, 278, 278, 278, 278, 278,
+    278, 278, 278, 0, 278, 278, 278, 278,
+    278, 278, 278, 278, 278, 278, 278, 278,
+    278, 278, 278, 0, 278, 278, 278, 278,
+    278, 278, 278, 0, 278, 278, 0, 279,
+    279, 279, 279, 279, 279, 279, 279, 279,
+    279, 279, 0, 279, 279, 279, 279, 279,
+    279, 279, 279, 279, 279, 279, 279, 279,
+    279, 279, 0, 279, 279, 279, 279, 279,
+    279, 279, 0, 279, 279, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    79, 1, 1, 79, 79, 79, 0, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79,
+    79, 0, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 0, 1, 1, 0,
+    0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 0,
+    0, 1, 1, 0, 0, 1, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 0, 0, 1, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 1, 1, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 0, 1, 0, 0, 0, 0, 1,
+    1, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 1, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1,
+    0, 0, 1, 1, 1, 1, 0, 1,
+    1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 0, 1, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 1, 1, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 0, 0, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 0,
+    0, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 1, 0, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 1, 1, 1,
+    1, 1, 1, 1, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0,
+    1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4,
+    0, 0, 4, 0, 0, 4, 4, 0,
+    0, 4, 4, 4, 4, 0, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 0, 4, 0, 4, 4, 4,
+    4, 4, 4, 4, 0, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 4,
+    4, 4, 4, 0, 0, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 0, 4, 4, 4, 4, 0,
+    4, 4, 4, 4, 4, 0, 4, 0,
+    0, 0, 4, 4, 4, 4, 4, 4,
+    4, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 0, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 0, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 0, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 0, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 0, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    280, 280, 280, 280, 280, 280, 280, 280,
+    280, 280, 280, 280, 280, 280, 280, 280,
+    280, 280, 280, 280, 280, 280, 280, 280,
+    280, 280, 280, 280, 280, 280, 280, 280,
+    280, 280, 281, 281, 281, 281, 281, 281,
+    281, 281, 281, 281, 281, 281, 281, 281,
+    281, 281, 281, 281, 281, 281, 281, 281,
+    281, 281, 281, 281, 281, 281, 281, 281,
+    281, 281, 281, 281, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const unsigned char Parrot_unicode_ccc_index[979] = {
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 2, 0, 3, 4, 5, 6, 7,
+    8, 9, 10, 11, 12, 12, 12, 13,
+    14, 12, 15, 16, 17, 18, 19, 20,
+    21, 22, 0, 0, 0, 0, 23, 0,
+    0, 0, 0, 0, 0, 0, 24, 25,
+    0, 26, 27, 0, 28, 29, 30, 31,
+    32, 33, 0, 34, 0, 0, 0, 0,
+    0, 35, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 36, 37, 38, 0, 0, 0, 0,
+    39, 40, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 41, 42, 0, 0,
+    43, 44, 45, 46, 0, 47, 0, 48,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 49, 0,
+    0, 0, 0, 0, 50, 0, 0, 0,
+    0, 0, 0, 51, 0, 52, 53, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 54, 55, 0, 0,
+    0, 0, 56, 0, 0, 57, 58, 59,
+    60, 61, 62, 63, 64, 65, 66, 0,
+    67, 68, 0, 69, 70, 71, 72, 0,
+    61, 0, 73, 74, 75, 76, 0, 0,
+    70, 0, 77, 78, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 79, 80, 0,
+    0, 0, 0, 0, 0, 0, 0, 81,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 82, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 83, 84, 85, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    86, 0, 80, 0, 0, 87, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 88, 89,
+};
+
+const unsigned char Parrot_unicode_ccc_blocks[11520] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 232, 220, 220,
+    220, 220, 232, 216, 220, 220, 220, 220,
+    220, 202, 202, 220, 220, 220, 220, 202,
+    202, 220, 220, 220, 220, 220, 220, 220,
+    220, 220, 220, 220, 1, 1, 1, 1,
+    1, 220, 220, 220, 220, 230, 230, 230,
+    230, 230, 230, 230, 230, 240, 230, 220,
+    220, 220, 230, 230, 230, 220, 220, 0,
+    230, 230, 230, 220, 220, 220, 220, 230,
+    232, 220, 220, 230, 233, 234, 234, 233,
+    234, 234, 233, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 230, 230, 230, 230, 220, 230,
+    230, 230, 222, 220, 230, 230, 230, 230,
+    230, 230, 220, 220, 220, 220, 220, 220,
+    230, 230, 220, 230, 230, 222, 228, 230,
+    10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 19, 20, 21, 22, 0, 23,
+    0, 24, 25, 0, 230, 220, 0, 18,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    30, 31, 32, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 27, 28, 29, 30, 31,
+    32, 33, 34, 230, 230, 220, 220, 230,
+    230, 230, 230, 230, 220, 230, 230, 220,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    35, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230,
+    230, 230, 230, 230, 230, 0, 0, 230,
+    230, 230, 230, 220, 230, 0, 0, 230,
+    230, 0, 220, 230, 230, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 36, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 220, 230, 230, 220, 230, 230, 220,
+    220, 220, 230, 220, 220, 230, 220, 230,
+    230, 230, 220, 230, 220, 230, 220, 230,
+    220, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 220, 230, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230,
+    230, 230, 0, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 0, 230, 230, 230,
+    0, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 220, 220, 220, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 230, 230, 230, 230, 220,
+    220, 220, 220, 220, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 0, 220, 230, 230, 220, 230,
+    230, 220, 230, 230, 230, 220, 220, 220,
+    27, 28, 29, 230, 230, 230, 220, 230,
+    230, 220, 220, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 230, 220, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 84, 91, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    103, 103, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    107, 107, 107, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    118, 118, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    122, 122, 122, 122, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    220, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 220,
+    0, 216, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 129, 130, 0, 132, 0, 0, 0,
+    0, 0, 130, 130, 130, 130, 0, 0,
+    130, 0, 230, 230, 9, 0, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7,
+    0, 9, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 228, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 222, 230, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230,
+    220, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 230, 230,
+    230, 230, 230, 230, 230, 0, 0, 220,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 220, 220, 220,
+    220, 220, 220, 230, 230, 220, 0, 220,
+    220, 230, 230, 220, 220, 230, 230, 230,
+    230, 230, 220, 230, 230, 230, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 220, 230, 230, 230,
+    230, 230, 230, 230, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 1, 220, 220, 220,
+    220, 220, 230, 230, 220, 220, 220, 220,
+    230, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 230, 0, 0, 0,
+    230, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 220, 230, 230, 230, 230, 230,
+    230, 230, 220, 230, 230, 234, 214, 220,
+    202, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 232, 228,
+    228, 220, 218, 230, 233, 220, 230, 220,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 1, 1, 230, 230, 230, 230,
+    1, 1, 1, 230, 230, 0, 0, 0,
+    0, 230, 0, 0, 0, 1, 1, 230,
+    220, 230, 1, 1, 220, 220, 220, 220,
+    230, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230,
+    230, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 218, 228, 232, 222, 224, 224,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230,
+    0, 0, 0, 0, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 220, 220, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 0, 230, 230, 220, 0, 0, 230,
+    230, 0, 0, 0, 0, 0, 230, 230,
+    0, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 26, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 220,
+    220, 220, 220, 220, 220, 220, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    220, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230,
+    230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 1, 220, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 220, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 220,
+    230, 230, 230, 220, 230, 220, 220, 220,
+    220, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 220, 230, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230,
+    230, 230, 230, 230, 230, 0, 0, 0,
+    230, 230, 230, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9,
+    7, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 7,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 9, 0,
+    0, 0, 0, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 9, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 216, 216, 1,
+    1, 1, 0, 0, 0, 226, 216, 216,
+    216, 216, 216, 0, 0, 0, 0, 0,
+    0, 0, 0, 220, 220, 220, 220, 220,
+    220, 220, 220, 0, 0, 230, 230, 230,
+    230, 230, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230,
+    230, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 0, 230, 230, 0, 230, 230,
+    230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    220, 220, 220, 220, 220, 220, 220, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230,
+    230, 230, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const unsigned short Parrot_unicode_qc_index[1525] = {
+    0, 1, 2, 3, 4, 0, 5, 6,
+    7, 8, 0, 0, 9, 10, 0, 0,
+    0, 0, 11, 12, 13, 0, 14, 15,
+    16, 17, 18, 19, 0, 0, 20, 21,
+    22, 0, 23, 24, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 25, 0,
+    0, 0, 0, 0, 26, 27, 28, 29,
+    30, 0, 31, 32, 33, 34, 35, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 36, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    37, 38, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 39,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 40, 40, 41, 42, 43, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 44, 45, 0, 0, 0, 46, 0,
+    0, 47, 0, 48, 0, 0, 0, 0,
+    0, 0, 49, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 50, 51, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    40, 40, 40, 40, 52,
+};
+
+const unsigned char Parrot_unicode_qc_blocks[6784] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    0, 2, 2, 2, 2, 2, 2, 0,
+    0, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    0, 2, 2, 2, 2, 2, 2, 0,
+    0, 2, 2, 2, 2, 2, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 2, 2, 2, 2,
+    0, 2, 2, 2, 2, 2, 2, 0,
+    0, 0, 0, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 0, 2, 2,
+    2, 2, 2, 2, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 0, 0, 2, 2,
+    0, 0, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 1,
+    0, 1, 0, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 1, 1, 0,
+    1, 1, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 1, 3, 3, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, 2, 2, 3,
+    2, 2, 2, 0, 2, 0, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 0,
+    0, 0, 0, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 0, 0, 0, 2,
+    0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 0, 0, 0, 2,
+    0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 0, 0, 2, 2,
+    0, 0, 2, 2, 2, 2, 2, 2,
+    0, 0, 2, 2, 2, 2, 2, 2,
+    0, 0, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 3, 3, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 3, 3, 0, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 1, 0, 0, 0, 0, 2,
+    2, 0, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 2, 2, 2, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 3, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 3, 3, 0,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0,
+    0, 0, 3, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0,
+    0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 2, 0, 2, 0, 0,
+    2, 2, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 0, 2, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    0, 2, 0, 2, 0, 2, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 2, 3, 2, 3, 2, 3,
+    2, 3, 2, 3, 2, 3, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 0, 2, 2,
+    2, 2, 2, 3, 2, 0, 3, 0,
+    0, 2, 2, 2, 2, 0, 2, 2,
+    2, 3, 2, 3, 2, 2, 2, 2,
+    2, 2, 2, 3, 0, 0, 2, 2,
+    2, 2, 2, 3, 0, 2, 2, 2,
+    2, 2, 2, 3, 2, 2, 2, 2,
+    2, 2, 2, 3, 2, 2, 3, 3,
+    0, 0, 2, 2, 2, 0, 2, 2,
+    2, 3, 2, 3, 2, 3, 0, 0,
+    3, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0,
+    0, 0, 3, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    0, 2, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 2, 0, 0, 2,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2,
+    2, 2, 0, 0, 2, 2, 0, 0,
+    2, 2, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 0, 2, 2, 0, 0,
+    2, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 0, 2, 0, 2,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 2, 0, 2, 2,
+    0, 2, 2, 0, 2, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    0, 1, 1, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 0, 2, 0, 2,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 2, 0, 2, 2,
+    0, 2, 2, 0, 2, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 2,
+    2, 2, 2, 0, 0, 0, 2, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 0,
+    3, 0, 3, 0, 0, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0,
+    3, 0, 3, 0, 0, 3, 3, 0,
+    0, 0, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0,
+    3, 3, 3, 3, 3, 0, 3, 0,
+    3, 3, 0, 3, 3, 0, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 2, 2, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 3,
+    3, 3, 3, 3, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 3, 3, 3, 3,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const unsigned short Parrot_unicode_decomp_index[1525] = {
+    0, 1, 2, 3, 4, 0, 5, 6,
+    7, 8, 0, 0, 9, 10, 0, 0,
+    0, 0, 11, 12, 13, 0, 14, 15,
+    16, 17, 18, 19, 0, 0, 20, 21,
+    22, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 23, 0,
+    0, 0, 0, 0, 24, 25, 26, 27,
+    28, 0, 29, 30, 31, 32, 33, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 34, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    35, 36, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 37, 38, 39, 40, 41, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 42, 43, 0, 0, 0, 44, 0,
+    0, 45, 0, 46, 0, 0, 0, 0,
+    0, 0, 47, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 48, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    50, 51, 52, 53, 54,
+};
+
+const unsigned short Parrot_unicode_decomp_blocks[7040] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 4, 7, 10, 13, 16, 0, 19,
+    22, 25, 28, 31, 34, 37, 40, 43,
+    0, 46, 49, 52, 55, 58, 61, 0,
+    0, 64, 67, 70, 73, 76, 0, 0,
+    79, 82, 85, 88, 91, 94, 0, 97,
+    100, 103, 106, 109, 112, 115, 118, 121,
+    0, 124, 127, 130, 133, 136, 139, 0,
+    0, 142, 145, 148, 151, 154, 0, 157,
+    160, 163, 166, 169, 172, 175, 178, 181,
+    184, 187, 190, 193, 196, 199, 202, 205,
+    0, 0, 208, 211, 214, 217, 220, 223,
+    226, 229, 232, 235, 238, 241, 244, 247,
+    250, 253, 256, 259, 262, 265, 0, 0,
+    268, 271, 274, 277, 280, 283, 286, 289,
+    292, 0, 0, 0, 295, 298, 301, 304,
+    0, 307, 310, 313, 316, 319, 322, 0,
+    0, 0, 0, 325, 328, 331, 334, 337,
+    340, 0, 0, 0, 343, 346, 349, 352,
+    355, 358, 0, 0, 361, 364, 367, 370,
+    373, 376, 379, 382, 385, 388, 391, 394,
+    397, 400, 403, 406, 409, 412, 0, 0,
+    415, 418, 421, 424, 427, 430, 433, 436,
+    439, 442, 445, 448, 451, 454, 457, 460,
+    463, 466, 469, 472, 475, 478, 481, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    484, 487, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 490,
+    493, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 496, 499, 502,
+    505, 508, 511, 514, 517, 520, 524, 528,
+    532, 536, 540, 544, 548, 0, 552, 556,
+    560, 564, 568, 571, 0, 0, 574, 577,
+    580, 583, 586, 589, 592, 596, 600, 603,
+    606, 0, 0, 0, 609, 612, 0, 0,
+    615, 618, 621, 625, 629, 632, 635, 638,
+    641, 644, 647, 650, 653, 656, 659, 662,
+    665, 668, 671, 674, 677, 680, 683, 686,
+    689, 692, 695, 698, 701, 704, 707, 710,
+    713, 716, 719, 722, 0, 0, 725, 728,
+    0, 0, 0, 0, 0, 0, 731, 734,
+    737, 740, 743, 747, 751, 755, 759, 762,
+    765, 769, 773, 776, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    779, 781, 0, 783, 785, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 788, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 790, 0,
+    0, 0, 0, 0, 0, 792, 795, 798,
+    800, 803, 806, 0, 809, 0, 812, 815,
+    818, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 822, 825, 828, 831, 834, 837,
+    840, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 844, 847, 850, 853, 856, 0,
+    0, 0, 0, 859, 862, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    865, 868, 0, 871, 0, 0, 0, 874,
+    0, 0, 0, 0, 877, 880, 883, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 886, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 889, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    892, 895, 0, 898, 0, 0, 0, 901,
+    0, 0, 0, 0, 904, 907, 910, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 913, 916,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 919, 922, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    925, 928, 931, 934, 0, 0, 937, 940,
+    0, 0, 943, 946, 949, 952, 955, 958,
+    0, 0, 961, 964, 967, 970, 973, 976,
+    0, 0, 979, 982, 985, 988, 991, 994,
+    997, 1000, 1003, 1006, 1009, 1012, 0, 0,
+    1015, 1018, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1021, 1024, 1027, 1030, 1033, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1036, 0, 1039, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1042, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1045, 0, 0, 0, 0, 0, 0,
+    0, 1048, 0, 0, 1051, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1054, 1057, 1060, 1063, 1066, 1069, 1072, 1075,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1078, 1081, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1084, 1087, 0, 1090,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1093, 0, 0, 1096, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1099, 1102, 1105, 0, 0, 1108, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1111, 0, 0, 1114, 1117, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1120, 1123, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1126, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1129, 1132, 1135, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1138, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1141, 0, 0, 0, 0, 0, 0, 1144,
+    1147, 0, 1150, 1153, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1157, 1160, 1163, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1166, 0, 1169, 1172, 1176, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1179, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1182, 0, 0,
+    0, 0, 1185, 0, 0, 0, 0, 1188,
+    0, 0, 0, 0, 1191, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1194, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1197, 0, 1200, 1203, 0,
+    1206, 0, 0, 0, 0, 0, 0, 0,
+    0, 1209, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1212, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1215, 0, 0,
+    0, 0, 1218, 0, 0, 0, 0, 1221,
+    0, 0, 0, 0, 1224, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1227, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1233, 0,
+    1236, 0, 1239, 0, 1242, 0, 1245, 0,
+    0, 0, 1248, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1251, 0, 1254, 0, 0,
+    1257, 1260, 0, 1263, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287,
+    1290, 1294, 1298, 1301, 1304, 1307, 1310, 1313,
+    1316, 1319, 1322, 1325, 1328, 1332, 1336, 1340,
+    1344, 1347, 1350, 1353, 1356, 1360, 1364, 1367,
+    1370, 1373, 1376, 1379, 1382, 1385, 1388, 1391,
+    1394, 1397, 1400, 1403, 1406, 1409, 1412, 1416,
+    1420, 1423, 1426, 1429, 1432, 1435, 1438, 1441,
+    1444, 1448, 1452, 1455, 1458, 1461, 1464, 1467,
+    1470, 1473, 1476, 1479, 1482, 1485, 1488, 1491,
+    1494, 1497, 1500, 1503, 1506, 1510, 1514, 1518,
+    1522, 1526, 1530, 1534, 1538, 1541, 1544, 1547,
+    1550, 1553, 1556, 1559, 1562, 1566, 1570, 1573,
+    1576, 1579, 1582, 1585, 1588, 1592, 1596, 1600,
+    1604, 1608, 1612, 1615, 1618, 1621, 1624, 1627,
+    1630, 1633, 1636, 1639, 1642, 1645, 1648, 1651,
+    1654, 1658, 1662, 1666, 1670, 1673, 1676, 1679,
+    1682, 1685, 1688, 1691, 1694, 1697, 1700, 1703,
+    1706, 1709, 1712, 1715, 1718, 1721, 1724, 1727,
+    1730, 1733, 1736, 1739, 1742, 1745, 1748, 1751,
+    1754, 1757, 0, 1760, 0, 0, 0, 0,
+    1763, 1766, 1769, 1772, 1775, 1779, 1783, 1787,
+    1791, 1795, 1799, 1803, 1807, 1811, 1815, 1819,
+    1823, 1827, 1831, 1835, 1839, 1843, 1847, 1851,
+    1855, 1858, 1861, 1864, 1867, 1870, 1873, 1877,
+    1881, 1885, 1889, 1893, 1897, 1901, 1905, 1909,
+    1913, 1916, 1919, 1922, 1925, 1928, 1931, 1934,
+    1937, 1941, 1945, 1949, 1953, 1957, 1961, 1965,
+    1969, 1973, 1977, 1981, 1985, 1989, 1993, 1997,
+    2001, 2005, 2009, 2013, 2017, 2020, 2023, 2026,
+    2029, 2033, 2037, 2041, 2045, 2049, 2053, 2057,
+    2061, 2065, 2069, 2072, 2075, 2078, 2081, 2084,
+    2087, 2090, 0, 0, 0, 0, 0, 0,
+    2093, 2096, 2099, 2103, 2107, 2111, 2115, 2119,
+    2123, 2126, 2129, 2133, 2137, 2141, 2145, 2149,
+    2153, 2156, 2159, 2163, 2167, 2171, 0, 0,
+    2175, 2178, 2181, 2185, 2189, 2193, 0, 0,
+    2197, 2200, 2203, 2207, 2211, 2215, 2219, 2223,
+    2227, 2230, 2233, 2237, 2241, 2245, 2249, 2253,
+    2257, 2260, 2263, 2267, 2271, 2275, 2279, 2283,
+    2287, 2290, 2293, 2297, 2301, 2305, 2309, 2313,
+    2317, 2320, 2323, 2327, 2331, 2335, 0, 0,
+    2339, 2342, 2345, 2349, 2353, 2357, 0, 0,
+    2361, 2364, 2367, 2371, 2375, 2379, 2383, 2387,
+    0, 2391, 0, 2394, 0, 2398, 0, 2402,
+    2406, 2409, 2412, 2416, 2420, 2424, 2428, 2432,
+    2436, 2439, 2442, 2446, 2450, 2454, 2458, 2462,
+    2466, 2469, 2472, 2475, 2478, 2481, 2484, 2487,
+    2490, 2493, 2496, 2499, 2502, 2505, 0, 0,
+    2508, 2512, 2516, 2521, 2526, 2531, 2536, 2541,
+    2546, 2550, 2554, 2559, 2564, 2569, 2574, 2579,
+    2584, 2588, 2592, 2597, 2602, 2607, 2612, 2617,
+    2622, 2626, 2630, 2635, 2640, 2645, 2650, 2655,
+    2660, 2664, 2668, 2673, 2678, 2683, 2688, 2693,
+    2698, 2702, 2706, 2711, 2716, 2721, 2726, 2731,
+    2736, 2739, 2742, 2746, 2749, 0, 2753, 2756,
+    2760, 2763, 2766, 2769, 2772, 0, 2775, 0,
+    0, 2777, 2780, 2784, 2787, 0, 2791, 2794,
+    2798, 2801, 2804, 2807, 2810, 2813, 2816, 2819,
+    2822, 2825, 2828, 2832, 0, 0, 2836, 2839,
+    2843, 2846, 2849, 2852, 0, 2855, 2858, 2861,
+    2864, 2867, 2870, 2874, 2878, 2881, 2884, 2887,
+    2891, 2894, 2897, 2900, 2903, 2906, 2909, 2912,
+    0, 0, 2914, 2918, 2921, 0, 2925, 2928,
+    2932, 2935, 2938, 2941, 2944, 2947, 0, 0,
+    2949, 2951, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2953, 0,
+    0, 0, 2955, 2957, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2960, 2963, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2966, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2969, 2972, 2975,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2978, 0, 0, 0,
+    0, 2981, 0, 0, 2984, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2987, 0, 2990, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2993, 0, 0, 2996, 0, 0, 2999,
+    0, 3002, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3005, 0, 3008, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3011, 3014, 3017,
+    3020, 3023, 0, 0, 3026, 3029, 0, 0,
+    3032, 3035, 0, 0, 0, 0, 0, 0,
+    3038, 3041, 0, 0, 3044, 3047, 0, 0,
+    3050, 3053, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3056, 3059, 3062, 3065,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    3068, 3071, 3074, 3077, 0, 0, 0, 0,
+    0, 0, 3080, 3083, 3086, 3089, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3092, 3094, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3096, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3099, 0, 3102, 0,
+    3105, 0, 3108, 0, 3111, 0, 3114, 0,
+    3117, 0, 3120, 0, 3123, 0, 3126, 0,
+    3129, 0, 3132, 0, 0, 3135, 0, 3138,
+    0, 3141, 0, 0, 0, 0, 0, 0,
+    3144, 3147, 0, 3150, 3153, 0, 3156, 3159,
+    0, 3162, 3165, 0, 3168, 3171, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3174, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3177, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3180, 0, 3183, 0,
+    3186, 0, 3189, 0, 3192, 0, 3195, 0,
+    3198, 0, 3201, 0, 3204, 0, 3207, 0,
+    3210, 0, 3213, 0, 0, 3216, 0, 3219,
+    0, 3222, 0, 0, 0, 0, 0, 0,
+    3225, 3228, 0, 3231, 3234, 0, 3237, 3240,
+    0, 3243, 3246, 0, 3249, 3252, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3255, 0, 0, 3258,
+    3261, 3264, 3267, 0, 0, 0, 3270, 0,
+    3273, 3275, 3277, 3279, 3281, 3283, 3285, 3287,
+    3289, 3291, 3293, 3295, 3297, 3299, 3301, 3303,
+    3305, 3307, 3309, 3311, 3313, 3315, 3317, 3319,
+    3321, 3323, 3325, 3327, 3329, 3331, 3333, 3335,
+    3337, 3339, 3341, 3343, 3345, 3347, 3349, 3351,
+    3353, 3355, 3357, 3359, 3361, 3363, 3365, 3367,
+    3369, 3371, 3373, 3375, 3377, 3379, 3381, 3383,
+    3385, 3387, 3389, 3391, 3393, 3395, 3397, 3399,
+    3401, 3403, 3405, 3407, 3409, 3411, 3413, 3415,
+    3417, 3419, 3421, 3423, 3425, 3427, 3429, 3431,
+    3433, 3435, 3437, 3439, 3441, 3443, 3445, 3447,
+    3449, 3451, 3453, 3455, 3457, 3459, 3461, 3463,
+    3465, 3467, 3469, 3471, 3473, 3475, 3477, 3479,
+    3481, 3483, 3485, 3487, 3489, 3491, 3493, 3495,
+    3497, 3499, 3501, 3503, 3505, 3507, 3509, 3511,
+    3513, 3515, 3517, 3519, 3521, 3523, 3525, 3527,
+    3529, 3531, 3533, 3535, 3537, 3539, 3541, 3543,
+    3545, 3547, 3549, 3551, 3553, 3555, 3557, 3559,
+    3561, 3563, 3565, 3567, 3569, 3571, 3573, 3575,
+    3577, 3579, 3581, 3583, 3585, 3587, 3589, 3591,
+    3593, 3595, 3597, 3599, 3601, 3603, 3605, 3607,
+    3609, 3611, 3613, 3615, 3617, 3619, 3621, 3623,
+    3625, 3627, 3629, 3631, 3633, 3635, 3637, 3639,
+    3641, 3643, 3645, 3647, 3649, 3651, 3653, 3655,
+    3657, 3659, 3661, 3663, 3665, 3667, 3669, 3671,
+    3673, 3675, 3677, 3679, 3681, 3683, 3685, 3687,
+    3689, 3691, 3693, 3695, 3697, 3699, 3701, 3703,
+    3705, 3707, 3709, 3711, 3713, 3715, 3717, 3719,
+    3721, 3723, 3725, 3727, 3729, 3731, 3733, 3735,
+    3737, 3739, 3741, 3743, 3745, 3747, 3749, 3751,
+    3753, 3755, 3757, 3759, 3761, 3763, 3765, 3767,
+    3769, 3771, 3773, 3775, 3777, 3779, 3781, 3783,
+    3785, 3787, 3789, 3791, 3793, 3795, 3797, 3799,
+    3801, 3803, 3805, 3807, 3809, 3811, 0, 0,
+    3813, 0, 3815, 0, 0, 3817, 3819, 3821,
+    3823, 3825, 3827, 3829, 3831, 3833, 3835, 0,
+    3837, 0, 3839, 0, 0, 3841, 3843, 0,
+    0, 0, 3845, 3847, 3849, 3851, 3853, 3855,
+    3857, 3859, 3861, 3863, 3865, 3867, 3869, 3871,
+    3873, 3875, 3877, 3879, 3881, 3883, 3885, 3887,
+    3889, 3891, 3893, 3895, 3897, 3899, 3901, 3903,
+    3905, 3907, 3909, 3911, 3913, 3915, 3917, 3919,
+    3921, 3923, 3925, 3927, 3929, 3931, 3933, 3935,
+    3937, 3939, 3941, 3943, 3945, 3947, 3949, 3951,
+    3953, 3955, 3957, 3959, 3961, 3963, 3965, 3967,
+    3969, 3971, 3973, 3975, 3977, 3979, 0, 0,
+    3981, 3983, 3985, 3987, 3989, 3991, 3993, 3995,
+    3997, 3999, 4001, 4003, 4005, 4007, 4009, 4011,
+    4013, 4015, 4017, 4019, 4021, 4023, 4025, 4027,
+    4029, 4031, 4033, 4035, 4037, 4039, 4041, 4043,
+    4045, 4047, 4049, 4051, 4053, 4055, 4057, 4059,
+    4061, 4063, 4065, 4067, 4069, 4071, 4073, 4075,
+    4077, 4079, 4081, 4083, 4085, 4087, 4089, 4091,
+    4093, 4095, 4097, 4099, 4101, 4103, 4105, 4107,
+    4109, 4111, 4113, 4115, 4117, 4119, 4121, 4123,
+    4125, 4127, 4129, 4131, 4133, 4135, 4137, 4139,
+    4141, 4143, 4145, 4147, 4149, 4151, 4153, 4155,
+    4157, 4159, 4161, 4163, 4165, 4167, 4169, 4171,
+    4173, 4175, 4177, 4179, 4181, 4183, 4185, 4187,
+    4189, 4191, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4193, 0, 4196,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4199, 4202, 4205, 4209, 4213, 4216,
+    4219, 4222, 4225, 4228, 4231, 4234, 4237, 0,
+    4240, 4243, 4246, 4249, 4252, 0, 4255, 0,
+    4258, 4261, 0, 4264, 4267, 0, 4270, 4273,
+    4276, 4279, 4282, 4285, 4288, 4291, 4294, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4297, 0, 4300, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4303, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4306, 4309,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4312, 4315, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4318, 4321, 0, 4324, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4327, 4330, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    4333, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4336, 4339,
+    4342, 4346, 4350, 4354, 4358, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4362, 4365, 4368, 4372, 4376,
+    4380, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    4384, 4386, 4388, 4390, 4392, 4394, 4396, 4398,
+    4400, 4402, 4404, 4406, 4408, 4410, 4412, 4414,
+    4416, 4418, 4420, 4422, 4424, 4426, 4428, 4430,
+    4432, 4434, 4436, 4438, 4440, 4442, 4444, 4446,
+    4448, 4450, 4452, 4454, 4456, 4458, 4460, 4462,
+    4464, 4466, 4468, 4470, 4472, 4474, 4476, 4478,
+    4480, 4482, 4484, 4486, 4488, 4490, 4492, 4494,
+    4496, 4498, 4500, 4502, 4504, 4506, 4508, 4510,
+    4512, 4514, 4516, 4518, 4520, 4522, 4524, 4526,
+    4528, 4530, 4532, 4534, 4536, 4538, 4540, 4542,
+    4544, 4546, 4548, 4550, 4552, 4554, 4556, 4558,
+    4560, 4562, 4564, 4566, 4568, 4570, 4572, 4574,
+    4576, 4578, 4580, 4582, 4584, 4586, 4588, 4590,
+    4592, 4594, 4596, 4598, 4600, 4602, 4604, 4606,
+    4608, 4610, 4612, 4614, 4616, 4618, 4620, 4622,
+    4624, 4626, 4628, 4630, 4632, 4634, 4636, 4638,
+    4640, 4642, 4644, 4646, 4648, 4650, 4652, 4654,
+    4656, 4658, 4660, 4662, 4664, 4666, 4668, 4670,
+    4672, 4674, 4676, 4678, 4680, 4682, 4684, 4686,
+    4688, 4690, 4692, 4694, 4696, 4698, 4700, 4702,
+    4704, 4706, 4708, 4710, 4712, 4714, 4716, 4718,
+    4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734,
+    4736, 4738, 4740, 4742, 4744, 4746, 4748, 4750,
+    4752, 4754, 4756, 4758, 4760, 4762, 4764, 4766,
+    4768, 4770, 4772, 4774, 4776, 4778, 4780, 4782,
+    4784, 4786, 4788, 4790, 4792, 4794, 4796, 4798,
+    4800, 4802, 4804, 4806, 4808, 4810, 4812, 4814,
+    4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830,
+    4832, 4834, 4836, 4838, 4840, 4842, 4844, 4846,
+    4848, 4850, 4852, 4854, 4856, 4858, 4860, 4862,
+    4864, 4866, 4868, 4870, 4872, 4874, 4876, 4878,
+    4880, 4882, 4884, 4886, 4888, 4890, 4892, 4894,
+    4896, 4898, 4900, 4902, 4904, 4906, 4908, 4910,
+    4912, 4914, 4916, 4918, 4920, 4922, 4924, 4926,
+    4928, 4930, 4932, 4934, 4936, 4938, 4940, 4942,
+    4944, 4946, 4948, 4950, 4952, 4954, 4956, 4958,
+    4960, 4962, 4964, 4966, 4968, 4970, 4972, 4974,
+    4976, 4978, 4980, 4982, 4984, 4986, 4988, 4990,
+    4992, 4994, 4996, 4998, 5000, 5002, 5004, 5006,
+    5008, 5010, 5012, 5014, 5016, 5018, 5020, 5022,
+    5024, 5026, 5028, 5030, 5032, 5034, 5036, 5038,
+    5040, 5042, 5044, 5046, 5048, 5050, 5052, 5054,
+    5056, 5058, 5060, 5062, 5064, 5066, 5068, 5070,
+    5072, 5074, 5076, 5078, 5080, 5082, 5084, 5086,
+    5088, 5090, 5092, 5094, 5096, 5098, 5100, 5102,
+    5104, 5106, 5108, 5110, 5112, 5114, 5116, 5118,
+    5120, 5122, 5124, 5126, 5128, 5130, 5132, 5134,
+    5136, 5138, 5140, 5142, 5144, 5146, 5148, 5150,
+    5152, 5154, 5156, 5158, 5160, 5162, 5164, 5166,
+    5168, 5170, 5172, 5174, 5176, 5178, 5180, 5182,
+    5184, 5186, 5188, 5190, 5192, 5194, 5196, 5198,
+    5200, 5202, 5204, 5206, 5208, 5210, 5212, 5214,
+    5216, 5218, 5220, 5222, 5224, 5226, 5228, 5230,
+    5232, 5234, 5236, 5238, 5240, 5242, 5244, 5246,
+    5248, 5250, 5252, 5254, 5256, 5258, 5260, 5262,
+    5264, 5266, 5268, 5270, 5272, 5274, 5276, 5278,
+    5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294,
+    5296, 5298, 5300, 5302, 5304, 5306, 5308, 5310,
+    5312, 5314, 5316, 5318, 5320, 5322, 5324, 5326,
+    5328, 5330, 5332, 5334, 5336, 5338, 5340, 5342,
+    5344, 5346, 5348, 5350, 5352, 5354, 5356, 5358,
+    5360, 5362, 5364, 5366, 5368, 5370, 5372, 5374,
+    5376, 5378, 5380, 5382, 5384, 5386, 5388, 5390,
+    5392, 5394, 5396, 5398, 5400, 5402, 5404, 5406,
+    5408, 5410, 5412, 5414, 5416, 5418, 5420, 5422,
+    5424, 5426, 5428, 5430, 5432, 5434, 5436, 5438,
+    5440, 5442, 5444, 5446, 5448, 5450, 5452, 5454,
+    5456, 5458, 5460, 5462, 5464, 5466, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const Parrot_UInt4 Parrot_unicode_decomp_data[5468] = {
+    0x0000, 0x0002, 0x0041, 0x0300, 0x0002, 0x0041, 0x0301, 0x0002,
+    0x0041, 0x0302, 0x0002, 0x0041, 0x0303, 0x0002, 0x0041, 0x0308,
+    0x0002, 0x0041, 0x030a, 0x0002, 0x0043, 0x0327, 0x0002, 0x0045,
+    0x0300, 0x0002, 0x0045, 0x0301, 0x0002, 0x0045, 0x0302, 0x0002,
+    0x0045, 0x0308, 0x0002, 0x0049, 0x0300, 0x0002, 0x0049, 0x0301,
+    0x0002, 0x0049, 0x0302, 0x0002, 0x0049, 0x0308, 0x0002, 0x004e,
+    0x0303, 0x0002, 0x004f, 0x0300, 0x0002, 0x004f, 0x0301, 0x0002,
+    0x004f, 0x0302, 0x0002, 0x004f, 0x0303, 0x0002, 0x004f, 0x0308,
+    0x0002, 0x0055, 0x0300, 0x0002, 0x0055, 0x0301, 0x0002, 0x0055,
+    0x0302, 0x0002, 0x0055, 0x0308, 0x0002, 0x0059, 0x0301, 0x0002,
+    0x0061, 0x0300, 0x0002, 0x0061, 0x0301, 0x0002, 0x0061, 0x0302,
+    0x0002, 0x0061, 0x0303, 0x0002, 0x0061, 0x0308, 0x0002, 0x0061,
+    0x030a, 0x0002, 0x0063, 0x0327, 0x0002, 0x0065, 0x0300, 0x0002,
+    0x0065, 0x0301, 0x0002, 0x0065, 0x0302, 0x0002, 0x0065, 0x0308,
+    0x0002, 0x0069, 0x0300, 0x0002, 0x0069, 0x0301, 0x0002, 0x0069,
+    0x0302, 0x0002, 0x0069, 0x0308, 0x0002, 0x006e, 0x0303, 0x0002,
+    0x006f, 0x0300, 0x0002, 0x006f, 0x0301, 0x0002, 0x006f, 0x0302,
+    0x0002, 0x006f, 0x0303, 0x0002, 0x006f, 0x0308, 0x0002, 0x0075,
+    0x0300, 0x0002, 0x0075, 0x0301, 0x0002, 0x0075, 0x0302, 0x0002,
+    0x0075, 0x0308, 0x0002, 0x0079, 0x0301, 0x0002, 0x0079, 0x0308,
+    0x0002, 0x0041, 0x0304, 0x0002, 0x0061, 0x0304, 0x0002, 0x0041,
+    0x0306, 0x0002, 0x0061, 0x0306, 0x0002, 0x0041, 0x0328, 0x0002,
+    0x0061, 0x0328, 0x0002, 0x0043, 0x0301, 0x0002, 0x0063, 0x0301,
+    0x0002, 0x0043, 0x0302, 0x0002, 0x0063, 0x0302, 0x0002, 0x0043,
+    0x0307, 0x0002, 0x0063, 0x0307, 0x0002, 0x0043, 0x030c, 0x0002,
+    0x0063, 0x030c, 0x0002, 0x0044, 0x030c, 0x0002, 0x0064, 0x030c,
+    0x0002, 0x0045, 0x0304, 0x0002, 0x0065, 0x0304, 0x0002, 0x0045,
+    0x0306, 0x0002, 0x0065, 0x0306, 0x0002, 0x0045, 0x0307, 0x0002,
+    0x0065, 0x0307, 0x0002, 0x0045, 0x0328, 0x0002, 0x0065, 0x0328,
+    0x0002, 0x0045, 0x030c, 0x0002, 0x0065, 0x030c, 0x0002, 0x0047,
+    0x0302, 0x0002, 0x0067, 0x0302, 0x0002, 0x0047, 0x0306, 0x0002,
+    0x0067, 0x0306, 0x0002, 0x0047, 0x0307, 0x0002, 0x0067, 0x0307,
+    0x0002, 0x0047, 0x0327, 0x0002, 0x0067, 0x0327, 0x0002, 0x0048,
+    0x0302, 0x0002, 0x0068, 0x0302, 0x0002, 0x0049, 0x0303, 0x0002,
+    0x0069, 0x0303, 0x0002, 0x0049, 0x0304, 0x0002, 0x0069, 0x0304,
+    0x0002, 0x0049, 0x0306, 0x0002, 0x0069, 0x0306, 0x0002, 0x0049,
+    0x0328, 0x0002, 0x0069, 0x0328, 0x0002, 0x0049, 0x0307, 0x0002,
+    0x004a, 0x0302, 0x0002, 0x006a, 0x0302, 0x0002, 0x004b, 0x0327,
+    0x0002, 0x006b, 0x0327, 0x0002, 0x004c, 0x0301, 0x0002, 0x006c,
+    0x0301, 0x0002, 0x004c, 0x0327, 0x0002, 0x006c, 0x0327, 0x0002,
+    0x004c, 0x030c, 0x0002, 0x006c, 0x030c, 0x0002, 0x004e, 0x0301,
+    0x0002, 0x006e, 0x0301, 0x0002, 0x004e, 0x0327, 0x0002, 0x006e,
+    0x0327, 0x0002, 0x004e, 0x030c, 0x0002, 0x006e, 0x030c, 0x0002,
+    0x004f, 0x0304, 0x0002, 0x006f, 0x0304, 0x0002, 0x004f, 0x0306,
+    0x0002, 0x006f, 0x0306, 0x0002, 0x004f, 0x030b, 0x0002, 0x006f,
+    0x030b, 0x0002, 0x0052, 0x0301, 0x0002, 0x0072, 0x0301, 0x0002,
+    0x0052, 0x0327, 0x0002, 0x0072, 0x0327, 0x0002, 0x0052, 0x030c,
+    0x0002, 0x0072, 0x030c, 0x0002, 0x0053, 0x0301, 0x0002, 0x0073,
+    0x0301, 0x0002, 0x0053, 0x0302, 0x0002, 0x0073, 0x0302, 0x0002,
+    0x0053, 0x0327, 0x0002, 0x0073, 0x0327, 0x0002, 0x0053, 0x030c,
+    0x0002, 0x0073, 0x030c, 0x0002, 0x0054, 0x0327, 0x0002, 0x0074,
+    0x0327, 0x0002, 0x0054, 0x030c, 0x0002, 0x0074, 0x030c, 0x0002,
+    0x0055, 0x0303, 0x0002, 0x0075, 0x0303, 0x0002, 0x0055, 0x0304,
+    0x0002, 0x0075, 0x0304, 0x0002, 0x0055, 0x0306, 0x0002, 0x0075,
+    0x0306, 0x0002, 0x0055, 0x030a, 0x0002, 0x0075, 0x030a, 0x0002,
+    0x0055, 0x030b, 0x0002, 0x0075, 0x030b, 0x0002, 0x0055, 0x0328,
+    0x0002, 0x0075, 0x0328, 0x0002, 0x0057, 0x0302, 0x0002, 0x0077,
+    0x0302, 0x0002, 0x0059, 0x0302, 0x0002, 0x0079, 0x0302, 0x0002,
+    0x0059, 0x0308, 0x0002, 0x005a, 0x0301, 0x0002, 0x007a, 0x0301,
+    0x0002, 0x005a, 0x0307, 0x0002, 0x007a, 0x0307, 0x0002, 0x005a,
+    0x030c, 0x0002, 0x007a, 0x030c, 0x0002, 0x004f, 0x031b, 0x0002,
+    0x006f, 0x031b, 0x0002, 0x0055, 0x031b, 0x0002, 0x0075, 0x031b,
+    0x0002, 0x0041, 0x030c, 0x0002, 0x0061, 0x030c, 0x0002, 0x0049,
+    0x030c, 0x0002, 0x0069, 0x030c, 0x0002, 0x004f, 0x030c, 0x0002,
+    0x006f, 0x030c, 0x0002, 0x0055, 0x030c, 0x0002, 0x0075, 0x030c,
+    0x0003, 0x0055, 0x0308, 0x0304, 0x0003, 0x0075, 0x0308, 0x0304,
+    0x0003, 0x0055, 0x0308, 0x0301, 0x0003, 0x0075, 0x0308, 0x0301,
+    0x0003, 0x0055, 0x0308, 0x030c, 0x0003, 0x0075, 0x0308, 0x030c,
+    0x0003, 0x0055, 0x0308, 0x0300, 0x0003, 0x0075, 0x0308, 0x0300,
+    0x0003, 0x0041, 0x0308, 0x0304, 0x0003, 0x0061, 0x0308, 0x0304,
+    0x0003, 0x0041, 0x0307, 0x0304, 0x0003, 0x0061, 0x0307, 0x0304,
+    0x0002, 0x00c6, 0x0304, 0x0002, 0x00e6, 0x0304, 0x0002, 0x0047,
+    0x030c, 0x0002, 0x0067, 0x030c, 0x0002, 0x004b, 0x030c, 0x0002,
+    0x006b, 0x030c, 0x0002, 0x004f, 0x0328, 0x0002, 0x006f, 0x0328,
+    0x0003, 0x004f, 0x0328, 0x0304, 0x0003, 0x006f, 0x0328, 0x0304,
+    0x0002, 0x01b7, 0x030c, 0x0002, 0x0292, 0x030c, 0x0002, 0x006a,
+    0x030c, 0x0002, 0x0047, 0x0301, 0x0002, 0x0067, 0x0301, 0x0002,
+    0x004e, 0x0300, 0x0002, 0x006e, 0x0300, 0x0003, 0x0041, 0x030a,
+    0x0301, 0x0003, 0x0061, 0x030a, 0x0301, 0x0002, 0x00c6, 0x0301,
+    0x0002, 0x00e6, 0x0301, 0x0002, 0x00d8, 0x0301, 0x0002, 0x00f8,
+    0x0301, 0x0002, 0x0041, 0x030f, 0x0002, 0x0061, 0x030f, 0x0002,
+    0x0041, 0x0311, 0x0002, 0x0061, 0x0311, 0x0002, 0x0045, 0x030f,
+    0x0002, 0x0065, 0x030f, 0x0002, 0x0045, 0x0311, 0x0002, 0x0065,
+    0x0311, 0x0002, 0x0049, 0x030f, 0x0002, 0x0069, 0x030f, 0x0002,
+    0x0049, 0x0311, 0x0002, 0x0069, 0x0311, 0x0002, 0x004f, 0x030f,
+    0x0002, 0x006f, 0x030f, 0x0002, 0x004f, 0x0311, 0x0002, 0x006f,
+    0x0311, 0x0002, 0x0052, 0x030f, 0x0002, 0x0072, 0x030f, 0x0002,
+    0x0052, 0x0311, 0x0002, 0x0072, 0x0311, 0x0002, 0x0055, 0x030f,
+    0x0002, 0x0075, 0x030f, 0x0002, 0x0055, 0x0311, 0x0002, 0x0075,
+    0x0311, 0x0002, 0x0053, 0x0326, 0x0002, 0x0073, 0x0326, 0x0002,
+    0x0054, 0x0326, 0x0002, 0x0074, 0x0326, 0x0002, 0x0048, 0x030c,
+    0x0002, 0x0068, 0x030c, 0x0002, 0x0041, 0x0307, 0x0002, 0x0061,
+    0x0307, 0x0002, 0x0045, 0x0327, 0x0002, 0x0065, 0x0327, 0x0003,
+    0x004f, 0x0308, 0x0304, 0x0003, 0x006f, 0x0308, 0x0304, 0x0003,
+    0x004f, 0x0303, 0x0304, 0x0003, 0x006f, 0x0303, 0x0304, 0x0002,
+    0x004f, 0x0307, 0x0002, 0x006f, 0x0307, 0x0003, 0x004f, 0x0307,
+    0x0304, 0x0003, 0x006f, 0x0307, 0x0304, 0x0002, 0x0059, 0x0304,
+    0x0002, 0x0079, 0x0304, 0x0001, 0x0300, 0x0001, 0x0301, 0x0001,
+    0x0313, 0x0002, 0x0308, 0x0301, 0x0001, 0x02b9, 0x0001, 0x003b,
+    0x0002, 0x00a8, 0x0301, 0x0002, 0x0391, 0x0301, 0x0001, 0x00b7,
+    0x0002, 0x0395, 0x0301, 0x0002, 0x0397, 0x0301, 0x0002, 0x0399,
+    0x0301, 0x0002, 0x039f, 0x0301, 0x0002, 0x03a5, 0x0301, 0x0002,
+    0x03a9, 0x0301, 0x0003, 0x03b9, 0x0308, 0x0301, 0x0002, 0x0399,
+    0x0308, 0x0002, 0x03a5, 0x0308, 0x0002, 0x03b1, 0x0301, 0x0002,
+    0x03b5, 0x0301, 0x0002, 0x03b7, 0x0301, 0x0002, 0x03b9, 0x0301,
+    0x0003, 0x03c5, 0x0308, 0x0301, 0x0002, 0x03b9, 0x0308, 0x0002,
+    0x03c5, 0x0308, 0x0002, 0x03bf, 0x0301, 0x0002, 0x03c5, 0x0301,
+    0x0002, 0x03c9, 0x0301, 0x0002, 0x03d2, 0x0301, 0x0002, 0x03d2,
+    0x0308, 0x0002, 0x0415, 0x0300, 0x0002, 0x0415, 0x0308, 0x0002,
+    0x0413, 0x0301, 0x0002, 0x0406, 0x0308, 0x0002, 0x041a, 0x0301,
+    0x0002, 0x0418, 0x0300, 0x0002, 0x0423, 0x0306, 0x0002, 0x0418,
+    0x0306, 0x0002, 0x0438, 0x0306, 0x0002, 0x0435, 0x0300, 0x0002,
+    0x0435, 0x0308, 0x0002, 0x0433, 0x0301, 0x0002, 0x0456, 0x0308,
+    0x0002, 0x043a, 0x0301, 0x0002, 0x0438, 0x0300, 0x0002, 0x0443,
+    0x0306, 0x0002, 0x0474, 0x030f, 0x0002, 0x0475, 0x030f, 0x0002,
+    0x0416, 0x0306, 0x0002, 0x0436, 0x0306, 0x0002, 0x0410, 0x0306,
+    0x0002, 0x0430, 0x0306, 0x0002, 0x0410, 0x0308, 0x0002, 0x0430,
+    0x0308, 0x0002, 0x0415, 0x0306, 0x0002, 0x0435, 0x0306, 0x0002,
+    0x04d8, 0x0308, 0x0002, 0x04d9, 0x0308, 0x0002, 0x0416, 0x0308,
+    0x0002, 0x0436, 0x0308, 0x0002, 0x0417, 0x0308, 0x0002, 0x0437,
+    0x0308, 0x0002, 0x0418, 0x0304, 0x0002, 0x0438, 0x0304, 0x0002,
+    0x0418, 0x0308, 0x0002, 0x0438, 0x0308, 0x0002, 0x041e, 0x0308,
+    0x0002, 0x043e, 0x0308, 0x0002, 0x04e8, 0x0308, 0x0002, 0x04e9,
+    0x0308, 0x0002, 0x042d, 0x0308, 0x0002, 0x044d, 0x0308, 0x0002,
+    0x0423, 0x0304, 0x0002, 0x0443, 0x0304, 0x0002, 0x0423, 0x0308,
+    0x0002, 0x0443, 0x0308, 0x0002, 0x0423, 0x030b, 0x0002, 0x0443,
+    0x030b, 0x0002, 0x0427, 0x0308, 0x0002, 0x0447, 0x0308, 0x0002,
+    0x042b, 0x0308, 0x0002, 0x044b, 0x0308, 0x0002, 0x0627, 0x0653,
+    0x0002, 0x0627, 0x0654, 0x0002, 0x0648, 0x0654, 0x0002, 0x0627,
+    0x0655, 0x0002, 0x064a, 0x0654, 0x0002, 0x06d5, 0x0654, 0x0002,
+    0x06c1, 0x0654, 0x0002, 0x06d2, 0x0654, 0x0002, 0x0928, 0x093c,
+    0x0002, 0x0930, 0x093c, 0x0002, 0x0933, 0x093c, 0x0002, 0x0915,
+    0x093c, 0x0002, 0x0916, 0x093c, 0x0002, 0x0917, 0x093c, 0x0002,
+    0x091c, 0x093c, 0x0002, 0x0921, 0x093c, 0x0002, 0x0922, 0x093c,
+    0x0002, 0x092b, 0x093c, 0x0002, 0x092f, 0x093c, 0x0002, 0x09c7,
+    0x09be, 0x0002, 0x09c7, 0x09d7, 0x0002, 0x09a1, 0x09bc, 0x0002,
+    0x09a2, 0x09bc, 0x0002, 0x09af, 0x09bc, 0x0002, 0x0a32, 0x0a3c,
+    0x0002, 0x0a38, 0x0a3c, 0x0002, 0x0a16, 0x0a3c, 0x0002, 0x0a17,
+    0x0a3c, 0x0002, 0x0a1c, 0x0a3c, 0x0002, 0x0a2b, 0x0a3c, 0x0002,
+    0x0b47, 0x0b56, 0x0002, 0x0b47, 0x0b3e, 0x0002, 0x0b47, 0x0b57,
+    0x0002, 0x0b21, 0x0b3c, 0x0002, 0x0b22, 0x0b3c, 0x0002, 0x0b92,
+    0x0bd7, 0x0002, 0x0bc6, 0x0bbe, 0x0002, 0x0bc7, 0x0bbe, 0x0002,
+    0x0bc6, 0x0bd7, 0x0002, 0x0c46, 0x0c56, 0x0002, 0x0cbf, 0x0cd5,
+    0x0002, 0x0cc6, 0x0cd5, 0x0002, 0x0cc6, 0x0cd6, 0x0002, 0x0cc6,
+    0x0cc2, 0x0003, 0x0cc6, 0x0cc2, 0x0cd5, 0x0002, 0x0d46, 0x0d3e,
+    0x0002, 0x0d47, 0x0d3e, 0x0002, 0x0d46, 0x0d57, 0x0002, 0x0dd9,
+    0x0dca, 0x0002, 0x0dd9, 0x0dcf, 0x0003, 0x0dd9, 0x0dcf, 0x0dca,
+    0x0002, 0x0dd9, 0x0ddf, 0x0002, 0x0f42, 0x0fb7, 0x0002, 0x0f4c,
+    0x0fb7, 0x0002, 0x0f51, 0x0fb7, 0x0002, 0x0f56, 0x0fb7, 0x0002,
+    0x0f5b, 0x0fb7, 0x0002, 0x0f40, 0x0fb5, 0x0002, 0x0f71, 0x0f72,
+    0x0002, 0x0f71, 0x0f74, 0x0002, 0x0fb2, 0x0f80, 0x0002, 0x0fb3,
+    0x0f80, 0x0002, 0x0f71, 0x0f80, 0x0002, 0x0f92, 0x0fb7, 0x0002,
+    0x0f9c, 0x0fb7, 0x0002, 0x0fa1, 0x0fb7, 0x0002, 0x0fa6, 0x0fb7,
+    0x0002, 0x0fab, 0x0fb7, 0x0002, 0x0f90, 0x0fb5, 0x0002, 0x1025,
+    0x102e, 0x0002, 0x1b05, 0x1b35, 0x0002, 0x1b07, 0x1b35, 0x0002,
+    0x1b09, 0x1b35, 0x0002, 0x1b0b, 0x1b35, 0x0002, 0x1b0d, 0x1b35,
+    0x0002, 0x1b11, 0x1b35, 0x0002, 0x1b3a, 0x1b35, 0x0002, 0x1b3c,
+    0x1b35, 0x0002, 0x1b3e, 0x1b35, 0x0002, 0x1b3f, 0x1b35, 0x0002,
+    0x1b42, 0x1b35, 0x0002, 0x0041, 0x0325, 0x0002, 0x0061, 0x0325,
+    0x0002, 0x0042, 0x0307, 0x0002, 0x0062, 0x0307, 0x0002, 0x0042,
+    0x0323, 0x0002, 0x0062, 0x0323, 0x0002, 0x0042, 0x0331, 0x0002,
+    0x0062, 0x0331, 0x0003, 0x0043, 0x0327, 0x0301, 0x0003, 0x0063,
+    0x0327, 0x0301, 0x0002, 0x0044, 0x0307, 0x0002, 0x0064, 0x0307,
+    0x0002, 0x0044, 0x0323, 0x0002, 0x0064, 0x0323, 0x0002, 0x0044,
+    0x0331, 0x0002, 0x0064, 0x0331, 0x0002, 0x0044, 0x0327, 0x0002,
+    0x0064, 0x0327, 0x0002, 0x0044, 0x032d, 0x0002, 0x0064, 0x032d,
+    0x0003, 0x0045, 0x0304, 0x0300, 0x0003, 0x0065, 0x0304, 0x0300,
+    0x0003, 0x0045, 0x0304, 0x0301, 0x0003, 0x0065, 0x0304, 0x0301,
+    0x0002, 0x0045, 0x032d, 0x0002, 0x0065, 0x032d, 0x0002, 0x0045,
+    0x0330, 0x0002, 0x0065, 0x0330, 0x0003, 0x0045, 0x0327, 0x0306,
+    0x0003, 0x0065, 0x0327, 0x0306, 0x0002, 0x0046, 0x0307, 0x0002,
+    0x0066, 0x0307, 0x0002, 0x0047, 0x0304, 0x0002, 0x0067, 0x0304,
+    0x0002, 0x0048, 0x0307, 0x0002, 0x0068, 0x0307, 0x0002, 0x0048,
+    0x0323, 0x0002, 0x0068, 0x0323, 0x0002, 0x0048, 0x0308, 0x0002,
+    0x0068, 0x0308, 0x0002, 0x0048, 0x0327, 0x0002, 0x0068, 0x0327,
+    0x0002, 0x0048, 0x032e, 0x0002, 0x0068, 0x032e, 0x0002, 0x0049,
+    0x0330, 0x0002, 0x0069, 0x0330, 0x0003, 0x0049, 0x0308, 0x0301,
+    0x0003, 0x0069, 0x0308, 0x0301, 0x0002, 0x004b, 0x0301, 0x0002,
+    0x006b, 0x0301, 0x0002, 0x004b, 0x0323, 0x0002, 0x006b, 0x0323,
+    0x0002, 0x004b, 0x0331, 0x0002, 0x006b, 0x0331, 0x0002, 0x004c,
+    0x0323, 0x0002, 0x006c, 0x0323, 0x0003, 0x004c, 0x0323, 0x0304,
+    0x0003, 0x006c, 0x0323, 0x0304, 0x0002, 0x004c, 0x0331, 0x0002,
+    0x006c, 0x0331, 0x0002, 0x004c, 0x032d, 0x0002, 0x006c, 0x032d,
+    0x0002, 0x004d, 0x0301, 0x0002, 0x006d, 0x0301, 0x0002, 0x004d,
+    0x0307, 0x0002, 0x006d, 0x0307, 0x0002, 0x004d, 0x0323, 0x0002,
+    0x006d, 0x0323, 0x0002, 0x004e, 0x0307, 0x0002, 0x006e, 0x0307,
+    0x0002, 0x004e, 0x0323, 0x0002, 0x006e, 0x0323, 0x0002, 0x004e,
+    0x0331, 0x0002, 0x006e, 0x0331, 0x0002, 0x004e, 0x032d, 0x0002,
+    0x006e, 0x032d, 0x0003, 0x004f, 0x0303, 0x0301, 0x0003, 0x006f,
+    0x0303, 0x0301, 0x0003, 0x004f, 0x0303, 0x0308, 0x0003, 0x006f,
+    0x0303, 0x0308, 0x0003, 0x004f, 0x0304, 0x0300, 0x0003, 0x006f,
+    0x0304, 0x0300, 0x0003, 0x004f, 0x0304, 0x0301, 0x0003, 0x006f,
+    0x0304, 0x0301, 0x0002, 0x0050, 0x0301, 0x0002, 0x0070, 0x0301,
+    0x0002, 0x0050, 0x0307, 0x0002, 0x0070, 0x0307, 0x0002, 0x0052,
+    0x0307, 0x0002, 0x0072, 0x0307, 0x0002, 0x0052, 0x0323, 0x0002,
+    0x0072, 0x0323, 0x0003, 0x0052, 0x0323, 0x0304, 0x0003, 0x0072,
+    0x0323, 0x0304, 0x0002, 0x0052, 0x0331, 0x0002, 0x0072, 0x0331,
+    0x0002, 0x0053, 0x0307, 0x0002, 0x0073, 0x0307, 0x0002, 0x0053,
+    0x0323, 0x0002, 0x0073, 0x0323, 0x0003, 0x0053, 0x0301, 0x0307,
+    0x0003, 0x0073, 0x0301, 0x0307, 0x0003, 0x0053, 0x030c, 0x0307,
+    0x0003, 0x0073, 0x030c, 0x0307, 0x0003, 0x0053, 0x0323, 0x0307,
+    0x0003, 0x0073, 0x0323, 0x0307, 0x0002, 0x0054, 0x0307, 0x0002,
+    0x0074, 0x0307, 0x0002, 0x0054, 0x0323, 0x0002, 0x0074, 0x0323,
+    0x0002, 0x0054, 0x0331, 0x0002, 0x0074, 0x0331, 0x0002, 0x0054,
+    0x032d, 0x0002, 0x0074, 0x032d, 0x0002, 0x0055, 0x0324, 0x0002,
+    0x0075, 0x0324, 0x0002, 0x0055, 0x0330, 0x0002, 0x0075, 0x0330,
+    0x0002, 0x0055, 0x032d, 0x0002, 0x0075, 0x032d, 0x0003, 0x0055,
+    0x0303, 0x0301, 0x0003, 0x0075, 0x0303, 0x0301, 0x0003, 0x0055,
+    0x0304, 0x0308, 0x0003, 0x0075, 0x0304, 0x0308, 0x0002, 0x0056,
+    0x0303, 0x0002, 0x0076, 0x0303, 0x0002, 0x0056, 0x0323, 0x0002,
+    0x0076, 0x0323, 0x0002, 0x0057, 0x0300, 0x0002, 0x0077, 0x0300,
+    0x0002, 0x0057, 0x0301, 0x0002, 0x0077, 0x0301, 0x0002, 0x0057,
+    0x0308, 0x0002, 0x0077, 0x0308, 0x0002, 0x0057, 0x0307, 0x0002,
+    0x0077, 0x0307, 0x0002, 0x0057, 0x0323, 0x0002, 0x0077, 0x0323,
+    0x0002, 0x0058, 0x0307, 0x0002, 0x0078, 0x0307, 0x0002, 0x0058,
+    0x0308, 0x0002, 0x0078, 0x0308, 0x0002, 0x0059, 0x0307, 0x0002,
+    0x0079, 0x0307, 0x0002, 0x005a, 0x0302, 0x0002, 0x007a, 0x0302,
+    0x0002, 0x005a, 0x0323, 0x0002, 0x007a, 0x0323, 0x0002, 0x005a,
+    0x0331, 0x0002, 0x007a, 0x0331, 0x0002, 0x0068, 0x0331, 0x0002,
+    0x0074, 0x0308, 0x0002, 0x0077, 0x030a, 0x0002, 0x0079, 0x030a,
+    0x0002, 0x017f, 0x0307, 0x0002, 0x0041, 0x0323, 0x0002, 0x0061,
+    0x0323, 0x0002, 0x0041, 0x0309, 0x0002, 0x0061, 0x0309, 0x0003,
+    0x0041, 0x0302, 0x0301, 0x0003, 0x0061, 0x0302, 0x0301, 0x0003,
+    0x0041, 0x0302, 0x0300, 0x0003, 0x0061, 0x0302, 0x0300, 0x0003,
+    0x0041, 0x0302, 0x0309, 0x0003, 0x0061, 0x0302, 0x0309, 0x0003,
+    0x0041, 0x0302, 0x0303, 0x0003, 0x0061, 0x0302, 0x0303, 0x0003,
+    0x0041, 0x0323, 0x0302, 0x0003, 0x0061, 0x0323, 0x0302, 0x0003,
+    0x0041, 0x0306, 0x0301, 0x0003, 0x0061, 0x0306, 0x0301, 0x0003,
+    0x0041, 0x0306, 0x0300, 0x0003, 0x0061, 0x0306, 0x0300, 0x0003,
+    0x0041, 0x0306, 0x0309, 0x0003, 0x0061, 0x0306, 0x0309, 0x0003,
+    0x0041, 0x0306, 0x0303, 0x0003, 0x0061, 0x0306, 0x0303, 0x0003,
+    0x0041, 0x0323, 0x0306, 0x0003, 0x0061, 0x0323, 0x0306, 0x0002,
+    0x0045, 0x0323, 0x0002, 0x0065, 0x0323, 0x0002, 0x0045, 0x0309,
+    0x0002, 0x0065, 0x0309, 0x0002, 0x0045, 0x0303, 0x0002, 0x0065,
+    0x0303, 0x0003, 0x0045, 0x0302, 0x0301, 0x0003, 0x0065, 0x0302,
+    0x0301, 0x0003, 0x0045, 0x0302, 0x0300, 0x0003, 0x0065, 0x0302,
+    0x0300, 0x0003, 0x0045, 0x0302, 0x0309, 0x0003, 0x0065, 0x0302,
+    0x0309, 0x0003, 0x0045, 0x0302, 0x0303, 0x0003, 0x0065, 0x0302,
+    0x0303, 0x0003, 0x0045, 0x0323, 0x0302, 0x0003, 0x0065, 0x0323,
+    0x0302, 0x0002, 0x0049, 0x0309, 0x0002, 0x0069, 0x0309, 0x0002,
+    0x0049, 0x0323, 0x0002, 0x0069, 0x0323, 0x0002, 0x004f, 0x0323,
+    0x0002, 0x006f, 0x0323, 0x0002, 0x004f, 0x0309, 0x0002, 0x006f,
+    0x0309, 0x0003, 0x004f, 0x0302, 0x0301, 0x0003, 0x006f, 0x0302,
+    0x0301, 0x0003, 0x004f, 0x0302, 0x0300, 0x0003, 0x006f, 0x0302,
+    0x0300, 0x0003, 0x004f, 0x0302, 0x0309, 0x0003, 0x006f, 0x0302,
+    0x0309, 0x0003, 0x004f, 0x0302, 0x0303, 0x0003, 0x006f, 0x0302,
+    0x0303, 0x0003, 0x004f, 0x0323, 0x0302, 0x0003, 0x006f, 0x0323,
+    0x0302, 0x0003, 0x004f, 0x031b, 0x0301, 0x0003, 0x006f, 0x031b,
+    0x0301, 0x0003, 0x004f, 0x031b, 0x0300, 0x0003, 0x006f, 0x031b,
+    0x0300, 0x0003, 0x004f, 0x031b, 0x0309, 0x0003, 0x006f, 0x031b,
+    0x0309, 0x0003, 0x004f, 0x031b, 0x0303, 0x0003, 0x006f, 0x031b,
+    0x0303, 0x0003, 0x004f, 0x031b, 0x0323, 0x0003, 0x006f, 0x031b,
+    0x0323, 0x0002, 0x0055, 0x0323, 0x0002, 0x0075, 0x0323, 0x0002,
+    0x0055, 0x0309, 0x0002, 0x0075, 0x0309, 0x0003, 0x0055, 0x031b,
+    0x0301, 0x0003, 0x0075, 0x031b, 0x0301, 0x0003, 0x0055, 0x031b,
+    0x0300, 0x0003, 0x0075, 0x031b, 0x0300, 0x0003, 0x0055, 0x031b,
+    0x0309, 0x0003, 0x0075, 0x031b, 0x0309, 0x0003, 0x0055, 0x031b,
+    0x0303, 0x0003, 0x0075, 0x031b, 0x0303, 0x0003, 0x0055, 0x031b,
+    0x0323, 0x0003, 0x0075, 0x031b, 0x0323, 0x0002, 0x0059, 0x0300,
+    0x0002, 0x0079, 0x0300, 0x0002, 0x0059, 0x0323, 0x0002, 0x0079,
+    0x0323, 0x0002, 0x0059, 0x0309, 0x0002, 0x0079, 0x0309, 0x0002,
+    0x0059, 0x0303, 0x0002, 0x0079, 0x0303, 0x0002, 0x03b1, 0x0313,
+    0x0002, 0x03b1, 0x0314, 0x0003, 0x03b1, 0x0313, 0x0300, 0x0003,
+    0x03b1, 0x0314, 0x0300, 0x0003, 0x03b1, 0x0313, 0x0301, 0x0003,
+    0x03b1, 0x0314, 0x0301, 0x0003, 0x03b1, 0x0313, 0x0342, 0x0003,
+    0x03b1, 0x0314, 0x0342, 0x0002, 0x0391, 0x0313, 0x0002, 0x0391,
+    0x0314, 0x0003, 0x0391, 0x0313, 0x0300, 0x0003, 0x0391, 0x0314,
+    0x0300, 0x0003, 0x0391, 0x0313, 0x0301, 0x0003, 0x0391, 0x0314,
+    0x0301, 0x0003, 0x0391, 0x0313, 0x0342, 0x0003, 0x0391, 0x0314,
+    0x0342, 0x0002, 0x03b5, 0x0313, 0x0002, 0x03b5, 0x0314, 0x0003,
+    0x03b5, 0x0313, 0x0300, 0x0003, 0x03b5, 0x0314, 0x0300, 0x0003,
+    0x03b5, 0x0313, 0x0301, 0x0003, 0x03b5, 0x0314, 0x0301, 0x0002,
+    0x0395, 0x0313, 0x0002, 0x0395, 0x0314, 0x0003, 0x0395, 0x0313,
+    0x0300, 0x0003, 0x0395, 0x0314, 0x0300, 0x0003, 0x0395, 0x0313,
+    0x0301, 0x0003, 0x0395, 0x0314, 0x0301, 0x0002, 0x03b7, 0x0313,
+    0x0002, 0x03b7, 0x0314, 0x0003, 0x03b7, 0x0313, 0x0300, 0x0003,
+    0x03b7, 0x0314, 0x0300, 0x0003, 0x03b7, 0x0313, 0x0301, 0x0003,
+    0x03b7, 0x0314, 0x0301, 0x0003, 0x03b7, 0x0313, 0x0342, 0x0003,
+    0x03b7, 0x0314, 0x0342, 0x0002, 0x0397, 0x0313, 0x0002, 0x0397,
+    0x0314, 0x0003, 0x0397, 0x0313, 0x0300, 0x0003, 0x0397, 0x0314,
+    0x0300, 0x0003, 0x0397, 0x0313, 0x0301, 0x0003, 0x0397, 0x0314,
+    0x0301, 0x0003, 0x0397, 0x0313, 0x0342, 0x0003, 0x0397, 0x0314,
+    0x0342, 0x0002, 0x03b9, 0x0313, 0x0002, 0x03b9, 0x0314, 0x0003,
+    0x03b9, 0x0313, 0x0300, 0x0003, 0x03b9, 0x0314, 0x0300, 0x0003,
+    0x03b9, 0x0313, 0x0301, 0x0003, 0x03b9, 0x0314, 0x0301, 0x0003,
+    0x03b9, 0x0313, 0x0342, 0x0003, 0x03b9, 0x0314, 0x0342, 0x0002,
+    0x0399, 0x0313, 0x0002, 0x0399, 0x0314, 0x0003, 0x0399, 0x0313,
+    0x0300, 0x0003, 0x0399, 0x0314, 0x0300, 0x0003, 0x0399, 0x0313,
+    0x0301, 0x0003, 0x0399, 0x0314, 0x0301, 0x0003, 0x0399, 0x0313,
+    0x0342, 0x0003, 0x0399, 0x0314, 0x0342, 0x0002, 0x03bf, 0x0313,
+    0x0002, 0x03bf, 0x0314, 0x0003, 0x03bf, 0x0313, 0x0300, 0x0003,
+    0x03bf, 0x0314, 0x0300, 0x0003, 0x03bf, 0x0313, 0x0301, 0x0003,
+    0x03bf, 0x0314, 0x0301, 0x0002, 0x039f, 0x0313, 0x0002, 0x039f,
+    0x0314, 0x0003, 0x039f, 0x0313, 0x0300, 0x0003, 0x039f, 0x0314,
+    0x0300, 0x0003, 0x039f, 0x0313, 0x0301, 0x0003, 0x039f, 0x0314,
+    0x0301, 0x0002, 0x03c5, 0x0313, 0x0002, 0x03c5, 0x0314, 0x0003,
+    0x03c5, 0x0313, 0x0300, 0x0003, 0x03c5, 0x0314, 0x0300, 0x0003,
+    0x03c5, 0x0313, 0x0301, 0x0003, 0x03c5, 0x0314, 0x0301, 0x0003,
+    0x03c5, 0x0313, 0x0342, 0x0003, 0x03c5, 0x0314, 0x0342, 0x0002,
+    0x03a5, 0x0314, 0x0003, 0x03a5, 0x0314, 0x0300, 0x0003, 0x03a5,
+    0x0314, 0x0301, 0x0003, 0x03a5, 0x0314, 0x0342, 0x0002, 0x03c9,
+    0x0313, 0x0002, 0x03c9, 0x0314, 0x0003, 0x03c9, 0x0313, 0x0300,
+    0x0003, 0x03c9, 0x0314, 0x0300, 0x0003, 0x03c9, 0x0313, 0x0301,
+    0x0003, 0x03c9, 0x0314, 0x0301, 0x0003, 0x03c9, 0x0313, 0x0342,
+    0x0003, 0x03c9, 0x0314, 0x0342, 0x0002, 0x03a9, 0x0313, 0x0002,
+    0x03a9, 0x0314, 0x0003, 0x03a9, 0x0313, 0x0300, 0x0003, 0x03a9,
+    0x0314, 0x0300, 0x0003, 0x03a9, 0x0313, 0x0301, 0x0003, 0x03a9,
+    0x0314, 0x0301, 0x0003, 0x03a9, 0x0313, 0x0342, 0x0003, 0x03a9,
+    0x0314, 0x0342, 0x0002, 0x03b1, 0x0300, 0x0002, 0x03b1, 0x0301,
+    0x0002, 0x03b5, 0x0300, 0x0002, 0x03b5, 0x0301, 0x0002, 0x03b7,
+    0x0300, 0x0002, 0x03b7, 0x0301, 0x0002, 0x03b9, 0x0300, 0x0002,
+    0x03b9, 0x0301, 0x0002, 0x03bf, 0x0300, 0x0002, 0x03bf, 0x0301,
+    0x0002, 0x03c5, 0x0300, 0x0002, 0x03c5, 0x0301, 0x0002, 0x03c9,
+    0x0300, 0x0002, 0x03c9, 0x0301, 0x0003, 0x03b1, 0x0313, 0x0345,
+    0x0003, 0x03b1, 0x0314, 0x0345, 0x0004, 0x03b1, 0x0313, 0x0300,
+    0x0345, 0x0004, 0x03b1, 0x0314, 0x0300, 0x0345, 0x0004, 0x03b1,
+    0x0313, 0x0301, 0x0345, 0x0004, 0x03b1, 0x0314, 0x0301, 0x0345,
+    0x0004, 0x03b1, 0x0313, 0x0342, 0x0345, 0x0004, 0x03b1, 0x0314,
+    0x0342, 0x0345, 0x0003, 0x0391, 0x0313, 0x0345, 0x0003, 0x0391,
+    0x0314, 0x0345, 0x0004, 0x0391, 0x0313, 0x0300, 0x0345, 0x0004,
+    0x0391, 0x0314, 0x0300, 0x0345, 0x0004, 0x0391, 0x0313, 0x0301,
+    0x0345, 0x0004, 0x0391, 0x0314, 0x0301, 0x0345, 0x0004, 0x0391,
+    0x0313, 0x0342, 0x0345, 0x0004, 0x0391, 0x0314, 0x0342, 0x0345,
+    0x0003, 0x03b7, 0x0313, 0x0345, 0x0003, 0x03b7, 0x0314, 0x0345,
+    0x0004, 0x03b7, 0x0313, 0x0300, 0x0345, 0x0004, 0x03b7, 0x0314,
+    0x0300, 0x0345, 0x0004, 0x03b7, 0x0313, 0x0301, 0x0345, 0x0004,
+    0x03b7, 0x0314, 0x0301, 0x0345, 0x0004, 0x03b7, 0x0313, 0x0342,
+    0x0345, 0x0004, 0x03b7, 0x0314, 0x0342, 0x0345, 0x0003, 0x0397,
+    0x0313, 0x0345, 0x0003, 0x0397, 0x0314, 0x0345, 0x0004, 0x0397,
+    0x0313, 0x0300, 0x0345, 0x0004, 0x0397, 0x0314, 0x0300, 0x0345,
+    0x0004, 0x0397, 0x0313, 0x0301, 0x0345, 0x0004, 0x0397, 0x0314,
+    0x0301, 0x0345, 0x0004, 0x0397, 0x0313, 0x0342, 0x0345, 0x0004,
+    0x0397, 0x0314, 0x0342, 0x0345, 0x0003, 0x03c9, 0x0313, 0x0345,
+    0x0003, 0x03c9, 0x0314, 0x0345, 0x0004, 0x03c9, 0x0313, 0x0300,
+    0x0345, 0x0004, 0x03c9, 0x0314, 0x0300, 0x0345, 0x0004, 0x03c9,
+    0x0313, 0x0301, 0x0345, 0x0004, 0x03c9, 0x0314, 0x0301, 0x0345,
+    0x0004, 0x03c9, 0x0313, 0x0342, 0x0345, 0x0004, 0x03c9, 0x0314,
+    0x0342, 0x0345, 0x0003, 0x03a9, 0x0313, 0x0345, 0x0003, 0x03a9,
+    0x0314, 0x0345, 0x0004, 0x03a9, 0x0313, 0x0300, 0x0345, 0x0004,
+    0x03a9, 0x0314, 0x0300, 0x0345, 0x0004, 0x03a9, 0x0313, 0x0301,
+    0x0345, 0x0004, 0x03a9, 0x0314, 0x0301, 0x0345, 0x0004, 0x03a9,
+    0x0313, 0x0342, 0x0345, 0x0004, 0x03a9, 0x0314, 0x0342, 0x0345,
+    0x0002, 0x03b1, 0x0306, 0x0002, 0x03b1, 0x0304, 0x0003, 0x03b1,
+    0x0300, 0x0345, 0x0002, 0x03b1, 0x0345, 0x0003, 0x03b1, 0x0301,
+    0x0345, 0x0002, 0x03b1, 0x0342, 0x0003, 0x03b1, 0x0342, 0x0345,
+    0x0002, 0x0391, 0x0306, 0x0002, 0x0391, 0x0304, 0x0002, 0x0391,
+    0x0300, 0x0002, 0x0391, 0x0301, 0x0002, 0x0391, 0x0345, 0x0001,
+    0x03b9, 0x0002, 0x00a8, 0x0342, 0x0003, 0x03b7, 0x0300, 0x0345,
+    0x0002, 0x03b7, 0x0345, 0x0003, 0x03b7, 0x0301, 0x0345, 0x0002,
+    0x03b7, 0x0342, 0x0003, 0x03b7, 0x0342, 0x0345, 0x0002, 0x0395,
+    0x0300, 0x0002, 0x0395, 0x0301, 0x0002, 0x0397, 0x0300, 0x0002,
+    0x0397, 0x0301, 0x0002, 0x0397, 0x0345, 0x0002, 0x1fbf, 0x0300,
+    0x0002, 0x1fbf, 0x0301, 0x0002, 0x1fbf, 0x0342, 0x0002, 0x03b9,
+    0x0306, 0x0002, 0x03b9, 0x0304, 0x0003, 0x03b9, 0x0308, 0x0300,
+    0x0003, 0x03b9, 0x0308, 0x0301, 0x0002, 0x03b9, 0x0342, 0x0003,
+    0x03b9, 0x0308, 0x0342, 0x0002, 0x0399, 0x0306, 0x0002, 0x0399,
+    0x0304, 0x0002, 0x0399, 0x0300, 0x0002, 0x0399, 0x0301, 0x0002,
+    0x1ffe, 0x0300, 0x0002, 0x1ffe, 0x0301, 0x0002, 0x1ffe, 0x0342,
+    0x0002, 0x03c5, 0x0306, 0x0002, 0x03c5, 0x0304, 0x0003, 0x03c5,
+    0x0308, 0x0300, 0x0003, 0x03c5, 0x0308, 0x0301, 0x0002, 0x03c1,
+    0x0313, 0x0002, 0x03c1, 0x0314, 0x0002, 0x03c5, 0x0342, 0x0003,
+    0x03c5, 0x0308, 0x0342, 0x0002, 0x03a5, 0x0306, 0x0002, 0x03a5,
+    0x0304, 0x0002, 0x03a5, 0x0300, 0x0002, 0x03a5, 0x0301, 0x0002,
+    0x03a1, 0x0314, 0x0002, 0x00a8, 0x0300, 0x0002, 0x00a8, 0x0301,
+    0x0001, 0x0060, 0x0003, 0x03c9, 0x0300, 0x0345, 0x0002, 0x03c9,
+    0x0345, 0x0003, 0x03c9, 0x0301, 0x0345, 0x0002, 0x03c9, 0x0342,
+    0x0003, 0x03c9, 0x0342, 0x0345, 0x0002, 0x039f, 0x0300, 0x0002,
+    0x039f, 0x0301, 0x0002, 0x03a9, 0x0300, 0x0002, 0x03a9, 0x0301,
+    0x0002, 0x03a9, 0x0345, 0x0001, 0x00b4, 0x0001, 0x2002, 0x0001,
+    0x2003, 0x0001, 0x03a9, 0x0001, 0x004b, 0x0002, 0x0041, 0x030a,
+    0x0002, 0x2190, 0x0338, 0x0002, 0x2192, 0x0338, 0x0002, 0x2194,
+    0x0338, 0x0002, 0x21d0, 0x0338, 0x0002, 0x21d4, 0x0338, 0x0002,
+    0x21d2, 0x0338, 0x0002, 0x2203, 0x0338, 0x0002, 0x2208, 0x0338,
+    0x0002, 0x220b, 0x0338, 0x0002, 0x2223, 0x0338, 0x0002, 0x2225,
+    0x0338, 0x0002, 0x223c, 0x0338, 0x0002, 0x2243, 0x0338, 0x0002,
+    0x2245, 0x0338, 0x0002, 0x2248, 0x0338, 0x0002, 0x003d, 0x0338,
+    0x0002, 0x2261, 0x0338, 0x0002, 0x224d, 0x0338, 0x0002, 0x003c,
+    0x0338, 0x0002, 0x003e, 0x0338, 0x0002, 0x2264, 0x0338, 0x0002,
+    0x2265, 0x0338, 0x0002, 0x2272, 0x0338, 0x0002, 0x2273, 0x0338,
+    0x0002, 0x2276, 0x0338, 0x0002, 0x2277, 0x0338, 0x0002, 0x227a,
+    0x0338, 0x0002, 0x227b, 0x0338, 0x0002, 0x2282, 0x0338, 0x0002,
+    0x2283, 0x0338, 0x0002, 0x2286, 0x0338, 0x0002, 0x2287, 0x0338,
+    0x0002, 0x22a2, 0x0338, 0x0002, 0x22a8, 0x0338, 0x0002, 0x22a9,
+    0x0338, 0x0002, 0x22ab, 0x0338, 0x0002, 0x227c, 0x0338, 0x0002,
+    0x227d, 0x0338, 0x0002, 0x2291, 0x0338, 0x0002, 0x2292, 0x0338,
+    0x0002, 0x22b2, 0x0338, 0x0002, 0x22b3, 0x0338, 0x0002, 0x22b4,
+    0x0338, 0x0002, 0x22b5, 0x0338, 0x0001, 0x3008, 0x0001, 0x3009,
+    0x0002, 0x2add, 0x0338, 0x0002, 0x304b, 0x3099, 0x0002, 0x304d,
+    0x3099, 0x0002, 0x304f, 0x3099, 0x0002, 0x3051, 0x3099, 0x0002,
+    0x3053, 0x3099, 0x0002, 0x3055, 0x3099, 0x0002, 0x3057, 0x3099,
+    0x0002, 0x3059, 0x3099, 0x0002, 0x305b, 0x3099, 0x0002, 0x305d,
+    0x3099, 0x0002, 0x305f, 0x3099, 0x0002, 0x3061, 0x3099, 0x0002,
+    0x3064, 0x3099, 0x0002, 0x3066, 0x3099, 0x0002, 0x3068, 0x3099,
+    0x0002, 0x306f, 0x3099, 0x0002, 0x306f, 0x309a, 0x0002, 0x3072,
+    0x3099, 0x0002, 0x3072, 0x309a, 0x0002, 0x3075, 0x3099, 0x0002,
+    0x3075, 0x309a, 0x0002, 0x3078, 0x3099, 0x0002, 0x3078, 0x309a,
+    0x0002, 0x307b, 0x3099, 0x0002, 0x307b, 0x309a, 0x0002, 0x3046,
+    0x3099, 0x0002, 0x309d, 0x3099, 0x0002, 0x30ab, 0x3099, 0x0002,
+    0x30ad, 0x3099, 0x0002, 0x30af, 0x3099, 0x0002, 0x30b1, 0x3099,
+    0x0002, 0x30b3, 0x3099, 0x0002, 0x30b5, 0x3099, 0x0002, 0x30b7,
+    0x3099, 0x0002, 0x30b9, 0x3099, 0x0002, 0x30bb, 0x3099, 0x0002,
+    0x30bd, 0x3099, 0x0002, 0x30bf, 0x3099, 0x0002, 0x30c1, 0x3099,
+    0x0002, 0x30c4, 0x3099, 0x0002, 0x30c6, 0x3099, 0x0002, 0x30c8,
+    0x3099, 0x0002, 0x30cf, 0x3099, 0x0002, 0x30cf, 0x309a, 0x0002,
+    0x30d2, 0x3099, 0x0002, 0x30d2, 0x309a, 0x0002, 0x30d5, 0x3099,
+    0x0002, 0x30d5, 0x309a, 0x0002, 0x30d8, 0x3099, 0x0002, 0x30d8,
+    0x309a, 0x0002, 0x30db, 0x3099, 0x0002, 0x30db, 0x309a, 0x0002,
+    0x30a6, 0x3099, 0x0002, 0x30ef, 0x3099, 0x0002, 0x30f0, 0x3099,
+    0x0002, 0x30f1, 0x3099, 0x0002, 0x30f2, 0x3099, 0x0002, 0x30fd,
+    0x3099, 0x0001, 0x8c48, 0x0001, 0x66f4, 0x0001, 0x8eca, 0x0001,
+    0x8cc8, 0x0001, 0x6ed1, 0x0001, 0x4e32, 0x0001, 0x53e5, 0x0001,
+    0x9f9c, 0x0001, 0x9f9c, 0x0001, 0x5951, 0x0001, 0x91d1, 0x0001,
+    0x5587, 0x0001, 0x5948, 0x0001, 0x61f6, 0x0001, 0x7669, 0x0001,
+    0x7f85, 0x0001, 0x863f, 0x0001, 0x87ba, 0x0001, 0x88f8, 0x0001,
+    0x908f, 0x0001, 0x6a02, 0x0001, 0x6d1b, 0x0001, 0x70d9, 0x0001,
+    0x73de, 0x0001, 0x843d, 0x0001, 0x916a, 0x0001, 0x99f1, 0x0001,
+    0x4e82, 0x0001, 0x5375, 0x0001, 0x6b04, 0x0001, 0x721b, 0x0001,
+    0x862d, 0x0001, 0x9e1e, 0x0001, 0x5d50, 0x0001, 0x6feb, 0x0001,
+    0x85cd, 0x0001, 0x8964, 0x0001, 0x62c9, 0x0001, 0x81d8, 0x0001,
+    0x881f, 0x0001, 0x5eca, 0x0001, 0x6717, 0x0001, 0x6d6a, 0x0001,
+    0x72fc, 0x0001, 0x90ce, 0x0001, 0x4f86, 0x0001, 0x51b7, 0x0001,
+    0x52de, 0x0001, 0x64c4, 0x0001, 0x6ad3, 0x0001, 0x7210, 0x0001,
+    0x76e7, 0x0001, 0x8001, 0x0001, 0x8606, 0x0001, 0x865c, 0x0001,
+    0x8def, 0x0001, 0x9732, 0x0001, 0x9b6f, 0x0001, 0x9dfa, 0x0001,
+    0x788c, 0x0001, 0x797f, 0x0001, 0x7da0, 0x0001, 0x83c9, 0x0001,
+    0x9304, 0x0001, 0x9e7f, 0x0001, 0x8ad6, 0x0001, 0x58df, 0x0001,
+    0x5f04, 0x0001, 0x7c60, 0x0001, 0x807e, 0x0001, 0x7262, 0x0001,
+    0x78ca, 0x0001, 0x8cc2, 0x0001, 0x96f7, 0x0001, 0x58d8, 0x0001,
+    0x5c62, 0x0001, 0x6a13, 0x0001, 0x6dda, 0x0001, 0x6f0f, 0x0001,
+    0x7d2f, 0x0001, 0x7e37, 0x0001, 0x964b, 0x0001, 0x52d2, 0x0001,
+    0x808b, 0x0001, 0x51dc, 0x0001, 0x51cc, 0x0001, 0x7a1c, 0x0001,
+    0x7dbe, 0x0001, 0x83f1, 0x0001, 0x9675, 0x0001, 0x8b80, 0x0001,
+    0x62cf, 0x0001, 0x6a02, 0x0001, 0x8afe, 0x0001, 0x4e39, 0x0001,
+    0x5be7, 0x0001, 0x6012, 0x0001, 0x7387, 0x0001, 0x7570, 0x0001,
+    0x5317, 0x0001, 0x78fb, 0x0001, 0x4fbf, 0x0001, 0x5fa9, 0x0001,
+    0x4e0d, 0x0001, 0x6ccc, 0x0001, 0x6578, 0x0001, 0x7d22, 0x0001,
+    0x53c3, 0x0001, 0x585e, 0x0001, 0x7701, 0x0001, 0x8449, 0x0001,
+    0x8aaa, 0x0001, 0x6bba, 0x0001, 0x8fb0, 0x0001, 0x6c88, 0x0001,
+    0x62fe, 0x0001, 0x82e5, 0x0001, 0x63a0, 0x0001, 0x7565, 0x0001,
+    0x4eae, 0x0001, 0x5169, 0x0001, 0x51c9, 0x0001, 0x6881, 0x0001,
+    0x7ce7, 0x0001, 0x826f, 0x0001, 0x8ad2, 0x0001, 0x91cf, 0x0001,
+    0x52f5, 0x0001, 0x5442, 0x0001, 0x5973, 0x0001, 0x5eec, 0x0001,
+    0x65c5, 0x0001, 0x6ffe, 0x0001, 0x792a, 0x0001, 0x95ad, 0x0001,
+    0x9a6a, 0x0001, 0x9e97, 0x0001, 0x9ece, 0x0001, 0x529b, 0x0001,
+    0x66c6, 0x0001, 0x6b77, 0x0001, 0x8f62, 0x0001, 0x5e74, 0x0001,
+    0x6190, 0x0001, 0x6200, 0x0001, 0x649a, 0x0001, 0x6f23, 0x0001,
+    0x7149, 0x0001, 0x7489, 0x0001, 0x79ca, 0x0001, 0x7df4, 0x0001,
+    0x806f, 0x0001, 0x8f26, 0x0001, 0x84ee, 0x0001, 0x9023, 0x0001,
+    0x934a, 0x0001, 0x5217, 0x0001, 0x52a3, 0x0001, 0x54bd, 0x0001,
+    0x70c8, 0x0001, 0x88c2, 0x0001, 0x8aaa, 0x0001, 0x5ec9, 0x0001,
+    0x5ff5, 0x0001, 0x637b, 0x0001, 0x6bae, 0x0001, 0x7c3e, 0x0001,
+    0x7375, 0x0001, 0x4ee4, 0x0001, 0x56f9, 0x0001, 0x5be7, 0x0001,
+    0x5dba, 0x0001, 0x601c, 0x0001, 0x73b2, 0x0001, 0x7469, 0x0001,
+    0x7f9a, 0x0001, 0x8046, 0x0001, 0x9234, 0x0001, 0x96f6, 0x0001,
+    0x9748, 0x0001, 0x9818, 0x0001, 0x4f8b, 0x0001, 0x79ae, 0x0001,
+    0x91b4, 0x0001, 0x96b8, 0x0001, 0x60e1, 0x0001, 0x4e86, 0x0001,
+    0x50da, 0x0001, 0x5bee, 0x0001, 0x5c3f, 0x0001, 0x6599, 0x0001,
+    0x6a02, 0x0001, 0x71ce, 0x0001, 0x7642, 0x0001, 0x84fc, 0x0001,
+    0x907c, 0x0001, 0x9f8d, 0x0001, 0x6688, 0x0001, 0x962e, 0x0001,
+    0x5289, 0x0001, 0x677b, 0x0001, 0x67f3, 0x0001, 0x6d41, 0x0001,
+    0x6e9c, 0x0001, 0x7409, 0x0001, 0x7559, 0x0001, 0x786b, 0x0001,
+    0x7d10, 0x0001, 0x985e, 0x0001, 0x516d, 0x0001, 0x622e, 0x0001,
+    0x9678, 0x0001, 0x502b, 0x0001, 0x5d19, 0x0001, 0x6dea, 0x0001,
+    0x8f2a, 0x0001, 0x5f8b, 0x0001, 0x6144, 0x0001, 0x6817, 0x0001,
+    0x7387, 0x0001, 0x9686, 0x0001, 0x5229, 0x0001, 0x540f, 0x0001,
+    0x5c65, 0x0001, 0x6613, 0x0001, 0x674e, 0x0001, 0x68a8, 0x0001,
+    0x6ce5, 0x0001, 0x7406, 0x0001, 0x75e2, 0x0001, 0x7f79, 0x0001,
+    0x88cf, 0x0001, 0x88e1, 0x0001, 0x91cc, 0x0001, 0x96e2, 0x0001,
+    0x533f, 0x0001, 0x6eba, 0x0001, 0x541d, 0x0001, 0x71d0, 0x0001,
+    0x7498, 0x0001, 0x85fa, 0x0001, 0x96a3, 0x0001, 0x9c57, 0x0001,
+    0x9e9f, 0x0001, 0x6797, 0x0001, 0x6dcb, 0x0001, 0x81e8, 0x0001,
+    0x7acb, 0x0001, 0x7b20, 0x0001, 0x7c92, 0x0001, 0x72c0, 0x0001,
+    0x7099, 0x0001, 0x8b58, 0x0001, 0x4ec0, 0x0001, 0x8336, 0x0001,
+    0x523a, 0x0001, 0x5207, 0x0001, 0x5ea6, 0x0001, 0x62d3, 0x0001,
+    0x7cd6, 0x0001, 0x5b85, 0x0001, 0x6d1e, 0x0001, 0x66b4, 0x0001,
+    0x8f3b, 0x0001, 0x884c, 0x0001, 0x964d, 0x0001, 0x898b, 0x0001,
+    0x5ed3, 0x0001, 0x5140, 0x0001, 0x55c0, 0x0001, 0x585a, 0x0001,
+    0x6674, 0x0001, 0x51de, 0x0001, 0x732a, 0x0001, 0x76ca, 0x0001,
+    0x793c, 0x0001, 0x795e, 0x0001, 0x7965, 0x0001, 0x798f, 0x0001,
+    0x9756, 0x0001, 0x7cbe, 0x0001, 0x7fbd, 0x0001, 0x8612, 0x0001,
+    0x8af8, 0x0001, 0x9038, 0x0001, 0x90fd, 0x0001, 0x98ef, 0x0001,
+    0x98fc, 0x0001, 0x9928, 0x0001, 0x9db4, 0x0001, 0x90de, 0x0001,
+    0x96b7, 0x0001, 0x4fae, 0x0001, 0x50e7, 0x0001, 0x514d, 0x0001,
+    0x52c9, 0x0001, 0x52e4, 0x0001, 0x5351, 0x0001, 0x559d, 0x0001,
+    0x5606, 0x0001, 0x5668, 0x0001, 0x5840, 0x0001, 0x58a8, 0x0001,
+    0x5c64, 0x0001, 0x5c6e, 0x0001, 0x6094, 0x0001, 0x6168, 0x0001,
+    0x618e, 0x0001, 0x61f2, 0x0001, 0x654f, 0x0001, 0x65e2, 0x0001,
+    0x6691, 0x0001, 0x6885, 0x0001, 0x6d77, 0x0001, 0x6e1a, 0x0001,
+    0x6f22, 0x0001, 0x716e, 0x0001, 0x722b, 0x0001, 0x7422, 0x0001,
+    0x7891, 0x0001, 0x793e, 0x0001, 0x7949, 0x0001, 0x7948, 0x0001,
+    0x7950, 0x0001, 0x7956, 0x0001, 0x795d, 0x0001, 0x798d, 0x0001,
+    0x798e, 0x0001, 0x7a40, 0x0001, 0x7a81, 0x0001, 0x7bc0, 0x0001,
+    0x7df4, 0x0001, 0x7e09, 0x0001, 0x7e41, 0x0001, 0x7f72, 0x0001,
+    0x8005, 0x0001, 0x81ed, 0x0001, 0x8279, 0x0001, 0x8279, 0x0001,
+    0x8457, 0x0001, 0x8910, 0x0001, 0x8996, 0x0001, 0x8b01, 0x0001,
+    0x8b39, 0x0001, 0x8cd3, 0x0001, 0x8d08, 0x0001, 0x8fb6, 0x0001,
+    0x9038, 0x0001, 0x96e3, 0x0001, 0x97ff, 0x0001, 0x983b, 0x0001,
+    0x6075, 0x0001, 0x242ee, 0x0001, 0x8218, 0x0001, 0x4e26, 0x0001,
+    0x51b5, 0x0001, 0x5168, 0x0001, 0x4f80, 0x0001, 0x5145, 0x0001,
+    0x5180, 0x0001, 0x52c7, 0x0001, 0x52fa, 0x0001, 0x559d, 0x0001,
+    0x5555, 0x0001, 0x5599, 0x0001, 0x55e2, 0x0001, 0x585a, 0x0001,
+    0x58b3, 0x0001, 0x5944, 0x0001, 0x5954, 0x0001, 0x5a62, 0x0001,
+    0x5b28, 0x0001, 0x5ed2, 0x0001, 0x5ed9, 0x0001, 0x5f69, 0x0001,
+    0x5fad, 0x0001, 0x60d8, 0x0001, 0x614e, 0x0001, 0x6108, 0x0001,
+    0x618e, 0x0001, 0x6160, 0x0001, 0x61f2, 0x0001, 0x6234, 0x0001,
+    0x63c4, 0x0001, 0x641c, 0x0001, 0x6452, 0x0001, 0x6556, 0x0001,
+    0x6674, 0x0001, 0x6717, 0x0001, 0x671b, 0x0001, 0x6756, 0x0001,
+    0x6b79, 0x0001, 0x6bba, 0x0001, 0x6d41, 0x0001, 0x6edb, 0x0001,
+    0x6ecb, 0x0001, 0x6f22, 0x0001, 0x701e, 0x0001, 0x716e, 0x0001,
+    0x77a7, 0x0001, 0x7235, 0x0001, 0x72af, 0x0001, 0x732a, 0x0001,
+    0x7471, 0x0001, 0x7506, 0x0001, 0x753b, 0x0001, 0x761d, 0x0001,
+    0x761f, 0x0001, 0x76ca, 0x0001, 0x76db, 0x0001, 0x76f4, 0x0001,
+    0x774a, 0x0001, 0x7740, 0x0001, 0x78cc, 0x0001, 0x7ab1, 0x0001,
+    0x7bc0, 0x0001, 0x7c7b, 0x0001, 0x7d5b, 0x0001, 0x7df4, 0x0001,
+    0x7f3e, 0x0001, 0x8005, 0x0001, 0x8352, 0x0001, 0x83ef, 0x0001,
+    0x8779, 0x0001, 0x8941, 0x0001, 0x8986, 0x0001, 0x8996, 0x0001,
+    0x8abf, 0x0001, 0x8af8, 0x0001, 0x8acb, 0x0001, 0x8b01, 0x0001,
+    0x8afe, 0x0001, 0x8aed, 0x0001, 0x8b39, 0x0001, 0x8b8a, 0x0001,
+    0x8d08, 0x0001, 0x8f38, 0x0001, 0x9072, 0x0001, 0x9199, 0x0001,
+    0x9276, 0x0001, 0x967c, 0x0001, 0x96e3, 0x0001, 0x9756, 0x0001,
+    0x97db, 0x0001, 0x97ff, 0x0001, 0x980b, 0x0001, 0x983b, 0x0001,
+    0x9b12, 0x0001, 0x9f9c, 0x0001, 0x2284a, 0x0001, 0x22844, 0x0001,
+    0x233d5, 0x0001, 0x3b9d, 0x0001, 0x4018, 0x0001, 0x4039, 0x0001,
+    0x25249, 0x0001, 0x25cd0, 0x0001, 0x27ed3, 0x0001, 0x9f43, 0x0001,
+    0x9f8e, 0x0002, 0x05d9, 0x05b4, 0x0002, 0x05f2, 0x05b7, 0x0002,
+    0x05e9, 0x05c1, 0x0002, 0x05e9, 0x05c2, 0x0003, 0x05e9, 0x05bc,
+    0x05c1, 0x0003, 0x05e9, 0x05bc, 0x05c2, 0x0002, 0x05d0, 0x05b7,
+    0x0002, 0x05d0, 0x05b8, 0x0002, 0x05d0, 0x05bc, 0x0002, 0x05d1,
+    0x05bc, 0x0002, 0x05d2, 0x05bc, 0x0002, 0x05d3, 0x05bc, 0x0002,
+    0x05d4, 0x05bc, 0x0002, 0x05d5, 0x05bc, 0x0002, 0x05d6, 0x05bc,
+    0x0002, 0x05d8, 0x05bc, 0x0002, 0x05d9, 0x05bc, 0x0002, 0x05da,
+    0x05bc, 0x0002, 0x05db, 0x05bc, 0x0002, 0x05dc, 0x05bc, 0x0002,
+    0x05de, 0x05bc, 0x0002, 0x05e0, 0x05bc, 0x0002, 0x05e1, 0x05bc,
+    0x0002, 0x05e3, 0x05bc, 0x0002, 0x05e4, 0x05bc, 0x0002, 0x05e6,
+    0x05bc, 0x0002, 0x05e7, 0x05bc, 0x0002, 0x05e8, 0x05bc, 0x0002,
+    0x05e9, 0x05bc, 0x0002, 0x05ea, 0x05bc, 0x0002, 0x05d5, 0x05b9,
+    0x0002, 0x05d1, 0x05bf, 0x0002, 0x05db, 0x05bf, 0x0002, 0x05e4,
+    0x05bf, 0x0002, 0x11099, 0x110ba, 0x0002, 0x1109b, 0x110ba, 0x0002,
+    0x110a5, 0x110ba, 0x0002, 0x11131, 0x11127, 0x0002, 0x11132, 0x11127,
+    0x0002, 0x11347, 0x1133e, 0x0002, 0x11347, 0x11357, 0x0002, 0x114b9,
+    0x114ba, 0x0002, 0x114b9, 0x114b0, 0x0002, 0x114b9, 0x114bd, 0x0002,
+    0x115b8, 0x115af, 0x0002, 0x115b9, 0x115af, 0x0002, 0x11935, 0x11930,
+    0x0002, 0x1d157, 0x1d165, 0x0002, 0x1d158, 0x1d165, 0x0003, 0x1d158,
+    0x1d165, 0x1d16e, 0x0003, 0x1d158, 0x1d165, 0x1d16f, 0x0003, 0x1d158,
+    0x1d165, 0x1d170, 0x0003, 0x1d158, 0x1d165, 0x1d171, 0x0003, 0x1d158,
+    0x1d165, 0x1d172, 0x0002, 0x1d1b9, 0x1d165, 0x0002, 0x1d1ba, 0x1d165,
+    0x0003, 0x1d1b9, 0x1d165, 0x1d16e, 0x0003, 0x1d1ba, 0x1d165, 0x1d16e,
+    0x0003, 0x1d1b9, 0x1d165, 0x1d16f, 0x0003, 0x1d1ba, 0x1d165, 0x1d16f,
+    0x0001, 0x4e3d, 0x0001, 0x4e38, 0x0001, 0x4e41, 0x0001, 0x20122,
+    0x0001, 0x4f60, 0x0001, 0x4fae, 0x0001, 0x4fbb, 0x0001, 0x5002,
+    0x0001, 0x507a, 0x0001, 0x5099, 0x0001, 0x50e7, 0x0001, 0x50cf,
+    0x0001, 0x349e, 0x0001, 0x2063a, 0x0001, 0x514d, 0x0001, 0x5154,
+    0x0001, 0x5164, 0x0001, 0x5177, 0x0001, 0x2051c, 0x0001, 0x34b9,
+    0x0001, 0x5167, 0x0001, 0x518d, 0x0001, 0x2054b, 0x0001, 0x5197,
+    0x0001, 0x51a4, 0x0001, 0x4ecc, 0x0001, 0x51ac, 0x0001, 0x51b5,
+    0x0001, 0x291df, 0x0001, 0x51f5, 0x0001, 0x5203, 0x0001, 0x34df,
+    0x0001, 0x523b, 0x0001, 0x5246, 0x0001, 0x5272, 0x0001, 0x5277,
+    0x0001, 0x3515, 0x0001, 0x52c7, 0x0001, 0x52c9, 0x0001, 0x52e4,
+    0x0001, 0x52fa, 0x0001, 0x5305, 0x0001, 0x5306, 0x0001, 0x5317,
+    0x0001, 0x5349, 0x0001, 0x5351, 0x0001, 0x535a, 0x0001, 0x5373,
+    0x0001, 0x537d, 0x0001, 0x537f, 0x0001, 0x537f, 0x0001, 0x537f,
+    0x0001, 0x20a2c, 0x0001, 0x7070, 0x0001, 0x53ca, 0x0001, 0x53df,
+    0x0001, 0x20b63, 0x0001, 0x53eb, 0x0001, 0x53f1, 0x0001, 0x5406,
+    0x0001, 0x549e, 0x0001, 0x5438, 0x0001, 0x5448, 0x0001, 0x5468,
+    0x0001, 0x54a2, 0x0001, 0x54f6, 0x0001, 0x5510, 0x0001, 0x5553,
+    0x0001, 0x5563, 0x0001, 0x5584, 0x0001, 0x5584, 0x0001, 0x5599,
+    0x0001, 0x55ab, 0x0001, 0x55b3, 0x0001, 0x55c2, 0x0001, 0x5716,
+    0x0001, 0x5606, 0x0001, 0x5717, 0x0001, 0x5651, 0x0001, 0x5674,
+    0x0001, 0x5207, 0x0001, 0x58ee, 0x0001, 0x57ce, 0x0001, 0x57f4,
+    0x0001, 0x580d, 0x0001, 0x578b, 0x0001, 0x5832, 0x0001, 0x5831,
+    0x0001, 0x58ac, 0x0001, 0x214e4, 0x0001, 0x58f2, 0x0001, 0x58f7,
+    0x0001, 0x5906, 0x0001, 0x591a, 0x0001, 0x5922, 0x0001, 0x5962,
+    0x0001, 0x216a8, 0x0001, 0x216ea, 0x0001, 0x59ec, 0x0001, 0x5a1b,
+    0x0001, 0x5a27, 0x0001, 0x59d8, 0x0001, 0x5a66, 0x0001, 0x36ee,
+    0x0001, 0x36fc, 0x0001, 0x5b08, 0x0001, 0x5b3e, 0x0001, 0x5b3e,
+    0x0001, 0x219c8, 0x0001, 0x5bc3, 0x0001, 0x5bd8, 0x0001, 0x5be7,
+    0x0001, 0x5bf3, 0x0001, 0x21b18, 0x0001, 0x5bff, 0x0001, 0x5c06,
+    0x0001, 0x5f53, 0x0001, 0x5c22, 0x0001, 0x3781, 0x0001, 0x5c60,
+    0x0001, 0x5c6e, 0x0001, 0x5cc0, 0x0001, 0x5c8d, 0x0001, 0x21de4,
+    0x0001, 0x5d43, 0x0001, 0x21de6, 0x0001, 0x5d6e, 0x0001, 0x5d6b,
+    0x0001, 0x5d7c, 0x0001, 0x5de1, 0x0001, 0x5de2, 0x0001, 0x382f,
+    0x0001, 0x5dfd, 0x0001, 0x5e28, 0x0001, 0x5e3d, 0x0001, 0x5e69,
+    0x0001, 0x3862, 0x0001, 0x22183, 0x0001, 0x387c, 0x0001, 0x5eb0,
+    0x0001, 0x5eb3, 0x0001, 0x5eb6, 0x0001, 0x5eca, 0x0001, 0x2a392,
+    0x0001, 0x5efe, 0x0001, 0x22331, 0x0001, 0x22331, 0x0001, 0x8201,
+    0x0001, 0x5f22, 0x0001, 0x5f22, 0x0001, 0x38c7, 0x0001, 0x232b8,
+    0x0001, 0x261da, 0x0001, 0x5f62, 0x0001, 0x5f6b, 0x0001, 0x38e3,
+    0x0001, 0x5f9a, 0x0001, 0x5fcd, 0x0001, 0x5fd7, 0x0001, 0x5ff9,
+    0x0001, 0x6081, 0x0001, 0x393a, 0x0001, 0x391c, 0x0001, 0x6094,
+    0x0001, 0x226d4, 0x0001, 0x60c7, 0x0001, 0x6148, 0x0001, 0x614c,
+    0x0001, 0x614e, 0x0001, 0x614c, 0x0001, 0x617a, 0x0001, 0x618e,
+    0x0001, 0x61b2, 0x0001, 0x61a4, 0x0001, 0x61af, 0x0001, 0x61de,
+    0x0001, 0x61f2, 0x0001, 0x61f6, 0x0001, 0x6210, 0x0001, 0x621b,
+    0x0001, 0x625d, 0x0001, 0x62b1, 0x0001, 0x62d4, 0x0001, 0x6350,
+    0x0001, 0x22b0c, 0x0001, 0x633d, 0x0001, 0x62fc, 0x0001, 0x6368,
+    0x0001, 0x6383, 0x0001, 0x63e4, 0x0001, 0x22bf1, 0x0001, 0x6422,
+    0x0001, 0x63c5, 0x0001, 0x63a9, 0x0001, 0x3a2e, 0x0001, 0x6469,
+    0x0001, 0x647e, 0x0001, 0x649d, 0x0001, 0x6477, 0x0001, 0x3a6c,
+    0x0001, 0x654f, 0x0001, 0x656c, 0x0001, 0x2300a, 0x0001, 0x65e3,
+    0x0001, 0x66f8, 0x0001, 0x6649, 0x0001, 0x3b19, 0x0001, 0x6691,
+    0x0001, 0x3b08, 0x0001, 0x3ae4, 0x0001, 0x5192, 0x0001, 0x5195,
+    0x0001, 0x6700, 0x0001, 0x669c, 0x0001, 0x80ad, 0x0001, 0x43d9,
+    0x0001, 0x6717, 0x0001, 0x671b, 0x0001, 0x6721, 0x0001, 0x675e,
+    0x0001, 0x6753, 0x0001, 0x233c3, 0x0001, 0x3b49, 0x0001, 0x67fa,
+    0x0001, 0x6785, 0x0001, 0x6852, 0x0001, 0x6885, 0x0001, 0x2346d,
+    0x0001, 0x688e, 0x0001, 0x681f, 0x0001, 0x6914, 0x0001, 0x3b9d,
+    0x0001, 0x6942, 0x0001, 0x69a3, 0x0001, 0x69ea, 0x0001, 0x6aa8,
+    0x0001, 0x236a3, 0x0001, 0x6adb, 0x0001, 0x3c18, 0x0001, 0x6b21,
+    0x0001, 0x238a7, 0x0001, 0x6b54, 0x0001, 0x3c4e, 0x0001, 0x6b72,
+    0x0001, 0x6b9f, 0x0001, 0x6bba, 0x0001, 0x6bbb, 0x0001, 0x23a8d,
+    0x0001, 0x21d0b, 0x0001, 0x23afa, 0x0001, 0x6c4e, 0x0001, 0x23cbc,
+    0x0001, 0x6cbf, 0x0001, 0x6ccd, 0x0001, 0x6c67, 0x0001, 0x6d16,
+    0x0001, 0x6d3e, 0x0001, 0x6d77, 0x0001, 0x6d41, 0x0001, 0x6d69,
+    0x0001, 0x6d78, 0x0001, 0x6d85, 0x0001, 0x23d1e, 0x0001, 0x6d34,
+    0x0001, 0x6e2f, 0x0001, 0x6e6e, 0x0001, 0x3d33, 0x0001, 0x6ecb,
+    0x0001, 0x6ec7, 0x0001, 0x23ed1, 0x0001, 0x6df9, 0x0001, 0x6f6e,
+    0x0001, 0x23f5e, 0x0001, 0x23f8e, 0x0001, 0x6fc6, 0x0001, 0x7039,
+    0x0001, 0x701e, 0x0001, 0x701b, 0x0001, 0x3d96, 0x0001, 0x704a,
+    0x0001, 0x707d, 0x0001, 0x7077, 0x0001, 0x70ad, 0x0001, 0x20525,
+    0x0001, 0x7145, 0x0001, 0x24263, 0x0001, 0x719c, 0x0001, 0x243ab,
+    0x0001, 0x7228, 0x0001, 0x7235, 0x0001, 0x7250, 0x0001, 0x24608,
+    0x0001, 0x7280, 0x0001, 0x7295, 0x0001, 0x24735, 0x0001, 0x24814,
+    0x0001, 0x737a, 0x0001, 0x738b, 0x0001, 0x3eac, 0x0001, 0x73a5,
+    0x0001, 0x3eb8, 0x0001, 0x3eb8, 0x0001, 0x7447, 0x0001, 0x745c,
+    0x0001, 0x7471, 0x0001, 0x7485, 0x0001, 0x74ca, 0x0001, 0x3f1b,
+    0x0001, 0x7524, 0x0001, 0x24c36, 0x0001, 0x753e, 0x0001, 0x24c92,
+    0x0001, 0x7570, 0x0001, 0x2219f, 0x0001, 0x7610, 0x0001, 0x24fa1,
+    0x0001, 0x24fb8, 0x0001, 0x25044, 0x0001, 0x3ffc, 0x0001, 0x4008,
+    0x0001, 0x76f4, 0x0001, 0x250f3, 0x0001, 0x250f2, 0x0001, 0x25119,
+    0x0001, 0x25133, 0x0001, 0x771e, 0x0001, 0x771f, 0x0001, 0x771f,
+    0x0001, 0x774a, 0x0001, 0x4039, 0x0001, 0x778b, 0x0001, 0x4046,
+    0x0001, 0x4096, 0x0001, 0x2541d, 0x0001, 0x784e, 0x0001, 0x788c,
+    0x0001, 0x78cc, 0x0001, 0x40e3, 0x0001, 0x25626, 0x0001, 0x7956,
+    0x0001, 0x2569a, 0x0001, 0x256c5, 0x0001, 0x798f, 0x0001, 0x79eb,
+    0x0001, 0x412f, 0x0001, 0x7a40, 0x0001, 0x7a4a, 0x0001, 0x7a4f,
+    0x0001, 0x2597c, 0x0001, 0x25aa7, 0x0001, 0x25aa7, 0x0001, 0x7aee,
+    0x0001, 0x4202, 0x0001, 0x25bab, 0x0001, 0x7bc6, 0x0001, 0x7bc9,
+    0x0001, 0x4227, 0x0001, 0x25c80, 0x0001, 0x7cd2, 0x0001, 0x42a0,
+    0x0001, 0x7ce8, 0x0001, 0x7ce3, 0x0001, 0x7d00, 0x0001, 0x25f86,
+    0x0001, 0x7d63, 0x0001, 0x4301, 0x0001, 0x7dc7, 0x0001, 0x7e02,
+    0x0001, 0x7e45, 0x0001, 0x4334, 0x0001, 0x26228, 0x0001, 0x26247,
+    0x0001, 0x4359, 0x0001, 0x262d9, 0x0001, 0x7f7a, 0x0001, 0x2633e,
+    0x0001, 0x7f95, 0x0001, 0x7ffa, 0x0001, 0x8005, 0x0001, 0x264da,
+    0x0001, 0x26523, 0x0001, 0x8060, 0x0001, 0x265a8, 0x0001, 0x8070,
+    0x0001, 0x2335f, 0x0001, 0x43d5, 0x0001, 0x80b2, 0x0001, 0x8103,
+    0x0001, 0x440b, 0x0001, 0x813e, 0x0001, 0x5ab5, 0x0001, 0x267a7,
+    0x0001, 0x267b5, 0x0001, 0x23393, 0x0001, 0x2339c, 0x0001, 0x8201,
+    0x0001, 0x8204, 0x0001, 0x8f9e, 0x0001, 0x446b, 0x0001, 0x8291,
+    0x0001, 0x828b, 0x0001, 0x829d, 0x0001, 0x52b3, 0x0001, 0x82b1,
+    0x0001, 0x82b3, 0x0001, 0x82bd, 0x0001, 0x82e6, 0x0001, 0x26b3c,
+    0x0001, 0x82e5, 0x0001, 0x831d, 0x0001, 0x8363, 0x0001, 0x83ad,
+    0x0001, 0x8323, 0x0001, 0x83bd, 0x0001, 0x83e7, 0x0001, 0x8457,
+    0x0001, 0x8353, 0x0001, 0x83ca, 0x0001, 0x83cc, 0x0001, 0x83dc,
+    0x0001, 0x26c36, 0x0001, 0x26d6b, 0x0001, 0x26cd5, 0x0001, 0x452b,
+    0x0001, 0x84f1, 0x0001, 0x84f3, 0x0001, 0x8516, 0x0001, 0x273ca,
+    0x0001, 0x8564, 0x0001, 0x26f2c, 0x0001, 0x455d, 0x0001, 0x4561,
+    0x0001, 0x26fb1, 0x0001, 0x270d2, 0x0001, 0x456b, 0x0001, 0x8650,
+    0x0001, 0x865c, 0x0001, 0x8667, 0x0001, 0x8669, 0x0001, 0x86a9,
+    0x0001, 0x8688, 0x0001, 0x870e, 0x0001, 0x86e2, 0x0001, 0x8779,
+    0x0001, 0x8728, 0x0001, 0x876b, 0x0001, 0x8786, 0x0001, 0x45d7,
+    0x0001, 0x87e1, 0x0001, 0x8801, 0x0001, 0x45f9, 0x0001, 0x8860,
+    0x0001, 0x8863, 0x0001, 0x27667, 0x0001, 0x88d7, 0x0001, 0x88de,
+    0x0001, 0x4635, 0x0001, 0x88fa, 0x0001, 0x34bb, 0x0001, 0x278ae,
+    0x0001, 0x27966, 0x0001, 0x46be, 0x0001, 0x46c7, 0x0001, 0x8aa0,
+    0x0001, 0x8aed, 0x0001, 0x8b8a, 0x0001, 0x8c55, 0x0001, 0x27ca8,
+    0x0001, 0x8cab, 0x0001, 0x8cc1, 0x0001, 0x8d1b, 0x0001, 0x8d77,
+    0x0001, 0x27f2f, 0x0001, 0x20804, 0x0001, 0x8dcb, 0x0001, 0x8dbc,
+    0x0001, 0x8df0, 0x0001, 0x208de, 0x0001, 0x8ed4, 0x0001, 0x8f38,
+    0x0001, 0x285d2, 0x0001, 0x285ed, 0x0001, 0x9094, 0x0001, 0x90f1,
+    0x0001, 0x9111, 0x0001, 0x2872e, 0x0001, 0x911b, 0x0001, 0x9238,
+    0x0001, 0x92d7, 0x0001, 0x92d8, 0x0001, 0x927c, 0x0001, 0x93f9,
+    0x0001, 0x9415, 0x0001, 0x28bfa, 0x0001, 0x958b, 0x0001, 0x4995,
+    0x0001, 0x95b7, 0x0001, 0x28d77, 0x0001, 0x49e6, 0x0001, 0x96c3,
+    0x0001, 0x5db2, 0x0001, 0x9723, 0x0001, 0x29145, 0x0001, 0x2921a,
+    0x0001, 0x4a6e, 0x0001, 0x4a76, 0x0001, 0x97e0, 0x0001, 0x2940a,
+    0x0001, 0x4ab2, 0x0001, 0x29496, 0x0001, 0x980b, 0x0001, 0x980b,
+    0x0001, 0x9829, 0x0001, 0x295b6, 0x0001, 0x98e2, 0x0001, 0x4b33,
+    0x0001, 0x9929, 0x0001, 0x99a7, 0x0001, 0x99c2, 0x0001, 0x99fe,
+    0x0001, 0x4bce, 0x0001, 0x29b30, 0x0001, 0x9b12, 0x0001, 0x9c40,
+    0x0001, 0x9cfd, 0x0001, 0x4cce, 0x0001, 0x4ced, 0x0001, 0x9d67,
+    0x0001, 0x2a0ce, 0x0001, 0x4cf8, 0x0001, 0x2a105, 0x0001, 0x2a20e,
+    0x0001, 0x2a291, 0x0001, 0x9ebb, 0x0001, 0x4d56, 0x0001, 0x9ef9,
+    0x0001, 0x9efe, 0x0001, 0x9f05, 0x0001, 0x9f0f, 0x0001, 0x9f16,
+    0x0001, 0x9f3b, 0x0001, 0x2a600,
+};
+
+const Parrot_unicode_composition_t Parrot_unicode_compositions[941] = {
+    { 0x003c, 0x0338, 0x226e },
+    { 0x003d, 0x0338, 0x2260 },
+    { 0x003e, 0x0338, 0x226f },
+    { 0x0041, 0x0300, 0x00c0 },
+    { 0x0041, 0x0301, 0x00c1 },
+    { 0x0041, 0x0302, 0x00c2 },
+    { 0x0041, 0x0303, 0x00c3 },
+    { 0x0041, 0x0304, 0x0100 },
+    { 0x0041, 0x0306, 0x0102 },
+    { 0x0041, 0x0307, 0x0226 },
+    { 0x0041, 0x0308, 0x00c4 },
+    { 0x0041, 0x0309, 0x1ea2 },
+    { 0x0041, 0x030a, 0x00c5 },
+    { 0x0041, 0x030c, 0x01cd },
+    { 0x0041, 0x030f, 0x0200 },
+    { 0x0041, 0x0311, 0x0202 },
+    { 0x0041, 0x0323, 0x1ea0 },
+    { 0x0041, 0x0325, 0x1e00 },
+    { 0x0041, 0x0328, 0x0104 },
+    { 0x0042, 0x0307, 0x1e02 },
+    { 0x0042, 0x0323, 0x1e04 },
+    { 0x0042, 0x0331, 0x1e06 },
+    { 0x0043, 0x0301, 0x0106 },
+    { 0x0043, 0x0302, 0x0108 },
+    { 0x0043, 0x0307, 0x010a },
+    { 0x0043, 0x030c, 0x010c },
+    { 0x0043, 0x0327, 0x00c7 },
+    { 0x0044, 0x0307, 0x1e0a },
+    { 0x0044, 0x030c, 0x010e },
+    { 0x0044, 0x0323, 0x1e0c },
+    { 0x0044, 0x0327, 0x1e10 },
+    { 0x0044, 0x032d, 0x1e12 },
+    { 0x0044, 0x0331, 0x1e0e },
+    { 0x0045, 0x0300, 0x00c8 },
+    { 0x0045, 0x0301, 0x00c9 },
+    { 0x0045, 0x0302, 0x00ca },
+    { 0x0045, 0x0303, 0x1ebc },
+    { 0x0045, 0x0304, 0x0112 },
+    { 0x0045, 0x0306, 0x0114 },
+    { 0x0045, 0x0307, 0x0116 },
+    { 0x0045, 0x0308, 0x00cb },
+    { 0x0045, 0x0309, 0x1eba },
+    { 0x0045, 0x030c, 0x011a },
+    { 0x0045, 0x030f, 0x0204 },
+    { 0x0045, 0x0311, 0x0206 },
+    { 0x0045, 0x0323, 0x1eb8 },
+    { 0x0045, 0x0327, 0x0228 },
+    { 0x0045, 0x0328, 0x0118 },
+    { 0x0045, 0x032d, 0x1e18 },
+    { 0x0045, 0x0330, 0x1e1a },
+    { 0x0046, 0x0307, 0x1e1e },
+    { 0x0047, 0x0301, 0x01f4 },
+    { 0x0047, 0x0302, 0x011c },
+    { 0x0047, 0x0304, 0x1e20 },
+    { 0x0047, 0x0306, 0x011e },
+    { 0x0047, 0x0307, 0x0120 },
+    { 0x0047, 0x030c, 0x01e6 },
+    { 0x0047, 0x0327, 0x0122 },
+    { 0x0048, 0x0302, 0x0124 },
+    { 0x0048, 0x0307, 0x1e22 },
+    { 0x0048, 0x0308, 0x1e26 },
+    { 0x0048, 0x030c, 0x021e },
+    { 0x0048, 0x0323, 0x1e24 },
+    { 0x0048, 0x0327, 0x1e28 },
+    { 0x0048, 0x032e, 0x1e2a },
+    { 0x0049, 0x0300, 0x00cc },
+    { 0x0049, 0x0301, 0x00cd },
+    { 0x0049, 0x0302, 0x00ce },
+    { 0x0049, 0x0303, 0x0128 },
+    { 0x0049, 0x0304, 0x012a },
+    { 0x0049, 0x0306, 0x012c },
+    { 0x0049, 0x0307, 0x0130 },
+    { 0x0049, 0x0308, 0x00cf },
+    { 0x0049, 0x0309, 0x1ec8 },
+    { 0x0049, 0x030c, 0x01cf },
+    { 0x0049, 0x030f, 0x0208 },
+    { 0x0049, 0x0311, 0x020a },
+    { 0x0049, 0x0323, 0x1eca },
+    { 0x0049, 0x0328, 0x012e },
+    { 0x0049, 0x0330, 0x1e2c },
+    { 0x004a, 0x0302, 0x0134 },
+    { 0x004b, 0x0301, 0x1e30 },
+    { 0x004b, 0x030c, 0x01e8 },
+    { 0x004b, 0x0323, 0x1e32 },
+    { 0x004b, 0x0327, 0x0136 },
+    { 0x004b, 0x0331, 0x1e34 },
+    { 0x004c, 0x0301, 0x0139 },
+    { 0x004c, 0x030c, 0x013d },
+    { 0x004c, 0x0323, 0x1e36 },
+    { 0x004c, 0x0327, 0x013b },
+    { 0x004c, 0x032d, 0x1e3c },
+    { 0x004c, 0x0331, 0x1e3a },
+    { 0x004d, 0x0301, 0x1e3e },
+    { 0x004d, 0x0307, 0x1e40 },
+    { 0x004d, 0x0323, 0x1e42 },
+    { 0x004e, 0x0300, 0x01f8 },
+    { 0x004e, 0x0301, 0x0143 },
+    { 0x004e, 0x0303, 0x00d1 },
+    { 0x004e, 0x0307, 0x1e44 },
+    { 0x004e, 0x030c, 0x0147 },
+    { 0x004e, 0x0323, 0x1e46 },
+    { 0x004e, 0x0327, 0x0145 },
+    { 0x004e, 0x032d, 0x1e4a },
+    { 0x004e, 0x0331, 0x1e48 },
+    { 0x004f, 0x0300, 0x00d2 },
+    { 0x004f, 0x0301, 0x00d3 },
+    { 0x004f, 0x0302, 0x00d4 },
+    { 0x004f, 0x0303, 0x00d5 },
+    { 0x004f, 0x0304, 0x014c },
+    { 0x004f, 0x0306, 0x014e },
+    { 0x004f, 0x0307, 0x022e },
+    { 0x004f, 0x0308, 0x00d6 },
+    { 0x004f, 0x0309, 0x1ece },
+    { 0x004f, 0x030b, 0x0150 },
+    { 0x004f, 0x030c, 0x01d1 },
+    { 0x004f, 0x030f, 0x020c },
+    { 0x004f, 0x0311, 0x020e },
+    { 0x004f, 0x031b, 0x01a0 },
+    { 0x004f, 0x0323, 0x1ecc },
+    { 0x004f, 0x0328, 0x01ea },
+    { 0x0050, 0x0301, 0x1e54 },
+    { 0x0050, 0x0307, 0x1e56 },
+    { 0x0052, 0x0301, 0x0154 },
+    { 0x0052, 0x0307, 0x1e58 },
+    { 0x0052, 0x030c, 0x0158 },
+    { 0x0052, 0x030f, 0x0210 },
+    { 0x0052, 0x0311, 0x0212 },
+    { 0x0052, 0x0323, 0x1e5a },
+    { 0x0052, 0x0327, 0x0156 },
+    { 0x0052, 0x0331, 0x1e5e },
+    { 0x0053, 0x0301, 0x015a },
+    { 0x0053, 0x0302, 0x015c },
+    { 0x0053, 0x0307, 0x1e60 },
+    { 0x0053, 0x030c, 0x0160 },
+    { 0x0053, 0x0323, 0x1e62 },
+    { 0x0053, 0x0326, 0x0218 },
+    { 0x0053, 0x0327, 0x015e },
+    { 0x0054, 0x0307, 0x1e6a },
+    { 0x0054, 0x030c, 0x0164 },
+    { 0x0054, 0x0323, 0x1e6c },
+    { 0x0054, 0x0326, 0x021a },
+    { 0x0054, 0x0327, 0x0162 },
+    { 0x0054, 0x032d, 0x1e70 },
+    { 0x0054, 0x0331, 0x1e6e },
+    { 0x0055, 0x0300, 0x00d9 },
+    { 0x0055, 0x0301, 0x00da },
+    { 0x0055, 0x0302, 0x00db },
+    { 0x0055, 0x0303, 0x0168 },
+    { 0x0055, 0x0304, 0x016a },
+    { 0x0055, 0x0306, 0x016c },
+    { 0x0055, 0x0308, 0x00dc },
+    { 0x0055, 0x0309, 0x1ee6 },
+    { 0x0055, 0x030a, 0x016e },
+    { 0x0055, 0x030b, 0x0170 },
+    { 0x0055, 0x030c, 0x01d3 },
+    { 0x0055, 0x030f, 0x0214 },
+    { 0x0055, 0x0311, 0x0216 },
+    { 0x0055, 0x031b, 0x01af },
+    { 0x0055, 0x0323, 0x1ee4 },
+    { 0x0055, 0x0324, 0x1e72 },
+    { 0x0055, 0x0328, 0x0172 },
+    { 0x0055, 0x032d, 0x1e76 },
+    { 0x0055, 0x0330, 0x1e74 },
+    { 0x0056, 0x0303, 0x1e7c },
+    { 0x0056, 0x0323, 0x1e7e },
+    { 0x0057, 0x0300, 0x1e80 },
+    { 0x0057, 0x0301, 0x1e82 },
+    { 0x0057, 0x0302, 0x0174 },
+    { 0x0057, 0x0307, 0x1e86 },
+    { 0x0057, 0x0308, 0x1e84 },
+    { 0x0057, 0x0323, 0x1e88 },
+    { 0x0058, 0x0307, 0x1e8a },
+    { 0x0058, 0x0308, 0x1e8c },
+    { 0x0059, 0x0300, 0x1ef2 },
+    { 0x0059, 0x0301, 0x00dd },
+    { 0x0059, 0x0302, 0x0176 },
+    { 0x0059, 0x0303, 0x1ef8 },
+    { 0x0059, 0x0304, 0x0232 },
+    { 0x0059, 0x0307, 0x1e8e },
+    { 0x0059, 0x0308, 0x0178 },
+    { 0x0059, 0x0309, 0x1ef6 },
+    { 0x0059, 0x0323, 0x1ef4 },
+    { 0x005a, 0x0301, 0x0179 },
+    { 0x005a, 0x0302, 0x1e90 },
+    { 0x005a, 0x0307, 0x017b },
+    { 0x005a, 0x030c, 0x017d },
+    { 0x005a, 0x0323, 0x1e92 },
+    { 0x005a, 0x0331, 0x1e94 },
+    { 0x0061, 0x0300, 0x00e0 },
+    { 0x0061, 0x0301, 0x00e1 },
+    { 0x0061, 0x0302, 0x00e2 },
+    { 0x0061, 0x0303, 0x00e3 },
+    { 0x0061, 0x0304, 0x0101 },
+    { 0x0061, 0x0306, 0x0103 },
+    { 0x0061, 0x0307, 0x0227 },
+    { 0x0061, 0x0308, 0x00e4 },
+    { 0x0061, 0x0309, 0x1ea3 },
+    { 0x0061, 0x030a, 0x00e5 },
+    { 0x0061, 0x030c, 0x01ce },
+    { 0x0061, 0x030f, 0x0201 },
+    { 0x0061, 0x0311, 0x0203 },
+    { 0x0061, 0x0323, 0x1ea1 },
+    { 0x0061, 0x0325, 0x1e01 },
+    { 0x0061, 0x0328, 0x0105 },
+    { 0x0062, 0x0307, 0x1e03 },
+    { 0x0062, 0x0323, 0x1e05 },
+    { 0x0062, 0x0331, 0x1e07 },
+    { 0x0063, 0x0301, 0x0107 },
+    { 0x0063, 0x0302, 0x0109 },
+    { 0x0063, 0x0307, 0x010b },
+    { 0x0063, 0x030c, 0x010d },
+    { 0x0063, 0x0327, 0x00e7 },
+    { 0x0064, 0x0307, 0x1e0b },
+    { 0x0064, 0x030c, 0x010f },
+    { 0x0064, 0x0323, 0x1e0d },
+    { 0x0064, 0x0327, 0x1e11 },
+    { 0x0064, 0x032d, 0x1e13 },
+    { 0x0064, 0x0331, 0x1e0f },
+    { 0x0065, 0x0300, 0x00e8 },
+    { 0x0065, 0x0301, 0x00e9 },
+    { 0x0065, 0x0302, 0x00ea },
+    { 0x0065, 0x0303, 0x1ebd },
+    { 0x0065, 0x0304, 0x0113 },
+    { 0x0065, 0x0306, 0x0115 },
+    { 0x0065, 0x0307, 0x0117 },
+    { 0x0065, 0x0308, 0x00eb },
+    { 0x0065, 0x0309, 0x1ebb },
+    { 0x0065, 0x030c, 0x011b },
+    { 0x0065, 0x030f, 0x0205 },
+    { 0x0065, 0x0311, 0x0207 },
+    { 0x0065, 0x0323, 0x1eb9 },
+    { 0x0065, 0x0327, 0x0229 },
+    { 0x0065, 0x0328, 0x0119 },
+    { 0x0065, 0x032d, 0x1e19 },
+    { 0x0065, 0x0330, 0x1e1b },
+    { 0x0066, 0x0307, 0x1e1f },
+    { 0x0067, 0x0301, 0x01f5 },
+    { 0x0067, 0x0302, 0x011d },
+    { 0x0067, 0x0304, 0x1e21 },
+    { 0x0067, 0x0306, 0x011f },
+    { 0x0067, 0x0307, 0x0121 },
+    { 0x0067, 0x030c, 0x01e7 },
+    { 0x0067, 0x0327, 0x0123 },
+    { 0x0068, 0x0302, 0x0125 },
+    { 0x0068, 0x0307, 0x1e23 },
+    { 0x0068, 0x0308, 0x1e27 },
+    { 0x0068, 0x030c, 0x021f },
+    { 0x0068, 0x0323, 0x1e25 },
+    { 0x0068, 0x0327, 0x1e29 },
+    { 0x0068, 0x032e, 0x1e2b },
+    { 0x0068, 0x0331, 0x1e96 },
+    { 0x0069, 0x0300, 0x00ec },
+    { 0x0069, 0x0301, 0x00ed },
+    { 0x0069, 0x0302, 0x00ee },
+    { 0x0069, 0x0303, 0x0129 },
+    { 0x0069, 0x0304, 0x012b },
+    { 0x0069, 0x0306, 0x012d },
+    { 0x0069, 0x0308, 0x00ef },
+    { 0x0069, 0x0309, 0x1ec9 },
+    { 0x0069, 0x030c, 0x01d0 },
+    { 0x0069, 0x030f, 0x0209 },
+    { 0x0069, 0x0311, 0x020b },
+    { 0x0069, 0x0323, 0x1ecb },
+    { 0x0069, 0x0328, 0x012f },
+    { 0x0069, 0x0330, 0x1e2d },
+    { 0x006a, 0x0302, 0x0135 },
+    { 0x006a, 0x030c, 0x01f0 },
+    { 0x006b, 0x0301, 0x1e31 },
+    { 0x006b, 0x030c, 0x01e9 },
+    { 0x006b, 0x0323, 0x1e33 },
+    { 0x006b, 0x0327, 0x0137 },
+    { 0x006b, 0x0331, 0x1e35 },
+    { 0x006c, 0x0301, 0x013a },
+    { 0x006c, 0x030c, 0x013e },
+    { 0x006c, 0x0323, 0x1e37 },
+    { 0x006c, 0x0327, 0x013c },
+    { 0x006c, 0x032d, 0x1e3d },
+    { 0x006c, 0x0331, 0x1e3b },
+    { 0x006d, 0x0301, 0x1e3f },
+    { 0x006d, 0x0307, 0x1e41 },
+    { 0x006d, 0x0323, 0x1e43 },
+    { 0x006e, 0x0300, 0x01f9 },
+    { 0x006e, 0x0301, 0x0144 },
+    { 0x006e, 0x0303, 0x00f1 },
+    { 0x006e, 0x0307, 0x1e45 },
+    { 0x006e, 0x030c, 0x0148 },
+    { 0x006e, 0x0323, 0x1e47 },
+    { 0x006e, 0x0327, 0x0146 },
+    { 0x006e, 0x032d, 0x1e4b },
+    { 0x006e, 0x0331, 0x1e49 },
+    { 0x006f, 0x0300, 0x00f2 },
+    { 0x006f, 0x0301, 0x00f3 },
+    { 0x006f, 0x0302, 0x00f4 },
+    { 0x006f, 0x0303, 0x00f5 },
+    { 0x006f, 0x0304, 0x014d },
+    { 0x006f, 0x0306, 0x014f },
+    { 0x006f, 0x0307, 0x022f },
+    { 0x006f, 0x0308, 0x00f6 },
+    { 0x006f, 0x0309, 0x1ecf },
+    { 0x006f, 0x030b, 0x0151 },
+    { 0x006f, 0x030c, 0x01d2 },
+    { 0x006f, 0x030f, 0x020d },
+    { 0x006f, 0x0311, 0x020f },
+    { 0x006f, 0x031b, 0x01a1 },
+    { 0x006f, 0x0323, 0x1ecd },
+    { 0x006f, 0x0328, 0x01eb },
+    { 0x0070, 0x0301, 0x1e55 },
+    { 0x0070, 0x0307, 0x1e57 },
+    { 0x0072, 0x0301, 0x0155 },
+    { 0x0072, 0x0307, 0x1e59 },
+    { 0x0072, 0x030c, 0x0159 },
+    { 0x0072, 0x030f, 0x0211 },
+    { 0x0072, 0x0311, 0x0213 },
+    { 0x0072, 0x0323, 0x1e5b },
+    { 0x0072, 0x0327, 0x0157 },
+    { 0x0072, 0x0331, 0x1e5f },
+    { 0x0073, 0x0301, 0x015b },
+    { 0x0073, 0x0302, 0x015d },
+    { 0x0073, 0x0307, 0x1e61 },
+    { 0x0073, 0x030c, 0x0161 },
+    { 0x0073, 0x0323, 0x1e63 },
+    { 0x0073, 0x0326, 0x0219 },
+    { 0x0073, 0x0327, 0x015f },
+    { 0x0074, 0x0307, 0x1e6b },
+    { 0x0074, 0x0308, 0x1e97 },
+    { 0x0074, 0x030c, 0x0165 },
+    { 0x0074, 0x0323, 0x1e6d },
+    { 0x0074, 0x0326, 0x021b },
+    { 0x0074, 0x0327, 0x0163 },
+    { 0x0074, 0x032d, 0x1e71 },
+    { 0x0074, 0x0331, 0x1e6f },
+    { 0x0075, 0x0300, 0x00f9 },
+    { 0x0075, 0x0301, 0x00fa },
+    { 0x0075, 0x0302, 0x00fb },
+    { 0x0075, 0x0303, 0x0169 },
+    { 0x0075, 0x0304, 0x016b },
+    { 0x0075, 0x0306, 0x016d },
+    { 0x0075, 0x0308, 0x00fc },
+    { 0x0075, 0x0309, 0x1ee7 },
+    { 0x0075, 0x030a, 0x016f },
+    { 0x0075, 0x030b, 0x0171 },
+    { 0x0075, 0x030c, 0x01d4 },
+    { 0x0075, 0x030f, 0x0215 },
+    { 0x0075, 0x0311, 0x0217 },
+    { 0x0075, 0x031b, 0x01b0 },
+    { 0x0075, 0x0323, 0x1ee5 },
+    { 0x0075, 0x0324, 0x1e73 },
+    { 0x0075, 0x0328, 0x0173 },
+    { 0x0075, 0x032d, 0x1e77 },
+    { 0x0075, 0x0330, 0x1e75 },
+    { 0x0076, 0x0303, 0x1e7d },
+    { 0x0076, 0x0323, 0x1e7f },
+    { 0x0077, 0x0300, 0x1e81 },
+    { 0x0077, 0x0301, 0x1e83 },
+    { 0x0077, 0x0302, 0x0175 },
+    { 0x0077, 0x0307, 0x1e87 },
+    { 0x0077, 0x0308, 0x1e85 },
+    { 0x0077, 0x030a, 0x1e98 },
+    { 0x0077, 0x0323, 0x1e89 },
+    { 0x0078, 0x0307, 0x1e8b },
+    { 0x0078, 0x0308, 0x1e8d },
+    { 0x0079, 0x0300, 0x1ef3 },
+    { 0x0079, 0x0301, 0x00fd },
+    { 0x0079, 0x0302, 0x0177 },
+    { 0x0079, 0x0303, 0x1ef9 },
+    { 0x0079, 0x0304, 0x0233 },
+    { 0x0079, 0x0307, 0x1e8f },
+    { 0x0079, 0x0308, 0x00ff },
+    { 0x0079, 0x0309, 0x1ef7 },
+    { 0x0079, 0x030a, 0x1e99 },
+    { 0x0079, 0x0323, 0x1ef5 },
+    { 0x007a, 0x0301, 0x017a },
+    { 0x007a, 0x0302, 0x1e91 },
+    { 0x007a, 0x0307, 0x017c },
+    { 0x007a, 0x030c, 0x017e },
+    { 0x007a, 0x0323, 0x1e93 },
+    { 0x007a, 0x0331, 0x1e95 },
+    { 0x00a8, 0x0300, 0x1fed },
+    { 0x00a8, 0x0301, 0x0385 },
+    { 0x00a8, 0x0342, 0x1fc1 },
+    { 0x00c2, 0x0300, 0x1ea6 },
+    { 0x00c2, 0x0301, 0x1ea4 },
+    { 0x00c2, 0x0303, 0x1eaa },
+    { 0x00c2, 0x0309, 0x1ea8 },
+    { 0x00c4, 0x0304, 0x01de },
+    { 0x00c5, 0x0301, 0x01fa },
+    { 0x00c6, 0x0301, 0x01fc },
+    { 0x00c6, 0x0304, 0x01e2 },
+    { 0x00c7, 0x0301, 0x1e08 },
+    { 0x00ca, 0x0300, 0x1ec0 },
+    { 0x00ca, 0x0301, 0x1ebe },
+    { 0x00ca, 0x0303, 0x1ec4 },
+    { 0x00ca, 0x0309, 0x1ec2 },
+    { 0x00cf, 0x0301, 0x1e2e },
+    { 0x00d4, 0x0300, 0x1ed2 },
+    { 0x00d4, 0x0301, 0x1ed0 },
+    { 0x00d4, 0x0303, 0x1ed6 },
+    { 0x00d4, 0x0309, 0x1ed4 },
+    { 0x00d5, 0x0301, 0x1e4c },
+    { 0x00d5, 0x0304, 0x022c },
+    { 0x00d5, 0x0308, 0x1e4e },
+    { 0x00d6, 0x0304, 0x022a },
+    { 0x00d8, 0x0301, 0x01fe },
+    { 0x00dc, 0x0300, 0x01db },
+    { 0x00dc, 0x0301, 0x01d7 },
+    { 0x00dc, 0x0304, 0x01d5 },
+    { 0x00dc, 0x030c, 0x01d9 },
+    { 0x00e2, 0x0300, 0x1ea7 },
+    { 0x00e2, 0x0301, 0x1ea5 },
+    { 0x00e2, 0x0303, 0x1eab },
+    { 0x00e2, 0x0309, 0x1ea9 },
+    { 0x00e4, 0x0304, 0x01df },
+    { 0x00e5, 0x0301, 0x01fb },
+    { 0x00e6, 0x0301, 0x01fd },
+    { 0x00e6, 0x0304, 0x01e3 },
+    { 0x00e7, 0x0301, 0x1e09 },
+    { 0x00ea, 0x0300, 0x1ec1 },
+    { 0x00ea, 0x0301, 0x1ebf },
+    { 0x00ea, 0x0303, 0x1ec5 },
+    { 0x00ea, 0x0309, 0x1ec3 },
+    { 0x00ef, 0x0301, 0x1e2f },
+    { 0x00f4, 0x0300, 0x1ed3 },
+    { 0x00f4, 0x0301, 0x1ed1 },
+    { 0x00f4, 0x0303, 0x1ed7 },
+    { 0x00f4, 0x0309, 0x1ed5 },
+    { 0x00f5, 0x0301, 0x1e4d },
+    { 0x00f5, 0x0304, 0x022d },
+    { 0x00f5, 0x0308, 0x1e4f },
+    { 0x00f6, 0x0304, 0x022b },
+    { 0x00f8, 0x0301, 0x01ff },
+    { 0x00fc, 0x0300, 0x01dc },
+    { 0x00fc, 0x0301, 0x01d8 },
+    { 0x00fc, 0x0304, 0x01d6 },
+    { 0x00fc, 0x030c, 0x01da },
+    { 0x0102, 0x0300, 0x1eb0 },
+    { 0x0102, 0x0301, 0x1eae },
+    { 0x0102, 0x0303, 0x1eb4 },
+    { 0x0102, 0x0309, 0x1eb2 },
+    { 0x0103, 0x0300, 0x1eb1 },
+    { 0x0103, 0x0301, 0x1eaf },
+    { 0x0103, 0x0303, 0x1eb5 },
+    { 0x0103, 0x0309, 0x1eb3 },
+    { 0x0112, 0x0300, 0x1e14 },
+    { 0x0112, 0x0301, 0x1e16 },
+    { 0x0113, 0x0300, 0x1e15 },
+    { 0x0113, 0x0301, 0x1e17 },
+    { 0x014c, 0x0300, 0x1e50 },
+    { 0x014c, 0x0301, 0x1e52 },
+    { 0x014d, 0x0300, 0x1e51 },
+    { 0x014d, 0x0301, 0x1e53 },
+    { 0x015a, 0x0307, 0x1e64 },
+    { 0x015b, 0x0307, 0x1e65 },
+    { 0x0160, 0x0307, 0x1e66 },
+    { 0x0161, 0x0307, 0x1e67 },
+    { 0x0168, 0x0301, 0x1e78 },
+    { 0x0169, 0x0301, 0x1e79 },
+    { 0x016a, 0x0308, 0x1e7a },
+    { 0x016b, 0x0308, 0x1e7b },
+    { 0x017f, 0x0307, 0x1e9b },
+    { 0x01a0, 0x0300, 0x1edc },
+    { 0x01a0, 0x0301, 0x1eda },
+    { 0x01a0, 0x0303, 0x1ee0 },
+    { 0x01a0, 0x0309, 0x1ede },
+    { 0x01a0, 0x0323, 0x1ee2 },
+    { 0x01a1, 0x0300, 0x1edd },
+    { 0x01a1, 0x0301, 0x1edb },
+    { 0x01a1, 0x0303, 0x1ee1 },
+    { 0x01a1, 0x0309, 0x1edf },
+    { 0x01a1, 0x0323, 0x1ee3 },
+    { 0x01af, 0x0300, 0x1eea },
+    { 0x01af, 0x0301, 0x1ee8 },
+    { 0x01af, 0x0303, 0x1eee },
+    { 0x01af, 0x0309, 0x1eec },
+    { 0x01af, 0x0323, 0x1ef0 },
+    { 0x01b0, 0x0300, 0x1eeb },
+    { 0x01b0, 0x0301, 0x1ee9 },
+    { 0x01b0, 0x0303, 0x1eef },
+    { 0x01b0, 0x0309, 0x1eed },
+    { 0x01b0, 0x0323, 0x1ef1 },
+    { 0x01b7, 0x030c, 0x01ee },
+    { 0x01ea, 0x0304, 0x01ec },
+    { 0x01eb, 0x0304, 0x01ed },
+    { 0x0226, 0x0304, 0x01e0 },
+    { 0x0227, 0x0304, 0x01e1 },
+    { 0x0228, 0x0306, 0x1e1c },
+    { 0x0229, 0x0306, 0x1e1d },
+    { 0x022e, 0x0304, 0x0230 },
+    { 0x022f, 0x0304, 0x0231 },
+    { 0x0292, 0x030c, 0x01ef },
+    { 0x0391, 0x0300, 0x1fba },
+    { 0x0391, 0x0301, 0x0386 },
+    { 0x0391, 0x0304, 0x1fb9 },
+    { 0x0391, 0x0306, 0x1fb8 },
+    { 0x0391, 0x0313, 0x1f08 },
+    { 0x0391, 0x0314, 0x1f09 },
+    { 0x0391, 0x0345, 0x1fbc },
+    { 0x0395, 0x0300, 0x1fc8 },
+    { 0x0395, 0x0301, 0x0388 },
+    { 0x0395, 0x0313, 0x1f18 },
+    { 0x0395, 0x0314, 0x1f19 },
+    { 0x0397, 0x0300, 0x1fca },
+    { 0x0397, 0x0301, 0x0389 },
+    { 0x0397, 0x0313, 0x1f28 },
+    { 0x0397, 0x0314, 0x1f29 },
+    { 0x0397, 0x0345, 0x1fcc },
+    { 0x0399, 0x0300, 0x1fda },
+    { 0x0399, 0x0301, 0x038a },
+    { 0x0399, 0x0304, 0x1fd9 },
+    { 0x0399, 0x0306, 0x1fd8 },
+    { 0x0399, 0x0308, 0x03aa },
+    { 0x0399, 0x0313, 0x1f38 },
+    { 0x0399, 0x0314, 0x1f39 },
+    { 0x039f, 0x0300, 0x1ff8 },
+    { 0x039f, 0x0301, 0x038c },
+    { 0x039f, 0x0313, 0x1f48 },
+    { 0x039f, 0x0314, 0x1f49 },
+    { 0x03a1, 0x0314, 0x1fec },
+    { 0x03a5, 0x0300, 0x1fea },
+    { 0x03a5, 0x0301, 0x038e },
+    { 0x03a5, 0x0304, 0x1fe9 },
+    { 0x03a5, 0x0306, 0x1fe8 },
+    { 0x03a5, 0x0308, 0x03ab },
+    { 0x03a5, 0x0314, 0x1f59 },
+    { 0x03a9, 0x0300, 0x1ffa },
+    { 0x03a9, 0x0301, 0x038f },
+    { 0x03a9, 0x0313, 0x1f68 },
+    { 0x03a9, 0x0314, 0x1f69 },
+    { 0x03a9, 0x0345, 0x1ffc },
+    { 0x03ac, 0x0345, 0x1fb4 },
+    { 0x03ae, 0x0345, 0x1fc4 },
+    { 0x03b1, 0x0300, 0x1f70 },
+    { 0x03b1, 0x0301, 0x03ac },
+    { 0x03b1, 0x0304, 0x1fb1 },
+    { 0x03b1, 0x0306, 0x1fb0 },
+    { 0x03b1, 0x0313, 0x1f00 },
+    { 0x03b1, 0x0314, 0x1f01 },
+    { 0x03b1, 0x0342, 0x1fb6 },
+    { 0x03b1, 0x0345, 0x1fb3 },
+    { 0x03b5, 0x0300, 0x1f72 },
+    { 0x03b5, 0x0301, 0x03ad },
+    { 0x03b5, 0x0313, 0x1f10 },
+    { 0x03b5, 0x0314, 0x1f11 },
+    { 0x03b7, 0x0300, 0x1f74 },
+    { 0x03b7, 0x0301, 0x03ae },
+    { 0x03b7, 0x0313, 0x1f20 },
+    { 0x03b7, 0x0314, 0x1f21 },
+    { 0x03b7, 0x0342, 0x1fc6 },
+    { 0x03b7, 0x0345, 0x1fc3 },
+    { 0x03b9, 0x0300, 0x1f76 },
+    { 0x03b9, 0x0301, 0x03af },
+    { 0x03b9, 0x0304, 0x1fd1 },
+    { 0x03b9, 0x0306, 0x1fd0 },
+    { 0x03b9, 0x0308, 0x03ca },
+    { 0x03b9, 0x0313, 0x1f30 },
+    { 0x03b9, 0x0314, 0x1f31 },
+    { 0x03b9, 0x0342, 0x1fd6 },
+    { 0x03bf, 0x0300, 0x1f78 },
+    { 0x03bf, 0x0301, 0x03cc },
+    { 0x03bf, 0x0313, 0x1f40 },
+    { 0x03bf, 0x0314, 0x1f41 },
+    { 0x03c1, 0x0313, 0x1fe4 },
+    { 0x03c1, 0x0314, 0x1fe5 },
+    { 0x03c5, 0x0300, 0x1f7a },
+    { 0x03c5, 0x0301, 0x03cd },
+    { 0x03c5, 0x0304, 0x1fe1 },
+    { 0x03c5, 0x0306, 0x1fe0 },
+    { 0x03c5, 0x0308, 0x03cb },
+    { 0x03c5, 0x0313, 0x1f50 },
+    { 0x03c5, 0x0314, 0x1f51 },
+    { 0x03c5, 0x0342, 0x1fe6 },
+    { 0x03c9, 0x0300, 0x1f7c },
+    { 0x03c9, 0x0301, 0x03ce },
+    { 0x03c9, 0x0313, 0x1f60 },
+    { 0x03c9, 0x0314, 0x1f61 },
+    { 0x03c9, 0x0342, 0x1ff6 },
+    { 0x03c9, 0x0345, 0x1ff3 },
+    { 0x03ca, 0x0300, 0x1fd2 },
+    { 0x03ca, 0x0301, 0x0390 },
+    { 0x03ca, 0x0342, 0x1fd7 },
+    { 0x03cb, 0x0300, 0x1fe2 },
+    { 0x03cb, 0x0301, 0x03b0 },
+    { 0x03cb, 0x0342, 0x1fe7 },
+    { 0x03ce, 0x0345, 0x1ff4 },
+    { 0x03d2, 0x0301, 0x03d3 },
+    { 0x03d2, 0x0308, 0x03d4 },
+    { 0x0406, 0x0308, 0x0407 },
+    { 0x0410, 0x0306, 0x04d0 },
+    { 0x0410, 0x0308, 0x04d2 },
+    { 0x0413, 0x0301, 0x0403 },
+    { 0x0415, 0x0300, 0x0400 },
+    { 0x0415, 0x0306, 0x04d6 },
+    { 0x0415, 0x0308, 0x0401 },
+    { 0x0416, 0x0306, 0x04c1 },
+    { 0x0416, 0x0308, 0x04dc },
+    { 0x0417, 0x0308, 0x04de },
+    { 0x0418, 0x0300, 0x040d },
+    { 0x0418, 0x0304, 0x04e2 },
+    { 0x0418, 0x0306, 0x0419 },
+    { 0x0418, 0x0308, 0x04e4 },
+    { 0x041a, 0x0301, 0x040c },
+    { 0x041e, 0x0308, 0x04e6 },
+    { 0x0423, 0x0304, 0x04ee },
+    { 0x0423, 0x0306, 0x040e },
+    { 0x0423, 0x0308, 0x04f0 },
+    { 0x0423, 0x030b, 0x04f2 },
+    { 0x0427, 0x0308, 0x04f4 },
+    { 0x042b, 0x0308, 0x04f8 },
+    { 0x042d, 0x0308, 0x04ec },
+    { 0x0430, 0x0306, 0x04d1 },
+    { 0x0430, 0x0308, 0x04d3 },
+    { 0x0433, 0x0301, 0x0453 },
+    { 0x0435, 0x0300, 0x0450 },
+    { 0x0435, 0x0306, 0x04d7 },
+    { 0x0435, 0x0308, 0x0451 },
+    { 0x0436, 0x0306, 0x04c2 },
+    { 0x0436, 0x0308, 0x04dd },
+    { 0x0437, 0x0308, 0x04df },
+    { 0x0438, 0x0300, 0x045d },
+    { 0x0438, 0x0304, 0x04e3 },
+    { 0x0438, 0x0306, 0x0439 },
+    { 0x0438, 0x0308, 0x04e5 },
+    { 0x043a, 0x0301, 0x045c },
+    { 0x043e, 0x0308, 0x04e7 },
+    { 0x0443, 0x0304, 0x04ef },
+    { 0x0443, 0x0306, 0x045e },
+    { 0x0443, 0x0308, 0x04f1 },
+    { 0x0443, 0x030b, 0x04f3 },
+    { 0x0447, 0x0308, 0x04f5 },
+    { 0x044b, 0x0308, 0x04f9 },
+    { 0x044d, 0x0308, 0x04ed },
+    { 0x0456, 0x0308, 0x0457 },
+    { 0x0474, 0x030f, 0x0476 },
+    { 0x0475, 0x030f, 0x0477 },
+    { 0x04d8, 0x0308, 0x04da },
+    { 0x04d9, 0x0308, 0x04db },
+    { 0x04e8, 0x0308, 0x04ea },
+    { 0x04e9, 0x0308, 0x04eb },
+    { 0x0627, 0x0653, 0x0622 },
+    { 0x0627, 0x0654, 0x0623 },
+    { 0x0627, 0x0655, 0x0625 },
+    { 0x0648, 0x0654, 0x0624 },
+    { 0x064a, 0x0654, 0x0626 },
+    { 0x06c1, 0x0654, 0x06c2 },
+    { 0x06d2, 0x0654, 0x06d3 },
+    { 0x06d5, 0x0654, 0x06c0 },
+    { 0x0928, 0x093c, 0x0929 },
+    { 0x0930, 0x093c, 0x0931 },
+    { 0x0933, 0x093c, 0x0934 },
+    { 0x09c7, 0x09be, 0x09cb },
+    { 0x09c7, 0x09d7, 0x09cc },
+    { 0x0b47, 0x0b3e, 0x0b4b },
+    { 0x0b47, 0x0b56, 0x0b48 },
+    { 0x0b47, 0x0b57, 0x0b4c },
+    { 0x0b92, 0x0bd7, 0x0b94 },
+    { 0x0bc6, 0x0bbe, 0x0bca },
+    { 0x0bc6, 0x0bd7, 0x0bcc },
+    { 0x0bc7, 0x0bbe, 0x0bcb },
+    { 0x0c46, 0x0c56, 0x0c48 },
+    { 0x0cbf, 0x0cd5, 0x0cc0 },
+    { 0x0cc6, 0x0cc2, 0x0cca },
+    { 0x0cc6, 0x0cd5, 0x0cc7 },
+    { 0x0cc6, 0x0cd6, 0x0cc8 },
+    { 0x0cca, 0x0cd5, 0x0ccb },
+    { 0x0d46, 0x0d3e, 0x0d4a },
+    { 0x0d46, 0x0d57, 0x0d4c },
+    { 0x0d47, 0x0d3e, 0x0d4b },
+    { 0x0dd9, 0x0dca, 0x0dda },
+    { 0x0dd9, 0x0dcf, 0x0ddc },
+    { 0x0dd9, 0x0ddf, 0x0dde },
+    { 0x0ddc, 0x0dca, 0x0ddd },
+    { 0x1025, 0x102e, 0x1026 },
+    { 0x1b05, 0x1b35, 0x1b06 },
+    { 0x1b07, 0x1b35, 0x1b08 },
+    { 0x1b09, 0x1b35, 0x1b0a },
+    { 0x1b0b, 0x1b35, 0x1b0c },
+    { 0x1b0d, 0x1b35, 0x1b0e },
+    { 0x1b11, 0x1b35, 0x1b12 },
+    { 0x1b3a, 0x1b35, 0x1b3b },
+    { 0x1b3c, 0x1b35, 0x1b3d },
+    { 0x1b3e, 0x1b35, 0x1b40 },
+    { 0x1b3f, 0x1b35, 0x1b41 },
+    { 0x1b42, 0x1b35, 0x1b43 },
+    { 0x1e36, 0x0304, 0x1e38 },
+    { 0x1e37, 0x0304, 0x1e39 },
+    { 0x1e5a, 0x0304, 0x1e5c },
+    { 0x1e5b, 0x0304, 0x1e5d },
+    { 0x1e62, 0x0307, 0x1e68 },
+    { 0x1e63, 0x0307, 0x1e69 },
+    { 0x1ea0, 0x0302, 0x1eac },
+    { 0x1ea0, 0x0306, 0x1eb6 },
+    { 0x1ea1, 0x0302, 0x1ead },
+    { 0x1ea1, 0x0306, 0x1eb7 },
+    { 0x1eb8, 0x0302, 0x1ec6 },
+    { 0x1eb9, 0x0302, 0x1ec7 },
+    { 0x1ecc, 0x0302, 0x1ed8 },
+    { 0x1ecd, 0x0302, 0x1ed9 },
+    { 0x1f00, 0x0300, 0x1f02 },
+    { 0x1f00, 0x0301, 0x1f04 },
+    { 0x1f00, 0x0342, 0x1f06 },
+    { 0x1f00, 0x0345, 0x1f80 },
+    { 0x1f01, 0x0300, 0x1f03 },
+    { 0x1f01, 0x0301, 0x1f05 },
+    { 0x1f01, 0x0342, 0x1f07 },
+    { 0x1f01, 0x0345, 0x1f81 },
+    { 0x1f02, 0x0345, 0x1f82 },
+    { 0x1f03, 0x0345, 0x1f83 },
+    { 0x1f04, 0x0345, 0x1f84 },
+    { 0x1f05, 0x0345, 0x1f85 },
+    { 0x1f06, 0x0345, 0x1f86 },
+    { 0x1f07, 0x0345, 0x1f87 },
+    { 0x1f08, 0x0300, 0x1f0a },
+    { 0x1f08, 0x0301, 0x1f0c },
+    { 0x1f08, 0x0342, 0x1f0e },
+    { 0x1f08, 0x0345, 0x1f88 },
+    { 0x1f09, 0x0300, 0x1f0b },
+    { 0x1f09, 0x0301, 0x1f0d },
+    { 0x1f09, 0x0342, 0x1f0f },
+    { 0x1f09, 0x0345, 0x1f89 },
+    { 0x1f0a, 0x0345, 0x1f8a },
+    { 0x1f0b, 0x0345, 0x1f8b },
+    { 0x1f0c, 0x0345, 0x1f8c },
+    { 0x1f0d, 0x0345, 0x1f8d },
+    { 0x1f0e, 0x0345, 0x1f8e },
+    { 0x1f0f, 0x0345, 0x1f8f },
+    { 0x1f10, 0x0300, 0x1f12 },
+    { 0x1f10, 0x0301, 0x1f14 },
+    { 0x1f11, 0x0300, 0x1f13 },
+    { 0x1f11, 0x0301, 0x1f15 },
+    { 0x1f18, 0x0300, 0x1f1a },
+    { 0x1f18, 0x0301, 0x1f1c },
+    { 0x1f19, 0x0300, 0x1f1b },
+    { 0x1f19, 0x0301, 0x1f1d },
+    { 0x1f20, 0x0300, 0x1f22 },
+    { 0x1f20, 0x0301, 0x1f24 },
+    { 0x1f20, 0x0342, 0x1f26 },
+    { 0x1f20, 0x0345, 0x1f90 },
+    { 0x1f21, 0x0300, 0x1f23 },
+    { 0x1f21, 0x0301, 0x1f25 },
+    { 0x1f21, 0x0342, 0x1f27 },
+    { 0x1f21, 0x0345, 0x1f91 },
+    { 0x1f22, 0x0345, 0x1f92 },
+    { 0x1f23, 0x0345, 0x1f93 },
+    { 0x1f24, 0x0345, 0x1f94 },
+    { 0x1f25, 0x0345, 0x1f95 },
+    { 0x1f26, 0x0345, 0x1f96 },
+    { 0x1f27, 0x0345, 0x1f97 },
+    { 0x1f28, 0x0300, 0x1f2a },
+    { 0x1f28, 0x0301, 0x1f2c },
+    { 0x1f28, 0x0342, 0x1f2e },
+    { 0x1f28, 0x0345, 0x1f98 },
+    { 0x1f29, 0x0300, 0x1f2b },
+    { 0x1f29, 0x0301, 0x1f2d },
+    { 0x1f29, 0x0342, 0x1f2f },
+    { 0x1f29, 0x0345, 0x1f99 },
+    { 0x1f2a, 0x0345, 0x1f9a },
+    { 0x1f2b, 0x0345, 0x1f9b },
+    { 0x1f2c, 0x0345, 0x1f9c },
+    { 0x1f2d, 0x0345, 0x1f9d },
+    { 0x1f2e, 0x0345, 0x1f9e },
+    { 0x1f2f, 0x0345, 0x1f9f },
+    { 0x1f30, 0x0300, 0x1f32 },
+    { 0x1f30, 0x0301, 0x1f34 },
+    { 0x1f30, 0x0342, 0x1f36 },
+    { 0x1f31, 0x0300, 0x1f33 },
+    { 0x1f31, 0x0301, 0x1f35 },
+    { 0x1f31, 0x0342, 0x1f37 },
+    { 0x1f38, 0x0300, 0x1f3a },
+    { 0x1f38, 0x0301, 0x1f3c },
+    { 0x1f38, 0x0342, 0x1f3e },
+    { 0x1f39, 0x0300, 0x1f3b },
+    { 0x1f39, 0x0301, 0x1f3d },
+    { 0x1f39, 0x0342, 0x1f3f },
+    { 0x1f40, 0x0300, 0x1f42 },
+    { 0x1f40, 0x0301, 0x1f44 },
+    { 0x1f41, 0x0300, 0x1f43 },
+    { 0x1f41, 0x0301, 0x1f45 },
+    { 0x1f48, 0x0300, 0x1f4a },
+    { 0x1f48, 0x0301, 0x1f4c },
+    { 0x1f49, 0x0300, 0x1f4b },
+    { 0x1f49, 0x0301, 0x1f4d },
+    { 0x1f50, 0x0300, 0x1f52 },
+    { 0x1f50, 0x0301, 0x1f54 },
+    { 0x1f50, 0x0342, 0x1f56 },
+    { 0x1f51, 0x0300, 0x1f53 },
+    { 0x1f51, 0x0301, 0x1f55 },
+    { 0x1f51, 0x0342, 0x1f57 },
+    { 0x1f59, 0x0300, 0x1f5b },
+    { 0x1f59, 0x0301, 0x1f5d },
+    { 0x1f59, 0x0342, 0x1f5f },
+    { 0x1f60, 0x0300, 0x1f62 },
+    { 0x1f60, 0x0301, 0x1f64 },
+    { 0x1f60, 0x0342, 0x1f66 },
+    { 0x1f60, 0x0345, 0x1fa0 },
+    { 0x1f61, 0x0300, 0x1f63 },
+    { 0x1f61, 0x0301, 0x1f65 },
+    { 0x1f61, 0x0342, 0x1f67 },
+    { 0x1f61, 0x0345, 0x1fa1 },
+    { 0x1f62, 0x0345, 0x1fa2 },
+    { 0x1f63, 0x0345, 0x1fa3 },
+    { 0x1f64, 0x0345, 0x1fa4 },
+    { 0x1f65, 0x0345, 0x1fa5 },
+    { 0x1f66, 0x0345, 0x1fa6 },
+    { 0x1f67, 0x0345, 0x1fa7 },
+    { 0x1f68, 0x0300, 0x1f6a },
+    { 0x1f68, 0x0301, 0x1f6c },
+    { 0x1f68, 0x0342, 0x1f6e },
+    { 0x1f68, 0x0345, 0x1fa8 },
+    { 0x1f69, 0x0300, 0x1f6b },
+    { 0x1f69, 0x0301, 0x1f6d },
+    { 0x1f69, 0x0342, 0x1f6f },
+    { 0x1f69, 0x0345, 0x1fa9 },
+    { 0x1f6a, 0x0345, 0x1faa },
+    { 0x1f6b, 0x0345, 0x1fab },
+    { 0x1f6c, 0x0345, 0x1fac },
+    { 0x1f6d, 0x0345, 0x1fad },
+    { 0x1f6e, 0x0345, 0x1fae },
+    { 0x1f6f, 0x0345, 0x1faf },
+    { 0x1f70, 0x0345, 0x1fb2 },
+    { 0x1f74, 0x0345, 0x1fc2 },
+    { 0x1f7c, 0x0345, 0x1ff2 },
+    { 0x1fb6, 0x0345, 0x1fb7 },
+    { 0x1fbf, 0x0300, 0x1fcd },
+    { 0x1fbf, 0x0301, 0x1fce },
+    { 0x1fbf, 0x0342, 0x1fcf },
+    { 0x1fc6, 0x0345, 0x1fc7 },
+    { 0x1ff6, 0x0345, 0x1ff7 },
+    { 0x1ffe, 0x0300, 0x1fdd },
+    { 0x1ffe, 0x0301, 0x1fde },
+    { 0x1ffe, 0x0342, 0x1fdf },
+    { 0x2190, 0x0338, 0x219a },
+    { 0x2192, 0x0338, 0x219b },
+    { 0x2194, 0x0338, 0x21ae },
+    { 0x21d0, 0x0338, 0x21cd },
+    { 0x21d2, 0x0338, 0x21cf },
+    { 0x21d4, 0x0338, 0x21ce },
+    { 0x2203, 0x0338, 0x2204 },
+    { 0x2208, 0x0338, 0x2209 },
+    { 0x220b, 0x0338, 0x220c },
+    { 0x2223, 0x0338, 0x2224 },
+    { 0x2225, 0x0338, 0x2226 },
+    { 0x223c, 0x0338, 0x2241 },
+    { 0x2243, 0x0338, 0x2244 },
+    { 0x2245, 0x0338, 0x2247 },
+    { 0x2248, 0x0338, 0x2249 },
+    { 0x224d, 0x0338, 0x226d },
+    { 0x2261, 0x0338, 0x2262 },
+    { 0x2264, 0x0338, 0x2270 },
+    { 0x2265, 0x0338, 0x2271 },
+    { 0x2272, 0x0338, 0x2274 },
+    { 0x2273, 0x0338, 0x2275 },
+    { 0x2276, 0x0338, 0x2278 },
+    { 0x2277, 0x0338, 0x2279 },
+    { 0x227a, 0x0338, 0x2280 },
+    { 0x227b, 0x0338, 0x2281 },
+    { 0x227c, 0x0338, 0x22e0 },
+    { 0x227d, 0x0338, 0x22e1 },
+    { 0x2282, 0x0338, 0x2284 },
+    { 0x2283, 0x0338, 0x2285 },
+    { 0x2286, 0x0338, 0x2288 },
+    { 0x2287, 0x0338, 0x2289 },
+    { 0x2291, 0x0338, 0x22e2 },
+    { 0x2292, 0x0338, 0x22e3 },
+    { 0x22a2, 0x0338, 0x22ac },
+    { 0x22a8, 0x0338, 0x22ad },
+    { 0x22a9, 0x0338, 0x22ae },
+    { 0x22ab, 0x0338, 0x22af },
+    { 0x22b2, 0x0338, 0x22ea },
+    { 0x22b3, 0x0338, 0x22eb },
+    { 0x22b4, 0x0338, 0x22ec },
+    { 0x22b5, 0x0338, 0x22ed },
+    { 0x3046, 0x3099, 0x3094 },
+    { 0x304b, 0x3099, 0x304c },
+    { 0x304d, 0x3099, 0x304e },
+    { 0x304f, 0x3099, 0x3050 },
+    { 0x3051, 0x3099, 0x3052 },
+    { 0x3053, 0x3099, 0x3054 },
+    { 0x3055, 0x3099, 0x3056 },
+    { 0x3057, 0x3099, 0x3058 },
+    { 0x3059, 0x3099, 0x305a },
+    { 0x305b, 0x3099, 0x305c },
+    { 0x305d, 0x3099, 0x305e },
+    { 0x305f, 0x3099, 0x3060 },
+    { 0x3061, 0x3099, 0x3062 },
+    { 0x3064, 0x3099, 0x3065 },
+    { 0x3066, 0x3099, 0x3067 },
+    { 0x3068, 0x3099, 0x3069 },
+    { 0x306f, 0x3099, 0x3070 },
+    { 0x306f, 0x309a, 0x3071 },
+    { 0x3072, 0x3099, 0x3073 },
+    { 0x3072, 0x309a, 0x3074 },
+    { 0x3075, 0x3099, 0x3076 },
+    { 0x3075, 0x309a, 0x3077 },
+    { 0x3078, 0x3099, 0x3079 },
+    { 0x3078, 0x309a, 0x307a },
+    { 0x307b, 0x3099, 0x307c },
+    { 0x307b, 0x309a, 0x307d },
+    { 0x309d, 0x3099, 0x309e },
+    { 0x30a6, 0x3099, 0x30f4 },
+    { 0x30ab, 0x3099, 0x30ac },
+    { 0x30ad, 0x3099, 0x30ae },
+    { 0x30af, 0x3099, 0x30b0 },
+    { 0x30b1, 0x3099, 0x30b2 },
+    { 0x30b3, 0x3099, 0x30b4 },
+    { 0x30b5, 0x3099, 0x30b6 },
+    { 0x30b7, 0x3099, 0x30b8 },
+    { 0x30b9, 0x3099, 0x30ba },
+    { 0x30bb, 0x3099, 0x30bc },
+    { 0x30bd, 0x3099, 0x30be },
+    { 0x30bf, 0x3099, 0x30c0 },
+    { 0x30c1, 0x3099, 0x30c2 },
+    { 0x30c4, 0x3099, 0x30c5 },
+    { 0x30c6, 0x3099, 0x30c7 },
+    { 0x30c8, 0x3099, 0x30c9 },
+    { 0x30cf, 0x3099, 0x30d0 },
+    { 0x30cf, 0x309a, 0x30d1 },
+    { 0x30d2, 0x3099, 0x30d3 },
+    { 0x30d2, 0x309a, 0x30d4 },
+    { 0x30d5, 0x3099, 0x30d6 },
+    { 0x30d5, 0x309a, 0x30d7 },
+    { 0x30d8, 0x3099, 0x30d9 },
+    { 0x30d8, 0x309a, 0x30da },
+    { 0x30db, 0x3099, 0x30dc },
+    { 0x30db, 0x309a, 0x30dd },
+    { 0x30ef, 0x3099, 0x30f7 },
+    { 0x30f0, 0x3099, 0x30f8 },
+    { 0x30f1, 0x3099, 0x30f9 },
+    { 0x30f2, 0x3099, 0x30fa },
+    { 0x30fd, 0x3099, 0x30fe },
+    { 0x11099, 0x110ba, 0x1109a },
+    { 0x1109b, 0x110ba, 0x1109c },
+    { 0x110a5, 0x110ba, 0x110ab },
+    { 0x11131, 0x11127, 0x1112e },
+    { 0x11132, 0x11127, 0x1112f },
+    { 0x11347, 0x1133e, 0x1134b },
+    { 0x11347, 0x11357, 0x1134c },
+    { 0x114b9, 0x114b0, 0x114bc },
+    { 0x114b9, 0x114ba, 0x114bb },
+    { 0x114b9, 0x114bd, 0x114be },
+    { 0x115b8, 0x115af, 0x115ba },
+    { 0x115b9, 0x115af, 0x115bb },
+    { 0x11935, 0x11930, 0x11938 },
+};
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -0,0 +1,96 @@
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from 'tools/dev/gen_unicode_tables.pl'.
+ *
+ * Unicode 14.0.0 case mapping and canonical normalization tables
+ * for the built-in string case conversion and NFC/NFD support.
+ *
+ * Copyright (C) 2016, Parrot Foundation.
+ */
+
+/* HEADERIZER HFILE: none */
+
+
+#ifndef PARROT_UNICODE_TABLES_H_GUARD
+#define PARROT_UNICODE_TABLES_H_GUARD
+#include "parrot/parrot.h"
+
+#define PARROT_UNICODE_VERSION          "14.0.0"
+
+#define PARROT_UNICODE_BLOCK_SHIFT      7
+#define PARROT_UNICODE_BLOCK_MASK       127
+
+/* code points at or above these limits have no entry in the tables */
+#define PARROT_UNICODE_CASE_LIMIT       0xe0200
+#define PARROT_UNICODE_CCC_LIMIT        0x1e980
+#define PARROT_UNICODE_QC_LIMIT         0x2fa80
+#define PARROT_UNICODE_DECOMP_LIMIT     0x2fa80
+
+/* strings with all code points below these are already in NFC / NFD */
+#define PARROT_UNICODE_NFC_QUICK_LIMIT  0x0300
+#define PARROT_UNICODE_NFD_QUICK_LIMIT  0x00c0
+
+/* longest full canonical decomposition of a single code point */
+#define PARROT_UNICODE_MAX_DECOMP       4
+
+/* longest full case mapping of a single code point */
+#define PARROT_UNICODE_MAX_CASE         3
+
+#define PARROT_UNICODE_N_COMPOSITIONS   941
+
+/* indexes into delta and special */
+#define PARROT_UNICODE_UPPER            0
+#define PARROT_UNICODE_LOWER            1
+#define PARROT_UNICODE_TITLE            2
+#define PARROT_UNICODE_FOLD             3
+
+/* case flags */
+#define PARROT_UNICODE_CASED            1
+#define PARROT_UNICODE_CASE_IGNORABLE   2
+
+/* quick check flags: set when NFC_Quick_Check / NFD_Quick_Check is not Yes */
+#define PARROT_UNICODE_NFC_MAYBE        1
+#define PARROT_UNICODE_NFD_MAYBE        2
+
+typedef struct Parrot_unicode_case_t {
+    /* added to the code point when the mapping is a single code point */
+    Parrot_Int4     delta[4];
+    /* otherwise the offset of the length-prefixed mapping in
+     * Parrot_unicode_case_special */
+    unsigned short  special[4];
+    unsigned short  flags;
+} Parrot_unicode_case_t;
+
+typedef struct Parrot_unicode_composition_t {
+    Parrot_UInt4 first;
+    Parrot_UInt4 second;
+    Parrot_UInt4 composite;
+} Parrot_unicode_composition_t;
+
+extern const Parrot_unicode_case_t        Parrot_unicode_case_records[282];
+extern const Parrot_UInt4                 Parrot_unicode_case_special[535];
+extern const unsigned short               Parrot_unicode_case_index[7172];
+extern const unsigned short               Parrot_unicode_case_blocks[20224];
+extern const unsigned char                Parrot_unicode_ccc_index[979];
+extern const unsigned char                Parrot_unicode_ccc_blocks[11520];
+extern const unsigned short               Parrot_unicode_qc_index[1525];
+extern const unsigned char                Parrot_unicode_qc_blocks[6784];
+extern const unsigned short               Parrot_unicode_decomp_index[1525];
+extern const unsigned short               Parrot_unicode_decomp_blocks[7040];
+extern const Parrot_UInt4                 Parrot_unicode_decomp_data[5468];
+extern const Parrot_unicode_composition_t Parrot_unicode_compositions[941];
+
+#define PARROT_UNICODE_LOOKUP(table, c) \
+    Parrot_unicode_ ## table ## _blocks[ \
+        (Parrot_unicode_ ## table ## _index[(c) >> PARROT_UNICODE_BLOCK_SHIFT] \
+            << PARROT_UNICODE_BLOCK_SHIFT) + ((c) & PARROT_UNICODE_BLOCK_MASK)]
+
+#endif /* PARROT_UNICODE_TABLES_H_GUARD */
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
+
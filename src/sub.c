@@ -23,6 +23,7 @@ Subroutines, continuations, co-routines and other fun stuff...
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_continuation.h"
 #include "pmc/pmc_coroutine.h"
+#include "pmc/pmc_lexpad.h"
 #include "parrot/oplib/core_ops.h"
 
 /* HEADERIZER HFILE: include/parrot/sub.h */
@@ -338,6 +339,52 @@ Parrot_sub_find_pad(PARROT_INTERP, ARGIN(STRING *lex_name), ARGIN(PMC *ctx))
 }
 
 
+/*
+
+=item C<PMC* Parrot_sub_find_indexed_ctx(PARROT_INTERP, PMC *ctx, INTVAL depth,
+PMC *lex_info)>
+
+Locate the context C<depth> C<:outer> levels up from C<ctx>, for a lexical
+that the compiler resolved to a register of the sub described by
+C<lex_info>. Return PMCNULL if the chain of outer contexts is shorter, if a
+context on the way has a pad other than a plain LexPad, or if the context
+found doesn't hold its lexicals in a LexPad for C<lex_info>.
+The lexical then has to be looked up by name.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC*
+Parrot_sub_find_indexed_ctx(PARROT_INTERP, ARGIN(PMC *ctx), INTVAL depth,
+        ARGIN(PMC *lex_info))
+{
+    ASSERT_ARGS(Parrot_sub_find_indexed_ctx)
+    PMC *lex_pad;
+    PMC *pad_info;
+
+    while (depth-- > 0) {
+        /* a pad that can grow new names at run time could shadow the lexical */
+        lex_pad = Parrot_pcc_get_lex_pad(interp, ctx);
+        if (!PMC_IS_NULL(lex_pad) && lex_pad->vtable->base_type != enum_class_LexPad)
+            return PMCNULL;
+
+        ctx = Parrot_pcc_get_outer_ctx(interp, ctx);
+        if (PMC_IS_NULL(ctx))
+            return PMCNULL;
+    }
+
+    lex_pad = Parrot_pcc_get_lex_pad(interp, ctx);
+    if (PMC_IS_NULL(lex_pad) || lex_pad->vtable->base_type != enum_class_LexPad)
+        return PMCNULL;
+
+    GETATTR_LexPad_lexinfo(interp, lex_pad, pad_info);
+    return pad_info == lex_info ? ctx : PMCNULL;
+}
+
+
 /*
 
 =item C<PMC* Parrot_sub_find_dynamic_pad(PARROT_INTERP, STRING *lex_name, PMC
@@ -411,6 +458,7 @@ Parrot_sub_capture_lex(PARROT_INTERP, ARGMOD(PMC *sub_pmc))
                                       child_outer_sub->subid)) {
                     PARROT_GC_WRITE_BARRIER(interp, child_pmc);
                     child_sub->outer_ctx = ctx;
+                    Parrot_pcc_mark_escaped(interp, ctx);
                 }
             }
         }
@@ -425,6 +473,7 @@ Parrot_sub_capture_lex(PARROT_INTERP, ARGMOD(PMC *sub_pmc))
     /* set the sub's outer context to the current context */
     PARROT_GC_WRITE_BARRIER(interp, sub_pmc);
     sub->outer_ctx = ctx;
+    Parrot_pcc_mark_escaped(interp, ctx);
 }
 
 
@@ -530,6 +579,9 @@ Parrot_sub_continuation_rewind_environment(PARROT_INTERP, ARGIN(PMC *pmc))
     /* set context */
     Parrot_pcc_set_context(interp, to_ctx);
     Parrot_pcc_set_signature(interp, to_ctx, sig);
+
+    /* and drop the register frames of the contexts we left */
+    Parrot_pcc_unwind_frames(interp, to_ctx);
 }
 
 
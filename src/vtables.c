@@ -70,6 +70,9 @@ Parrot_vtbl_clone_vtable(PARROT_INTERP, ARGIN(const VTABLE *base_vtable))
         Parrot_hash_clone(interp, base_vtable->isa_hash, new_vtable->isa_hash);
     }
 
+    /* rebuilt on demand from the cloned isa_hash */
+    new_vtable->isa_bits = NULL;
+
 
     return new_vtable;
 }
@@ -104,6 +107,9 @@ Parrot_vtbl_destroy_vtable(PARROT_INTERP, ARGFREE_NOTNULL(VTABLE *vtable))
             ro_vtable->isa_hash = NULL;
         }
 
+        if (ro_vtable->isa_bits)
+            mem_internal_free(ro_vtable->isa_bits);
+
         mem_internal_free(ro_vtable);
         vtable->ro_variant_vtable = NULL;
     }
@@ -113,6 +119,9 @@ Parrot_vtbl_destroy_vtable(PARROT_INTERP, ARGFREE_NOTNULL(VTABLE *vtable))
         vtable->isa_hash = NULL;
     }
 
+    if (vtable->isa_bits)
+        mem_internal_free(vtable->isa_bits);
+
     mem_internal_free(vtable);
 }
 
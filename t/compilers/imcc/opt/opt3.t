@@ -0,0 +1,367 @@
+#!perl
+# Copyright (C) 2016, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 14;
+
+# The code of these tests goes to opt3_*.pir, which Parrot::Test runs with -O3.
+
+{
+    local $ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' -v';
+
+    pir_output_like( <<'CODE', <<'OUT', "value numbering, copies, invariants" );
+.sub main :main
+    .local int i, n, a, b, c, sum
+    n = 10
+    a = 3
+    b = 4
+    sum = 0
+    i = 0
+  loop:
+    c = a * b
+    $I0 = c + i
+    $I1 = a * b
+    $I2 = $I1 + i
+    $I3 = $I0 + $I2
+    $I4 = $I3
+    sum += $I4
+    inc i
+    if i < n goto loop
+    say sum
+.end
+CODE
+/[1-9]\d* invariants_moved
+\s*[1-9]\d* copies propagated, [1-9]\d* values numbered, [1-9]\d* dead stores
+.*^330$/sm
+OUT
+}
+
+pir_output_is( <<'CODE', <<'OUT', "values merging from branches are not the same" );
+.sub main :main
+    .param pmc argv
+    .local int a, x, y
+    $I0 = elements argv
+    if $I0 goto one
+    a = 5
+    x = a * 3
+    goto join
+  one:
+    a = 7
+  join:
+    y = a * 3
+    say y
+    a = 2
+    y = a * 3
+    say y
+.end
+CODE
+21
+6
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "copies are not propagated past writes of their source" );
+.sub main :main
+    .local int a, b, i
+    a = 1
+    i = 0
+  loop:
+    b = a
+    a = a + 10
+    say b
+    inc i
+    if i < 3 goto loop
+.end
+CODE
+1
+11
+21
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "operations reading their own result are not dead" );
+.sub main :main
+    .local string s
+    .local int i
+    s = ''
+    i = 0
+  loop:
+    $S0 = i
+    $S0 = concat $S0, '-'
+    s = concat s, $S0
+    inc i
+    if i < 4 goto loop
+    say s
+.end
+CODE
+0-1-2-3-
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "invariant needed after a loop that may exit early" );
+.sub main :main
+    .local int i, a, b, c
+    a = 6
+    b = 7
+    c = 0
+    i = 0
+  loop:
+    if i == 0 goto done
+    c = a * b
+    inc i
+    if i < 5 goto loop
+  done:
+    say c
+.end
+CODE
+0
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "invariant written twice in the loop stays" );
+.sub main :main
+    .local int i, a, c, sum
+    a = 6
+    sum = 0
+    i = 0
+  loop:
+    c = a * 2
+    sum += c
+    c = i
+    sum += c
+    inc i
+    if i < 3 goto loop
+    say sum
+.end
+CODE
+39
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "units with exception handlers are left alone" );
+.sub main :main
+    .local int a
+    a = 1
+    push_eh handler
+    a = 2
+    die 'oops'
+  handler:
+    pop_eh
+    say a
+.end
+CODE
+2
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "calls may return more than once" );
+.sub main :main
+    .local int redux, a, b
+    .local pmc cont
+    redux = 0
+    a = 1
+    cont = take()
+    b = a
+    say b
+    if redux goto done
+    redux = 1
+    a = 2
+    cont(cont)
+  done:
+    say 'done'
+.end
+.sub take
+    $P0 = new ['Continuation']
+    set_label $P0, again
+    .return ($P0)
+  again:
+    .get_results ($P1)
+    .return ($P1)
+.end
+CODE
+1
+2
+done
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "no invariants hoisted past a call that may return again" );
+.sub main :main
+    .local int i, a, c
+    .local pmc cont
+    a = 3
+    i = 0
+  loop:
+    cont = take()
+    c = a * 2
+    say c
+    inc i
+    if i < 2 goto loop
+    if a > 3 goto done
+    a = 4
+    cont(cont)
+  done:
+.end
+.sub take
+    $P0 = new ['Continuation']
+    set_label $P0, again
+    .return ($P0)
+  again:
+    .get_results ($P1)
+    .return ($P1)
+.end
+CODE
+6
+6
+8
+OUT
+
+{
+    local $ENV{TEST_PROG_ARGS} = ( $ENV{TEST_PROG_ARGS} || '' ) . ' -v';
+
+    pir_output_like( <<'CODE', <<'OUT', "small leaf subs are inlined" );
+.sub 'sq'
+    .param int x
+    $I0 = x * x
+    .return ($I0)
+.end
+.sub 'absdiff'
+    .param int a
+    .param int b
+    if a < b goto less
+    $I0 = a - b
+    .return ($I0)
+  less:
+    $I0 = b - a
+    .return ($I0)
+.end
+.sub 'acc'
+    .param pmc arr
+    .param int v
+    push arr, v
+.end
+.sub main :main
+    .local int i
+    $P0 = new ['ResizableIntegerArray']
+    i = 0
+  loop:
+    $I0 = 'sq'(i)
+    $I1 = absdiff($I0, 10)
+    acc($P0, $I1)
+    inc i
+    if i < 5 goto loop
+    $S0 = join ' ', $P0
+    say $S0
+.end
+CODE
+/^sub main:.*^\s*3 calls inlined$.*^10 9 6 1 6$/sm
+OUT
+}
+
+pir_output_is( <<'CODE', <<'OUT', "PMC registers read before written are null in each inlined call" );
+.sub 'mark'
+    .param int n
+    if n goto skip
+    $P0 = box 'set'
+  skip:
+    if null $P0 goto none
+    .return ($P0)
+  none:
+    .return ('null')
+.end
+.sub main :main
+    .local int i
+    i = 0
+  loop:
+    $S0 = mark(i)
+    say $S0
+    inc i
+    if i < 3 goto loop
+.end
+CODE
+set
+null
+null
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "subs with lexicals, recursion or outer subs are called" );
+.sub 'fact'
+    .param int n
+    if n > 1 goto rec
+    .return (1)
+  rec:
+    $I0 = n - 1
+    $I1 = 'fact'($I0)
+    $I1 *= n
+    .return ($I1)
+.end
+.sub 'lex'
+    .param int n
+    .lex 'n', $P0
+    $P0 = box n
+    $P1 = find_lex 'n'
+    .return ($P1)
+.end
+.sub 'main' :main
+    $I0 = 'fact'(5)
+    say $I0
+    $P0 = 'lex'(7)
+    say $P0
+    $I0 = 'inner'()
+    say $I0
+.end
+.sub 'inner' :outer('main')
+    .return (3)
+.end
+CODE
+120
+7
+3
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "calls that don't fit the sub are not inlined" );
+.sub 'two'
+    .param int a
+    .param int b
+    $I0 = a + b
+    .return ($I0, b)
+.end
+.sub 'main' :main
+    $I0 = 'two'(1, 2)
+    say $I0
+    ($I0, $I1) = 'two'(3, 4)
+    say $I0
+    say $I1
+    $P0 = new ['ResizableIntegerArray']
+    push $P0, 5
+    push $P0, 6
+    $I0 = 'two'($P0 :flat)
+    say $I0
+.end
+CODE
+3
+7
+4
+11
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "subs in other namespaces are not inlined by name" );
+.namespace ['Foo']
+.sub 'val'
+    .return (1)
+.end
+.namespace []
+.sub 'val'
+    .return (2)
+.end
+.sub 'main' :main
+    $I0 = 'val'()
+    say $I0
+.end
+CODE
+2
+OUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 11;
+use Parrot::Test tests => 13;
 
 pir_output_is( <<'CODE', <<'OUT', "alligator" );
 # if the side-effect of set_label/continuation isn't
@@ -160,6 +160,63 @@ pir_output_is( <<'CODE', <<'OUT', "Wrong regs_used[S], afl crash 3 - GH #1168" )
 CODE
 OUT
 
+SKIP: {
+    skip 'the optimizer changes the registers used', 1
+        if ( $ENV{TEST_PROG_ARGS} || '' ) =~ /-O[23]/;
+
+pir_output_is( <<'CODE', <<'OUT', "temporaries with disjoint live ranges share registers" );
+.sub main :main
+    .include "interpinfo.pasm"
+    $I1 = 1
+    $I2 = $I1 + 1
+    $I3 = $I2 + 1
+    $I4 = $I3 + 1
+    $I5 = $I4 + 1
+    print $I5
+    print "\n"
+    $P0 = interpinfo .INTERPINFO_CURRENT_SUB
+    $I0 = $P0."__get_regs_used"('I')
+    print $I0
+    print "\n"
+.end
+CODE
+5
+2
+OUT
+}
+
+pir_output_is( <<'CODE', <<'OUT', "values live around loops and calls keep their registers" );
+.sub main :main
+    .local int i, total
+    .local string s
+    total = 0
+    s     = 'outer'
+    i     = 0
+  loop:
+    $I0 = i * 2
+    $I1 = 'twice'($I0)
+    total += $I1
+    $I2 = i + 100
+    inc i
+    if i < 5 goto loop
+    print total
+    print "\n"
+    print s
+    print "\n"
+    print $I2
+    print "\n"
+.end
+.sub 'twice'
+    .param int n
+    $I5 = n + n
+    .return ($I5)
+.end
+CODE
+40
+outer
+104
+OUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
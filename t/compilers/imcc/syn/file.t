@@ -12,7 +12,7 @@ use Test::More;
 
 use Parrot::Test::Util 'create_tempfile';
 use Parrot::Config;
-use Parrot::Test tests => 14;
+use Parrot::Test tests => 15;
 
 =head1 NAME
 
@@ -349,6 +349,34 @@ sub2
 back
 OUT
 
+# a precompiled program compiles nothing until it asks for it, so the ops of
+# an oplib it loaded before have to be known to the compiler all the same
+($FOO,  $temp_pir) = create_tempfile( SUFFIX => '.pir', UNLINK => 1 );
+(undef, $temp_pbc) = create_tempfile( SUFFIX => '.pbc', UNLINK => 1 );
+
+print $FOO <<'ENDF';
+.sub main :main
+    $P0 = loadlib 'math_ops'
+    $P1 = compreg 'PIR'
+    $P2 = $P1(<<'END_PIR')
+.sub 'modulus'
+    $I0 = cmod 7, 4
+    say $I0
+.end
+END_PIR
+    $P3 = get_global 'modulus'
+    $P3()
+.end
+ENDF
+
+close $FOO;
+
+system_or_die( $PARROT, '-o', $temp_pbc, $temp_pir );
+
+is( `$PARROT $temp_pbc`, <<OUT, 'compile an op of a loaded oplib, precompiled' );
+3
+OUT
+
 {
 
     # include a non-existent file and catch the error message
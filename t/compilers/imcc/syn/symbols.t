@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
 use Parrot::Config;
-use Parrot::Test tests => 6;
+use Parrot::Test tests => 7;
 
 # 1 ##########################
 pir_error_output_like( <<'CODE', <<'OUT', "register names with one letter only are invalid" );
@@ -62,6 +62,56 @@ CODE
 /error:imcc:'\$S0' is not a valid register name in pasm mode/
 OUT
 
+# 7 ##########################
+pir_output_is( <<'CODE', <<'OUT', "sub names resolve in their own namespace" );
+.sub main :main
+    'helper'()
+    $P0 = get_hll_global ['Foo'], 'run'
+    $P0()
+    $P0 = get_hll_global ['Bar'], 'run'
+    $P0()
+    .globalconst string late = "late globalconst"
+.end
+
+.namespace ['Foo']
+
+.sub 'run'
+    'helper'()
+.end
+
+.sub 'helper'
+    say 'Foo helper'
+.end
+
+.namespace ['Bar']
+
+.sub 'run'
+    'helper'()
+    'tail'()
+.end
+
+.sub 'helper'
+    say 'Bar helper'
+.end
+
+.namespace []
+
+.sub 'helper'
+    say 'root helper'
+.end
+
+.namespace ['Bar']
+
+.sub 'tail'
+    say late
+.end
+CODE
+root helper
+Foo helper
+Bar helper
+late globalconst
+OUT
+
 
 # Local Variables:
 #   mode: cperl
@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
 use Parrot::Config;
-use Parrot::Test tests => 7;
+use Parrot::Test tests => 9;
 
 ##############################
 # Parrot Calling Conventions:  Tail call optimization.
@@ -399,6 +399,140 @@ G
 H
 OUTPUT
 
+
+pir_output_is( <<'CODE', <<'OUT', "tail calls run in constant space" );
+.include 'interpinfo.pasm'
+
+.sub main :main
+    $P0 = newclass 'Walker'
+    $P1 = new 'Walker'
+    sweep 1
+    $I0 = interpinfo .INTERPINFO_ACTIVE_PMCS
+    $P2 = box $I0
+    set_global '$before', $P2
+
+    $I1 = 'even'(100000)
+    say $I1
+    $I1 = $P1.'even'(100000)
+    say $I1
+    $I1 = 'step'(100000, 'even')
+    say $I1
+.end
+
+.sub 'grown'
+    sweep 1
+    $I0 = interpinfo .INTERPINFO_ACTIVE_PMCS
+    $P0 = get_global '$before'
+    $I1 = $P0
+    $I0 -= $I1
+    $I0 = $I0 < 1000
+    .return ($I0)
+.end
+
+.sub 'even'
+    .param int n
+    unless n goto done
+    dec n
+    .tailcall 'odd'(n)
+  done:
+    .tailcall 'grown'()
+.end
+
+.sub 'odd'
+    .param int n
+    dec n
+    .tailcall 'even'(n)
+.end
+
+.sub 'step' :multi(int, string)
+    .param int n
+    .param string s
+    unless n goto done
+    dec n
+    .tailcall 'step'(n, 1)
+  done:
+    .tailcall 'grown'()
+.end
+
+.sub 'step' :multi(int, int)
+    .param int n
+    .param int i
+    dec n
+    .tailcall 'step'(n, 'odd')
+.end
+
+.namespace ['Walker']
+
+.sub 'even' :method
+    .param int n
+    unless n goto done
+    dec n
+    .tailcall self.'odd'(n)
+  done:
+    .tailcall 'grown'()
+.end
+
+.sub 'odd' :method
+    .param int n
+    dec n
+    .tailcall self.'even'(n)
+.end
+CODE
+1
+1
+1
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "tail calls without params, coroutines in between" );
+.sub main :main
+    .local pmc coro
+    .local int i
+    coro = get_global 'gen'
+    i    = 0
+  loop:
+    $I0 = 'start'()
+    say $I0
+    $I0 = 'pull'(coro)
+    say $I0
+    inc i
+    if i < 2 goto loop
+.end
+
+.sub 'start'
+    .tailcall 'no_params'()
+.end
+
+.sub 'no_params'
+    $P0 = getinterp
+    $P0 = $P0['sub'; 1]
+    $S0 = $P0
+    say $S0
+    .return (42)
+.end
+
+.sub 'pull'
+    .param pmc coro
+    $I0 = coro()
+    $I1 = 'start'()
+    $I0 += $I1
+    .return ($I0)
+.end
+
+.sub 'gen'
+    .yield (1)
+    .return (2)
+.end
+CODE
+main
+42
+pull
+43
+main
+42
+pull
+44
+OUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
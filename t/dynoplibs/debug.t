@@ -44,6 +44,9 @@ CODE
 /$nolineno/
 OUTPUT
 
+SKIP: {
+    skip "dead stores are removed at -O3", 1 if $ENV{TEST_PROG_ARGS} =~ /-O3/;
+
 pir_output_like( <<'CODE', <<"OUTPUT", "debug_print" );
 .loadlib 'debug_ops'
 .sub main :main
@@ -66,6 +69,7 @@ CODE
   P0 = String=PMC[(](0x)?[a-f0-9]+ Str:"bar"[)]
 /
 OUTPUT
+}
 
 open STDERR, ">>&STDOUT";
 pir_output_like( <<'CODE', <<"OUTPUT", "debug_print without debugger" );
@@ -11,16 +11,59 @@ t/oo/attributes.t - Test OO attributes
 
 =head1 DESCRIPTION
 
-Tests OO features related to adding and removing attributes.
+Tests OO features related to adding, removing and looking up attributes.
 
 =cut
 
 .sub main :main
     .include 'test_more.pir'
 
-    plan(3)
+    plan(7)
 
     remove_1()
+    slots_per_class()
+.end
+
+.sub slots_per_class
+    .local pmc a, b, c, oa, ob, oc
+    .local int i
+
+    # 'y' lives in a different slot in each class
+    a = newclass 'SlotA'
+    addattribute a, 'x'
+    addattribute a, 'y'
+    b = newclass 'SlotB'
+    addattribute b, 'y'
+    c = subclass a, 'SlotC'
+    addattribute c, 'z'
+
+    oa = new a
+    ob = new b
+    oc = new c
+
+    # The same constant name alternates between classes
+    i = 0
+  loop:
+    $P0 = box i
+    setattribute oa, 'y', $P0
+    $P1 = box 'b'
+    setattribute ob, 'y', $P1
+    setattribute oc, 'y', $P1
+    inc i
+    if i < 3 goto loop
+
+    $P0 = getattribute oa, 'y'
+    is($P0, 2, 'attribute slot of first class')
+    $P0 = getattribute ob, 'y'
+    is($P0, 'b', 'same name in a different slot of another class')
+
+    # Names built at runtime are different STRINGs with the same contents
+    $S0 = 'y'
+    $S0 = concat $S0, ''
+    $P0 = getattribute oc, $S0
+    is($P0, 'b', 'inherited attribute via a computed name')
+    $P0 = getattribute oa, 'x'
+    is_null($P0, 'unset attribute in a neighbouring slot')
 .end
 
 .sub remove_1
@@ -19,7 +19,7 @@ composition.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(30)
+    plan(39)
 
     isa_by_string_name()
     isa_by_class_object()
@@ -28,6 +28,8 @@ composition.
     string_isa_and_pmc_isa_have_same_result()
     string_register_and_string_pmc_isa_have_same_result()
     isa_accepts_rsa()
+    isa_after_instantiation()
+    does_through_parent_roles()
 .end
 
 
@@ -189,6 +191,51 @@ composition.
     ok($I0, "isa accepts a ResizablePMCArray")
  .end
 
+.sub isa_after_instantiation
+    .local pmc a, b, c, obj, late, anon
+    a   = newclass 'IsaA'
+    b   = subclass a, 'IsaB'
+    c   = subclass b, 'IsaC'
+    obj = new c
+
+    $I0 = isa obj, 'IsaA'
+    ok( $I0, 'instance isa grandparent by name' )
+    $I0 = isa obj, a
+    ok( $I0, 'instance isa grandparent by class object' )
+    $I0 = isa c, 'IsaB'
+    ok( $I0, 'class isa parent by name' )
+
+    late = newclass 'IsaLate'
+    $I0  = isa obj, late
+    nok( $I0, 'instance is no class created after instantiation' )
+    $I0  = isa obj, 'IsaLate'
+    nok( $I0, '... also by name' )
+
+    anon = new 'Class'
+    $I0  = isa obj, anon
+    nok( $I0, 'instance is no anonymous class' )
+
+    $P0  = subclass 'Integer', 'IsaInt'
+    $P1  = new $P0
+    $I0  = isa $P1, 'Integer'
+    ok( $I0, 'instance of a PMC subclass isa the PMC by name' )
+.end
+
+.sub does_through_parent_roles
+    .local pmc role, p, q, obj
+    role = new 'Role'
+    role.'name'('DoesR')
+    p = newclass 'DoesP'
+    p.'add_role'(role)
+    q = subclass p, 'DoesQ'
+    obj = new q
+
+    $I0 = does obj, 'DoesR'
+    ok( $I0, 'instance does the role of its parent class' )
+    $I0 = does obj, 'DoesNothing'
+    nok( $I0, '... but no other' )
+.end
+
 .HLL 'foo'
 .namespace ['XYZ']
 
@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 104;
+use Parrot::Test tests => 106;
 
 =head1 NAME
 
@@ -2679,6 +2679,108 @@ CODE
 /Null PMC access/
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', "plain positional args and returns of every type" );
+.sub 'main' :main
+    $P0 = box 'p'
+    $I0 = 7
+    $N0 = 2.5
+    $S0 = 's'
+    ($I1, $N1, $S1, $P1) = 'swap'($P0, $S0, $N0, $I0)
+    say $I1
+    say $N1
+    say $S1
+    say $P1
+    ($I1, $N1, $S1, $P1) = 'swap'($P0, 'c', 1.5, 3)
+    say $I1
+    say $N1
+    say $S1
+.end
+
+.sub 'swap'
+    .param pmc p
+    .param string s
+    .param num n
+    .param int i
+    .return (i, n, s, p)
+.end
+CODE
+7
+2.5
+s
+p
+3
+1.5
+c
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', "one call site, callees with different signatures" );
+.sub 'main' :main
+    .local pmc callees, it, callee
+    callees = new 'ResizablePMCArray'
+    $P0 = get_global 'exact'
+    push callees, $P0
+    $P0 = get_global 'convert'
+    push callees, $P0
+    $P0 = get_global 'optional'
+    push callees, $P0
+    $P0 = get_global 'too_many'
+    push callees, $P0
+
+    it = iter callees
+  loop:
+    unless it goto done
+    callee = shift it
+    push_eh failed
+    $S0 = callee(42, 'x')
+    pop_eh
+    say $S0
+    goto loop
+  failed:
+    .get_results ($P0)
+    pop_eh
+    $S0 = $P0
+    say $S0
+    goto loop
+  done:
+.end
+
+.sub 'exact'
+    .param int i
+    .param string s
+    $S0 = i
+    $S0 = concat s, $S0
+    .return ($S0)
+.end
+
+.sub 'convert'
+    .param pmc i
+    .param pmc s
+    $S0 = typeof i
+    .return ($S0)
+.end
+
+.sub 'optional'
+    .param int i
+    .param string s
+    .param int extra :optional
+    .param int has_extra :opt_flag
+    $S0 = has_extra
+    .return ($S0)
+.end
+
+.sub 'too_many'
+    .param int i
+    .param string s
+    .param int t
+    .return ('unreachable')
+.end
+CODE
+x42
+Integer
+0
+too few positional arguments: 2 passed, 3 (or more) expected
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -18,11 +18,12 @@ Tests various PMCs with copy.
 .sub 'main' :main
     .include 'test_more.pir'
 
-    plan(4)
+    plan(8)
 
     test_basic()
     test_rt48467()
     test_tonull()
+    test_small_boxes()
 .end
 
 .sub 'test_basic'
@@ -79,6 +80,30 @@ check:
     is( msg, 'Null PMC in copy', 'copy to null throws' )
 .end
 
+.sub 'test_small_boxes'
+    .local pmc i, f, s, dest
+    i = box 42
+    f = box 2.5
+    s = box 'hello'
+
+    dest = new 'Undef'
+    dest = copy i
+    i = 7
+    sweep 1
+    is( dest, 42, 'copy of an Integer survives the clone being collected' )
+    inc dest
+    is( i, 7, '... and is independent of the source' )
+
+    dest = copy f
+    sweep 1
+    is( dest, 2.5, 'copy of a Float survives the clone being collected' )
+
+    dest = copy s
+    s = 'bye'
+    sweep 1
+    is( dest, 'hello', 'copy of a String survives the clone being collected' )
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
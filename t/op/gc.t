@@ -43,6 +43,8 @@ Note that this test will fail for --gc=inf
     collect_count()
     collect_toggle()
     collect_toggle_nested()
+    string_churn()
+    large_strings()
     "stats"()
   start_inf_tests:
     vanishing_singleton_PMC()
@@ -150,6 +152,95 @@ Note that this test will fail for --gc=inf
 
 .end
 
+# Keep a set of strings alive while most allocations die young, so the
+# string pool is compacted repeatedly; substrings share their buffers.
+.sub string_churn
+    .local pmc live
+    .local int i, j, n, bad
+    live = new ['ResizableStringArray']
+    n = 2000
+    i = 0
+  fill:
+    $S0 = i
+    $S0 = repeat $S0, 8
+    push live, $S0
+    inc i
+    if i < n goto fill
+
+    j = 0
+  churn:
+    $I0 = j * 7919
+    $I0 = $I0 % n
+    $S0 = j
+    $S0 = repeat $S0, 8
+    $S1 = concat $S0, "-tmp-"
+    $S1 = concat $S1, $S0
+    $I1 = length $S0
+    $S2 = substr $S1, 0, $I1
+    live[$I0] = $S2
+    $I1 = j % 10000
+    if $I1 goto next
+    sweep 1
+    collect
+  next:
+    inc j
+    if j < 100000 goto churn
+
+    bad = 0
+    i = 0
+  check:
+    $I0 = j - n
+    $I0 = $I0 + i
+    $I1 = $I0 * 7919
+    $I1 = $I1 % n
+    $S0 = $I0
+    $S0 = repeat $S0, 8
+    $S1 = live[$I1]
+    if $S0 == $S1 goto ok
+    inc bad
+  ok:
+    inc i
+    if i < n goto check
+    is(bad, 0, "string_churn keeps live strings intact")
+.end
+
+.sub large_strings
+    .local pmc live
+    .local int i, bad
+    live = new ['ResizableStringArray']
+    live = 8
+    i = 0
+  churn:
+    $S0 = i
+    $S0 = repeat $S0, 60000
+    $I0 = i % 8
+    $S1 = substr $S0, 0, 100000
+    live[$I0] = $S1
+    $S2 = concat $S0, "x"
+    $I1 = i % 100
+    if $I1 goto next
+    sweep 1
+    collect
+  next:
+    inc i
+    if i < 1000 goto churn
+
+    bad = 0
+    i = 992
+  check:
+    $I0 = i % 8
+    $S0 = i
+    $S0 = repeat $S0, 60000
+    $S0 = substr $S0, 0, 100000
+    $S1 = live[$I0]
+    if $S0 == $S1 goto ok
+    inc bad
+  ok:
+    inc i
+    if i < 1000 goto check
+    is(bad, 0, "large string buffers survive collection and compaction")
+.end
+
 .sub "stats"
     $P0 = new ['ResizablePMCArray']
     $P0[5] = 'hello'
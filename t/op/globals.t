@@ -15,7 +15,7 @@ Tests the C<get_global> and C<set_global> operations.
 
 =cut
 
-.const int TESTS = 12
+.const int TESTS = 17
 
 .namespace []
 
@@ -32,6 +32,7 @@ Tests the C<get_global> and C<set_global> operations.
     find_null_global()
     get_hll_global_not_found()
     find_store_with_key()
+    cached_lookups_see_changes()
 .end
 
 .namespace []
@@ -152,6 +153,55 @@ Tests the C<get_global> and C<set_global> operations.
     set_hll_global [ "Monkey2"; "Toaster" ], "Explosion", $P0
 .end
 
+.namespace []
+
+.sub 'cached_lookups_see_changes'
+    .local pmc ns, results, value
+    .local int i
+
+    ns      = get_namespace
+    results = new ['ResizablePMCArray']
+    i       = 0
+  loop:
+    # the same op looks up the global each time
+    value = get_global 'cached_global'
+    push results, value
+    inc i
+    if i == 1 goto first
+    if i == 2 goto second
+    if i == 3 goto third
+    if i == 4 goto fourth
+    goto done
+  first:
+    $P0 = box 'first'
+    set_global 'cached_global', $P0
+    goto loop
+  second:
+    $P0 = box 'second'
+    set_global 'cached_global', $P0
+    goto loop
+  third:
+    ns['cached_global'] = 'third'
+    goto loop
+  fourth:
+    ns.'del_var'('cached_global')
+    goto loop
+  done:
+
+    $P0 = results[0]
+    $I0 = isnull $P0
+    ok($I0, 'cached get_global - not there yet')
+    $S0 = results[1]
+    is($S0, 'first', 'cached get_global - after set_global')
+    $S0 = results[2]
+    is($S0, 'second', 'cached get_global - after another set_global')
+    $S0 = results[3]
+    is($S0, 'third', 'cached get_global - after keyed store')
+    $P0 = results[4]
+    $I0 = isnull $P0
+    ok($I0, 'cached get_global - after del_var')
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
@@ -13,7 +13,7 @@ $ENV{TEST_PROG_ARGS} ||= '';
 plan( skip_all => 'lexicals not thawed properly from PBC, GH #430' )
     if $ENV{TEST_PROG_ARGS} =~ /--run-pbc/;
 
-plan( tests => 54 );
+plan( tests => 56 );
 
 =head1 NAME
 
@@ -1645,6 +1645,80 @@ Starobrno
 Pilsner Urquell
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', 'resolved lexicals - each closure keeps its own pad' );
+.sub 'main' :main
+    $P0 = 'make_counter'(10)
+    $P1 = 'make_counter'(20)
+    $P0()
+    $P0()
+    $P1()
+    $I0 = $P0()
+    say $I0
+    $I0 = $P1()
+    say $I0
+.end
+.sub 'make_counter'
+    .param int start
+    .lex 'count', $P0
+    $P0 = box start
+    $P1 = get_global 'step'
+    $P1 = newclosure $P1
+    .return ($P1)
+.end
+.sub 'step' :outer('make_counter')
+    .lex 'by', $I0
+    $I0 = 1
+    $P0 = get_global 'bump'
+    $P0 = newclosure $P0
+    .tailcall $P0()
+.end
+.sub 'bump' :outer('step')
+    $P0 = find_lex 'count'
+    $I0 = find_lex 'by'
+    $P1 = clone $P0
+    $P1 += $I0
+    store_lex 'count', $P1
+    .return ($P1)
+.end
+CODE
+13
+22
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', 'resolved lexicals - inner .lex shadows outer, types checked' );
+.sub 'main' :main
+    .lex 'x', $P0
+    .lex 'n', $N0
+    $P0 = box 'outer'
+    $N0 = 1.5
+    'inner'()
+    $P1 = find_lex 'x'
+    say $P1
+    $N1 = find_lex 'n'
+    say $N1
+.end
+.sub 'inner' :outer('main')
+    .lex 'x', $P0
+    $P0 = box 'inner'
+    $P1 = find_lex 'x'
+    say $P1
+    store_lex 'n', 2.5
+    push_eh wrong_type
+    $I0 = find_lex 'n'
+    pop_eh
+    say 'no exception'
+    .return ()
+  wrong_type:
+    pop_eh
+    say 'wrong register type'
+.end
+CODE
+inner
+wrong register type
+outer
+2.5
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -1,11 +1,13 @@
 #!perl
-# Copyright (C) 2006-2007, Parrot Foundation.
+# Copyright (C) 2006-2016, Parrot Foundation.
 
 use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 3;
+use Parrot::Test tests => 11;
+use File::Path qw( rmtree );
+use Parrot::Config;
 
 =head1 NAME
 
@@ -45,6 +47,111 @@ CODE
 /"load_bytecode" couldn't find file 'no_file_by_this_name'/
 OUTPUT
 
+my $temp = "temp_load_bytecode";
+
+END {
+    unlink( "$temp.pir", "$temp.pbc" );
+}
+
+open my $S, '>', "$temp.pir" or die "Can't write $temp.pir";
+print $S <<'EOF';
+.sub 'constants'
+    .local string short, long, wide
+    short = 'ab'
+    long  = 'a string constant that is longer than a STRING header can hold inline'
+    wide  = utf8:"\x{263a} smiles \x{263a}"
+    .return (short, long, wide)
+.end
+EOF
+close $S;
+
+system(".$PConfig{slash}parrot$PConfig{exe} -o $temp.pbc $temp.pir");
+
+pir_output_is( <<'CODE', <<'OUTPUT', "string constants of a loaded bytecode file" );
+.sub main :main
+    load_bytecode 'temp_load_bytecode.pbc'
+    ($S0, $S1, $S2) = 'constants'()
+    sweep 1
+    collect
+    say $S0
+    say $S1
+    $I0 = length $S2
+    say $I0
+    $S3 = concat $S0, $S2
+    $I0 = index $S3, 'smiles'
+    say $I0
+    $P0 = new ['Hash']
+    $P0[$S1] = 42
+    $S3 = clone $S1
+    $I0 = $P0[$S3]
+    say $I0
+.end
+CODE
+ab
+a string constant that is longer than a STRING header can hold inline
+10
+4
+42
+OUTPUT
+
+# the compilation cache
+
+my $cache  = "temp_pbc_cache";
+my $source = "temp_load_bytecode_cached";
+
+END {
+    unlink( "$source.pir", "$source.pbc" );
+    rmtree($cache);
+}
+
+sub write_source {
+    my ($text) = @_;
+    open my $S, '>', "$source.pir" or die "Can't write $source.pir";
+    print $S <<"EOF";
+.sub 'cached'
+    say '$text'
+.end
+EOF
+    close $S;
+}
+
+sub cache_entries {
+    my @entries = sort glob("$cache/*.pbc");
+    return @entries;
+}
+
+my $loader = <<"CODE";
+.sub main :main
+    load_bytecode '$source.pir'
+    'cached'()
+.end
+CODE
+
+{
+    local $ENV{PARROT_PBC_CACHE} = $cache;
+
+    write_source('compiled');
+    pir_output_is( $loader, "compiled\n", "load_bytecode of a .pir file fills the cache" );
+    my @entries = cache_entries();
+    is( scalar @entries, 1, "one cache entry" );
+
+    # replace the entry with other bytecode to see that it is used
+    write_source('from the cache');
+    system(".$PConfig{slash}parrot$PConfig{exe} -o $source.pbc $source.pir");
+    write_source('compiled');
+    rename( "$source.pbc", $entries[0] ) or die "Can't replace $entries[0]";
+    pir_output_is( $loader, "from the cache\n", "load_bytecode of a cached .pir file" );
+
+    write_source('edited');
+    pir_output_is( $loader, "edited\n", "editing the .pir file invalidates its entry" );
+    is( scalar cache_entries(), 2, "one more cache entry" );
+
+    local $ENV{PARROT_PBC_CACHE_SIZE} = 0;
+    write_source('edited again');
+    pir_output_is( $loader, "edited again\n", "load_bytecode with a full cache" );
+    is( scalar cache_entries(), 1, "only the newest entry is kept" );
+}
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -0,0 +1,262 @@
+#!./parrot
+# Copyright (C) 2016, Parrot Foundation.
+
+=head1 NAME
+
+t/op/quicken.t - Quickened arithmetic ops
+
+=head1 SYNOPSIS
+
+        % prove t/op/quicken.t
+
+=head1 DESCRIPTION
+
+Runs the same PMC arithmetic and comparison op sites first with C<Integer> or
+C<Float> operands, which quickens them to the specialized ops, then with other
+types, which has to deoptimize them again.
+
+=cut
+
+.sub main :main
+    .include 'test_more.pir'
+    .include 'iglobals.pasm'
+
+    plan(26)
+
+    integer_then_float()
+    float_then_integer()
+    integer_then_object()
+    compare_branches()
+    increment_and_decrement()
+    modulus()
+    overflow()
+.end
+
+.sub 'add_them'
+    .param pmc a
+    .param pmc b
+    $P0 = a + b
+    .return ($P0)
+.end
+
+.sub 'sub_one'
+    .param pmc a
+    $P0 = a - 1
+    .return ($P0)
+.end
+
+.sub integer_then_float
+    .local pmc i, f
+    i = box 3
+    f = box 1.25
+
+    $P0 = 'add_them'(i, i)
+    $P0 = 'add_them'(i, i)
+    is($P0, 6, 'Integer + Integer')
+    $S0 = typeof $P0
+    is($S0, 'Integer', '... gives an Integer')
+
+    $P0 = 'add_them'(f, i)
+    is($P0, 4.25, 'Float + Integer at the same site')
+
+    $P0 = 'add_them'(i, i)
+    is($P0, 6, 'Integer + Integer after that')
+
+    $P0 = 'sub_one'(i)
+    $P0 = 'sub_one'(i)
+    is($P0, 2, 'Integer - constant')
+    $P0 = 'sub_one'(f)
+    is($P0, 0.25, 'Float - constant at the same site')
+.end
+
+.sub float_then_integer
+    .local pmc i, f
+    i = box 3
+    f = box 1.25
+
+    $P0 = 'add_them'(f, f)
+    $P0 = 'add_them'(f, f)
+    is($P0, 2.5, 'Float + Float')
+    $S0 = typeof $P0
+    is($S0, 'Float', '... gives a Float')
+
+    $P0 = 'add_them'(i, i)
+    is($P0, 6, 'Integer + Integer at the same site')
+.end
+
+.sub integer_then_object
+    .local pmc cls, i, obj
+    cls = subclass 'Integer', 'AddsFortyTwo'
+    i   = box 3
+    obj = new 'AddsFortyTwo'
+    obj = 3
+
+    $P0 = 'add_them'(i, i)
+    $P0 = 'add_them'(i, i)
+    $P0 = 'add_them'(obj, i)
+    is($P0, 42, 'overridden add of an Integer subclass is called')
+.end
+
+.sub 'count_to'
+    .param pmc n
+    .param pmc limit
+    .local int count
+    count = 0
+  loop:
+    if n >= limit goto done
+    inc count
+    n = n + 1
+    goto loop
+  done:
+    .return (count)
+.end
+
+.sub 'below_three'
+    .param pmc n
+    if n < 3 goto yes
+    .return (0)
+  yes:
+    .return (1)
+.end
+
+.sub compare_branches
+    $P0 = box 0
+    $P1 = box 5
+    $I0 = 'count_to'($P0, $P1)
+    is($I0, 5, 'loop on Integer compare')
+
+    $P0 = box 0.5
+    $I0 = 'count_to'($P0, $P1)
+    is($I0, 5, 'loop on Float compare at the same sites')
+
+    $P0 = box 1
+    $I0 = 'below_three'($P0)
+    $I0 = 'below_three'($P0)
+    is($I0, 1, 'Integer compare with a constant')
+
+    $P0 = box 2.5
+    $I0 = 'below_three'($P0)
+    is($I0, 1, 'Float compare with a constant at the same site')
+
+    $P0 = box '7'
+    $I0 = 'below_three'($P0)
+    is($I0, 0, 'String compare with a constant at the same site')
+.end
+
+.sub 'bump'
+    .param pmc a
+    inc a
+    inc a
+    dec a
+.end
+
+.sub increment_and_decrement
+    .local pmc i, f, s
+    i = box 1
+    'bump'(i)
+    'bump'(i)
+    is(i, 3, 'Integer inc and dec')
+
+    f = box 0.5
+    'bump'(f)
+    'bump'(f)
+    is(f, 2.5, 'Float inc and dec at the same sites')
+
+    $P0 = subclass 'Integer', 'Counter'
+    s   = new 'Counter'
+    s   = 1
+    'bump'(s)
+    is(s, 2, 'Integer subclass inc and dec at the same sites')
+.end
+
+.sub 'mod_them'
+    .param pmc a
+    .param pmc b
+    $P0 = a % b
+    .return ($P0)
+.end
+
+.sub modulus
+    .local pmc a, b
+    a = box 7
+    b = box 3
+
+    $P0 = 'mod_them'(a, b)
+    $P0 = 'mod_them'(a, b)
+    is($P0, 1, 'Integer % Integer')
+
+    a = -7
+    $P0 = 'mod_them'(a, b)
+    is($P0, 2, 'negative dividend')
+
+    a = 7
+    b = -3
+    $P0 = 'mod_them'(a, b)
+    is($P0, -2, 'negative divisor')
+
+    b = 0
+    push_eh by_zero
+    $P0 = 'mod_them'(a, b)
+    pop_eh
+    ok(0, 'modulus by zero throws')
+    goto done
+  by_zero:
+    .get_results ($P1)
+    pop_eh
+    $S0 = $P1['message']
+    is($S0, 'int modulus by zero', 'modulus by zero throws')
+  done:
+.end
+
+.sub 'mul_them'
+    .param pmc a
+    .param pmc b
+    $P0 = a * b
+    .return ($P0)
+.end
+
+.sub overflow
+    .local pmc interp, config, a, b
+    interp = getinterp
+    config = interp[.IGLOBALS_CONFIG_HASH]
+    $S0    = config['gmp']
+    if $S0 goto have_gmp
+    skip(4, 'no BigInt without gmp')
+    .return ()
+
+  have_gmp:
+    a = box 2
+    b = box 3
+    $P0 = 'mul_them'(a, b)
+    $P0 = 'mul_them'(a, b)
+    is($P0, 6, 'Integer * Integer')
+
+    $I0 = 1
+    $I0 <<= 40
+    a = $I0
+    b = $I0
+    $P0 = 'mul_them'(a, b)
+    $S0 = typeof $P0
+    is($S0, 'BigInt', 'overflow promotes to BigInt')
+    $S0 = $P0
+    is($S0, '1208925819614629174706176', '... with the right value')
+
+    $P0 = 'mul_them'(a, a)
+    $P0 = 'mul_them'(b, b)
+    $S0 = typeof $P0
+    is($S0, 'BigInt', '... still at a quickened site')
+.end
+
+.namespace ['AddsFortyTwo']
+
+.sub 'add' :vtable
+    .param pmc other
+    .param pmc dest
+    .return (42)
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
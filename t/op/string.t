@@ -1092,6 +1092,19 @@ WHILE:
     set $N0, -1.111111
     set $S0, $N0
     is( $S0, "-1.111111", 'num to string' )
+
+    set $N0, 123456789012345.0
+    set $S0, $N0
+    is( $S0, "123456789012345", 'integral num to string' )
+
+    set $N0, 1e15
+    set $S0, $N0
+    is( $S0, "1e+15", 'num to string with exponent' )
+
+    set $N0, 0.1
+    add $N0, 0.2
+    set $S0, $N0
+    is( $S0, "0.3", 'num to string rounds to 15 digits' )
 .end
 
 .sub string_to_int
@@ -1124,6 +1137,23 @@ WHILE:
     set $S0, "16foo"
     set $N0, $S0
     is( $N0, "16", '16foo to num' )
+
+    set $S0, "123.456"
+    set $N0, $S0
+    set $N1, 123.456
+    is( $N0, $N1, 'decimal string to num is correctly rounded' )
+
+    set $S0, "  +2.5E-2"
+    set $N0, $S0
+    is( $N0, 0.025, 'string with exponent to num' )
+
+    set $S0, "-1.5e3x"
+    set $N0, $S0
+    is( $N0, -1500, 'trailing garbage ignored' )
+
+    set $S0, "12345678901234567890"
+    set $N0, $S0
+    is( $N0, 1.2345678901234567e19, 'long mantissa to num' )
 .end
 
 .sub concat_or_substr_cow
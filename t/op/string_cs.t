@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 61;
+use Parrot::Test tests => 64;
 use Parrot::Config;
 
 =head1 NAME
@@ -785,10 +785,7 @@ CODE
 6
 OUTPUT
 
-SKIP: {
-    skip( 'no ICU lib', 12 ) unless $PConfig{has_icu};
-
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode downcase" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode downcase" );
 .sub main :main
     set $S0, iso-8859-1:"TTSCH"
     find_encoding $I0, "utf8"
@@ -804,7 +801,7 @@ CODE
 t\xc3\xb6tsch
 OUTPUT
 
-    pasm_output_is( <<'CODE', <<"OUTPUT", "unicode downcase, trans_encoding_s_s_i" );
+pasm_output_is( <<'CODE', <<"OUTPUT", "unicode downcase, trans_encoding_s_s_i" );
     .pcc_sub :main main:
     set S0, iso-8859-1:"TTSCH"
     find_encoding I0, "utf8"
@@ -819,7 +816,7 @@ CODE
 t\xf6tsch
 OUTPUT
 
-    pasm_output_is( <<'CODE', <<"OUTPUT", "unicode downcase - transencoding" );
+pasm_output_is( <<'CODE', <<"OUTPUT", "unicode downcase - transencoding" );
     .pcc_sub :main main:
     set S0, iso-8859-1:"TTSCH"
     find_encoding I0, "utf8"
@@ -834,7 +831,7 @@ CODE
 t\xc3\xb6tsch
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase" );
 .sub main :main
     set $S0, iso-8859-1:"ttsch"
     find_encoding $I0, "utf8"
@@ -850,7 +847,7 @@ CODE
 T\x{c3}\x{96}TSCH
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase to combined char" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase to combined char" );
 .sub main :main
     set $S1, utf8:"hacek j \u01f0"
     upcase $S1, $S1
@@ -868,7 +865,7 @@ HACEK J J\xcc\x8c
 10
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode titlecase to combined char" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode titlecase to combined char" );
 .sub main :main
     set $S1, utf8:"hacek j \u01f0"
     titlecase $S1, $S1
@@ -886,7 +883,7 @@ Hacek J J\xcc\x8c
 10
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode foldcase to combined char" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode foldcase to combined char" );
 .sub main :main
     set $S1, utf8:"hacek j \u01f0"
     foldcase $S1, $S1
@@ -904,7 +901,7 @@ hacek j j\xcc\x8c
 10
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode downcase to combined char" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode downcase to combined char" );
 .sub main :main
     set $S1, utf8:"I WITH DOT ABOVE \u0130"
     downcase $S1, $S1
@@ -922,23 +919,23 @@ i with dot above i\xcc\x87
 19
 OUTPUT
 
-    # charset/unicode.c
-    #
-    # 106         dest_len = u_strToUpper(src->strstart, dest_len,
-    # (gdb) p src_len
-    # $17 = 7
-    # (gdb) p dest_len
-    # $18 = 7
-    # (gdb) x /8h src->strstart
-    # 0x844fb60:      0x005f  0x005f  0x005f  0x01f0  0x0031  0x0032  0x0033  0x0000
-    # (gdb) n
-    # 110         src->bufused = dest_len * sizeof(UChar);
-    # (gdb) p dest_len
-    # $19 = 8
-    # (gdb) x /8h src->strstart
-    # 0x844fb60:      0x005f  0x005f  0x005f  0x004a  0x030c  0x0031  0x0032  0x0000
-
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase to combined char 3.2 bug?" );
+# charset/unicode.c
+#
+# 106         dest_len = u_strToUpper(src->strstart, dest_len,
+# (gdb) p src_len
+# $17 = 7
+# (gdb) p dest_len
+# $18 = 7
+# (gdb) x /8h src->strstart
+# 0x844fb60:      0x005f  0x005f  0x005f  0x01f0  0x0031  0x0032  0x0033  0x0000
+# (gdb) n
+# 110         src->bufused = dest_len * sizeof(UChar);
+# (gdb) p dest_len
+# $19 = 8
+# (gdb) x /8h src->strstart
+# 0x844fb60:      0x005f  0x005f  0x005f  0x004a  0x030c  0x0031  0x0032  0x0000
+
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode upcase to combined char 3.2 bug?" );
 .sub main :main
     set $S1, utf8:"___\u01f0123"
     upcase $S1, $S1
@@ -952,7 +949,7 @@ CODE
 ___J\xcc\x8c123
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode titlecase" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode titlecase" );
 .sub main :main
     set $S0, iso-8859-1:"ttsch leo"
     find_encoding $I0, "utf8"
@@ -968,7 +965,7 @@ CODE
 T\x{c3}\x{b6}tsch Leo
 OUTPUT
 
-    pir_output_is( <<'CODE', <<"OUTPUT", "unicode foldcase" );
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode foldcase" );
 .sub main :main
     set $S0, iso-8859-1:"ttsch leo"
     find_encoding $I0, "utf8"
@@ -984,7 +981,7 @@ CODE
 t\x{c3}\x{b6}tsch leo
 OUTPUT
 
-    pir_output_is( <<'CODE', <<OUTPUT, "compose combined char" );
+pir_output_is( <<'CODE', <<OUTPUT, "compose combined char" );
 .sub main :main
     set $S1, utf8:"___\u01f0___"
     length $I0, $S1
@@ -1013,7 +1010,62 @@ ___\x{c7}\x{b0}___
 7 8 8 7
 OUTPUT
 
-}    # SKIP
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode downcase final sigma" );
+.sub main :main
+    set $S1, utf8:"\u039f\u0394\u03a5\u03a3\u03a3\u0395\u03a5\u03a3 \u03a3 A\u03a3'."
+    downcase $S1, $S1
+    getstdout $P0          # need to convert back to utf8
+    $P0.'encoding'("utf8") # set utf8 output
+    print $S1
+    print "\n"
+.end
+CODE
+\xce\xbf\xce\xb4\xcf\x85\xcf\x83\xcf\x83\xce\xb5\xcf\x85\xcf\x82 \xcf\x83 a\xcf\x82'.
+OUTPUT
+
+pir_output_is( <<'CODE', <<"OUTPUT", "unicode case mapping of ucs4 and utf16 strings" );
+.sub main :main
+    $S0 = utf8:"stra\u00dfe \U0001043c"
+    $I0 = find_encoding "ucs4"
+    $S1 = trans_encoding $S0, $I0
+    $S1 = upcase $S1
+    $I0 = find_encoding "utf16"
+    $S2 = trans_encoding $S0, $I0
+    $S2 = foldcase $S2
+    $S3 = utf8:"don't stop \u01c6"
+    $S3 = titlecase $S3
+    getstdout $P0          # need to convert back to utf8
+    $P0.'encoding'("utf8") # set utf8 output
+    print $S1
+    print "\n"
+    print $S2
+    print "\n"
+    print $S3
+    print "\n"
+.end
+CODE
+STRASSE \xf0\x90\x90\x94
+strasse \xf0\x90\x90\xbc
+Don't Stop \xc7\x85
+OUTPUT
+
+pir_output_is( <<'CODE', <<"OUTPUT", "compose reorders marks and joins hangul" );
+.sub main :main
+    $S1 = utf8:"a\u0302\u0323 \u1100\u1161\u11a8 \u212b"
+    compose $S1, $S1
+    length $I0, $S1
+    getstdout $P0          # need to convert back to utf8
+    $P0.'encoding'("utf8") # set utf8 output
+    print $S1
+    print "\n"
+    print $I0
+    print "\n"
+.end
+CODE
+\xe1\xba\xad \xea\xb0\x81 \xc3\x85
+5
+OUTPUT
+
 
 pasm_output_is( <<'CODE', <<'OUTPUT', "escape ascii" );
 .pcc_sub :main main:
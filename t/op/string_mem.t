@@ -31,7 +31,7 @@ pin/unpin
 .include 'stringinfo.pasm'
 .include 'interpinfo.pasm'
 
-.const int TESTS = 7
+.const int TESTS = 12
 
 .sub _main :main
     .include 'test_more.pir'
@@ -39,6 +39,7 @@ pin/unpin
     plan(TESTS)
 
     test_stringinfo()
+    test_inline_strings()
     $S0 = interpinfo .INTERPINFO_GC_SYS_NAME
     if $S0 != "ms" goto dont_run_hanging_tests
     test_pin_unpin()
@@ -71,6 +72,46 @@ pin/unpin
     isnt($I0, $I2, "stringinfo - STRHEADER on different COW strings same value")
 .end
 
+.sub test_inline_strings
+    .local int header, strstart, offset
+
+    $S0 = 1234567
+    $S1 = substr $S0, 2, 3
+    is($S1, "345", "substr of an inline string")
+
+    $S2 = concat $S1, "6789abcdef"
+    is($S2, "3456789abcdef", "concat grows an inline string")
+
+    $P0 = new ['StringBuilder']
+    push $P0, $S1
+    push $P0, "6789abcdefghijklmnop"
+    $S3 = $P0
+    is($S3, "3456789abcdefghijklmnop", "StringBuilder appends to an inline string")
+
+    # GC inf allocates all string storage with malloc
+    $S9 = interpinfo .INTERPINFO_GC_SYS_NAME
+    if $S9 != "inf" goto check_location
+    skip(2, "Inline strings not used by GC inf")
+    .return ()
+
+  check_location:
+    header   = stringinfo $S0, .STRINGINFO_HEADER
+    strstart = stringinfo $S0, .STRINGINFO_STRSTART
+    offset   = strstart - header
+    $I0 = offset > 0
+    $I1 = offset < 256
+    $I0 = $I0 && $I1
+    ok($I0, "short strings are stored in their header")
+
+    header   = stringinfo $S1, .STRINGINFO_HEADER
+    strstart = stringinfo $S1, .STRINGINFO_STRSTART
+    offset   = strstart - header
+    $I0 = offset > 0
+    $I1 = offset < 256
+    $I0 = $I0 && $I1
+    ok($I0, "substr copies inline contents into its own header")
+.end
+
 .sub test_pin_unpin
 
     .local int init, before, after
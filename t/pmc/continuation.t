@@ -17,7 +17,7 @@ Tests the Continuation PMC.
 
 .sub main :main
     .include 'test_more.pir'
-    plan(9)
+    plan(14)
 
     test_new()
     invoke_with_init()
@@ -25,6 +25,8 @@ Tests the Continuation PMC.
     returns_tt1528()
     experimental_caller()
     get_pointer_and_string()
+    resume_returned_frames()
+    closure_over_returned_frame()
 .end
 
 .sub test_new
@@ -173,6 +175,78 @@ end:
    dummy:
 .end
 
+.sub 'deep_capture'
+    .param int depth
+    .param pmc box
+    .local int mine
+    mine = depth * 10
+    if depth > 0 goto recurse
+    $P0 = new 'Continuation'
+    set_label $P0, resumed
+    box[0] = $P0
+    .return (0)
+  recurse:
+    $I0 = depth - 1
+    $I1 = 'deep_capture'($I0, box)
+    $I1 += mine
+    .return ($I1)
+  resumed:
+    .return (-1)
+.end
+
+.sub resume_returned_frames
+    .local pmc box
+    .local int runs
+    box  = new 'ResizablePMCArray'
+    runs = 0
+    $I0  = 'deep_capture'(20, box)
+    inc runs
+    if runs > 1 goto resumed
+    is($I0, 2100, 'deep recursion captures a continuation')
+    # overwrite the returned frames before resuming them
+    $P0 = box[0]
+    $P1 = new 'ResizablePMCArray'
+    $I1 = 'deep_capture'(20, $P1)
+    $P0()
+  resumed:
+    is($I0, 2099, 'continuation resumes frames that already returned')
+.end
+
+.sub 'make_counter'
+    .param int depth
+    .param int start
+    if depth > 0 goto recurse
+    .lex '$n', $P0
+    $P0 = box start
+    .const 'Sub' inner = 'counter_inner'
+    $P1 = newclosure inner
+    .return ($P1)
+  recurse:
+    $I0 = depth - 1
+    $P1 = 'make_counter'($I0, start)
+    .return ($P1)
+.end
+
+.sub 'counter_inner' :outer('make_counter')
+    $P0 = find_lex '$n'
+    $P1 = clone $P0
+    inc $P1
+    store_lex '$n', $P1
+    .return ($P1)
+.end
+
+.sub closure_over_returned_frame
+    .local pmc c1, c2
+    c1 = 'make_counter'(10, 10)
+    c2 = 'make_counter'(10, 100)
+    $I0 = c1()
+    is($I0, 11, 'closure sees lexicals of a returned deep frame')
+    $I0 = c2()
+    is($I0, 101, 'closures over the same frame depth stay apart')
+    $I0 = c1()
+    is($I0, 12, 'closure keeps its lexicals across calls')
+.end
+
 # end of tests.
 
 # Local Variables:
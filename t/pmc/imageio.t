@@ -18,7 +18,7 @@ Tests the ImageIO PMC.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(12)
+    plan(21)
 
     .local pmc frz, thw
     frz = new ['ImageIOFreeze']
@@ -57,6 +57,69 @@ Tests the ImageIO PMC.
     $P1 = thaw $S1
     is_deeply($P0, $P1, 'thaw gives same PMC as ImageIO (aggregate)')
     is_deeply($P0, test_pmc, 'round trip gives same PMC (aggregate)')
+
+    core_types()
+    shifted_array()
+.end
+
+.sub core_types
+    .local pmc shared, list, fixed, sub_int, copy
+    shared = box 'shared'
+    fixed  = new ['FixedPMCArray']
+    fixed  = 2
+    fixed[0] = shared
+    $P0    = box 2.5
+    fixed[1] = $P0
+
+    $P0     = subclass 'Integer', 'FrozenInteger'
+    sub_int = new ['FrozenInteger']
+    sub_int = 7
+
+    list = new ['ResizablePMCArray']
+    push list, -42
+    push list, shared
+    push list, fixed
+    push list, sub_int
+
+    $S0  = freeze list
+    copy = thaw $S0
+    $P0 = copy[0]
+    is($P0, -42, 'round trip of core scalars and arrays')
+    $S1 = typeof $P0
+    is($S1, 'Integer', '... keeps Integer')
+    $P0 = copy[2]
+    $P0 = $P0[1]
+    is($P0, 2.5, '... and Float inside a FixedPMCArray')
+    $S1 = typeof $P0
+    is($S1, 'Float', '... keeps Float')
+    $P0 = copy[3]
+    $S1 = typeof $P0
+    is($S1, 'FrozenInteger', '... keeps a subclass of Integer')
+    $I0 = $P0
+    is($I0, 7, '... with its value')
+
+    $P0 = copy[1]
+    $P1 = copy[2]
+    $P1 = $P1[0]
+    $I0 = issame $P0, $P1
+    ok($I0, '... keeps a shared reference shared')
+.end
+
+.sub shifted_array
+    .local pmc list, copy
+    list = new ['ResizablePMCArray']
+    push list, 1
+    push list, 2
+    push list, 3
+    $P0 = shift list
+
+    $S0  = freeze list
+    copy = thaw $S0
+    $S1  = join ',', copy
+    is($S1, '2,3', 'round trip of a shifted ResizablePMCArray')
+
+    $I0 = elements copy
+    is($I0, 2, '... keeps its size')
 .end
 
 .sub get_test_simple
@@ -19,7 +19,7 @@ Tests the creation and invocation of Perl6 multi subs.
 .sub main :main
     .include 'test_more.pir'
 
-    plan( 8 )
+    plan( 14 )
 
     $P0 = new ['MultiSub']
     $I0 = defined $P0
@@ -51,6 +51,104 @@ Tests the creation and invocation of Perl6 multi subs.
     $S0 = foo($P1 :flat, $P2 :flat)
     is($S0, "testing 42, goodbye", "Int and String double :flat")
 
+    repeated_dispatch()
+    candidates_changed()
+    class_created_later()
+.end
+
+.sub repeated_dispatch
+    .local string res
+    .local int i
+    i   = 0
+    res = ''
+  loop:
+    $S0 = foo(i)
+    res .= $S0
+    $S0 = foo(i, "x")
+    res .= $S0
+    $S0 = foo("y")
+    res .= $S0
+    inc i
+    if i < 3 goto loop
+    $S0 = "testing 0testing 0, xtesting ytesting 1testing 1, xtesting y"
+    $S0 .= "testing 2testing 2, xtesting y"
+    is(res, $S0, "repeated calls with changing types")
+
+    $P0 = box 7
+    $S0 = pick($P0)
+    $S1 = pick($P0, $P0)
+    $S2 = pick($P0)
+    $S0 = $S0 . $S1
+    $S0 = $S0 . $S2
+    is($S0, "one:Integerone:Integer+one:Integer", "extra arguments after the invocants")
+.end
+
+.sub candidates_changed
+    .local pmc multi, specific
+    $P0 = box 7
+    multi = get_global 'pick'
+    $S0 = pick($P0)
+    is($S0, "one:Integer", "generic candidate before push")
+
+    $P1  = get_global 'pick_integer'
+    specific = $P1[0]
+    push multi, specific
+    $S0 = pick($P0)
+    is($S0, "Integer", "candidate pushed after the first call")
+
+    $I0 = elements multi
+    dec $I0
+    $P1 = get_global 'pick_float'
+    $P2 = $P1[0]
+    multi[$I0] = $P2
+    $S0 = pick($P0)
+    is($S0, "one:Integer", "candidate replaced after a call")
+.end
+
+.sub class_created_later
+    $P0 = box 7
+    $S0 = widget($P0)
+    $P1 = newclass 'Widget'
+    $P2 = new 'Widget'
+    $S1 = widget($P2)
+    $S0 = $S0 . $S1
+    is($S0, "anythingwidget", "candidate for a class created after the first call")
+.end
+
+.sub pick :multi(_)
+    .param pmc a
+    $S0 = typeof a
+    $S0 = "one:" . $S0
+    .return ($S0)
+.end
+
+.sub pick :multi(_, _)
+    .param pmc a
+    .param pmc b
+    $S0 = typeof a
+    $S0 = "one:" . $S0
+    $S0 .= "+"
+    .return ($S0)
+.end
+
+.sub pick_integer :multi(Integer)
+    .param pmc a
+    .return ("Integer")
+.end
+
+.sub pick_float :multi(Float)
+    .param pmc a
+    .return ("Float")
+.end
+
+.sub widget :multi(_)
+    .param pmc a
+    .return ("anything")
+.end
+
+.sub widget :multi(Widget)
+    .param pmc a
+    .return ("widget")
 .end
 
 .sub foo :multi()
@@ -4,7 +4,7 @@
 .sub 'main' :main
     .include 'test_more.pir'
 
-    plan(20)
+    plan(26)
 
     test_create()
     test_interp_same_after_compile()
@@ -173,7 +173,52 @@ __EOCODE__
 .end
 
 .sub 'test_method_deserialize'
-    # TODO
+    .local pmc compiler, view, copy, before, after
+    compiler = compreg "PIR"
+    $S0 = <<'CODE'
+.namespace ['PVDeserialize';'A']
+.sub 'one'
+    .return (1)
+.end
+.namespace ['PVDeserialize';'B']
+.sub 'two'
+    .return (2)
+.end
+.namespace ['PVDeserialize';'A']
+.sub 'three'
+    .return (3)
+.end
+.sub 'pick' :multi(int)
+    .return ('int')
+.end
+.sub 'pick' :multi(string)
+    .return ('string')
+.end
+CODE
+    view   = compiler.'compile'($S0)
+    before = get_hll_global ['PVDeserialize';'A'], 'one'
+    $S1    = view.'serialize'()
+
+    copy = new ['PackfileView']
+    copy.'deserialize'($S1)
+    ok(copy, "Deserialized PackfileView is true")
+
+    after = get_hll_global ['PVDeserialize';'A'], 'one'
+    $I0 = issame after, before
+    is($I0, 0, "deserializing stores its own subs in their namespaces")
+    $I0 = after()
+    is($I0, 1, "... which can be called")
+
+    $P0 = get_hll_global ['PVDeserialize';'B'], 'two'
+    $I0 = $P0()
+    is($I0, 2, "... in the namespace they were compiled in")
+    $P0 = get_hll_global ['PVDeserialize';'A'], 'three'
+    $I0 = $P0()
+    is($I0, 3, "... when namespaces alternate")
+
+    $P0 = get_hll_global ['PVDeserialize';'A'], 'pick'
+    $S2 = $P0('x')
+    is($S2, "string", "... and multis still dispatch")
 .end
 
 .sub 'test_method_all_subs'
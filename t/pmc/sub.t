@@ -1050,6 +1050,10 @@ CODE
 0101
 OUTPUT
 
+SKIP: {
+    skip 'the optimizer changes the registers used', 1
+        if ( $ENV{TEST_PROG_ARGS} || '' ) =~ /-O[23]/;
+
 pir_output_is( <<'CODE', <<'OUTPUT', "__get_regs_used 2" );
 .sub main :main
     foo()
@@ -1076,8 +1080,9 @@ pir_output_is( <<'CODE', <<'OUTPUT', "__get_regs_used 2" );
 
 
 CODE
-2301
+2201
 OUTPUT
+}
 
 pir_output_like( <<"CODE", <<'OUTPUT', 'warn on in main' );
 .sub 'test' :main
@@ -0,0 +1,131 @@
+#! perl
+# Copyright (C) 2015, Parrot Foundation.
+
+=head1 NAME
+
+t/stress/tailcall.t - Deep tail call chains
+
+=head1 SYNOPSIS
+
+    % prove t/stress/tailcall.t
+
+=head1 DESCRIPTION
+
+Runs 10 million deep mutual recursions through C<.tailcall> into subs,
+methods and MultiSubs, and checks that the number of live PMCs stays bounded.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw(lib . ../lib ../../lib);
+use Parrot::Test tests => 3;
+
+my $grown = <<'PIR';
+.include 'interpinfo.pasm'
+
+.sub 'before'
+    sweep 1
+    $I0 = interpinfo .INTERPINFO_ACTIVE_PMCS
+    $P0 = box $I0
+    set_global '$before', $P0
+.end
+
+.sub 'bounded'
+    sweep 1
+    $I0 = interpinfo .INTERPINFO_ACTIVE_PMCS
+    $P0 = get_global '$before'
+    $I1 = $P0
+    $I0 -= $I1
+    $I0 = $I0 < 1000
+    .return ($I0)
+.end
+PIR
+
+pir_output_is( $grown . <<'CODE', <<'OUT', "10M deep mutual recursion of subs" );
+.sub main :main
+    'before'()
+    $I0 = 'even'(10000000)
+    say $I0
+.end
+
+.sub 'even'
+    .param int n
+    unless n goto done
+    dec n
+    .tailcall 'odd'(n)
+  done:
+    .tailcall 'bounded'()
+.end
+
+.sub 'odd'
+    .param int n
+    dec n
+    .tailcall 'even'(n)
+.end
+CODE
+1
+OUT
+
+pir_output_is( $grown . <<'CODE', <<'OUT', "10M deep mutual recursion of methods" );
+.sub main :main
+    $P0 = newclass 'Walker'
+    $P1 = new 'Walker'
+    'before'()
+    $I0 = $P1.'even'(10000000)
+    say $I0
+.end
+
+.namespace ['Walker']
+
+.sub 'even' :method
+    .param int n
+    unless n goto done
+    dec n
+    .tailcall self.'odd'(n)
+  done:
+    .tailcall 'bounded'()
+.end
+
+.sub 'odd' :method
+    .param int n
+    dec n
+    .tailcall self.'even'(n)
+.end
+CODE
+1
+OUT
+
+pir_output_is( $grown . <<'CODE', <<'OUT', "10M deep mutual recursion of multis" );
+.sub main :main
+    'before'()
+    $I0 = 'step'(10000000, 'even')
+    say $I0
+.end
+
+.sub 'step' :multi(int, string)
+    .param int n
+    .param string s
+    unless n goto done
+    dec n
+    .tailcall 'step'(n, 1)
+  done:
+    .tailcall 'bounded'()
+.end
+
+.sub 'step' :multi(int, int)
+    .param int n
+    .param int i
+    dec n
+    .tailcall 'step'(n, 'odd')
+.end
+CODE
+1
+OUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,402 @@
+#! perl
+# Copyright (C) 2016, Parrot Foundation.
+use strict;
+use warnings;
+use feature qw( fc unicode_strings );
+use File::Spec;
+use Unicode::UCD ();
+use Unicode::Normalize ();
+
+no warnings 'utf8';    ## no critic (ProhibitNoWarnings)
+
+=head1 NAME
+
+tools/dev/gen_unicode_tables.pl -- generate Unicode case and normalization tables
+
+=head1 SYNOPSIS
+
+        perl tools/dev/gen_unicode_tables.pl
+
+=head1 DESCRIPTION
+
+Generate the Unicode case mapping, canonical decomposition and composition
+tables used by the built-in (non-ICU) implementations of C<upcase>,
+C<downcase>, C<titlecase>, C<foldcase> and C<compose> in
+F<src/string/encoding/shared.c>.
+
+The data is taken from the Unicode database shipped with the running perl,
+so regenerate the tables with a perl whose Unicode version you want Parrot to
+follow.
+
+Code points are looked up through two-stage tables: the high bits of a code
+point select a block of C<2**BLOCK_SHIFT> entries, identical blocks are
+shared.
+
+=cut
+
+my $BLOCK_SHIFT = 7;
+my $BLOCK_SIZE  = 1 << $BLOCK_SHIFT;
+my $MAX_CP      = 0x10FFFF;
+
+my $encoding_dir = File::Spec->catdir(qw/ src string encoding /);
+
+my $coda = <<'EOF';
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
+EOF
+
+my $unicode_version = Unicode::UCD::UnicodeVersion();
+
+my $header = <<"HEADER";
+/* ex: set ro ft=c: -*- buffer-read-only:t -*-
+ * !!!!!!!   DO NOT EDIT THIS FILE   !!!!!!!
+ *
+ * This file is generated automatically from '$0'.
+ *
+ * Unicode $unicode_version case mapping and canonical normalization tables
+ * for the built-in string case conversion and NFC/NFD support.
+ *
+ * Copyright (C) 2016, Parrot Foundation.
+ */
+
+/* HEADERIZER HFILE: none */
+
+HEADER
+
+=over
+
+=item B<is_valid>( $cp )
+
+True unless C<$cp> is a surrogate.
+
+=cut
+
+sub is_valid {
+    my ($cp) = @_;
+    return $cp < 0xD800 || $cp > 0xDFFF;
+}
+
+=item B<two_stage>( $values, $limit )
+
+Split the per-code-point values in C<@$values> (up to C<$limit>) into an
+index and a deduplicated block array.
+
+=cut
+
+sub two_stage {
+    my ($values, $limit) = @_;
+    my (@index, @blocks, %seen);
+
+    for (my $base = 0; $base < $limit; $base += $BLOCK_SIZE) {
+        my @block = map { $values->[$_] || 0 } $base .. $base + $BLOCK_SIZE - 1;
+        my $key   = join ',', @block;
+        unless (exists $seen{$key}) {
+            $seen{$key} = @blocks / $BLOCK_SIZE;
+            push @blocks, @block;
+        }
+        push @index, $seen{$key};
+    }
+
+    return (\@index, \@blocks);
+}
+
+=item B<limit_of>( $values )
+
+The smallest multiple of the block size above the last non-zero value.
+
+=cut
+
+sub limit_of {
+    my ($values) = @_;
+    my $last = $#$values;
+    $last-- while $last > 0 && !$values->[$last];
+    return ($last + $BLOCK_SIZE) & ~($BLOCK_SIZE - 1);
+}
+
+=item B<print_array>( $type, $name, $values, $format )
+
+Print a C array definition.
+
+=back
+
+=cut
+
+sub print_array {
+    my ($type, $name, $values, $format) = @_;
+    my $per_line = $format =~ /x%\.[5-8]/ ? 6 : 8;
+
+    print "const $type ${name}[", scalar @$values, "] = {\n";
+    for (my $i = 0; $i < @$values; $i += $per_line) {
+        my $last = $i + $per_line - 1;
+        $last    = $#$values if $last > $#$values;
+        print '    ', join(', ', map { sprintf $format, $_ } @{$values}[$i .. $last]), ",\n";
+    }
+    print "};\n\n";
+}
+
+#
+# case mappings
+#
+###########################################################################
+my @special  = (0);    # index 0 means "no multi-character mapping"
+my %special_of;
+my @records  = ([ 0, 0, 0, 0, 0, 0, 0, 0, 0 ]);
+my %record_of = (join(',', @{ $records[0] }) => 0);
+my @case_value;
+
+my @mappers = (
+    sub { uc $_[0] },
+    sub { lc $_[0] },
+    sub { ucfirst $_[0] },
+    sub { fc $_[0] },
+);
+
+for my $cp (0 .. $MAX_CP) {
+    next unless is_valid($cp);
+    my $chr   = chr $cp;
+    my $flags = 0;
+    $flags |= 1 if $chr =~ /\p{Cased}/;
+    $flags |= 2 if $chr =~ /\p{Case_Ignorable}/;
+
+    my (@delta, @offset);
+    for my $mapper (@mappers) {
+        my @to = map { ord } split //, $mapper->($chr);
+        if (@to == 1) {
+            push @delta,  $to[0] - $cp;
+            push @offset, 0;
+        }
+        else {
+            my $key = join ',', @to;
+            unless (exists $special_of{$key}) {
+                $special_of{$key} = @special;
+                push @special, scalar @to, @to;
+            }
+            push @delta,  0;
+            push @offset, $special_of{$key};
+        }
+    }
+
+    my $key = join ',', @delta, @offset, $flags;
+    unless (exists $record_of{$key}) {
+        $record_of{$key} = @records;
+        push @records, [ @delta, @offset, $flags ];
+    }
+    $case_value[$cp] = $record_of{$key};
+}
+
+my $case_limit = limit_of(\@case_value);
+my ($case_index, $case_blocks) = two_stage(\@case_value, $case_limit);
+
+#
+# normalization
+#
+###########################################################################
+my (@ccc, @qc, @decomp_value, @compositions);
+my @decomp_data  = (0);    # index 0 means "no decomposition"
+my $max_decomp   = 1;
+my $nfc_quick    = $MAX_CP + 1;
+my $nfd_quick    = $MAX_CP + 1;
+
+for my $cp (0 .. $MAX_CP) {
+    next unless is_valid($cp);
+
+    my $chr = chr $cp;
+    $qc[$cp] |= 1 if $chr =~ /\P{NFC_Quick_Check=Yes}/;
+    $qc[$cp] |= 2 if $chr =~ /\P{NFD_Quick_Check=Yes}/;
+
+    # Hangul syllables are decomposed algorithmically
+    next if $cp >= 0xAC00 && $cp <= 0xD7A3;
+
+    my $class = Unicode::Normalize::getCombinClass($cp);
+    if ($class) {
+        $ccc[$cp]   = $class;
+        $nfc_quick  = $cp if $cp < $nfc_quick;
+        $nfd_quick  = $cp if $cp < $nfd_quick;
+    }
+
+    $nfc_quick = $cp if $cp < $nfc_quick && ($qc[$cp] || 0) & 1;
+
+    my $canon = Unicode::Normalize::getCanon($cp);
+    next unless defined $canon && $canon ne chr $cp;
+
+    my @to = map { ord } split //, $canon;
+    $decomp_value[$cp] = @decomp_data;
+    push @decomp_data, scalar @to, @to;
+    $max_decomp = @to if @to > $max_decomp;
+    $nfd_quick  = $cp if $cp < $nfd_quick;
+
+    next if Unicode::Normalize::isComp_Ex($cp);
+
+    my $single = Unicode::UCD::charinfo($cp)->{decomposition};
+    my @pair   = map { hex } split ' ', $single;
+    next unless @pair == 2;
+    push @compositions, [ @pair, $cp ];
+    $nfc_quick = $pair[1] if $pair[1] < $nfc_quick;
+}
+
+@compositions = sort { $a->[0] <=> $b->[0] || $a->[1] <=> $b->[1] } @compositions;
+
+my $ccc_limit = limit_of(\@ccc);
+my ($ccc_index, $ccc_blocks) = two_stage(\@ccc, $ccc_limit);
+
+my $qc_limit = limit_of(\@qc);
+my ($qc_index, $qc_blocks) = two_stage(\@qc, $qc_limit);
+
+my $decomp_limit = limit_of(\@decomp_value);
+my ($decomp_index, $decomp_blocks) = two_stage(\@decomp_value, $decomp_limit);
+
+die "decomposition data too large\n" if @decomp_data > 0xFFFF;
+die "too many case records\n"        if @records     > 0xFFFF;
+
+#
+# create 'src/string/encoding/unicode_tables.c'
+#
+###########################################################################
+my $c_file = File::Spec->catfile( $encoding_dir, 'unicode_tables.c' );
+open STDOUT, '>', $c_file
+    or die "can not open '$c_file': $!\n";
+print <<"END";
+$header
+#include "unicode_tables.h"
+
+END
+
+print "const Parrot_unicode_case_t Parrot_unicode_case_records[", scalar @records, "] = {\n";
+for my $r (@records) {
+    printf "    { { %d, %d, %d, %d }, { %d, %d, %d, %d }, %d },\n", @$r;
+}
+print "};\n\n";
+
+print_array('Parrot_UInt4',   'Parrot_unicode_case_special', \@special,      '0x%.4x');
+print_array('unsigned short', 'Parrot_unicode_case_index',   $case_index,    '%d');
+print_array('unsigned short', 'Parrot_unicode_case_blocks',  $case_blocks,   '%d');
+print_array('unsigned char',  'Parrot_unicode_ccc_index',    $ccc_index,     '%d');
+print_array('unsigned char',  'Parrot_unicode_ccc_blocks',   $ccc_blocks,    '%d');
+print_array('unsigned short', 'Parrot_unicode_qc_index',     $qc_index,      '%d');
+print_array('unsigned char',  'Parrot_unicode_qc_blocks',    $qc_blocks,     '%d');
+print_array('unsigned short', 'Parrot_unicode_decomp_index', $decomp_index,  '%d');
+print_array('unsigned short', 'Parrot_unicode_decomp_blocks', $decomp_blocks, '%d');
+print_array('Parrot_UInt4',   'Parrot_unicode_decomp_data',  \@decomp_data,  '0x%.4x');
+
+print "const Parrot_unicode_composition_t Parrot_unicode_compositions[",
+    scalar @compositions, "] = {\n";
+printf "    { 0x%.4x, 0x%.4x, 0x%.4x },\n", @$_ for @compositions;
+print "};\n\n";
+
+print $coda;
+close STDOUT;
+
+die "ccc index does not fit in unsigned char\n" if grep { $_ > 0xFF } @$ccc_index;
+
+#
+# create 'src/string/encoding/unicode_tables.h'
+#
+###########################################################################
+my $h_file = File::Spec->catfile( $encoding_dir, 'unicode_tables.h' );
+open STDOUT, '>', $h_file
+    or die "can not open '$h_file': $!\n";
+
+my $n_records      = @records;
+my $n_special      = @special;
+my $n_case_index   = @$case_index;
+my $n_case_blocks  = @$case_blocks;
+my $n_ccc_index    = @$ccc_index;
+my $n_ccc_blocks   = @$ccc_blocks;
+my $n_qc_index     = @$qc_index;
+my $n_qc_blocks    = @$qc_blocks;
+my $n_decomp_index = @$decomp_index;
+my $n_decomp_blocks = @$decomp_blocks;
+my $n_decomp_data  = @decomp_data;
+my $n_compositions = @compositions;
+
+printf <<"END", $case_limit, $ccc_limit, $qc_limit, $decomp_limit, $nfc_quick, $nfd_quick;
+$header
+#ifndef PARROT_UNICODE_TABLES_H_GUARD
+#define PARROT_UNICODE_TABLES_H_GUARD
+#include "parrot/parrot.h"
+
+#define PARROT_UNICODE_VERSION          "$unicode_version"
+
+#define PARROT_UNICODE_BLOCK_SHIFT      $BLOCK_SHIFT
+#define PARROT_UNICODE_BLOCK_MASK       @{[ $BLOCK_SIZE - 1 ]}
+
+/* code points at or above these limits have no entry in the tables */
+#define PARROT_UNICODE_CASE_LIMIT       0x%.4x
+#define PARROT_UNICODE_CCC_LIMIT        0x%.4x
+#define PARROT_UNICODE_QC_LIMIT         0x%.4x
+#define PARROT_UNICODE_DECOMP_LIMIT     0x%.4x
+
+/* strings with all code points below these are already in NFC / NFD */
+#define PARROT_UNICODE_NFC_QUICK_LIMIT  0x%.4x
+#define PARROT_UNICODE_NFD_QUICK_LIMIT  0x%.4x
+
+/* longest full canonical decomposition of a single code point */
+#define PARROT_UNICODE_MAX_DECOMP       $max_decomp
+
+/* longest full case mapping of a single code point */
+#define PARROT_UNICODE_MAX_CASE         3
+
+#define PARROT_UNICODE_N_COMPOSITIONS   $n_compositions
+
+/* indexes into delta and special */
+#define PARROT_UNICODE_UPPER            0
+#define PARROT_UNICODE_LOWER            1
+#define PARROT_UNICODE_TITLE            2
+#define PARROT_UNICODE_FOLD             3
+
+/* case flags */
+#define PARROT_UNICODE_CASED            1
+#define PARROT_UNICODE_CASE_IGNORABLE   2
+
+/* quick check flags: set when NFC_Quick_Check / NFD_Quick_Check is not Yes */
+#define PARROT_UNICODE_NFC_MAYBE        1
+#define PARROT_UNICODE_NFD_MAYBE        2
+
+typedef struct Parrot_unicode_case_t {
+    /* added to the code point when the mapping is a single code point */
+    Parrot_Int4     delta[4];
+    /* otherwise the offset of the length-prefixed mapping in
+     * Parrot_unicode_case_special */
+    unsigned short  special[4];
+    unsigned short  flags;
+} Parrot_unicode_case_t;
+
+typedef struct Parrot_unicode_composition_t {
+    Parrot_UInt4 first;
+    Parrot_UInt4 second;
+    Parrot_UInt4 composite;
+} Parrot_unicode_composition_t;
+
+extern const Parrot_unicode_case_t        Parrot_unicode_case_records[$n_records];
+extern const Parrot_UInt4                 Parrot_unicode_case_special[$n_special];
+extern const unsigned short               Parrot_unicode_case_index[$n_case_index];
+extern const unsigned short               Parrot_unicode_case_blocks[$n_case_blocks];
+extern const unsigned char                Parrot_unicode_ccc_index[$n_ccc_index];
+extern const unsigned char                Parrot_unicode_ccc_blocks[$n_ccc_blocks];
+extern const unsigned short               Parrot_unicode_qc_index[$n_qc_index];
+extern const unsigned char                Parrot_unicode_qc_blocks[$n_qc_blocks];
+extern const unsigned short               Parrot_unicode_decomp_index[$n_decomp_index];
+extern const unsigned short               Parrot_unicode_decomp_blocks[$n_decomp_blocks];
+extern const Parrot_UInt4                 Parrot_unicode_decomp_data[$n_decomp_data];
+extern const Parrot_unicode_composition_t Parrot_unicode_compositions[$n_compositions];
+
+#define PARROT_UNICODE_LOOKUP(table, c) \\
+    Parrot_unicode_ ## table ## _blocks[ \\
+        (Parrot_unicode_ ## table ## _index[(c) >> PARROT_UNICODE_BLOCK_SHIFT] \\
+            << PARROT_UNICODE_BLOCK_SHIFT) + ((c) & PARROT_UNICODE_BLOCK_MASK)]
+
+#endif /* PARROT_UNICODE_TABLES_H_GUARD */
+$coda
+END
+close STDOUT;
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4: